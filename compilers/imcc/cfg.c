@@ -281,7 +281,8 @@ find_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), int first)
 
     ins = unit->instructions;
 
-    if (unit->type & IMC_PCCSUB) {
+    /* like the other PCC directives, expand it on the first pass only */
+    if ((unit->type & IMC_PCCSUB) && first) {
         IMCC_debug(imcc, DEBUG_CFG, "pcc_sub %s nparams %d\n",
                 ins->symregs[0]->name, ins->symregs[0]->pcc_sub->nargs);
         expand_pcc_sub(imcc, unit, ins);
@@ -1116,6 +1117,99 @@ natural_preheader(ARGIN(const IMC_Unit *unit), ARGIN(const Loop_info *loop_info)
 }
 
 
+/*
+
+=item C<int has_local_branch(const IMC_Unit *unit)>
+
+Returns true if the unit uses C<local_branch>/C<local_return>, whose return
+edges aren't part of the CFG.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+int
+has_local_branch(ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(has_local_branch)
+    const Instruction *ins;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        if (ins->opname
+        && (STREQ(ins->opname, "local_branch") || STREQ(ins->opname, "local_return")))
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<Set * find_address_taken_blocks(imc_info_t * imcc, const IMC_Unit
+*unit)>
+
+Returns the set of basic blocks which can be entered other than through the
+CFG -- blocks starting at a label taken by C<set_addr>, C<set_label>,
+C<push_eh> etc. -- together with all blocks reachable from them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Set *
+find_address_taken_blocks(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(find_address_taken_blocks)
+    Set * const        blocks = set_make(imcc, unit->n_basic_blocks);
+    const Instruction *ins;
+    int                changed;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int i;
+
+        /* label operands of non-jump ops take the label's address */
+        if (!ins->op || ins->op->jump)
+            continue;
+
+        for (i = 0; i < ins->symreg_count; i++) {
+            const SymReg * const label = ins->symregs[i];
+
+            if ((ins->type & (1 << i))
+            &&   label && (label->type & VTADDRESS)
+            &&   label->first_ins
+            &&   label->first_ins->bbindex < unit->n_basic_blocks
+            &&   unit->bb_list[label->first_ins->bbindex]->start == label->first_ins)
+                set_add(blocks, label->first_ins->bbindex);
+        }
+    }
+
+    /* close over successors */
+    do {
+        unsigned int b;
+        changed = 0;
+
+        for (b = 0; b < unit->n_basic_blocks; b++) {
+            const Edge *e;
+
+            if (!set_contains(blocks, b))
+                continue;
+
+            for (e = unit->bb_list[b]->succ_list; e; e = e->succ_next) {
+                if (!set_contains(blocks, e->to->index)) {
+                    set_add(blocks, e->to->index);
+                    changed = 1;
+                }
+            }
+        }
+    } while (changed);
+
+    return blocks;
+}
+
+
 /*
 
 =item C<static void mark_loop(imc_info_t *imcc, IMC_Unit *unit, const Edge *e)>
@@ -77,6 +77,15 @@ PARROT_PURE_FUNCTION
 int edge_count(ARGIN(const IMC_Unit *unit))
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+Set * find_address_taken_blocks(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc);
+
 void find_basic_blocks(
     ARGMOD(imc_info_t *imcc),
     ARGMOD(IMC_Unit *unit),
@@ -92,6 +101,10 @@ void find_loops(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+int has_local_branch(ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 int natural_preheader(
@@ -120,12 +133,17 @@ void search_predecessors_not_in(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_edge_count __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_find_address_taken_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_find_basic_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_find_loops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_has_local_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_natural_preheader __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(loop_info))
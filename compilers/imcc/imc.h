@@ -366,6 +366,7 @@ typedef enum _enum_opt {
     OPT_PRE, /*0x001 */
     OPT_CFG  = 0x002,
     OPT_SUB  = 0x004,
+    OPT_LOOP = 0x008,
     OPT_PASM = 0x100
  /* OPT_J    = 0x200 */
 } enum_opt_t;
@@ -414,6 +415,7 @@ typedef struct code_segment_t {
     struct code_segment_t *prev;          /* previous code segment */
     struct code_segment_t *next;          /* next code segment */
     SymHash                key_consts;    /* this seg's cached key constants */
+    int                    ns_caches;     /* global lookup cache slots used */
 } code_segment_t;
 
 /* globals store the state between individual e_pbc_emit calls */
@@ -53,6 +53,15 @@ used_once ... deletes assignments, when LHS is unused
 
 constant_propagation
 
+global_value_numbering ... replaces a pure op recomputing the value of a
+dominating one by a copy. Registers with a single definition are in SSA
+form already, so they double as value numbers.
+
+copy_propagation ... reads of a single definition copy use the source
+
+loop_invariant_code_motion (-O3) ... moves invariant arithmetic into the
+loop preheader
+
 post_optimizer: currently pcc_optimize in pcc.c
 ---------------
 
@@ -127,6 +136,16 @@ static int constant_propagation(
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+static int copy_propagation(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(const Set *entered))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 static int dead_code_remove(
     ARGMOD(imc_info_t *imcc),
     ARGMOD(IMC_Unit *unit))
@@ -146,12 +165,92 @@ static int eval_ins(
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*imcc);
 
+static int global_value_numbering(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(const Set *entered))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 static int if_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int ins_dominates(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *a),
+    ARGIN(const Instruction *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int is_value_op(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static SymReg * lexical_reg(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static SymReg * lexinfo_const(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const IMC_Unit *target))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+static int loop_invariant(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Loop_info *loop),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static int loop_invariant_code_motion(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(const Set *entered))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const IMC_Unit * outer_unit(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Instruction * single_def(ARGIN(const SymReg *r))
+        __attribute__nonnull__(1);
+
 static int strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -171,6 +270,28 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+static int uses_dominated(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Set *entered),
+    ARGIN(const SymReg *r),
+    ARGIN(const Instruction *def))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_WARN_UNUSED_RESULT
+static int value_available(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Set *entered),
+    ARGIN(const SymReg *r),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 #define ASSERT_ARGS_branch_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -189,6 +310,10 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_constant_propagation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_copy_propagation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(entered))
 #define ASSERT_ARGS_dead_code_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -196,9 +321,40 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(op) \
     , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_global_value_numbering __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(entered))
 #define ASSERT_ARGS_if_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_ins_dominates __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_is_value_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_lexical_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_lexinfo_const __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(target))
+#define ASSERT_ARGS_loop_invariant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(loop) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_loop_invariant_code_motion __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(entered))
+#define ASSERT_ARGS_outer_unit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_single_def __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(r))
 #define ASSERT_ARGS_strength_reduce __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -208,6 +364,16 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_used_once __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_uses_dominated __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(entered) \
+    , PARROT_ASSERT_ARG(r) \
+    , PARROT_ASSERT_ARG(def))
+#define ASSERT_ARGS_value_available __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(entered) \
+    , PARROT_ASSERT_ARG(r) \
+    , PARROT_ASSERT_ARG(ins))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -280,6 +446,10 @@ Runs after the CFG is built and handles constant propagation.
 used_once ... deletes assignments, when LHS is unused and the
 op is purely functional, i.e. no side-effects.
 
+global_value_numbering and copy_propagation remove recomputed values and
+register copies, with -O3 loop_invariant_code_motion also hoists invariant
+arithmetic out of loops. Code entered through a taken label is left alone.
+
 =cut
 
 */
@@ -294,12 +464,188 @@ optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         any = constant_propagation(imcc, unit);
         if (used_once(imcc, unit))
             return 1;
+
+        /* the SSA-style passes need fresh def/use chains */
+        if (!any && !has_local_branch(unit)) {
+            Set * const entered = find_address_taken_blocks(imcc, unit);
+
+            any = global_value_numbering(imcc, unit, entered)
+               || copy_propagation(imcc, unit, entered)
+               || ((imcc->optimizer_level & OPT_LOOP)
+               &&  loop_invariant_code_motion(imcc, unit, entered));
+
+            set_free(entered);
+        }
     }
     return any;
 }
 
 /*
 
+=item C<int resolve_lexicals(imc_info_t *imcc, IMC_Unit *unit)>
+
+Runs at all optimization levels, after register allocation.
+Rewrites C<find_lex> and C<store_lex> with a constant name into
+C<find_lex_idx> and C<store_lex_idx>, if the lexical is declared in this sub
+or in one of its already compiled C<:outer> subs. The new ops access the
+register directly as long as the outer chain at runtime matches. Returns the
+number of rewritten instructions.
+
+=cut
+
+*/
+
+int
+resolve_lexicals(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(resolve_lexicals)
+    Instruction *ins;
+    int changes = 0;
+
+    if (unit->type != IMC_PCCSUB
+    ||  !unit->instructions->symregs[0]
+    ||  !unit->instructions->symregs[0]->subid)
+        return 0;
+
+    IMCC_info(imcc, 2, "resolve_lexicals\n");
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const IMC_Unit *target = unit;
+        SymReg   *name, *value, *r[5];
+        SymReg   *lex = NULL;
+        STRING   *lex_name;
+        Instruction *tmp;
+        char      fullname[64], buf[32];
+        int       find, depth;
+
+        if (!ins->opname || ins->opsize != 3)
+            continue;
+
+        find = STREQ(ins->opname, "find_lex");
+        if (!find && !STREQ(ins->opname, "store_lex"))
+            continue;
+
+        name  = ins->symregs[find];
+        value = ins->symregs[!find];
+
+        if (!(name->type & VTCONST) || name->set != 'S'
+        ||  (value->type & (VTCONST|VT_CONSTP) && (find || value->set == 'P')))
+            continue;
+
+        lex_name = IMCC_string_from_reg(imcc, name);
+
+        /* walk the :outer chain like Parrot_sub_find_pad will */
+        for (depth = 0; target; depth++) {
+            lex = lexical_reg(imcc, target, lex_name);
+            if (lex)
+                break;
+            target = outer_unit(imcc, target);
+        }
+
+        if (!target || lex->set != value->set)
+            continue;
+
+        r[0] = ins->symregs[0];
+        r[1] = ins->symregs[1];
+        r[2] = lexinfo_const(imcc, unit, target);
+        snprintf(buf, sizeof (buf), "%d", depth);
+        r[3] = mk_const(imcc, buf, 'I');
+        snprintf(buf, sizeof (buf), "%d", (int)lex->color);
+        r[4] = mk_const(imcc, buf, 'I');
+
+        if (find)
+            snprintf(fullname, sizeof (fullname), "find_lex_idx_%c_sc_pc_ic_ic",
+                    tolower((unsigned char)value->set));
+        else
+            snprintf(fullname, sizeof (fullname), "store_lex_idx_sc_%c%s_pc_ic_ic",
+                    tolower((unsigned char)value->set),
+                    value->type & (VTCONST|VT_CONSTP) ? "c" : "");
+
+        IMCC_debug(imcc, DEBUG_OPT1, "resolve lexical ");
+        IMCC_debug_ins(imcc, DEBUG_OPT1, ins);
+        tmp = INS(imcc, unit, fullname, "", r, 5, 0, 0);
+        subst_ins(unit, ins, tmp, 1);
+        ins = tmp;
+        changes++;
+    }
+
+    return changes;
+}
+
+/*
+
+=item C<int cache_global_lookups(imc_info_t *imcc, IMC_Unit *unit)>
+
+Runs at all optimization levels. Rewrites C<get_global>, C<get_hll_global>
+and C<get_root_global> with a constant name and, if any, a constant key into
+their inline cached C<_ic> variants, each getting its own lookup cache slot in
+the code segment. Returns the number of rewritten instructions.
+
+=cut
+
+*/
+
+int
+cache_global_lookups(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(cache_global_lookups)
+    PARROT_OBSERVER static const char * const ops[] = {
+        "get_global", "get_hll_global", "get_root_global"
+    };
+    Instruction *ins;
+    int changes = 0;
+
+    if (!imcc->globals || !imcc->globals->cs)
+        return 0;
+
+    IMCC_info(imcc, 2, "cache_global_lookups\n");
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        SymReg      *r[4], *name;
+        Instruction *tmp;
+        char         fullname[64], buf[32];
+        const int    n = ins->opsize - 1;
+        size_t       i;
+        int          j;
+
+        if (!ins->opname || (n != 2 && n != 3))
+            continue;
+
+        for (i = 0; i < N_ELEMENTS(ops); i++)
+            if (STREQ(ins->opname, ops[i]))
+                break;
+
+        if (i == N_ELEMENTS(ops))
+            continue;
+
+        name = ins->symregs[n - 1];
+        if (!(name->type & VTCONST) || name->set != 'S')
+            continue;
+
+        if (n == 3 && (ins->symregs[1]->set != 'K'
+                   || !(ins->symregs[1]->type & VTCONST)
+                   ||  (ins->symregs[1]->type & VTREGKEY)))
+            continue;
+
+        for (j = 0; j < n; j++)
+            r[j] = ins->symregs[j];
+        snprintf(buf, sizeof (buf), "%d", imcc->globals->cs->ns_caches++);
+        r[n] = mk_const(imcc, buf, 'I');
+
+        snprintf(fullname, sizeof (fullname), "%s_ic_p_%ssc_ic",
+                ops[i], n == 3 ? "pc_" : "");
+
+        IMCC_debug(imcc, DEBUG_OPT1, "cache global lookup ");
+        IMCC_debug_ins(imcc, DEBUG_OPT1, ins);
+        tmp = INS(imcc, unit, fullname, "", r, n + 1, 0, 0);
+        subst_ins(unit, ins, tmp, 1);
+        ins = tmp;
+        changes++;
+    }
+
+    return changes;
+}
+
+/*
+
 =item C<const char * get_neg_op(const char *op, int *n)>
 
 Get negated form of operator. If no negated form is known, return NULL.
@@ -1693,6 +2039,620 @@ used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
     return opt;
 }
 
+/* SSA-style optimizations on single definition registers */
+/*
+
+=item C<static int ins_dominates(const IMC_Unit *unit, const Instruction *a,
+const Instruction *b)>
+
+Returns true if instruction C<a> is executed before C<b> on every path
+through the CFG which reaches C<b>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+ins_dominates(ARGIN(const IMC_Unit *unit), ARGIN(const Instruction *a),
+        ARGIN(const Instruction *b))
+{
+    ASSERT_ARGS(ins_dominates)
+
+    if (a->bbindex == b->bbindex)
+        return a->index < b->index;
+
+    return set_contains(unit->dominators[b->bbindex], a->bbindex);
+}
+
+/*
+
+=item C<static Instruction * single_def(const SymReg *r)>
+
+Returns the only instruction writing to the register C<r>, or NULL if C<r>
+is written more than once, is a lexical or a PASM register or is otherwise
+visible outside of the usual def/use chains.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Instruction *
+single_def(ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(single_def)
+    Instruction *ins;
+
+    if (!(r->type & (VTREG|VTIDENTIFIER)) || (r->type & (VTPASM|VTREGKEY))
+    ||   (r->usage & U_LEXICAL) || r->reg || r->lhs_use_count != 1)
+        return NULL;
+
+    for (ins = r->first_ins; ins; ins = ins->next) {
+        if (instruction_writes(ins, r))
+            return ins;
+        if (ins == r->last_ins)
+            break;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static int value_available(const IMC_Unit *unit, const Set *entered,
+const SymReg *r, const Instruction *ins)>
+
+Returns true if the operand C<r> is a constant or a single definition
+register whose definition dominates C<ins>, i.e. it holds the same value
+wherever C<ins> or code dominated by C<ins> reads it.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+value_available(ARGIN(const IMC_Unit *unit), ARGIN(const Set *entered),
+        ARGIN(const SymReg *r), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(value_available)
+    const Instruction *def;
+
+    if (r->type & VTCONST)
+        return 1;
+
+    def = single_def(r);
+
+    return def
+        && !set_contains(entered, def->bbindex)
+        && ins_dominates(unit, def, ins);
+}
+
+/*
+
+=item C<static int is_value_op(const Instruction *ins)>
+
+Returns true if C<ins> computes its first operand from the other ones
+without side effects and without touching PMCs or keys.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+is_value_op(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(is_value_op)
+    int i;
+
+    if (!ins->op || ins->op->jump || ins->keys || ins->symreg_count < 2)
+        return 0;
+
+    /* the result is written, not read */
+    if (!(ins->flags & (1 << 16)) || (ins->flags & 1))
+        return 0;
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+
+        if (r->set == 'P' || r->set == 'K' || (r->type & VTREGKEY))
+            return 0;
+
+        if (i && (ins->flags & (1 << (16 + i))))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static int uses_dominated(const IMC_Unit *unit, const Set *entered,
+const SymReg *r, const Instruction *def)>
+
+Returns true if every instruction reading C<r> is dominated by C<def>, outside
+of code entered through a taken label and reads C<r> as a plain operand.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+uses_dominated(ARGIN(const IMC_Unit *unit), ARGIN(const Set *entered),
+        ARGIN(const SymReg *r), ARGIN(const Instruction *def))
+{
+    ASSERT_ARGS(uses_dominated)
+    const Instruction *ins;
+
+    for (ins = r->first_ins; ins; ins = ins->next) {
+        if (ins != def && instruction_reads(ins, r)) {
+            int i;
+
+            if (set_contains(entered, ins->bbindex) || !ins_dominates(unit, def, ins))
+                return 0;
+
+            for (i = 0; i < ins->symreg_count; i++) {
+                const SymReg *key;
+
+                for (key = ins->symregs[i]->nextkey; key; key = key->nextkey)
+                    if (key->reg == r || key == r)
+                        return 0;
+            }
+        }
+
+        if (ins == r->last_ins)
+            break;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static int global_value_numbering(imc_info_t *imcc, IMC_Unit *unit,
+const Set *entered)>
+
+Finds pure computations which repeat an earlier, dominating computation of the
+same op on the same values and replaces them with a copy of the earlier
+result. As only single definition registers take part, their names serve as
+value numbers.
+
+=cut
+
+*/
+
+static int
+global_value_numbering(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(const Set *entered))
+{
+    ASSERT_ARGS(global_value_numbering)
+    Instruction **values, **redundant, **sources;
+    Instruction  *ins;
+    int           n_values = 0, n_redundant = 0, n = 0, i;
+
+    for (ins = unit->instructions; ins; ins = ins->next)
+        n++;
+
+    values    = mem_gc_allocate_n_typed(imcc->interp, n, Instruction *);
+    redundant = mem_gc_allocate_n_typed(imcc->interp, n, Instruction *);
+    sources   = mem_gc_allocate_n_typed(imcc->interp, n, Instruction *);
+
+    IMCC_info(imcc, 2, "\tglobal_value_numbering\n");
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int j;
+
+        if (!(ins->type & ITPUREFUNC) || !is_value_op(ins)
+        ||   set_contains(entered, ins->bbindex)
+        ||   single_def(ins->symregs[0]) != ins)
+            continue;
+
+        for (j = 0; j < n_values; j++) {
+            Instruction * const prev = values[j];
+            int k;
+
+            if (prev->op != ins->op || prev->symreg_count != ins->symreg_count
+            || !ins_dominates(unit, prev, ins))
+                continue;
+
+            for (k = 1; k < ins->symreg_count; k++) {
+                const SymReg * const a = prev->symregs[k];
+                const SymReg * const b = ins->symregs[k];
+
+                if (a != b
+                && !((a->type & VTCONST) && (b->type & VTCONST)
+                    && a->set == b->set && STREQ(a->name, b->name)))
+                    break;
+                if (!value_available(unit, entered, a, prev))
+                    break;
+            }
+
+            if (k == ins->symreg_count)
+                break;
+        }
+
+        if (j < n_values) {
+            redundant[n_redundant] = ins;
+            sources[n_redundant++] = values[j];
+        }
+        else
+            values[n_values++] = ins;
+    }
+
+    /* replace only now, the def/use chains still point to the old ones */
+    for (i = 0; i < n_redundant; i++) {
+        SymReg *r[2];
+        Instruction *tmp;
+
+        r[0] = redundant[i]->symregs[0];
+        r[1] = sources[i]->symregs[0];
+        tmp  = INS(imcc, unit, "set", "", r, 2, 0, 0);
+
+        IMCC_debug(imcc, DEBUG_OPT2, "value numbering ");
+        IMCC_debug_ins(imcc, DEBUG_OPT2, redundant[i]);
+
+        tmp->type    = ITPUREFUNC;
+        tmp->index   = redundant[i]->index;
+        tmp->bbindex = redundant[i]->bbindex;
+        subst_ins(unit, redundant[i], tmp, 1);
+        unit->ostat.values_numbered++;
+    }
+
+    mem_gc_free(imcc->interp, values);
+    mem_gc_free(imcc->interp, redundant);
+    mem_gc_free(imcc->interp, sources);
+
+    return n_redundant;
+}
+
+/*
+
+=item C<static int copy_propagation(imc_info_t *imcc, IMC_Unit *unit, const Set
+*entered)>
+
+For a register copy C<set dst, src> where both registers have a single
+definition and the one of C<src> dominates the copy, replaces all reads of
+C<dst> with C<src>. The copy is left to C<used_once> to delete.
+
+=cut
+
+*/
+
+static int
+copy_propagation(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(const Set *entered))
+{
+    ASSERT_ARGS(copy_propagation)
+    Instruction *ins;
+    int          changed = 0;
+
+    IMCC_info(imcc, 2, "\tcopy_propagation\n");
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        SymReg      *dst, *src;
+        Instruction *use;
+        int          replaced = 0;
+
+        if (!ins->op || ins->op->jump || ins->keys || ins->symreg_count != 2
+        || !STREQ(ins->opname, "set")
+        ||  set_contains(entered, ins->bbindex))
+            continue;
+
+        dst = ins->symregs[0];
+        src = ins->symregs[1];
+
+        if (dst == src || dst->set != src->set || dst->set == 'K'
+        || (src->type & VTCONST)
+        ||  single_def(dst) != ins
+        || !value_available(unit, entered, src, ins)
+        || !uses_dominated(unit, entered, dst, ins))
+            continue;
+
+        for (use = ins->next; use; use = use->next) {
+            int i;
+
+            for (i = 0; i < use->symreg_count; i++) {
+                if (use->symregs[i] == dst) {
+                    use->symregs[i] = src;
+                    replaced++;
+                }
+            }
+
+            if (use == dst->last_ins)
+                break;
+        }
+
+        if (replaced) {
+            IMCC_debug(imcc, DEBUG_OPT2, "copy propagated ");
+            IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+            ins->type |= ITPUREFUNC;
+            unit->ostat.copies_propagated++;
+            changed++;
+        }
+    }
+
+    return changed;
+}
+
+/*
+
+=item C<static int loop_invariant(const IMC_Unit *unit, const Loop_info *loop,
+const Instruction *ins)>
+
+Returns true if C<ins> is a non-throwing arithmetic op or a copy, whose
+operands aren't written inside C<loop>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+loop_invariant(ARGIN(const IMC_Unit *unit), ARGIN(const Loop_info *loop),
+        ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(loop_invariant)
+    PARROT_OBSERVER static const char * const invariant_ops[] = {
+        "set", "add", "sub", "mul", "neg", "abs",
+        "band", "bor", "bxor", "bnot", "shl", "shr", "lsr"
+    };
+    size_t       i;
+    int          k;
+    unsigned int b;
+
+    for (i = 0; i < N_ELEMENTS(invariant_ops); i++)
+        if (STREQ(ins->opname, invariant_ops[i]))
+            break;
+
+    if (i == N_ELEMENTS(invariant_ops) || !is_value_op(ins))
+        return 0;
+
+    for (k = 0; k < ins->symreg_count; k++) {
+        const SymReg * const r = ins->symregs[k];
+
+        if (r->set == 'S' && (i || !(ins->symregs[1]->type & VTCONST)))
+            return 0;
+
+        if (!k || (r->type & VTCONST))
+            continue;
+
+        /* lexicals may change under the loop through store_lex */
+        if ((r->usage & U_LEXICAL) || r->reg)
+            return 0;
+
+        for (b = 0; b < unit->n_basic_blocks; b++) {
+            const Basic_block * const bb = unit->bb_list[b];
+            const Instruction        *w;
+
+            if (!set_contains(loop->loop, b))
+                continue;
+
+            for (w = bb->start; w; w = w->next) {
+                if (instruction_writes(w, r))
+                    return 0;
+                if (w == bb->end)
+                    break;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static int loop_invariant_code_motion(imc_info_t *imcc, IMC_Unit *unit,
+const Set *entered)>
+
+Moves one loop invariant computation into the natural preheader of its loop.
+The result register must have a single definition which dominates all its
+uses, so computing it once before the loop is enough. Returns true if an
+instruction was moved; the CFG has to be rebuilt then.
+
+=cut
+
+*/
+
+static int
+loop_invariant_code_motion(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(const Set *entered))
+{
+    ASSERT_ARGS(loop_invariant_code_motion)
+    Set * const reachable = set_make(imcc, unit->n_basic_blocks);
+    int         l, changed;
+
+    /* dominators and thus loops of dead code aren't meaningful */
+    set_add(reachable, 0);
+    do {
+        unsigned int b;
+        changed = 0;
+
+        for (b = 0; b < unit->n_basic_blocks; b++) {
+            const Edge *e;
+
+            if (!set_contains(reachable, b))
+                continue;
+
+            for (e = unit->bb_list[b]->succ_list; e; e = e->succ_next) {
+                if (!set_contains(reachable, e->to->index)) {
+                    set_add(reachable, e->to->index);
+                    changed = 1;
+                }
+            }
+        }
+    } while (changed);
+
+    IMCC_info(imcc, 2, "\tloop_invariant_code_motion\n");
+    for (l = 0; l < unit->n_loops; l++) {
+        const Loop_info * const loop = unit->loop_info[l];
+        const int               pre  = natural_preheader(unit, loop);
+        Instruction            *end;
+        unsigned int            b;
+
+        if (pre < 0 || set_contains(entered, pre) || !set_contains(reachable, pre))
+            continue;
+
+        end = unit->bb_list[pre]->end;
+
+        /* the invariant goes in front of the final branch, but not between a
+         * call and its results */
+        if (end->type & ITBRANCH) {
+            if (!end->prev || end->prev->bbindex != (unsigned int)pre)
+                continue;
+            end = end->prev;
+        }
+
+        if (end->type & (ITPCCSUB|ITCALL|ITPCCYIELD|ITPCCRET|ITRESULT|ITBRANCH))
+            continue;
+
+        for (b = 0; b < unit->n_basic_blocks; b++)
+            if (set_contains(loop->loop, b)
+            && (set_contains(entered, b) || !set_contains(reachable, b)))
+                break;
+
+        if (b < unit->n_basic_blocks)
+            continue;
+
+        for (b = 0; b < unit->n_basic_blocks; b++) {
+            Instruction *ins;
+
+            if (!set_contains(loop->loop, b))
+                continue;
+
+            for (ins = unit->bb_list[b]->start; ins; ins = ins->next) {
+                if (ins->symreg_count
+                &&  single_def(ins->symregs[0]) == ins
+                &&  loop_invariant(unit, loop, ins)
+                &&  uses_dominated(unit, entered, ins->symregs[0], ins)) {
+                    IMCC_debug(imcc, DEBUG_OPT2, "loop invariant moved ");
+                    IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+                    move_ins(unit, ins, end);
+                    unit->ostat.invariants_moved++;
+                    set_free(reachable);
+                    return 1;
+                }
+
+                if (ins == unit->bb_list[b]->end)
+                    break;
+            }
+        }
+    }
+
+    set_free(reachable);
+
+    return 0;
+}
+
+/*
+
+=item C<static SymReg * lexical_reg(imc_info_t *imcc, const IMC_Unit *unit,
+STRING *name)>
+
+Returns the register of the lexical C<name> declared in C<unit>, or NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static SymReg *
+lexical_reg(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(STRING *name))
+{
+    ASSERT_ARGS(lexical_reg)
+    const SymHash * const hsh = &unit->hash;
+    unsigned int i;
+
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+
+        for (r = hsh->data[i]; r; r = r->next) {
+            const SymReg *n;
+
+            if (!(r->usage & U_LEXICAL))
+                continue;
+
+            /* r->reg is a chain of names for the same lex sym */
+            for (n = r->reg; n; n = n->reg)
+                if (STRING_equal(imcc->interp, IMCC_string_from_reg(imcc, n), name))
+                    return r;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static const IMC_Unit * outer_unit(imc_info_t *imcc, const IMC_Unit
+*unit)>
+
+Returns the already compiled C<:outer> unit of C<unit>, or NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static const IMC_Unit *
+outer_unit(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(outer_unit)
+    const subs_t *s;
+
+    if (!unit->outer || !imcc->globals || !imcc->globals->cs)
+        return NULL;
+
+    /* same lookup as find_outer in pbc.c */
+    for (s = imcc->globals->cs->first; s; s = s->next)
+        if (s->unit->subid && STREQ(s->unit->subid->name, unit->outer->name))
+            return s->unit;
+
+    return NULL;
+}
+
+/*
+
+=item C<static SymReg * lexinfo_const(imc_info_t *imcc, const IMC_Unit *unit,
+const IMC_Unit *target)>
+
+Returns a C<LexInfo> constant for the sub of C<target>, like C<.const
+'LexInfo'> does. C<target> is either C<unit> or an already emitted unit.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static SymReg *
+lexinfo_const(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const IMC_Unit *target))
+{
+    ASSERT_ARGS(lexinfo_const)
+    const char *subid = target->instructions->symregs[0]->subid->name;
+    SymReg     *r;
+
+    /* an explicit :subid keeps its quotes until the sub is emitted */
+    if (target == unit && unit->subid) {
+        char * const unquoted = mem_sys_strdup(subid + 1);
+        unquoted[strlen(unquoted) - 1] = 0;
+        r = mk_const(imcc, unquoted, 'l');
+        mem_sys_free(unquoted);
+    }
+    else
+        r = mk_const(imcc, subid, 'l');
+
+    r->usage |= U_FIXUP | U_LEXINFO_LOOKUP;
+    return r;
+}
+
 /*
 
 =back
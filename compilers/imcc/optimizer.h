@@ -10,6 +10,12 @@
 /* HEADERIZER BEGIN: compilers/imcc/optimizer.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+int cache_global_lookups(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 PARROT_WARN_UNUSED_RESULT
 int cfg_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
@@ -71,6 +77,15 @@ int pre_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+int resolve_lexicals(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+#define ASSERT_ARGS_cache_global_lookups __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_cfg_optimize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -94,6 +109,9 @@ int pre_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_pre_optimize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_resolve_lexicals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: compilers/imcc/optimizer.c */
 
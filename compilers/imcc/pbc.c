@@ -711,6 +711,17 @@ get_code_size(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
                         "PMC is not defined");
                 */
             }
+            else {
+                /* LexInfo operands of find_lex_idx and store_lex_idx */
+                int i;
+                for (i = 0; i < ins->symreg_count; i++) {
+                    const SymReg *r = ins->symregs[i];
+                    if (r->type & VT_CONSTP)
+                        r = r->reg;
+                    if (r->usage & U_LEXINFO_LOOKUP)
+                        store_fixup(imcc, r, code_size, i + 1);
+                }
+            }
         }
         code_size += opsize;
     }
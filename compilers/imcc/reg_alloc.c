@@ -12,14 +12,13 @@ compilers/imcc/reg_alloc.c
 
 Register allocator:
 
-This is a brute force register allocator. It uses a graph-coloring
-algorithm, but the implementation is very kludgy.
+Without optimization every symbolic register gets its own parrot register
+(vanilla_reg_alloc).
 
-It is a partial implementation of a Briggs-style register allocator
-The following parts are just missing:
-
- - Renumbering
- - Coalescing
+With B<-O1> and above a linear-scan allocator is used instead: the live
+range of each symbolic is computed from the CFG by a backward liveness
+analysis, and symbolics whose ranges don't overlap share a parrot
+register (linear_scan_reg_alloc).
 
 =head2 Functions
 
@@ -33,6 +32,14 @@ The following parts are just missing:
 #include "imc.h"
 #include "optimizer.h"
 
+/* live range of a symbolic, as instruction indices */
+typedef struct _live_range {
+    SymReg *r;
+    int     start;
+    int     end;
+    int     index;      /* position in unit->reglist */
+} Live_range;
+
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
 /* HEADERIZER BEGIN: static */
@@ -65,6 +72,16 @@ static void compute_du_chain(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Live_range * compute_live_ranges(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void compute_one_du_chain(ARGMOD(SymReg *r), ARGIN(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -85,6 +102,19 @@ static void imc_stat_init(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void linear_scan_reg_alloc(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
+PARROT_WARN_UNUSED_RESULT
+static int live_range_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void make_stat(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(int *sets),
@@ -128,6 +158,9 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_compute_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_live_ranges __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_compute_one_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(unit))
@@ -136,6 +169,12 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_imc_stat_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_linear_scan_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_range_sort_f __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_make_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_print_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -168,6 +207,7 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
 {
     ASSERT_ARGS(imc_reg_alloc)
     const char *function;
+    int         first;
 
     if (!unit)
         return;
@@ -197,9 +237,10 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     /* all lexicals get a unique register */
     allocate_lexicals(imcc, unit);
 
-    /* build CFG and life info, and optimize iteratively */
+    /* build CFG and life info, and optimize iteratively; the PCC directives
+     * are expanded on the very first pass only */
+    first = 1;
     do {
-        int first = 1;
         do {
             while (pre_optimize(imcc, unit)) { };
 
@@ -222,8 +263,16 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     if (imcc->debug & DEBUG_IMC)
         dump_symreg(unit);
 
-    /* TODO add option for a better allocator */
-    vanilla_reg_alloc(imcc, unit);
+    if ((imcc->optimizer_level & OPT_PRE)
+    &&  !imcc->dont_optimize
+    &&  !has_local_branch(unit))
+        linear_scan_reg_alloc(imcc, unit);
+    else
+        vanilla_reg_alloc(imcc, unit);
+
+    /* find_lex and store_lex can use the final lexical registers directly */
+    resolve_lexicals(imcc, unit);
+    cache_global_lookups(imcc, unit);
 
     if (imcc->debug & DEBUG_IMC)
         dump_instructions(imcc, unit);
@@ -376,6 +425,8 @@ print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
               unit->ostat.used_once);
     IMCC_info(imcc, 1, "\t%d invariants_moved\n",
               unit->ostat.invariants_moved);
+    IMCC_info(imcc, 1, "\t%d values numbered, %d copies propagated\n",
+              unit->ostat.values_numbered, unit->ostat.copies_propagated);
     IMCC_info(imcc, 1, "\tregisters needed:\t I%d, N%d, S%d, P%d\n",
             sets[0], sets[1], sets[2], sets[3]);
     IMCC_info(imcc, 1,
@@ -764,6 +815,267 @@ vanilla_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static Live_range * compute_live_ranges(imc_info_t * imcc, IMC_Unit
+*unit)>
+
+Computes the live range of every symbolic in C<unit->reglist>. Per basic
+block use and def sets are solved backward to live-in and live-out sets; a
+symbolic's range then spans its first to last appearance, every block it is
+live into and every block it is live out of.
+
+Lexicals, and symbolics which are live into or used by code reachable through
+a taken label (exception handlers, continuations), get a range covering the
+whole unit.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Live_range *
+compute_live_ranges(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(compute_live_ranges)
+    const unsigned int n_syms   = unit->n_symbols;
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    Live_range * const ranges   = mem_gc_allocate_n_zeroed_typed(imcc->interp,
+                                    n_syms ? n_syms : 1, Live_range);
+    Set ** const use            = mem_gc_allocate_n_zeroed_typed(imcc->interp,
+                                    4 * n_blocks, Set *);
+    Set ** const def            = use + n_blocks;
+    Set ** const live_in        = def + n_blocks;
+    Set ** const live_out       = live_in + n_blocks;
+    Set * const  entered        = find_address_taken_blocks(imcc, unit);
+    Set * const  tmp            = set_make(imcc, n_syms);
+    const Instruction *ins;
+    int          last_index     = 0;
+    unsigned int b, k;
+    int          changed;
+
+    for (ins = unit->instructions; ins; ins = ins->next)
+        last_index = (int)ins->index;
+
+    for (b = 0; b < n_blocks; b++) {
+        use[b]      = set_make(imcc, n_syms);
+        def[b]      = set_make(imcc, n_syms);
+        live_in[b]  = set_make(imcc, n_syms);
+        live_out[b] = set_make(imcc, n_syms);
+    }
+
+    /* local use and def sets; only scan between first and last appearance */
+    for (k = 0; k < n_syms; k++) {
+        SymReg * const r     = unit->reglist[k];
+        Live_range * const lr = &ranges[k];
+        unsigned int   cur_bb  = n_blocks;
+        int            written = 0;
+
+        lr->r     = r;
+        lr->index = (int)k;
+
+        if (!r->first_ins || (r->usage & U_LEXICAL)) {
+            lr->start = 0;
+            lr->end   = last_index;
+            continue;
+        }
+
+        lr->start = (int)r->first_ins->index;
+        lr->end   = (int)r->last_ins->index;
+
+        for (ins = r->first_ins; ins; ins = ins->next) {
+            const int reads  = instruction_reads(ins, r);
+            const int writes = instruction_writes(ins, r);
+
+            if (ins->bbindex != cur_bb) {
+                cur_bb  = ins->bbindex;
+                written = 0;
+            }
+
+            if (reads && !written)
+                set_add(use[cur_bb], k);
+
+            if (writes) {
+                set_add(def[cur_bb], k);
+                written = 1;
+            }
+
+            if ((reads || writes) && set_contains(entered, cur_bb)) {
+                lr->start = 0;
+                lr->end   = last_index;
+            }
+
+            if (ins == r->last_ins)
+                break;
+        }
+    }
+
+    /* solve live_out = U live_in(succ), live_in = use U (live_out - def) */
+    do {
+        changed = 0;
+
+        for (b = n_blocks; b-- > 0;) {
+            const Edge *e;
+
+            for (e = unit->bb_list[b]->succ_list; e; e = e->succ_next)
+                set_union_inplace(live_out[b], live_in[e->to->index]);
+
+            set_clear(tmp);
+            set_union_inplace(tmp, live_out[b]);
+            set_difference_inplace(tmp, def[b]);
+            set_union_inplace(tmp, use[b]);
+
+            if (!set_equal(tmp, live_in[b])) {
+                set_union_inplace(live_in[b], tmp);
+                changed = 1;
+            }
+        }
+    } while (changed);
+
+    /* widen ranges over the blocks they are live through */
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+
+        for (k = 0; k < n_syms; k++) {
+            Live_range * const lr = &ranges[k];
+
+            if (set_contains(live_in[b], k)) {
+                if (set_contains(entered, b)) {
+                    lr->start = 0;
+                    lr->end   = last_index;
+                }
+                else if ((int)bb->start->index < lr->start)
+                    lr->start = (int)bb->start->index;
+            }
+
+            if (set_contains(live_out[b], k) && (int)bb->end->index > lr->end)
+                lr->end = (int)bb->end->index;
+        }
+    }
+
+    for (b = 0; b < n_blocks; b++) {
+        set_free(use[b]);
+        set_free(def[b]);
+        set_free(live_in[b]);
+        set_free(live_out[b]);
+    }
+
+    mem_gc_free(imcc->interp, use);
+    set_free(entered);
+    set_free(tmp);
+
+    return ranges;
+}
+
+/*
+
+=item C<static int live_range_sort_f(const void *a, const void *b)>
+
+Sort live ranges by start, then by position in the register list.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+live_range_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(live_range_sort_f)
+    const Live_range * const ra = (const Live_range *)a;
+    const Live_range * const rb = (const Live_range *)b;
+
+    if (ra->start != rb->start)
+        return ra->start < rb->start ? -1 : 1;
+
+    return ra->index < rb->index ? -1 : ra->index > rb->index;
+}
+
+/*
+
+=item C<static void linear_scan_reg_alloc(imc_info_t * imcc, IMC_Unit *unit)>
+
+Linear-scan register allocator. Walks the live ranges of each register set
+in order of their start and gives each symbolic the lowest parrot register
+whose previous holder's range has already ended, so symbolics with disjoint
+ranges share registers.
+
+=cut
+
+*/
+
+static void
+linear_scan_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(linear_scan_reg_alloc)
+    const char   type[]   = "INSP";
+    SymHash     *hsh      = &unit->hash;
+    Live_range  *ranges;
+    int         *busy_until;
+    unsigned int i, j;
+
+    /* Clear the pre-assigned colors. */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+        for (r = hsh->data[i]; r; r = r->next) {
+            if (REG_NEEDS_ALLOC(r))
+                r->color = -1;
+        }
+    }
+
+    ranges = compute_live_ranges(imcc, unit);
+    qsort(ranges, unit->n_symbols, sizeof (Live_range), live_range_sort_f);
+
+    /* end of the range currently holding each register */
+    busy_until = mem_gc_allocate_n_typed(imcc->interp,
+                    unit->n_symbols ? unit->n_symbols : 1, int);
+
+    for (j = 0; j < 4; j++) {
+        const int reg_set  = type[j];
+        int       n_colors = 0;
+
+        for (i = 0; i < unit->n_symbols; i++) {
+            Live_range * const lr = &ranges[i];
+            int                color;
+
+            if (lr->r->set != reg_set)
+                continue;
+
+            /* a register is free once its holder's range ended before us */
+            for (color = 0; color < n_colors; color++)
+                if (busy_until[color] < lr->start)
+                    break;
+
+            if (color == n_colors)
+                n_colors++;
+
+            busy_until[color] = lr->end;
+            lr->r->color      = color;
+
+            IMCC_debug(imcc, DEBUG_IMC, "linear scan %c '%s' [%d, %d] color %d\n",
+                    reg_set, lr->r->name, lr->start, lr->end, color);
+        }
+
+        /* symbolics left unused by the optimizer still need a register */
+        for (i = 0; i < hsh->size; i++) {
+            SymReg *r;
+            for (r = hsh->data[i]; r; r = r->next) {
+                if (r->set == reg_set && REG_NEEDS_ALLOC(r) && r->color == -1) {
+                    if (!n_colors)
+                        n_colors = 1;
+                    r->color = 0;
+                }
+            }
+        }
+
+        unit->first_avail[j] = n_colors;
+    }
+
+    mem_gc_free(imcc->interp, busy_until);
+    mem_gc_free(imcc->interp, ranges);
+}
+
+/*
+
 =item C<static void allocate_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
 
 Allocate registers for lexical variables. These must have unique registers
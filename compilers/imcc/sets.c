@@ -296,7 +296,7 @@ set_union(ARGMOD(imc_info_t * imcc), ARGIN(const Set *s1), ARGIN(const Set *s2))
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s->bmp[i] = s1->bmp[i] | s2->bmp[i];
     }
 
@@ -327,7 +327,7 @@ set_intersec(ARGMOD(imc_info_t * imcc), ARGIN(const Set *s1),
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s->bmp[i] = s1->bmp[i] & s2->bmp[i];
     }
 
@@ -354,13 +354,60 @@ set_intersec_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s1->bmp[i] &= s2->bmp[i];
     }
 }
 
 /*
 
+=item C<void set_union_inplace(Set *s1, const Set *s2)>
+
+Performs a set union in place -- the first Set argument changes to contain
+the result.
+
+=cut
+
+*/
+
+void
+set_union_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+{
+    ASSERT_ARGS(set_union_inplace)
+    unsigned int i;
+
+    PARROT_ASSERT(s1->length == s2->length);
+
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
+        s1->bmp[i] |= s2->bmp[i];
+    }
+}
+
+/*
+
+=item C<void set_difference_inplace(Set *s1, const Set *s2)>
+
+Removes from the first Set argument every element contained in the second.
+
+=cut
+
+*/
+
+void
+set_difference_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+{
+    ASSERT_ARGS(set_difference_inplace)
+    unsigned int i;
+
+    PARROT_ASSERT(s1->length == s2->length);
+
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
+        s1->bmp[i] &= ~s2->bmp[i];
+    }
+}
+
+/*
+
 =back
 
 =cut
@@ -33,6 +33,11 @@ Set* set_copy(ARGMOD(imc_info_t * imcc), ARGIN(const Set *s))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(* imcc);
 
+void set_difference_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*s1);
+
 PARROT_PURE_FUNCTION
 int set_equal(ARGIN(const Set *s1), ARGIN(const Set *s2))
         __attribute__nonnull__(1)
@@ -86,6 +91,11 @@ Set * set_union(
         __attribute__nonnull__(3)
         FUNC_MODIFIES(* imcc);
 
+void set_union_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*s1);
+
 #define ASSERT_ARGS_set_add __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_set_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -95,6 +105,9 @@ Set * set_union(
 #define ASSERT_ARGS_set_copy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_set_difference_inplace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s1) \
+    , PARROT_ASSERT_ARG(s2))
 #define ASSERT_ARGS_set_equal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s1) \
     , PARROT_ASSERT_ARG(s2))
@@ -117,6 +130,9 @@ Set * set_union(
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(s1) \
     , PARROT_ASSERT_ARG(s2))
+#define ASSERT_ARGS_set_union_inplace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s1) \
+    , PARROT_ASSERT_ARG(s2))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: compilers/imcc/sets.c */
 
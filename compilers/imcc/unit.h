@@ -29,6 +29,8 @@ struct imcc_ostat {
     int invariants_moved;
     int deleted_ins;
     int used_once;
+    int values_numbered;
+    int copies_propagated;
 } ;
 
 struct IMC_Unit {
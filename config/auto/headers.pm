@@ -97,7 +97,8 @@ sub _list_extra_headers {
     # the header.
     my @extra_headers = qw(malloc.h fcntl.h setjmp.h pthread.h signal.h
         sys/types.h sys/socket.h netinet/in.h arpa/inet.h
-        sys/stat.h sysexit.h limits.h sys/resource.h sys/sysctl.h libcpuid.h);
+        sys/stat.h sysexit.h limits.h sys/resource.h sys/sysctl.h libcpuid.h
+        linux/perf_event.h ucontext.h);
 
     # more extra_headers needed on mingw/msys; *BSD fails if they are present
     if ( $conf->data->get('OSNAME_provisional') eq "msys" ) {
@@ -550,7 +550,7 @@ help(void)
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
     "    -R --runcore fast|slow|bounds\n"
-    "    -R --runcore trace|profiling|subprof\n"
+    "    -R --runcore trace|profiling|subprof|sampling\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
     "    -D --parrot-debug[=HEXFLAGS]\n"
@@ -841,6 +841,9 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
                 args->imcc_opts |= PARROT_IMCC_OPT_PRE;
             if (strchr(opt.opt_arg, '2'))
                 args->imcc_opts |= (PARROT_IMCC_OPT_PRE|PARROT_IMCC_OPT_CFG);
+            if (strchr(opt.opt_arg, '3'))
+                args->imcc_opts |= (PARROT_IMCC_OPT_PRE|PARROT_IMCC_OPT_CFG
+                                 |  PARROT_IMCC_OPT_LOOP);
             break;
 
           case '.':  /* Give Windows Parrot hackers an opportunity to
@@ -0,0 +1,1188 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+parrot_microbench - Time single ops and internal calls in ns/op
+
+=head1 SYNOPSIS
+
+ parrot_microbench [-n iterations] [-r repeat] [-R runcore] [pattern ...]
+ parrot_microbench --list
+
+=head1 DESCRIPTION
+
+This program embeds an interpreter through the embedding API and times the
+building blocks everything else is made of, one at a time, in tight loops:
+
+=over 4
+
+=item C<op/...>
+
+Single PIR ops. Each one is compiled into a loop of its own; the time of the
+same loop without the op, reported as C<op/empty_loop>, is subtracted.
+
+=item C<vtable/...>
+
+Vtable calls on core PMCs, e.g. C<VTABLE_get_integer_keyed_int>.
+
+=item C<pcc/...>
+
+Calls of a PIR sub from C through C<Parrot_pcc_invoke_sub_from_c_args>.
+
+=item C<hash/...>
+
+C<Parrot_hash_get> and C<Parrot_hash_put> on STRING and integer keyed hashes.
+
+=item C<string/...>
+
+The common STRING functions.
+
+=back
+
+Every benchmark runs its loop the given number of iterations, as often as
+requested, and reports the median and the minimum time per iteration in
+nanoseconds. Benchmarks that allocate include the cost of collecting their
+garbage. Use C<make microbench> to build and run all of them; pass options in
+C<MICROBENCH_ARGS>.
+
+=head2 Command-Line Options
+
+=over 4
+
+=item C<-n N> or C<--iterations=N>
+
+Iterations of each loop, 1000000 by default.
+
+=item C<-r N> or C<--repeat=N>
+
+How often each loop is run, 5 by default.
+
+=item C<-R core> or C<--runcore=core>
+
+The runcore to run the C<op/> benchmarks with, C<fast> by default.
+
+=item C<-l> or C<--list>
+
+List the benchmarks and exit.
+
+=item C<pattern ...>
+
+Only run the benchmarks whose names contain one of the patterns.
+
+=item C<-h> or C<--help>
+
+=back
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/api.h"
+#include "parrot/longopt.h"
+#include "imcc/api.h"
+
+extern int Parrot_set_config_hash(Parrot_PMC interp_pmc);
+
+/* the number of distinct keys the hash and vtable benchmarks cycle through */
+#define MICROBENCH_KEYS 1024
+
+/* Everything the benchmarks work on, set up once before timing. */
+typedef struct microbench_state {
+    PMC     *op_subs;       /* compiled op loops, by benchmark index */
+    PMC     *nop_sub;       /* PIR subs called by the pcc benchmarks */
+    PMC     *ident_sub;
+    PMC     *add_sub;
+    PMC     *int_array;     /* ResizableIntegerArray of MICROBENCH_KEYS */
+    PMC     *integer;       /* an Integer */
+    PMC     *hash_pmc;      /* Hash with MICROBENCH_KEYS STRING keys */
+    PMC     *keys;          /* the keys in hash_pmc */
+    PMC     *misses;        /* keys not in hash_pmc */
+    Hash    *str_hash;      /* the Hash inside hash_pmc */
+    Hash    *int_hash;      /* INTVAL keys and values */
+    STRING  *short_str;
+    STRING  *long_str;
+    STRING  *long_copy;     /* equal to long_str, but not the same STRING */
+    STRING  *needle;        /* found at the end of long_str */
+    STRING  *number;
+} microbench_state;
+
+typedef void (*microbench_run)(PARROT_INTERP, microbench_state *s, INTVAL n);
+
+/* A benchmark is either a PIR op, with optional setup code, or a C loop. */
+typedef struct microbench {
+    const char     *name;
+    const char     *preops;
+    const char     *op;
+    microbench_run  run;
+} microbench;
+
+/* keeps the compiler from optimizing away unused results */
+static volatile INTVAL microbench_sink;
+
+/* HEADERIZER HFILE: none */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void bench_get_integer(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_get_integer_keyed_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_get_pmc_keyed_str(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_hash_get_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_hash_get_string_hit(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_hash_get_string_miss(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_hash_put_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_hash_put_string(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_invoke_int_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_invoke_no_args(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_invoke_pmc(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_set_integer_keyed_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_set_integer_native(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_compare(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_concat(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_equal(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_find_index(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_from_int(PARROT_INTERP, microbench_state *s, INTVAL n)
+        __attribute__nonnull__(1);
+
+static void bench_str_substr(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void bench_str_to_int(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int compare_doubles(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * compile_op_loop(PARROT_INTERP,
+    ARGIN(PMC *compiler),
+    ARGIN(const microbench *b),
+    INTVAL index)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * compile_pir(PARROT_INTERP,
+    ARGIN(PMC *compiler),
+    ARGIN(const char *source),
+    ARGIN(const char *subname))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_DOES_NOT_RETURN
+static void help(void);
+
+PARROT_WARN_UNUSED_RESULT
+static int selected(
+    ARGIN(const microbench *b),
+    ARGIN(const char **patterns),
+    int num_patterns)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void setup(PARROT_INTERP,
+    ARGIN(PMC *compiler),
+    ARGOUT(microbench_state *s),
+    ARGIN(const char **patterns),
+    int num_patterns)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*s);
+
+static double time_once(PARROT_INTERP,
+    ARGIN(microbench_state *s),
+    INTVAL index,
+    INTVAL iterations)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_bench_get_integer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_get_integer_keyed_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_get_pmc_keyed_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_hash_get_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_hash_get_string_hit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_hash_get_string_miss __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_hash_put_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_hash_put_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_invoke_int_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_invoke_no_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_invoke_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_set_integer_keyed_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_set_integer_native __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_concat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_equal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_find_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_from_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_bench_str_substr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_bench_str_to_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_compare_doubles __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_compile_op_loop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(compiler) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_compile_pir __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(compiler) \
+    , PARROT_ASSERT_ARG(source) \
+    , PARROT_ASSERT_ARG(subname))
+#define ASSERT_ARGS_help __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_selected __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(patterns))
+#define ASSERT_ARGS_setup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(compiler) \
+    , PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(patterns))
+#define ASSERT_ARGS_time_once __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+static const microbench benchmarks[] = {
+    { "op/empty_loop",      "", "", NULL },
+    { "op/noop",            "", "noop", NULL },
+    { "op/set_i_ic",        "", "$I0 = 42", NULL },
+    { "op/add_i_i_i",       "$I1 = 1\n$I2 = 2", "$I0 = $I1 + $I2", NULL },
+    { "op/add_n_n_n",       "$N1 = 1.5\n$N2 = 2.5", "$N0 = $N1 + $N2", NULL },
+    { "op/set_s_sc",        "", "$S0 = 'microbench'", NULL },
+    { "op/concat_s_s_s",    "$S1 = 'micro'", "$S0 = concat $S1, $S1", NULL },
+    { "op/new_p_sc",        "", "$P0 = new ['Integer']", NULL },
+    { "op/set_p_i",         "$P0 = new ['Integer']", "$P0 = 42", NULL },
+    { "op/add_p_p_p",       "$P1 = box 1\n$P2 = box 2\n$P0 = new ['Integer']",
+                            "add $P0, $P1, $P2", NULL },
+    { "op/set_i_p_kic",     "$P0 = new ['ResizableIntegerArray']\n$P0[9] = 1",
+                            "$I0 = $P0[5]", NULL },
+    { "op/set_p_p_kc",      "$P0 = new ['Hash']\n$P0['key'] = 1",
+                            "$P1 = $P0['key']", NULL },
+    { "op/call_no_args",    "", "'microbench_nop'()", NULL },
+    { "op/call_pmc",        "$P1 = box 1", "$P0 = 'microbench_ident'($P1)", NULL },
+    { "vtable/get_integer",             NULL, NULL, bench_get_integer },
+    { "vtable/set_integer_native",      NULL, NULL, bench_set_integer_native },
+    { "vtable/get_integer_keyed_int",   NULL, NULL, bench_get_integer_keyed_int },
+    { "vtable/set_integer_keyed_int",   NULL, NULL, bench_set_integer_keyed_int },
+    { "vtable/get_pmc_keyed_str",       NULL, NULL, bench_get_pmc_keyed_str },
+    { "pcc/invoke_no_args",             NULL, NULL, bench_invoke_no_args },
+    { "pcc/invoke_pmc",                 NULL, NULL, bench_invoke_pmc },
+    { "pcc/invoke_int_int",             NULL, NULL, bench_invoke_int_int },
+    { "hash/get_string_hit",            NULL, NULL, bench_hash_get_string_hit },
+    { "hash/get_string_miss",           NULL, NULL, bench_hash_get_string_miss },
+    { "hash/put_string",                NULL, NULL, bench_hash_put_string },
+    { "hash/get_int",                   NULL, NULL, bench_hash_get_int },
+    { "hash/put_int",                   NULL, NULL, bench_hash_put_int },
+    { "string/concat",                  NULL, NULL, bench_str_concat },
+    { "string/equal",                   NULL, NULL, bench_str_equal },
+    { "string/compare",                 NULL, NULL, bench_str_compare },
+    { "string/find_index",              NULL, NULL, bench_str_find_index },
+    { "string/substr",                  NULL, NULL, bench_str_substr },
+    { "string/from_int",                NULL, NULL, bench_str_from_int },
+    { "string/to_int",                  NULL, NULL, bench_str_to_int }
+};
+
+#define NUM_BENCHMARKS (sizeof (benchmarks) / sizeof (benchmarks[0]))
+
+/* the subs the op and pcc benchmarks call */
+static const char support_pir[] =
+    ".sub 'microbench_nop'\n"
+    ".end\n"
+    ".sub 'microbench_ident'\n"
+    "    .param pmc p\n"
+    "    .return (p)\n"
+    ".end\n"
+    ".sub 'microbench_add'\n"
+    "    .param int a\n"
+    "    .param int b\n"
+    "    $I0 = a + b\n"
+    "    .return ($I0)\n"
+    ".end\n";
+
+/*
+
+=item C<static void bench_get_integer(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_set_integer_native(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_get_integer_keyed_int(PARROT_INTERP, microbench_state
+*s, INTVAL n)>
+
+=item C<static void bench_set_integer_keyed_int(PARROT_INTERP, microbench_state
+*s, INTVAL n)>
+
+=item C<static void bench_get_pmc_keyed_str(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+Vtable calls on an Integer, a ResizableIntegerArray and a Hash.
+
+=cut
+
+*/
+
+static void
+bench_get_integer(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_get_integer)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += VTABLE_get_integer(interp, s->integer);
+
+    microbench_sink = sum;
+}
+
+static void
+bench_set_integer_native(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_set_integer_native)
+    INTVAL i;
+
+    for (i = 0; i < n; ++i)
+        VTABLE_set_integer_native(interp, s->integer, i);
+}
+
+static void
+bench_get_integer_keyed_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_get_integer_keyed_int)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += VTABLE_get_integer_keyed_int(interp, s->int_array, i & (MICROBENCH_KEYS - 1));
+
+    microbench_sink = sum;
+}
+
+static void
+bench_set_integer_keyed_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_set_integer_keyed_int)
+    INTVAL i;
+
+    for (i = 0; i < n; ++i)
+        VTABLE_set_integer_keyed_int(interp, s->int_array, i & (MICROBENCH_KEYS - 1), i);
+}
+
+static void
+bench_get_pmc_keyed_str(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_get_pmc_keyed_str)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key = VTABLE_get_string_keyed_int(interp, s->keys,
+                                i & (MICROBENCH_KEYS - 1));
+        sum += !PMC_IS_NULL(VTABLE_get_pmc_keyed_str(interp, s->hash_pmc, key));
+    }
+
+    microbench_sink = sum;
+}
+
+/*
+
+=item C<static void bench_invoke_no_args(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_invoke_pmc(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_invoke_int_int(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+Calls of PIR subs taking and returning nothing, a PMC, and two integers
+returning one.
+
+=cut
+
+*/
+
+static void
+bench_invoke_no_args(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_invoke_no_args)
+    INTVAL i;
+
+    for (i = 0; i < n; ++i)
+        Parrot_pcc_invoke_sub_from_c_args(interp, s->nop_sub, "->");
+}
+
+static void
+bench_invoke_pmc(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_invoke_pmc)
+    INTVAL i;
+    PMC   *result = PMCNULL;
+
+    for (i = 0; i < n; ++i)
+        Parrot_pcc_invoke_sub_from_c_args(interp, s->ident_sub, "P->P",
+                s->integer, &result);
+
+    microbench_sink = result == s->integer;
+}
+
+static void
+bench_invoke_int_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_invoke_int_int)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        INTVAL result;
+        Parrot_pcc_invoke_sub_from_c_args(interp, s->add_sub, "II->I", i, 1, &result);
+        sum += result;
+    }
+
+    microbench_sink = sum;
+}
+
+/*
+
+=item C<static void bench_hash_get_string_hit(PARROT_INTERP, microbench_state
+*s, INTVAL n)>
+
+=item C<static void bench_hash_get_string_miss(PARROT_INTERP, microbench_state
+*s, INTVAL n)>
+
+=item C<static void bench_hash_put_string(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_hash_get_int(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_hash_put_int(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+Lookups and stores of existing keys, and lookups of missing ones. The STRING
+keys are fetched from an array first, which is included in the time; its cost
+is that of C<vtable/get_string_keyed_int>, which is well below the lookup.
+
+=cut
+
+*/
+
+static void
+bench_hash_get_string_hit(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_hash_get_string_hit)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key = VTABLE_get_string_keyed_int(interp, s->keys,
+                                i & (MICROBENCH_KEYS - 1));
+        sum += Parrot_hash_get(interp, s->str_hash, key) != NULL;
+    }
+
+    microbench_sink = sum;
+}
+
+static void
+bench_hash_get_string_miss(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_hash_get_string_miss)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key = VTABLE_get_string_keyed_int(interp, s->misses,
+                                i & (MICROBENCH_KEYS - 1));
+        sum += Parrot_hash_get(interp, s->str_hash, key) != NULL;
+    }
+
+    microbench_sink = sum;
+}
+
+static void
+bench_hash_put_string(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_hash_put_string)
+    INTVAL i;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const key = VTABLE_get_string_keyed_int(interp, s->keys,
+                                i & (MICROBENCH_KEYS - 1));
+        Parrot_hash_put(interp, s->str_hash, key, s->integer);
+    }
+}
+
+static void
+bench_hash_get_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_hash_get_int)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += (INTVAL)Parrot_hash_get(interp, s->int_hash,
+                (void *)(i & (MICROBENCH_KEYS - 1)));
+
+    microbench_sink = sum;
+}
+
+static void
+bench_hash_put_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_hash_put_int)
+    INTVAL i;
+
+    for (i = 0; i < n; ++i)
+        Parrot_hash_put(interp, s->int_hash,
+                (void *)(i & (MICROBENCH_KEYS - 1)), (void *)i);
+}
+
+/*
+
+=item C<static void bench_str_concat(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_str_equal(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_str_compare(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_str_find_index(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_str_substr(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+=item C<static void bench_str_from_int(PARROT_INTERP, microbench_state *s,
+INTVAL n)>
+
+=item C<static void bench_str_to_int(PARROT_INTERP, microbench_state *s, INTVAL
+n)>
+
+Concatenation of two short strings, comparison of two equal 64 character
+strings, a search for a needle at the end of them, a short substring, and
+conversions between integers and strings.
+
+=cut
+
+*/
+
+static void
+bench_str_concat(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_concat)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_concat(interp, s->short_str, s->short_str)->strlen;
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_equal(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_equal)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_equal(interp, s->long_str, s->long_copy);
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_compare(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_compare)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_compare(interp, s->long_str, s->long_copy);
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_find_index(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_find_index)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_find_index(interp, s->long_str, s->needle, 0);
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_substr(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_substr)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_substr(interp, s->long_str, i & 31, 8)->strlen;
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_from_int(PARROT_INTERP, SHIM(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_from_int)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_from_int(interp, i)->strlen;
+
+    microbench_sink = sum;
+}
+
+static void
+bench_str_to_int(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL n)
+{
+    ASSERT_ARGS(bench_str_to_int)
+    INTVAL i, sum = 0;
+
+    for (i = 0; i < n; ++i)
+        sum += Parrot_str_to_int(interp, s->number);
+
+    microbench_sink = sum;
+}
+
+/*
+
+=item C<static PMC * compile_pir(PARROT_INTERP, PMC *compiler, const char
+*source, const char *subname)>
+
+Compiles C<source> and returns the global sub C<subname> it defines.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+compile_pir(PARROT_INTERP, ARGIN(PMC *compiler), ARGIN(const char *source),
+        ARGIN(const char *subname))
+{
+    ASSERT_ARGS(compile_pir)
+    PMC *result = PMCNULL;
+    PMC *sub;
+
+    Parrot_pcc_invoke_method_from_c_args(interp, compiler,
+            Parrot_str_new_constant(interp, "compile"), "S->P",
+            Parrot_str_new(interp, source, 0), &result);
+
+    /* subs can only run with a current packfile, the first one will do */
+    if (!interp->code)
+        Parrot_pf_set_current_packfile(interp, result);
+
+    sub = Parrot_ns_find_current_namespace_global(interp,
+            Parrot_str_new(interp, subname, 0));
+
+    if (PMC_IS_NULL(sub)) {
+        fprintf(stderr, "parrot_microbench: could not compile %s\n", subname);
+        exit(EXIT_FAILURE);
+    }
+
+    return sub;
+}
+
+/*
+
+=item C<static PMC * compile_op_loop(PARROT_INTERP, PMC *compiler, const
+microbench *b, INTVAL index)>
+
+Compiles the loop around the op of benchmark C<b>. The sub takes the number of
+iterations.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+compile_op_loop(PARROT_INTERP, ARGIN(PMC *compiler), ARGIN(const microbench *b),
+        INTVAL index)
+{
+    ASSERT_ARGS(compile_op_loop)
+    char   subname[32];
+    char  *source;
+    size_t size = strlen(b->preops) + strlen(b->op) + 256;
+    PMC   *sub;
+
+    source = mem_gc_allocate_n_typed(interp, size, char);
+    snprintf(subname, sizeof (subname), "microbench_op_%d", (int)index);
+    snprintf(source, size,
+        ".sub '%s'\n"
+        "    .param int n\n"
+        "    .local int i\n"
+        "%s\n"
+        "    i = 0\n"
+        "  loop:\n"
+        "%s\n"
+        "    inc i\n"
+        "    if i < n goto loop\n"
+        ".end\n",
+        subname, b->preops, b->op);
+
+    sub = compile_pir(interp, compiler, source, subname);
+    mem_gc_free(interp, source);
+
+    return sub;
+}
+
+/*
+
+=item C<static void setup(PARROT_INTERP, PMC *compiler, microbench_state *s,
+const char **patterns, int num_patterns)>
+
+Creates everything the selected benchmarks use.
+
+=cut
+
+*/
+
+static void
+setup(PARROT_INTERP, ARGIN(PMC *compiler), ARGOUT(microbench_state *s),
+        ARGIN(const char **patterns), int num_patterns)
+{
+    ASSERT_ARGS(setup)
+    INTVAL i;
+
+    s->op_subs = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    Parrot_pmc_gc_register(interp, s->op_subs);
+
+    s->nop_sub   = compile_pir(interp, compiler, support_pir, "microbench_nop");
+    s->ident_sub = Parrot_ns_find_current_namespace_global(interp,
+                        Parrot_str_new_constant(interp, "microbench_ident"));
+    s->add_sub   = Parrot_ns_find_current_namespace_global(interp,
+                        Parrot_str_new_constant(interp, "microbench_add"));
+
+    for (i = 0; i < (INTVAL)NUM_BENCHMARKS; ++i) {
+        const microbench * const b = &benchmarks[i];
+
+        /* the empty loop is always needed to subtract it from the others */
+        if (b->op && (i == 0 || selected(b, patterns, num_patterns)))
+            VTABLE_set_pmc_keyed_int(interp, s->op_subs, i,
+                    compile_op_loop(interp, compiler, b, i));
+    }
+
+    s->integer = Parrot_pmc_new(interp, enum_class_Integer);
+    Parrot_pmc_gc_register(interp, s->integer);
+
+    s->int_array = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+    Parrot_pmc_gc_register(interp, s->int_array);
+    VTABLE_set_integer_native(interp, s->int_array, MICROBENCH_KEYS);
+
+    s->hash_pmc = Parrot_pmc_new(interp, enum_class_Hash);
+    Parrot_pmc_gc_register(interp, s->hash_pmc);
+    s->str_hash = (Hash *)VTABLE_get_pointer(interp, s->hash_pmc);
+
+    s->keys = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    Parrot_pmc_gc_register(interp, s->keys);
+    s->misses = Parrot_pmc_new(interp, enum_class_ResizableStringArray);
+    Parrot_pmc_gc_register(interp, s->misses);
+
+    s->int_hash = Parrot_hash_new_intval_hash(interp);
+
+    for (i = 0; i < MICROBENCH_KEYS; ++i) {
+        STRING * const key  = Parrot_sprintf_c(interp, "key%d", (int)i);
+        STRING * const miss = Parrot_sprintf_c(interp, "miss%d", (int)i);
+
+        VTABLE_push_string(interp, s->keys, key);
+        VTABLE_push_string(interp, s->misses, miss);
+        VTABLE_set_pmc_keyed_str(interp, s->hash_pmc, key, s->integer);
+        Parrot_hash_put(interp, s->int_hash, (void *)i, (void *)i);
+    }
+
+    s->short_str = Parrot_str_new_constant(interp, "micro");
+    s->long_str  = Parrot_str_new_constant(interp,
+            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!?");
+    s->long_copy = Parrot_str_new(interp,
+            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!?", 0);
+    s->needle    = Parrot_str_new_constant(interp, "YZ!?");
+    s->number    = Parrot_str_new_constant(interp, "1234567890");
+}
+
+/*
+
+=item C<static int selected(const microbench *b, const char **patterns, int
+num_patterns)>
+
+Returns whether benchmark C<b> is to be run.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+selected(ARGIN(const microbench *b), ARGIN(const char **patterns), int num_patterns)
+{
+    ASSERT_ARGS(selected)
+    int i;
+
+    if (!num_patterns)
+        return 1;
+
+    for (i = 0; i < num_patterns; ++i)
+        if (strstr(b->name, patterns[i]))
+            return 1;
+
+    return 0;
+}
+
+/*
+
+=item C<static double time_once(PARROT_INTERP, microbench_state *s, INTVAL
+index, INTVAL iterations)>
+
+Runs benchmark C<index> once and returns the time per iteration in ns.
+
+=cut
+
+*/
+
+static double
+time_once(PARROT_INTERP, ARGIN(microbench_state *s), INTVAL index, INTVAL iterations)
+{
+    ASSERT_ARGS(time_once)
+    const microbench * const b = &benchmarks[index];
+    UHUGEINTVAL start, end;
+
+    if (b->op) {
+        PMC * const sub = VTABLE_get_pmc_keyed_int(interp, s->op_subs, index);
+
+        start = Parrot_hires_get_time();
+        Parrot_pcc_invoke_sub_from_c_args(interp, sub, "I->", iterations);
+        end   = Parrot_hires_get_time();
+    }
+    else {
+        start = Parrot_hires_get_time();
+        (b->run)(interp, s, iterations);
+        end   = Parrot_hires_get_time();
+    }
+
+    return (double)(end - start) * Parrot_hires_get_tick_duration() / iterations;
+}
+
+/*
+
+=item C<static int compare_doubles(const void *a, const void *b)>
+
+C<qsort> comparison of two doubles.
+
+=cut
+
+*/
+
+static int
+compare_doubles(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(compare_doubles)
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/*
+
+=item C<static void help(void)>
+
+Print out the user help info.
+
+=cut
+
+*/
+
+PARROT_DOES_NOT_RETURN
+static void
+help(void)
+{
+    ASSERT_ARGS(help)
+    printf("parrot_microbench - time single ops and internal calls in ns/op\n\n");
+    printf("Usage:\n");
+    printf("   parrot_microbench [options] [pattern ...]\n\n");
+    printf("Options:\n");
+    printf("  -n --iterations=N   iterations of each loop (default 1000000)\n");
+    printf("  -r --repeat=N       how often each loop is run (default 5)\n");
+    printf("  -R --runcore=CORE   runcore of the op benchmarks (default fast)\n");
+    printf("  -l --list           list the benchmarks\n");
+    printf("  -h --help           print this message\n");
+    exit(EXIT_SUCCESS);
+}
+
+/*
+
+=item C<int main(int argc, const char **argv)>
+
+Sets up the interpreter and the benchmarks, then times and reports them.
+
+=cut
+
+*/
+
+static struct longopt_opt_decl options[] = {
+    { 'n', 'n', OPTION_required_FLAG, { "--iterations" } },
+    { 'r', 'r', OPTION_required_FLAG, { "--repeat"     } },
+    { 'R', 'R', OPTION_required_FLAG, { "--runcore"    } },
+    { 'l', 'l', OPTION_optional_FLAG, { "--list"       } },
+    { 'h', 'h', OPTION_optional_FLAG, { "--help"       } },
+    {  0 ,  0 , OPTION_optional_FLAG, { NULL           } }
+};
+
+int
+main(int argc, const char **argv)
+{
+    struct longopt_opt_info opt = LONGOPT_OPT_INFO_INIT;
+    Parrot_Init_Args *initargs;
+    Parrot_PMC        interp_pmc;
+    Parrot_PMC        compiler;
+    Parrot_Int        size;
+    void             *raw_interp;
+    Interp           *interp;
+    microbench_state  state;
+    double           *times;
+    double            empty_loop = 0.0;
+    const char       *runcore    = "fast";
+    INTVAL            iterations = 1000000;
+    int               repeat     = 5;
+    int               status, i, j;
+
+    while ((status = Parrot_longopt_get(argc, argv, options, &opt)) > 0) {
+        switch (opt.opt_id) {
+          case 'n':
+            iterations = atol(opt.opt_arg);
+            break;
+          case 'r':
+            repeat = atoi(opt.opt_arg);
+            break;
+          case 'R':
+            runcore = opt.opt_arg;
+            break;
+          case 'l':
+            for (i = 0; i < (int)NUM_BENCHMARKS; ++i)
+                printf("%s\n", benchmarks[i].name);
+            exit(EXIT_SUCCESS);
+          default:
+            help();
+        }
+    }
+    if (status == -1 || iterations < 1 || repeat < 1)
+        help();
+
+    argc -= opt.opt_index;
+    argv += opt.opt_index;
+
+    GET_INIT_STRUCT(initargs);
+    if (!(Parrot_api_make_interpreter(NULL, 0, initargs, &interp_pmc)
+    &&    Parrot_set_config_hash(interp_pmc)
+    &&    Parrot_api_set_runcore(interp_pmc, runcore, 0)
+    &&    imcc_get_pir_compreg_api(interp_pmc, 1, &compiler)
+    &&    Parrot_api_unwrap_pointer(interp_pmc, interp_pmc, &raw_interp, &size))) {
+        fprintf(stderr, "parrot_microbench: could not set up the interpreter\n");
+        exit(EXIT_FAILURE);
+    }
+
+    interp = (Interp *)raw_interp;
+    setup(interp, compiler, &state, argv, argc);
+
+    times = mem_gc_allocate_n_typed(interp, repeat, double);
+
+    printf("# %ld iterations, %d runs, %s runcore\n", (long)iterations, repeat, runcore);
+    printf("%-32s %10s %10s\n", "benchmark", "ns/op", "min");
+
+    for (i = 0; i < (int)NUM_BENCHMARKS; ++i) {
+        const microbench * const b = &benchmarks[i];
+        double median;
+
+        if (i && !selected(b, argv, argc))
+            continue;
+
+        for (j = 0; j < repeat; ++j)
+            times[j] = time_once(interp, &state, i, iterations);
+
+        qsort(times, repeat, sizeof (double), compare_doubles);
+        median = repeat % 2
+               ? times[repeat / 2]
+               : (times[repeat / 2 - 1] + times[repeat / 2]) / 2;
+
+        /* all op loops have the cost of the empty one, except itself */
+        if (i == 0)
+            empty_loop = median;
+        else if (b->op) {
+            median   -= empty_loop;
+            times[0] -= empty_loop;
+        }
+
+        if (i || selected(b, argv, argc))
+            printf("%-32s %10.2f %10.2f\n", b->name, median, times[0]);
+    }
+
+    mem_gc_free(interp, times);
+    Parrot_hash_destroy(interp, state.int_hash);
+    Parrot_api_destroy_interpreter(interp_pmc);
+
+    return 0;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<tools/dev/bench.pl> for whole programs, F<tools/dev/bench_op.pir> for ops
+timed from PIR.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -10,22 +10,33 @@ $Id$
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
 PARROT_EXPORT
-int Parrot_alarm_check(ARGMOD(UINTVAL* last_serial))
+int Parrot_alarm_check(PARROT_INTERP, ARGMOD(UINTVAL* last_serial))
         __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
         FUNC_MODIFIES(* last_serial);
 
 PARROT_EXPORT
-void Parrot_alarm_set(FLOATVAL when);
+void Parrot_alarm_set(PARROT_INTERP, FLOATVAL when)
+        __attribute__nonnull__(1);
 
 PARROT_EXPORT
-void Parrot_alarm_wait_for_next_alarm(PARROT_INTERP);
+void Parrot_alarm_wait_for_next_alarm(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_alarm_clear(PARROT_INTERP)
+        __attribute__nonnull__(1);
 
 void Parrot_alarm_init(void);
 #define ASSERT_ARGS_Parrot_alarm_check __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(last_serial))
-#define ASSERT_ARGS_Parrot_alarm_set __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(last_serial))
+#define ASSERT_ARGS_Parrot_alarm_set __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_alarm_wait_for_next_alarm \
-     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_alarm_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_alarm_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/alarm.c */
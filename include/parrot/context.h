@@ -22,6 +22,23 @@ typedef union {
     INTVAL       *regs_i;
 } Regs_ni;
 
+/* Register frames released by dead contexts, kept for reuse.  Each slot
+ * holds a LIFO list of frames of one size, linked through their first word. */
+typedef struct _context_mem {
+    void    **free_list;                /* frames available for reuse */
+    UINTVAL  *n_free;                   /* number of frames in each slot */
+    UINTVAL   n_free_slots;             /* allocated slots in free_list */
+} context_mem;
+
+/* An exception handler pushed in a context but not turned into an
+ * ExceptionHandler PMC yet, see Parrot_cx_record_handler_local. */
+typedef struct Parrot_eh_record {
+    void                     *address;    /* handler code or Parrot_runloop */
+    struct PackFile_ByteCode *seg;        /* segment of the handler code */
+    INTVAL                    runloop_id; /* runloop that pushed the handler */
+    INTVAL                    flags;      /* SUB_FLAG_C_HANDLER or 0 */
+} Parrot_eh_record;
+
 #include "pmc/pmc_callcontext.h"
 
 typedef struct Parrot_CallContext_attributes Parrot_Context;
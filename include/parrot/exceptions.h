@@ -157,6 +157,15 @@ PARROT_CAN_RETURN_NULL
 PMC * Parrot_ex_get_current_handler(PARROT_INTERP, ARGIN_NULLOK(PMC *expmc))
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_ex_handler_can_handle(PARROT_INTERP,
+    ARGIN(PMC *handler),
+    ARGIN(PMC *exception))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_EXPORT
 void Parrot_ex_mark_unhandled(PARROT_INTERP, ARGIN(PMC *exception))
         __attribute__nonnull__(1)
@@ -176,6 +185,14 @@ opcode_t * Parrot_ex_rethrow_from_op(PARROT_INTERP, ARGIN(PMC *exception))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+opcode_t * Parrot_ex_throw_control_from_op(PARROT_INTERP,
+    INTVAL type,
+    ARGIN_NULLOK(PMC *payload),
+    ARGIN_NULLOK(void *dest))
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_DOES_NOT_RETURN
 PARROT_COLD
@@ -221,6 +238,12 @@ opcode_t * Parrot_ex_throw_from_op_args(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(4);
 
+PARROT_EXPORT
+void Parrot_ex_update_for_rethrow(PARROT_INTERP, ARGMOD(PMC * ex))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* ex);
+
 PARROT_DOES_NOT_RETURN
 PARROT_COLD
 void die_from_exception(PARROT_INTERP, ARGIN(PMC *exception))
@@ -247,6 +270,10 @@ void Parrot_print_backtrace(void);
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_ex_get_current_handler __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_ex_handler_can_handle __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handler) \
+    , PARROT_ASSERT_ARG(exception))
 #define ASSERT_ARGS_Parrot_ex_mark_unhandled __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(exception))
@@ -256,6 +283,9 @@ void Parrot_print_backtrace(void);
 #define ASSERT_ARGS_Parrot_ex_rethrow_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(exception))
+#define ASSERT_ARGS_Parrot_ex_throw_control_from_op \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_ex_throw_from_c __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(exception))
@@ -271,6 +301,9 @@ void Parrot_print_backtrace(void);
 #define ASSERT_ARGS_Parrot_ex_throw_from_op_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(format))
+#define ASSERT_ARGS_Parrot_ex_update_for_rethrow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ex))
 #define ASSERT_ARGS_die_from_exception __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(exception))
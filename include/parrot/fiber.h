@@ -0,0 +1,141 @@
+/* fiber.h
+ *  Copyright (C) 2026, Parrot Foundation.
+ *  Overview:
+ *     Fibers, the C stacks of their own that Tasks run on
+ *  Data Structure and Algorithms:
+ *     See src/fiber.c
+ */
+
+#ifndef PARROT_FIBER_H_GUARD
+#define PARROT_FIBER_H_GUARD
+
+#if defined(PARROT_HAS_HEADER_UCONTEXT) && !defined(_WIN32)
+#  define PARROT_HAS_FIBERS 1
+#  include <ucontext.h>
+#endif
+
+/* The C stack of a fiber, unless PARROT_FIBER_STACK_SIZE in the environment
+ * or the stack limit of the process says otherwise. The pages that are never
+ * touched don't cost any memory. */
+#define PARROT_FIBER_STACK_SIZE (8 * 1024 * 1024)
+
+/* The least a fiber gets, whatever the environment asks for */
+#define PARROT_FIBER_MIN_STACK_SIZE (64 * 1024)
+
+/* How many finished fibers are kept, stack and all, for the next tasks */
+#define PARROT_FIBER_MAX_SPARE 16
+
+typedef enum {
+    PARROT_FIBER_NEW,           /* not started yet */
+    PARROT_FIBER_RUNNING,       /* the interpreter runs on it */
+    PARROT_FIBER_SUSPENDED,     /* switched out, waiting to be resumed */
+    PARROT_FIBER_DONE           /* its code returned */
+} Parrot_fiber_state;
+
+typedef struct Parrot_fiber {
+    /* All the fibers with a stack of an interpreter, or its spare ones */
+    struct Parrot_fiber *prev;
+    struct Parrot_fiber *next;
+
+    Interp  *interp;
+    PMC     *code;              /* invoked with data when the fiber starts */
+    PMC     *data;
+    PMC     *exception;         /* what left the code unhandled, or NULL */
+
+    char    *stack;             /* NULL for the stack of the thread itself */
+    size_t   stack_size;
+    void    *stack_ptr;         /* how deep the stack was when switched out */
+    Parrot_fiber_state state;
+
+    /* The state of the interpreter belonging to the fiber, kept here
+     * while the fiber is switched out */
+    PMC                     *ctx;
+    PackFile_ByteCode       *code_seg;
+    struct parrot_runloop_t *runloop;
+    int                      runloop_level;
+    int                      runloop_id;
+
+#ifdef PARROT_HAS_FIBERS
+    ucontext_t regs;
+#endif
+} Parrot_fiber;
+
+/* The fibers of an interpreter, made when it starts its first one */
+typedef struct Parrot_fiber_set {
+    Parrot_fiber  thread;       /* the stack of the thread itself */
+    Parrot_fiber *current;      /* the fiber running, NULL on the thread's stack */
+    Parrot_fiber *live;         /* the started fibers and those to start */
+    Parrot_fiber *spare;        /* finished fibers, kept for their stacks */
+    INTVAL        num_spare;
+    size_t        stack_size;   /* of every fiber of the interpreter */
+    size_t        guard_size;   /* the inaccessible pages below each stack */
+} Parrot_fiber_set;
+
+/* The fiber the interpreter runs on, or NULL on the thread's own stack */
+#define Parrot_fiber_current(interp) \
+    ((interp)->fibers ? (interp)->fibers->current : NULL)
+
+/* HEADERIZER BEGIN: src/fiber.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_fiber_exception(ARGIN(const Parrot_fiber *fiber))
+        __attribute__nonnull__(1);
+
+void Parrot_fiber_finish(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_fiber_free(PARROT_INTERP, ARGFREE(Parrot_fiber *fiber))
+        __attribute__nonnull__(1);
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_fiber_is_done(ARGIN(const Parrot_fiber *fiber))
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+Parrot_fiber * Parrot_fiber_new(PARROT_INTERP,
+    ARGIN(PMC *code),
+    ARGIN(PMC *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+void Parrot_fiber_resume(PARROT_INTERP, ARGMOD(Parrot_fiber *fiber))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*fiber);
+
+void Parrot_fiber_suspend(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_fiber_exception __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(fiber))
+#define ASSERT_ARGS_Parrot_fiber_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_fiber_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_fiber_is_done __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(fiber))
+#define ASSERT_ARGS_Parrot_fiber_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_fiber_resume __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(fiber))
+#define ASSERT_ARGS_Parrot_fiber_suspend __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/fiber.c */
+
+#endif /* PARROT_FIBER_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
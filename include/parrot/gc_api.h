@@ -139,6 +139,34 @@ typedef enum {
                                                       mem_alloc to sweep dead strings */
                                                    /* garbage collect. */
 
+/* GC phases timed by the telemetry, see Parrot_gc_phase_histogram */
+typedef enum {
+    PARROT_GC_PHASE_MARK,
+    PARROT_GC_PHASE_SWEEP,
+    PARROT_GC_PHASE_COMPACT,
+    PARROT_GC_PHASES
+} Parrot_gc_phase;
+
+/* Bucket N of a phase histogram counts durations below 2^N microseconds
+ * (and at least 2^(N-1) microseconds), the last one everything longer */
+#define PARROT_GC_HISTOGRAM_BUCKETS 32
+
+/* Generations reported in a GC event, GC_MAX_GENERATIONS can't exceed it */
+#define PARROT_GC_EVENT_GENERATIONS 8
+
+/* One collection as recorded by the GC telemetry */
+typedef struct Parrot_GC_event {
+    UINTVAL  cycle;         /* sequence number, starting at 0 */
+    INTVAL   generation;    /* oldest generation collected */
+    FLOATVAL start;         /* seconds on the high resolution timer */
+    FLOATVAL end;
+    FLOATVAL phase[PARROT_GC_PHASES];   /* seconds spent in each phase */
+    size_t   promoted;      /* bytes moved into an older generation */
+    size_t   memory_used;   /* after the collection */
+    /* live headers found in each collected generation */
+    size_t   survivors[PARROT_GC_EVENT_GENERATIONS];
+} Parrot_GC_event;
+
 /* HEADERIZER BEGIN: src/gc/api.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -205,6 +233,12 @@ void Parrot_gc_allocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_gc_allocation_sites(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_compact_memory_pool(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -233,6 +267,16 @@ void Parrot_gc_destroy_child_interp(
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*dest_interp);
 
+PARROT_EXPORT
+UINTVAL Parrot_gc_event_count(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_gc_events(PARROT_INTERP, UINTVAL since)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_finalize(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -273,6 +317,12 @@ void Parrot_gc_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*s);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const Parrot_GC_event * Parrot_gc_get_event(PARROT_INTERP, UINTVAL cycle)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 size_t Parrot_gc_headers_alloc_since_last_collect(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -333,6 +383,13 @@ PARROT_WARN_UNUSED_RESULT
 STRING * Parrot_gc_new_string_header(PARROT_INTERP, UINTVAL flags)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const UINTVAL * Parrot_gc_phase_histogram(PARROT_INTERP,
+    Parrot_gc_phase phase)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_gc_pmc_needs_early_collection(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
@@ -370,6 +427,10 @@ void Parrot_gc_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+PARROT_EXPORT
+void Parrot_gc_sample_allocations(PARROT_INTERP, UINTVAL rate)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 STRING * Parrot_gc_sys_name(PARROT_INTERP)
@@ -462,6 +523,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_Parrot_gc_allocation_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_compact_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_completely_unblock __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -477,6 +540,10 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(dest_interp) \
     , PARROT_ASSERT_ARG(source_interp))
+#define ASSERT_ARGS_Parrot_gc_event_count __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_events __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_finalize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_free_bufferlike_header \
@@ -497,6 +564,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_gc_free_string_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_Parrot_gc_get_event __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_headers_alloc_since_last_collect \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -527,6 +596,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_new_string_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_phase_histogram __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -545,6 +616,8 @@ void Parrot_unblock_GC_sweep(PARROT_INTERP)
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_Parrot_gc_sample_allocations __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_sys_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_gc_total_copied __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
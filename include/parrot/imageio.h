@@ -17,12 +17,28 @@
 /* preallocate freeze image for aggregates with this estimation */
 #define FREEZE_BYTES_PER_ITEM 9
 
+/* largest chunk buffered before a streaming freeze writes it to its handle */
+#define FREEZE_STREAM_CHUNK 65536
+
 enum {
     enum_PackID_normal      = 0,
     enum_PackID_seen        = 1,
     enum_PackID_pbc_backref = 2
 };
 
+/* header word of a push_raw block: the element count and, in the 2 LSBs,
+ * the encoding of the elements that follow
+ */
+#define PackRaw_new(count, enc)     (((UINTVAL)(count) * 4) | ((UINTVAL)(enc) & 3))
+#define PackRaw_get_COUNT(hdr)      ((UINTVAL)(hdr) / 4)
+#define PackRaw_get_ENCODING(hdr)   ((UINTVAL)(hdr) & 3)
+
+enum {
+    enum_PackRaw_native     = 0,    /* INTVAL/FLOATVAL words, as push_integer/push_float */
+    enum_PackRaw_varint     = 1,    /* zigzag LEB128 integers, see PF_store_varints */
+    enum_PackRaw_bytes      = 2     /* bytes padded to a whole opcode_t */
+};
+
 #endif /* PARROT_IMAGEIO_H_GUARD */
 
 /*
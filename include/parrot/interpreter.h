@@ -79,6 +79,7 @@ typedef enum { /* sync with compilers/imcc/imc.h */
     PARROT_IMCC_OPT_PRE             = 0x001,  /* -O1 */
     PARROT_IMCC_OPT_CFG             = 0x002,  /* -O2 */
     PARROT_IMCC_OPT_SUB             = 0x004,  /* -Oc */
+    PARROT_IMCC_OPT_LOOP            = 0x008,  /* -O3 */
     PARROT_IMCC_OPT_PASM            = 0x100,  /* -Op */
 } Parrot_imcc_opt_flags;
 
@@ -93,7 +94,8 @@ typedef enum {
     PARROT_PROFILING_CORE   = 0x160,        /* used by parrot debugger */
     PARROT_SUBPROF_SUB_CORE = 0x200,        /* sub profiler core, sub mode */
     PARROT_SUBPROF_HLL_CORE = 0x201,        /* sub profiler core, hll mode */
-    PARROT_SUBPROF_OPS_CORE = 0x202         /* sub profiler core, ops mode */
+    PARROT_SUBPROF_OPS_CORE = 0x202,        /* sub profiler core, ops mode */
+    PARROT_SAMPLING_CORE    = 0x300         /* sampling profiler core */
 } Parrot_Run_core_t;
 /* &end_gen */
 
@@ -192,6 +194,7 @@ struct _handler_node_t; /* forward def - exit.h */
 /* The actual interpreter structure */
 struct parrot_interp_t {
     PMC                 *ctx;                 /* current Context */
+    context_mem          ctx_mem;             /* recycled register frames */
 
     struct GC_Subsystem *gc_sys;              /* functions and data specific
                                                  to current GC subsystem*/
@@ -258,6 +261,8 @@ struct parrot_interp_t {
     PMC *HLL_entries;                         /* ResizablePMCArray */
 
     PMC *root_namespace;                      /* namespace hash */
+    UINTVAL ns_stamp;                         /* last NameSpace modification stamp */
+    struct Parrot_ns_cache_table *ns_caches;  /* global lookup caches per code segment */
     PMC *scheduler;                           /* concurrency scheduler */
     PMC *cur_task;
 
@@ -278,7 +283,12 @@ struct parrot_interp_t {
     int current_runloop_id;
     int runloop_id_counter;                   /* for synthesizing runloop ids. */
 
+    struct Parrot_fiber_set *fibers;          /* C stacks of the tasks, see fiber.c */
+
     UINTVAL              last_alarm;          /* has an alarm triggered? */
+    volatile UINTVAL     alarm_serial;        /* bumped when our alarm fires */
+    FLOATVAL             alarm_time;          /* our pending alarm, 0 if none */
+    struct parrot_interp_t *alarm_next;       /* next interp with an alarm */
     FLOATVAL             quantum_done;        /* expiration of current quantum */
 
     struct _Thread_data *thread_data;         /* thread specific items */
@@ -0,0 +1,87 @@
+/* mailbox.h
+ *  Copyright (C) 2026, Parrot Foundation.
+ *  Overview:
+ *     The multi-producer, single-consumer message queue of a Task
+ *  Data Structure and Algorithms:
+ *     See src/mailbox.c
+ */
+
+#ifndef PARROT_MAILBOX_H_GUARD
+#define PARROT_MAILBOX_H_GUARD
+
+/* A message pushed by a sender, waiting for the receiver to take it */
+typedef struct Parrot_mailbox_node {
+    struct Parrot_mailbox_node *next;
+    PMC                        *message;
+} Parrot_mailbox_node;
+
+typedef struct Parrot_mailbox {
+    /* The newest message first, pushed by any thread with a CAS and taken
+     * as a whole by the receiver */
+    Parrot_atomic_pointer inbox;
+
+    /* The messages taken from the inbox, oldest first. Only the receiver
+     * moves batch_read; batch_size and the slots change under lock. */
+    PMC         **batch;
+    UINTVAL       batch_read;
+    UINTVAL       batch_size;
+    UINTVAL       batch_alloc;
+
+    /* Taken to refill the batch, to mark, and to decide whether to block
+     * the receiver or to wake it up */
+    Parrot_mutex  lock;
+} Parrot_mailbox;
+
+/* HEADERIZER BEGIN: src/mailbox.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_mailbox_destroy(ARGFREE(Parrot_mailbox *mailbox));
+PARROT_WARN_UNUSED_RESULT
+int Parrot_mailbox_is_empty(ARGMOD(Parrot_mailbox *mailbox))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*mailbox);
+
+void Parrot_mailbox_mark(PARROT_INTERP, ARGMOD(Parrot_mailbox *mailbox))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*mailbox);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_mailbox * Parrot_mailbox_new(void);
+
+int Parrot_mailbox_push(
+    ARGMOD(Parrot_mailbox *mailbox),
+    ARGIN(PMC *message))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*mailbox);
+
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_mailbox_shift(ARGMOD(Parrot_mailbox *mailbox))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*mailbox);
+
+#define ASSERT_ARGS_Parrot_mailbox_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_mailbox_is_empty __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(mailbox))
+#define ASSERT_ARGS_Parrot_mailbox_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mailbox))
+#define ASSERT_ARGS_Parrot_mailbox_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_mailbox_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(mailbox) \
+    , PARROT_ASSERT_ARG(message))
+#define ASSERT_ARGS_Parrot_mailbox_shift __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(mailbox))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/mailbox.c */
+
+#endif /* PARROT_MAILBOX_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
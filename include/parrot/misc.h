@@ -33,6 +33,11 @@
 
 typedef int (*reg_move_func)(PARROT_INTERP, unsigned char d, unsigned char s, void *);
 
+/* flags for the Parrot_util_sort_* functions */
+typedef enum {
+    PARROT_SORT_STABLE = 1 << 0     /* keep equal elements in their order */
+} Parrot_sort_flags;
+
 /* HEADERIZER BEGIN: src/utils.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -90,17 +95,6 @@ PARROT_CONST_FUNCTION
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_util_intval_mod(INTVAL i2, INTVAL i3);
 
-void Parrot_util_quicksort(PARROT_INTERP,
-    ARGMOD(void **data),
-    UINTVAL n,
-    ARGIN(PMC *cmp),
-    ARGIN(const char * cmp_signature))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(4)
-        __attribute__nonnull__(5)
-        FUNC_MODIFIES(*data);
-
 #define ASSERT_ARGS_Parrot_util_byte_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(base) \
     , PARROT_ASSERT_ARG(search))
@@ -117,13 +111,75 @@ void Parrot_util_quicksort(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_util_uint_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_floatval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_intval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_Parrot_util_quicksort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/utils.c */
+
+/* HEADERIZER BEGIN: src/sort.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_util_sort_floatvals(PARROT_INTERP,
+    ARGMOD(FLOATVAL *data),
+    size_t n,
+    ARGIN_NULLOK(PMC *cmp),
+    INTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_intvals(PARROT_INTERP,
+    ARGMOD(INTVAL *data),
+    size_t n,
+    ARGIN_NULLOK(PMC *cmp),
+    INTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_pmcs(PARROT_INTERP,
+    ARGMOD(PMC **data),
+    size_t n,
+    ARGIN_NULLOK(PMC *cmp),
+    INTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_pmcs_by_key(PARROT_INTERP,
+    ARGMOD(PMC **data),
+    size_t n,
+    ARGIN(PMC *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_strings(PARROT_INTERP,
+    ARGMOD(STRING **data),
+    size_t n,
+    ARGIN_NULLOK(PMC *cmp),
+    INTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+#define ASSERT_ARGS_Parrot_util_sort_floatvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_util_sort_intvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_util_sort_pmcs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_util_sort_pmcs_by_key __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(data) \
-    , PARROT_ASSERT_ARG(cmp) \
-    , PARROT_ASSERT_ARG(cmp_signature))
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_Parrot_util_sort_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
-/* HEADERIZER END: src/utils.c */
+/* HEADERIZER END: src/sort.c */
 
 #endif /* PARROT_MISC_H_GUARD */
 
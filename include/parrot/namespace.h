@@ -11,6 +11,24 @@
 #ifndef PARROT_GLOBAL_H_GUARD
 #define PARROT_GLOBAL_H_GUARD
 
+/* A global lookup cached by a get_*global_ic op. It is valid as long as
+ * the base namespace still has the stamp it had when the lookup was done. */
+typedef struct Parrot_ns_cache_entry {
+    PMC     *ns;        /* base namespace */
+    PMC     *key;       /* key of the nested namespace or PMCNULL */
+    STRING  *name;      /* name of the global */
+    UINTVAL  stamp;     /* modification stamp of ns */
+    PMC     *value;     /* the global found */
+} Parrot_ns_cache_entry;
+
+/* The global lookup caches of one code segment in one interpreter */
+typedef struct Parrot_ns_cache_table {
+    struct Parrot_ns_cache_table   *next;
+    const struct PackFile_ByteCode *seg;
+    Parrot_ns_cache_entry          *entries;
+    size_t                          n_entries;
+} Parrot_ns_cache_table;
+
 /* HEADERIZER BEGIN: src/namespace.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -21,6 +39,16 @@ PMC * Parrot_ns_find_current_namespace_global(PARROT_INTERP,
     ARGIN_NULLOK(STRING *globalname))
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_ns_find_global_cached(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *ns),
+    ARGIN_NULLOK(PMC *key),
+    ARGIN_NULLOK(STRING *globalname),
+    INTVAL slot)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
@@ -135,9 +163,19 @@ void Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+void Parrot_ns_destroy_caches(PARROT_INTERP,
+    ARGIN_NULLOK(const PackFile_ByteCode *seg))
+        __attribute__nonnull__(1);
+
+void Parrot_ns_modified(PARROT_INTERP, ARGIN(PMC *ns))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_Parrot_ns_find_current_namespace_global \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_ns_find_global_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_ns_find_global_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ns))
@@ -185,6 +223,11 @@ void Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 #define ASSERT_ARGS_Parrot_ns_store_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_Parrot_ns_destroy_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_ns_modified __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ns))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/namespace.c */
 
@@ -697,6 +697,8 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_freeze_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_thaw_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_thaw_p_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_freeze_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_thaw_p_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_s_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_sc_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_s_sc_p(opcode_t *, PARROT_INTERP);
@@ -1017,6 +1019,17 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_find_lex_i_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_lex_n_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_lex_n_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_idx_p_sc_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_idx_s_sc_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_idx_i_sc_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_idx_n_sc_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_p_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_s_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_sc_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_i_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_ic_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_n_pc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_idx_sc_nc_pc_ic_ic(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_dynamic_lex_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_dynamic_lex_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_caller_lex_p_s(opcode_t *, PARROT_INTERP);
@@ -1048,6 +1061,12 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_get_root_global_p_pc_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_get_root_global_p_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_get_root_global_p_pc_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_global_ic_p_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_global_ic_p_pc_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_hll_global_ic_p_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_hll_global_ic_p_pc_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_root_global_ic_p_sc_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_get_root_global_ic_p_pc_sc_ic(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_set_global_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_set_global_sc_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_set_global_p_s_p(opcode_t *, PARROT_INTERP);
@@ -1151,6 +1170,13 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_disable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_enable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_terminate(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_throw_control_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_throw_control_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_throw_control_i_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_throw_control_ic_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_resume_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_yield_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_share_ro_p_p(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -691,460 +691,486 @@ typedef enum {
     PARROT_OP_freeze_s_p,                      /* 674 */
     PARROT_OP_thaw_p_s,                        /* 675 */
     PARROT_OP_thaw_p_sc,                       /* 676 */
-    PARROT_OP_add_multi_s_s_p,                 /* 677 */
-    PARROT_OP_add_multi_sc_s_p,                /* 678 */
-    PARROT_OP_add_multi_s_sc_p,                /* 679 */
-    PARROT_OP_add_multi_sc_sc_p,               /* 680 */
-    PARROT_OP_find_multi_p_s_s,                /* 681 */
-    PARROT_OP_find_multi_p_sc_s,               /* 682 */
-    PARROT_OP_find_multi_p_s_sc,               /* 683 */
-    PARROT_OP_find_multi_p_sc_sc,              /* 684 */
-    PARROT_OP_register_p,                      /* 685 */
-    PARROT_OP_unregister_p,                    /* 686 */
-    PARROT_OP_box_p_i,                         /* 687 */
-    PARROT_OP_box_p_ic,                        /* 688 */
-    PARROT_OP_box_p_n,                         /* 689 */
-    PARROT_OP_box_p_nc,                        /* 690 */
-    PARROT_OP_box_p_s,                         /* 691 */
-    PARROT_OP_box_p_sc,                        /* 692 */
-    PARROT_OP_iter_p_p,                        /* 693 */
-    PARROT_OP_morph_p_p,                       /* 694 */
-    PARROT_OP_morph_p_pc,                      /* 695 */
-    PARROT_OP_clone_s_s,                       /* 696 */
-    PARROT_OP_clone_s_sc,                      /* 697 */
-    PARROT_OP_set_i_i,                         /* 698 */
-    PARROT_OP_set_i_ic,                        /* 699 */
-    PARROT_OP_set_i_n,                         /* 700 */
-    PARROT_OP_set_i_nc,                        /* 701 */
-    PARROT_OP_set_i_s,                         /* 702 */
-    PARROT_OP_set_i_sc,                        /* 703 */
-    PARROT_OP_set_n_n,                         /* 704 */
-    PARROT_OP_set_n_nc,                        /* 705 */
-    PARROT_OP_set_n_i,                         /* 706 */
-    PARROT_OP_set_n_ic,                        /* 707 */
-    PARROT_OP_set_n_s,                         /* 708 */
-    PARROT_OP_set_n_sc,                        /* 709 */
-    PARROT_OP_set_n_p,                         /* 710 */
-    PARROT_OP_set_s_p,                         /* 711 */
-    PARROT_OP_set_s_s,                         /* 712 */
-    PARROT_OP_set_s_sc,                        /* 713 */
-    PARROT_OP_set_s_i,                         /* 714 */
-    PARROT_OP_set_s_ic,                        /* 715 */
-    PARROT_OP_set_s_n,                         /* 716 */
-    PARROT_OP_set_s_nc,                        /* 717 */
-    PARROT_OP_set_p_pc,                        /* 718 */
-    PARROT_OP_set_p_p,                         /* 719 */
-    PARROT_OP_set_p_i,                         /* 720 */
-    PARROT_OP_set_p_ic,                        /* 721 */
-    PARROT_OP_set_p_n,                         /* 722 */
-    PARROT_OP_set_p_nc,                        /* 723 */
-    PARROT_OP_set_p_s,                         /* 724 */
-    PARROT_OP_set_p_sc,                        /* 725 */
-    PARROT_OP_set_i_p,                         /* 726 */
-    PARROT_OP_assign_p_p,                      /* 727 */
-    PARROT_OP_assign_p_i,                      /* 728 */
-    PARROT_OP_assign_p_ic,                     /* 729 */
-    PARROT_OP_assign_p_n,                      /* 730 */
-    PARROT_OP_assign_p_nc,                     /* 731 */
-    PARROT_OP_assign_p_s,                      /* 732 */
-    PARROT_OP_assign_p_sc,                     /* 733 */
-    PARROT_OP_assign_s_s,                      /* 734 */
-    PARROT_OP_assign_s_sc,                     /* 735 */
-    PARROT_OP_setref_p_p,                      /* 736 */
-    PARROT_OP_deref_p_p,                       /* 737 */
-    PARROT_OP_set_p_ki_i,                      /* 738 */
-    PARROT_OP_set_p_kic_i,                     /* 739 */
-    PARROT_OP_set_p_ki_ic,                     /* 740 */
-    PARROT_OP_set_p_kic_ic,                    /* 741 */
-    PARROT_OP_set_p_ki_n,                      /* 742 */
-    PARROT_OP_set_p_kic_n,                     /* 743 */
-    PARROT_OP_set_p_ki_nc,                     /* 744 */
-    PARROT_OP_set_p_kic_nc,                    /* 745 */
-    PARROT_OP_set_p_ki_s,                      /* 746 */
-    PARROT_OP_set_p_kic_s,                     /* 747 */
-    PARROT_OP_set_p_ki_sc,                     /* 748 */
-    PARROT_OP_set_p_kic_sc,                    /* 749 */
-    PARROT_OP_set_p_ki_p,                      /* 750 */
-    PARROT_OP_set_p_kic_p,                     /* 751 */
-    PARROT_OP_set_i_p_ki,                      /* 752 */
-    PARROT_OP_set_i_p_kic,                     /* 753 */
-    PARROT_OP_set_n_p_ki,                      /* 754 */
-    PARROT_OP_set_n_p_kic,                     /* 755 */
-    PARROT_OP_set_s_p_ki,                      /* 756 */
-    PARROT_OP_set_s_p_kic,                     /* 757 */
-    PARROT_OP_set_p_p_ki,                      /* 758 */
-    PARROT_OP_set_p_p_kic,                     /* 759 */
-    PARROT_OP_set_p_k_i,                       /* 760 */
-    PARROT_OP_set_p_kc_i,                      /* 761 */
-    PARROT_OP_set_p_k_ic,                      /* 762 */
-    PARROT_OP_set_p_kc_ic,                     /* 763 */
-    PARROT_OP_set_p_k_n,                       /* 764 */
-    PARROT_OP_set_p_kc_n,                      /* 765 */
-    PARROT_OP_set_p_k_nc,                      /* 766 */
-    PARROT_OP_set_p_kc_nc,                     /* 767 */
-    PARROT_OP_set_p_k_s,                       /* 768 */
-    PARROT_OP_set_p_kc_s,                      /* 769 */
-    PARROT_OP_set_p_k_sc,                      /* 770 */
-    PARROT_OP_set_p_kc_sc,                     /* 771 */
-    PARROT_OP_set_p_k_p,                       /* 772 */
-    PARROT_OP_set_p_kc_p,                      /* 773 */
-    PARROT_OP_set_i_p_k,                       /* 774 */
-    PARROT_OP_set_i_p_kc,                      /* 775 */
-    PARROT_OP_set_n_p_k,                       /* 776 */
-    PARROT_OP_set_n_p_kc,                      /* 777 */
-    PARROT_OP_set_s_p_k,                       /* 778 */
-    PARROT_OP_set_s_p_kc,                      /* 779 */
-    PARROT_OP_set_p_p_k,                       /* 780 */
-    PARROT_OP_set_p_p_kc,                      /* 781 */
-    PARROT_OP_clone_p_p,                       /* 782 */
-    PARROT_OP_clone_p_p_p,                     /* 783 */
-    PARROT_OP_clone_p_p_pc,                    /* 784 */
-    PARROT_OP_copy_p_p,                        /* 785 */
-    PARROT_OP_null_s,                          /* 786 */
-    PARROT_OP_null_i,                          /* 787 */
-    PARROT_OP_null_p,                          /* 788 */
-    PARROT_OP_null_n,                          /* 789 */
-    PARROT_OP_ord_i_s,                         /* 790 */
-    PARROT_OP_ord_i_sc,                        /* 791 */
-    PARROT_OP_ord_i_s_i,                       /* 792 */
-    PARROT_OP_ord_i_sc_i,                      /* 793 */
-    PARROT_OP_ord_i_s_ic,                      /* 794 */
-    PARROT_OP_ord_i_sc_ic,                     /* 795 */
-    PARROT_OP_chr_s_i,                         /* 796 */
-    PARROT_OP_chr_s_ic,                        /* 797 */
-    PARROT_OP_chopn_s_s_i,                     /* 798 */
-    PARROT_OP_chopn_s_sc_i,                    /* 799 */
-    PARROT_OP_chopn_s_s_ic,                    /* 800 */
-    PARROT_OP_chopn_s_sc_ic,                   /* 801 */
-    PARROT_OP_concat_p_p,                      /* 802 */
-    PARROT_OP_concat_p_s,                      /* 803 */
-    PARROT_OP_concat_p_sc,                     /* 804 */
-    PARROT_OP_concat_s_s_s,                    /* 805 */
-    PARROT_OP_concat_s_sc_s,                   /* 806 */
-    PARROT_OP_concat_s_s_sc,                   /* 807 */
-    PARROT_OP_concat_p_p_s,                    /* 808 */
-    PARROT_OP_concat_p_p_sc,                   /* 809 */
-    PARROT_OP_concat_p_p_p,                    /* 810 */
-    PARROT_OP_repeat_s_s_i,                    /* 811 */
-    PARROT_OP_repeat_s_sc_i,                   /* 812 */
-    PARROT_OP_repeat_s_s_ic,                   /* 813 */
-    PARROT_OP_repeat_s_sc_ic,                  /* 814 */
-    PARROT_OP_repeat_p_p_i,                    /* 815 */
-    PARROT_OP_repeat_p_p_ic,                   /* 816 */
-    PARROT_OP_repeat_p_p_p,                    /* 817 */
-    PARROT_OP_repeat_p_i,                      /* 818 */
-    PARROT_OP_repeat_p_ic,                     /* 819 */
-    PARROT_OP_repeat_p_p,                      /* 820 */
-    PARROT_OP_length_i_s,                      /* 821 */
-    PARROT_OP_length_i_sc,                     /* 822 */
-    PARROT_OP_bytelength_i_s,                  /* 823 */
-    PARROT_OP_bytelength_i_sc,                 /* 824 */
-    PARROT_OP_pin_s,                           /* 825 */
-    PARROT_OP_unpin_s,                         /* 826 */
-    PARROT_OP_substr_s_s_i,                    /* 827 */
-    PARROT_OP_substr_s_sc_i,                   /* 828 */
-    PARROT_OP_substr_s_s_ic,                   /* 829 */
-    PARROT_OP_substr_s_sc_ic,                  /* 830 */
-    PARROT_OP_substr_s_s_i_i,                  /* 831 */
-    PARROT_OP_substr_s_sc_i_i,                 /* 832 */
-    PARROT_OP_substr_s_s_ic_i,                 /* 833 */
-    PARROT_OP_substr_s_sc_ic_i,                /* 834 */
-    PARROT_OP_substr_s_s_i_ic,                 /* 835 */
-    PARROT_OP_substr_s_sc_i_ic,                /* 836 */
-    PARROT_OP_substr_s_s_ic_ic,                /* 837 */
-    PARROT_OP_substr_s_sc_ic_ic,               /* 838 */
-    PARROT_OP_substr_s_p_i_i,                  /* 839 */
-    PARROT_OP_substr_s_p_ic_i,                 /* 840 */
-    PARROT_OP_substr_s_p_i_ic,                 /* 841 */
-    PARROT_OP_substr_s_p_ic_ic,                /* 842 */
-    PARROT_OP_replace_s_s_i_i_s,               /* 843 */
-    PARROT_OP_replace_s_sc_i_i_s,              /* 844 */
-    PARROT_OP_replace_s_s_ic_i_s,              /* 845 */
-    PARROT_OP_replace_s_sc_ic_i_s,             /* 846 */
-    PARROT_OP_replace_s_s_i_ic_s,              /* 847 */
-    PARROT_OP_replace_s_sc_i_ic_s,             /* 848 */
-    PARROT_OP_replace_s_s_ic_ic_s,             /* 849 */
-    PARROT_OP_replace_s_sc_ic_ic_s,            /* 850 */
-    PARROT_OP_replace_s_s_i_i_sc,              /* 851 */
-    PARROT_OP_replace_s_sc_i_i_sc,             /* 852 */
-    PARROT_OP_replace_s_s_ic_i_sc,             /* 853 */
-    PARROT_OP_replace_s_sc_ic_i_sc,            /* 854 */
-    PARROT_OP_replace_s_s_i_ic_sc,             /* 855 */
-    PARROT_OP_replace_s_sc_i_ic_sc,            /* 856 */
-    PARROT_OP_replace_s_s_ic_ic_sc,            /* 857 */
-    PARROT_OP_replace_s_sc_ic_ic_sc,           /* 858 */
-    PARROT_OP_index_i_s_s,                     /* 859 */
-    PARROT_OP_index_i_sc_s,                    /* 860 */
-    PARROT_OP_index_i_s_sc,                    /* 861 */
-    PARROT_OP_index_i_sc_sc,                   /* 862 */
-    PARROT_OP_index_i_s_s_i,                   /* 863 */
-    PARROT_OP_index_i_sc_s_i,                  /* 864 */
-    PARROT_OP_index_i_s_sc_i,                  /* 865 */
-    PARROT_OP_index_i_sc_sc_i,                 /* 866 */
-    PARROT_OP_index_i_s_s_ic,                  /* 867 */
-    PARROT_OP_index_i_sc_s_ic,                 /* 868 */
-    PARROT_OP_index_i_s_sc_ic,                 /* 869 */
-    PARROT_OP_index_i_sc_sc_ic,                /* 870 */
-    PARROT_OP_rindex_i_s_s,                    /* 871 */
-    PARROT_OP_rindex_i_sc_s,                   /* 872 */
-    PARROT_OP_rindex_i_s_sc,                   /* 873 */
-    PARROT_OP_rindex_i_sc_sc,                  /* 874 */
-    PARROT_OP_rindex_i_s_s_i,                  /* 875 */
-    PARROT_OP_rindex_i_sc_s_i,                 /* 876 */
-    PARROT_OP_rindex_i_s_sc_i,                 /* 877 */
-    PARROT_OP_rindex_i_sc_sc_i,                /* 878 */
-    PARROT_OP_rindex_i_s_s_ic,                 /* 879 */
-    PARROT_OP_rindex_i_sc_s_ic,                /* 880 */
-    PARROT_OP_rindex_i_s_sc_ic,                /* 881 */
-    PARROT_OP_rindex_i_sc_sc_ic,               /* 882 */
-    PARROT_OP_sprintf_s_s_p,                   /* 883 */
-    PARROT_OP_sprintf_s_sc_p,                  /* 884 */
-    PARROT_OP_sprintf_p_p_p,                   /* 885 */
-    PARROT_OP_new_s,                           /* 886 */
-    PARROT_OP_stringinfo_i_s_i,                /* 887 */
-    PARROT_OP_stringinfo_i_sc_i,               /* 888 */
-    PARROT_OP_stringinfo_i_s_ic,               /* 889 */
-    PARROT_OP_stringinfo_i_sc_ic,              /* 890 */
-    PARROT_OP_upcase_s_s,                      /* 891 */
-    PARROT_OP_upcase_s_sc,                     /* 892 */
-    PARROT_OP_downcase_s_s,                    /* 893 */
-    PARROT_OP_downcase_s_sc,                   /* 894 */
-    PARROT_OP_titlecase_s_s,                   /* 895 */
-    PARROT_OP_titlecase_s_sc,                  /* 896 */
-    PARROT_OP_foldcase_s_s,                    /* 897 */
-    PARROT_OP_foldcase_s_sc,                   /* 898 */
-    PARROT_OP_join_s_s_p,                      /* 899 */
-    PARROT_OP_join_s_sc_p,                     /* 900 */
-    PARROT_OP_split_p_s_s,                     /* 901 */
-    PARROT_OP_split_p_sc_s,                    /* 902 */
-    PARROT_OP_split_p_s_sc,                    /* 903 */
-    PARROT_OP_split_p_sc_sc,                   /* 904 */
-    PARROT_OP_encoding_i_s,                    /* 905 */
-    PARROT_OP_encoding_i_sc,                   /* 906 */
-    PARROT_OP_encodingname_s_i,                /* 907 */
-    PARROT_OP_encodingname_s_ic,               /* 908 */
-    PARROT_OP_find_encoding_i_s,               /* 909 */
-    PARROT_OP_find_encoding_i_sc,              /* 910 */
-    PARROT_OP_trans_encoding_s_s_i,            /* 911 */
-    PARROT_OP_trans_encoding_s_sc_i,           /* 912 */
-    PARROT_OP_trans_encoding_s_s_ic,           /* 913 */
-    PARROT_OP_trans_encoding_s_sc_ic,          /* 914 */
-    PARROT_OP_is_cclass_i_i_s_i,               /* 915 */
-    PARROT_OP_is_cclass_i_ic_s_i,              /* 916 */
-    PARROT_OP_is_cclass_i_i_sc_i,              /* 917 */
-    PARROT_OP_is_cclass_i_ic_sc_i,             /* 918 */
-    PARROT_OP_is_cclass_i_i_s_ic,              /* 919 */
-    PARROT_OP_is_cclass_i_ic_s_ic,             /* 920 */
-    PARROT_OP_is_cclass_i_i_sc_ic,             /* 921 */
-    PARROT_OP_is_cclass_i_ic_sc_ic,            /* 922 */
-    PARROT_OP_find_cclass_i_i_s_i_i,           /* 923 */
-    PARROT_OP_find_cclass_i_ic_s_i_i,          /* 924 */
-    PARROT_OP_find_cclass_i_i_sc_i_i,          /* 925 */
-    PARROT_OP_find_cclass_i_ic_sc_i_i,         /* 926 */
-    PARROT_OP_find_cclass_i_i_s_ic_i,          /* 927 */
-    PARROT_OP_find_cclass_i_ic_s_ic_i,         /* 928 */
-    PARROT_OP_find_cclass_i_i_sc_ic_i,         /* 929 */
-    PARROT_OP_find_cclass_i_ic_sc_ic_i,        /* 930 */
-    PARROT_OP_find_cclass_i_i_s_i_ic,          /* 931 */
-    PARROT_OP_find_cclass_i_ic_s_i_ic,         /* 932 */
-    PARROT_OP_find_cclass_i_i_sc_i_ic,         /* 933 */
-    PARROT_OP_find_cclass_i_ic_sc_i_ic,        /* 934 */
-    PARROT_OP_find_cclass_i_i_s_ic_ic,         /* 935 */
-    PARROT_OP_find_cclass_i_ic_s_ic_ic,        /* 936 */
-    PARROT_OP_find_cclass_i_i_sc_ic_ic,        /* 937 */
-    PARROT_OP_find_cclass_i_ic_sc_ic_ic,       /* 938 */
-    PARROT_OP_find_not_cclass_i_i_s_i_i,       /* 939 */
-    PARROT_OP_find_not_cclass_i_ic_s_i_i,      /* 940 */
-    PARROT_OP_find_not_cclass_i_i_sc_i_i,      /* 941 */
-    PARROT_OP_find_not_cclass_i_ic_sc_i_i,     /* 942 */
-    PARROT_OP_find_not_cclass_i_i_s_ic_i,      /* 943 */
-    PARROT_OP_find_not_cclass_i_ic_s_ic_i,     /* 944 */
-    PARROT_OP_find_not_cclass_i_i_sc_ic_i,     /* 945 */
-    PARROT_OP_find_not_cclass_i_ic_sc_ic_i,    /* 946 */
-    PARROT_OP_find_not_cclass_i_i_s_i_ic,      /* 947 */
-    PARROT_OP_find_not_cclass_i_ic_s_i_ic,     /* 948 */
-    PARROT_OP_find_not_cclass_i_i_sc_i_ic,     /* 949 */
-    PARROT_OP_find_not_cclass_i_ic_sc_i_ic,    /* 950 */
-    PARROT_OP_find_not_cclass_i_i_s_ic_ic,     /* 951 */
-    PARROT_OP_find_not_cclass_i_ic_s_ic_ic,    /* 952 */
-    PARROT_OP_find_not_cclass_i_i_sc_ic_ic,    /* 953 */
-    PARROT_OP_find_not_cclass_i_ic_sc_ic_ic,   /* 954 */
-    PARROT_OP_escape_s_s,                      /* 955 */
-    PARROT_OP_compose_s_s,                     /* 956 */
-    PARROT_OP_compose_s_sc,                    /* 957 */
-    PARROT_OP_find_codepoint_i_s,              /* 958 */
-    PARROT_OP_find_codepoint_i_sc,             /* 959 */
-    PARROT_OP_spawnw_i_s,                      /* 960 */
-    PARROT_OP_spawnw_i_sc,                     /* 961 */
-    PARROT_OP_spawnw_i_p,                      /* 962 */
-    PARROT_OP_err_i,                           /* 963 */
-    PARROT_OP_err_s,                           /* 964 */
-    PARROT_OP_err_s_i,                         /* 965 */
-    PARROT_OP_err_s_ic,                        /* 966 */
-    PARROT_OP_time_i,                          /* 967 */
-    PARROT_OP_time_n,                          /* 968 */
-    PARROT_OP_sleep_i,                         /* 969 */
-    PARROT_OP_sleep_ic,                        /* 970 */
-    PARROT_OP_sleep_n,                         /* 971 */
-    PARROT_OP_sleep_nc,                        /* 972 */
-    PARROT_OP_store_lex_s_p,                   /* 973 */
-    PARROT_OP_store_lex_sc_p,                  /* 974 */
-    PARROT_OP_store_lex_s_s,                   /* 975 */
-    PARROT_OP_store_lex_sc_s,                  /* 976 */
-    PARROT_OP_store_lex_s_sc,                  /* 977 */
-    PARROT_OP_store_lex_sc_sc,                 /* 978 */
-    PARROT_OP_store_lex_s_i,                   /* 979 */
-    PARROT_OP_store_lex_sc_i,                  /* 980 */
-    PARROT_OP_store_lex_s_ic,                  /* 981 */
-    PARROT_OP_store_lex_sc_ic,                 /* 982 */
-    PARROT_OP_store_lex_s_n,                   /* 983 */
-    PARROT_OP_store_lex_sc_n,                  /* 984 */
-    PARROT_OP_store_lex_s_nc,                  /* 985 */
-    PARROT_OP_store_lex_sc_nc,                 /* 986 */
-    PARROT_OP_store_dynamic_lex_s_p,           /* 987 */
-    PARROT_OP_store_dynamic_lex_sc_p,          /* 988 */
-    PARROT_OP_find_lex_p_s,                    /* 989 */
-    PARROT_OP_find_lex_p_sc,                   /* 990 */
-    PARROT_OP_find_lex_s_s,                    /* 991 */
-    PARROT_OP_find_lex_s_sc,                   /* 992 */
-    PARROT_OP_find_lex_i_s,                    /* 993 */
-    PARROT_OP_find_lex_i_sc,                   /* 994 */
-    PARROT_OP_find_lex_n_s,                    /* 995 */
-    PARROT_OP_find_lex_n_sc,                   /* 996 */
-    PARROT_OP_find_dynamic_lex_p_s,            /* 997 */
-    PARROT_OP_find_dynamic_lex_p_sc,           /* 998 */
-    PARROT_OP_find_caller_lex_p_s,             /* 999 */
-    PARROT_OP_find_caller_lex_p_sc,            /* 1000 */
-    PARROT_OP_get_namespace_p,                 /* 1001 */
-    PARROT_OP_get_namespace_p_p,               /* 1002 */
-    PARROT_OP_get_namespace_p_pc,              /* 1003 */
-    PARROT_OP_get_hll_namespace_p,             /* 1004 */
-    PARROT_OP_get_hll_namespace_p_p,           /* 1005 */
-    PARROT_OP_get_hll_namespace_p_pc,          /* 1006 */
-    PARROT_OP_get_root_namespace_p,            /* 1007 */
-    PARROT_OP_get_root_namespace_p_p,          /* 1008 */
-    PARROT_OP_get_root_namespace_p_pc,         /* 1009 */
-    PARROT_OP_get_global_p_s,                  /* 1010 */
-    PARROT_OP_get_global_p_sc,                 /* 1011 */
-    PARROT_OP_get_global_p_p_s,                /* 1012 */
-    PARROT_OP_get_global_p_pc_s,               /* 1013 */
-    PARROT_OP_get_global_p_p_sc,               /* 1014 */
-    PARROT_OP_get_global_p_pc_sc,              /* 1015 */
-    PARROT_OP_get_hll_global_p_s,              /* 1016 */
-    PARROT_OP_get_hll_global_p_sc,             /* 1017 */
-    PARROT_OP_get_hll_global_p_p_s,            /* 1018 */
-    PARROT_OP_get_hll_global_p_pc_s,           /* 1019 */
-    PARROT_OP_get_hll_global_p_p_sc,           /* 1020 */
-    PARROT_OP_get_hll_global_p_pc_sc,          /* 1021 */
-    PARROT_OP_get_root_global_p_s,             /* 1022 */
-    PARROT_OP_get_root_global_p_sc,            /* 1023 */
-    PARROT_OP_get_root_global_p_p_s,           /* 1024 */
-    PARROT_OP_get_root_global_p_pc_s,          /* 1025 */
-    PARROT_OP_get_root_global_p_p_sc,          /* 1026 */
-    PARROT_OP_get_root_global_p_pc_sc,         /* 1027 */
-    PARROT_OP_set_global_s_p,                  /* 1028 */
-    PARROT_OP_set_global_sc_p,                 /* 1029 */
-    PARROT_OP_set_global_p_s_p,                /* 1030 */
-    PARROT_OP_set_global_pc_s_p,               /* 1031 */
-    PARROT_OP_set_global_p_sc_p,               /* 1032 */
-    PARROT_OP_set_global_pc_sc_p,              /* 1033 */
-    PARROT_OP_set_hll_global_s_p,              /* 1034 */
-    PARROT_OP_set_hll_global_sc_p,             /* 1035 */
-    PARROT_OP_set_hll_global_p_s_p,            /* 1036 */
-    PARROT_OP_set_hll_global_pc_s_p,           /* 1037 */
-    PARROT_OP_set_hll_global_p_sc_p,           /* 1038 */
-    PARROT_OP_set_hll_global_pc_sc_p,          /* 1039 */
-    PARROT_OP_set_root_global_s_p,             /* 1040 */
-    PARROT_OP_set_root_global_sc_p,            /* 1041 */
-    PARROT_OP_set_root_global_p_s_p,           /* 1042 */
-    PARROT_OP_set_root_global_pc_s_p,          /* 1043 */
-    PARROT_OP_set_root_global_p_sc_p,          /* 1044 */
-    PARROT_OP_set_root_global_pc_sc_p,         /* 1045 */
-    PARROT_OP_find_name_p_s,                   /* 1046 */
-    PARROT_OP_find_name_p_sc,                  /* 1047 */
-    PARROT_OP_find_sub_not_null_p_s,           /* 1048 */
-    PARROT_OP_find_sub_not_null_p_sc,          /* 1049 */
-    PARROT_OP_trap,                            /* 1050 */
-    PARROT_OP_set_label_p_ic,                  /* 1051 */
-    PARROT_OP_get_label_i_p,                   /* 1052 */
-    PARROT_OP_get_id_i_p,                      /* 1053 */
-    PARROT_OP_get_id_i_pc,                     /* 1054 */
-    PARROT_OP_fetch_p_p_p_p,                   /* 1055 */
-    PARROT_OP_fetch_p_pc_p_p,                  /* 1056 */
-    PARROT_OP_fetch_p_p_pc_p,                  /* 1057 */
-    PARROT_OP_fetch_p_pc_pc_p,                 /* 1058 */
-    PARROT_OP_fetch_p_p_p_pc,                  /* 1059 */
-    PARROT_OP_fetch_p_pc_p_pc,                 /* 1060 */
-    PARROT_OP_fetch_p_p_pc_pc,                 /* 1061 */
-    PARROT_OP_fetch_p_pc_pc_pc,                /* 1062 */
-    PARROT_OP_fetch_p_p_i_p,                   /* 1063 */
-    PARROT_OP_fetch_p_pc_i_p,                  /* 1064 */
-    PARROT_OP_fetch_p_p_ic_p,                  /* 1065 */
-    PARROT_OP_fetch_p_pc_ic_p,                 /* 1066 */
-    PARROT_OP_fetch_p_p_i_pc,                  /* 1067 */
-    PARROT_OP_fetch_p_pc_i_pc,                 /* 1068 */
-    PARROT_OP_fetch_p_p_ic_pc,                 /* 1069 */
-    PARROT_OP_fetch_p_pc_ic_pc,                /* 1070 */
-    PARROT_OP_fetch_p_p_s_p,                   /* 1071 */
-    PARROT_OP_fetch_p_pc_s_p,                  /* 1072 */
-    PARROT_OP_fetch_p_p_sc_p,                  /* 1073 */
-    PARROT_OP_fetch_p_pc_sc_p,                 /* 1074 */
-    PARROT_OP_fetch_p_p_s_pc,                  /* 1075 */
-    PARROT_OP_fetch_p_pc_s_pc,                 /* 1076 */
-    PARROT_OP_fetch_p_p_sc_pc,                 /* 1077 */
-    PARROT_OP_fetch_p_pc_sc_pc,                /* 1078 */
-    PARROT_OP_vivify_p_p_p_p,                  /* 1079 */
-    PARROT_OP_vivify_p_pc_p_p,                 /* 1080 */
-    PARROT_OP_vivify_p_p_pc_p,                 /* 1081 */
-    PARROT_OP_vivify_p_pc_pc_p,                /* 1082 */
-    PARROT_OP_vivify_p_p_p_pc,                 /* 1083 */
-    PARROT_OP_vivify_p_pc_p_pc,                /* 1084 */
-    PARROT_OP_vivify_p_p_pc_pc,                /* 1085 */
-    PARROT_OP_vivify_p_pc_pc_pc,               /* 1086 */
-    PARROT_OP_vivify_p_p_i_p,                  /* 1087 */
-    PARROT_OP_vivify_p_pc_i_p,                 /* 1088 */
-    PARROT_OP_vivify_p_p_ic_p,                 /* 1089 */
-    PARROT_OP_vivify_p_pc_ic_p,                /* 1090 */
-    PARROT_OP_vivify_p_p_i_pc,                 /* 1091 */
-    PARROT_OP_vivify_p_pc_i_pc,                /* 1092 */
-    PARROT_OP_vivify_p_p_ic_pc,                /* 1093 */
-    PARROT_OP_vivify_p_pc_ic_pc,               /* 1094 */
-    PARROT_OP_vivify_p_p_s_p,                  /* 1095 */
-    PARROT_OP_vivify_p_pc_s_p,                 /* 1096 */
-    PARROT_OP_vivify_p_p_sc_p,                 /* 1097 */
-    PARROT_OP_vivify_p_pc_sc_p,                /* 1098 */
-    PARROT_OP_vivify_p_p_s_pc,                 /* 1099 */
-    PARROT_OP_vivify_p_pc_s_pc,                /* 1100 */
-    PARROT_OP_vivify_p_p_sc_pc,                /* 1101 */
-    PARROT_OP_vivify_p_pc_sc_pc,               /* 1102 */
-    PARROT_OP_new_p_s_i,                       /* 1103 */
-    PARROT_OP_new_p_sc_i,                      /* 1104 */
-    PARROT_OP_new_p_s_ic,                      /* 1105 */
-    PARROT_OP_new_p_sc_ic,                     /* 1106 */
-    PARROT_OP_new_p_p_i,                       /* 1107 */
-    PARROT_OP_new_p_pc_i,                      /* 1108 */
-    PARROT_OP_new_p_p_ic,                      /* 1109 */
-    PARROT_OP_new_p_pc_ic,                     /* 1110 */
-    PARROT_OP_root_new_p_p_i,                  /* 1111 */
-    PARROT_OP_root_new_p_pc_i,                 /* 1112 */
-    PARROT_OP_root_new_p_p_ic,                 /* 1113 */
-    PARROT_OP_root_new_p_pc_ic,                /* 1114 */
-    PARROT_OP_get_context_p,                   /* 1115 */
-    PARROT_OP_new_call_context_p,              /* 1116 */
-    PARROT_OP_invokecc_p_p,                    /* 1117 */
-    PARROT_OP_flatten_array_into_p_p_i,        /* 1118 */
-    PARROT_OP_flatten_array_into_p_p_ic,       /* 1119 */
-    PARROT_OP_flatten_hash_into_p_p_i,         /* 1120 */
-    PARROT_OP_flatten_hash_into_p_p_ic,        /* 1121 */
-    PARROT_OP_slurp_array_from_p_p_i,          /* 1122 */
-    PARROT_OP_slurp_array_from_p_p_ic,         /* 1123 */
-    PARROT_OP_receive_p,                       /* 1124 */
-    PARROT_OP_wait_p,                          /* 1125 */
-    PARROT_OP_wait_pc,                         /* 1126 */
-    PARROT_OP_pass,                            /* 1127 */
-    PARROT_OP_disable_preemption,              /* 1128 */
-    PARROT_OP_enable_preemption,               /* 1129 */
-    PARROT_OP_terminate                        /* 1130 */
+    PARROT_OP_freeze_p_p,                      /* 677 */
+    PARROT_OP_thaw_p_p,                        /* 678 */
+    PARROT_OP_add_multi_s_s_p,                 /* 679 */
+    PARROT_OP_add_multi_sc_s_p,                /* 680 */
+    PARROT_OP_add_multi_s_sc_p,                /* 681 */
+    PARROT_OP_add_multi_sc_sc_p,               /* 682 */
+    PARROT_OP_find_multi_p_s_s,                /* 683 */
+    PARROT_OP_find_multi_p_sc_s,               /* 684 */
+    PARROT_OP_find_multi_p_s_sc,               /* 685 */
+    PARROT_OP_find_multi_p_sc_sc,              /* 686 */
+    PARROT_OP_register_p,                      /* 687 */
+    PARROT_OP_unregister_p,                    /* 688 */
+    PARROT_OP_box_p_i,                         /* 689 */
+    PARROT_OP_box_p_ic,                        /* 690 */
+    PARROT_OP_box_p_n,                         /* 691 */
+    PARROT_OP_box_p_nc,                        /* 692 */
+    PARROT_OP_box_p_s,                         /* 693 */
+    PARROT_OP_box_p_sc,                        /* 694 */
+    PARROT_OP_iter_p_p,                        /* 695 */
+    PARROT_OP_morph_p_p,                       /* 696 */
+    PARROT_OP_morph_p_pc,                      /* 697 */
+    PARROT_OP_clone_s_s,                       /* 698 */
+    PARROT_OP_clone_s_sc,                      /* 699 */
+    PARROT_OP_set_i_i,                         /* 700 */
+    PARROT_OP_set_i_ic,                        /* 701 */
+    PARROT_OP_set_i_n,                         /* 702 */
+    PARROT_OP_set_i_nc,                        /* 703 */
+    PARROT_OP_set_i_s,                         /* 704 */
+    PARROT_OP_set_i_sc,                        /* 705 */
+    PARROT_OP_set_n_n,                         /* 706 */
+    PARROT_OP_set_n_nc,                        /* 707 */
+    PARROT_OP_set_n_i,                         /* 708 */
+    PARROT_OP_set_n_ic,                        /* 709 */
+    PARROT_OP_set_n_s,                         /* 710 */
+    PARROT_OP_set_n_sc,                        /* 711 */
+    PARROT_OP_set_n_p,                         /* 712 */
+    PARROT_OP_set_s_p,                         /* 713 */
+    PARROT_OP_set_s_s,                         /* 714 */
+    PARROT_OP_set_s_sc,                        /* 715 */
+    PARROT_OP_set_s_i,                         /* 716 */
+    PARROT_OP_set_s_ic,                        /* 717 */
+    PARROT_OP_set_s_n,                         /* 718 */
+    PARROT_OP_set_s_nc,                        /* 719 */
+    PARROT_OP_set_p_pc,                        /* 720 */
+    PARROT_OP_set_p_p,                         /* 721 */
+    PARROT_OP_set_p_i,                         /* 722 */
+    PARROT_OP_set_p_ic,                        /* 723 */
+    PARROT_OP_set_p_n,                         /* 724 */
+    PARROT_OP_set_p_nc,                        /* 725 */
+    PARROT_OP_set_p_s,                         /* 726 */
+    PARROT_OP_set_p_sc,                        /* 727 */
+    PARROT_OP_set_i_p,                         /* 728 */
+    PARROT_OP_assign_p_p,                      /* 729 */
+    PARROT_OP_assign_p_i,                      /* 730 */
+    PARROT_OP_assign_p_ic,                     /* 731 */
+    PARROT_OP_assign_p_n,                      /* 732 */
+    PARROT_OP_assign_p_nc,                     /* 733 */
+    PARROT_OP_assign_p_s,                      /* 734 */
+    PARROT_OP_assign_p_sc,                     /* 735 */
+    PARROT_OP_assign_s_s,                      /* 736 */
+    PARROT_OP_assign_s_sc,                     /* 737 */
+    PARROT_OP_setref_p_p,                      /* 738 */
+    PARROT_OP_deref_p_p,                       /* 739 */
+    PARROT_OP_set_p_ki_i,                      /* 740 */
+    PARROT_OP_set_p_kic_i,                     /* 741 */
+    PARROT_OP_set_p_ki_ic,                     /* 742 */
+    PARROT_OP_set_p_kic_ic,                    /* 743 */
+    PARROT_OP_set_p_ki_n,                      /* 744 */
+    PARROT_OP_set_p_kic_n,                     /* 745 */
+    PARROT_OP_set_p_ki_nc,                     /* 746 */
+    PARROT_OP_set_p_kic_nc,                    /* 747 */
+    PARROT_OP_set_p_ki_s,                      /* 748 */
+    PARROT_OP_set_p_kic_s,                     /* 749 */
+    PARROT_OP_set_p_ki_sc,                     /* 750 */
+    PARROT_OP_set_p_kic_sc,                    /* 751 */
+    PARROT_OP_set_p_ki_p,                      /* 752 */
+    PARROT_OP_set_p_kic_p,                     /* 753 */
+    PARROT_OP_set_i_p_ki,                      /* 754 */
+    PARROT_OP_set_i_p_kic,                     /* 755 */
+    PARROT_OP_set_n_p_ki,                      /* 756 */
+    PARROT_OP_set_n_p_kic,                     /* 757 */
+    PARROT_OP_set_s_p_ki,                      /* 758 */
+    PARROT_OP_set_s_p_kic,                     /* 759 */
+    PARROT_OP_set_p_p_ki,                      /* 760 */
+    PARROT_OP_set_p_p_kic,                     /* 761 */
+    PARROT_OP_set_p_k_i,                       /* 762 */
+    PARROT_OP_set_p_kc_i,                      /* 763 */
+    PARROT_OP_set_p_k_ic,                      /* 764 */
+    PARROT_OP_set_p_kc_ic,                     /* 765 */
+    PARROT_OP_set_p_k_n,                       /* 766 */
+    PARROT_OP_set_p_kc_n,                      /* 767 */
+    PARROT_OP_set_p_k_nc,                      /* 768 */
+    PARROT_OP_set_p_kc_nc,                     /* 769 */
+    PARROT_OP_set_p_k_s,                       /* 770 */
+    PARROT_OP_set_p_kc_s,                      /* 771 */
+    PARROT_OP_set_p_k_sc,                      /* 772 */
+    PARROT_OP_set_p_kc_sc,                     /* 773 */
+    PARROT_OP_set_p_k_p,                       /* 774 */
+    PARROT_OP_set_p_kc_p,                      /* 775 */
+    PARROT_OP_set_i_p_k,                       /* 776 */
+    PARROT_OP_set_i_p_kc,                      /* 777 */
+    PARROT_OP_set_n_p_k,                       /* 778 */
+    PARROT_OP_set_n_p_kc,                      /* 779 */
+    PARROT_OP_set_s_p_k,                       /* 780 */
+    PARROT_OP_set_s_p_kc,                      /* 781 */
+    PARROT_OP_set_p_p_k,                       /* 782 */
+    PARROT_OP_set_p_p_kc,                      /* 783 */
+    PARROT_OP_clone_p_p,                       /* 784 */
+    PARROT_OP_clone_p_p_p,                     /* 785 */
+    PARROT_OP_clone_p_p_pc,                    /* 786 */
+    PARROT_OP_copy_p_p,                        /* 787 */
+    PARROT_OP_null_s,                          /* 788 */
+    PARROT_OP_null_i,                          /* 789 */
+    PARROT_OP_null_p,                          /* 790 */
+    PARROT_OP_null_n,                          /* 791 */
+    PARROT_OP_ord_i_s,                         /* 792 */
+    PARROT_OP_ord_i_sc,                        /* 793 */
+    PARROT_OP_ord_i_s_i,                       /* 794 */
+    PARROT_OP_ord_i_sc_i,                      /* 795 */
+    PARROT_OP_ord_i_s_ic,                      /* 796 */
+    PARROT_OP_ord_i_sc_ic,                     /* 797 */
+    PARROT_OP_chr_s_i,                         /* 798 */
+    PARROT_OP_chr_s_ic,                        /* 799 */
+    PARROT_OP_chopn_s_s_i,                     /* 800 */
+    PARROT_OP_chopn_s_sc_i,                    /* 801 */
+    PARROT_OP_chopn_s_s_ic,                    /* 802 */
+    PARROT_OP_chopn_s_sc_ic,                   /* 803 */
+    PARROT_OP_concat_p_p,                      /* 804 */
+    PARROT_OP_concat_p_s,                      /* 805 */
+    PARROT_OP_concat_p_sc,                     /* 806 */
+    PARROT_OP_concat_s_s_s,                    /* 807 */
+    PARROT_OP_concat_s_sc_s,                   /* 808 */
+    PARROT_OP_concat_s_s_sc,                   /* 809 */
+    PARROT_OP_concat_p_p_s,                    /* 810 */
+    PARROT_OP_concat_p_p_sc,                   /* 811 */
+    PARROT_OP_concat_p_p_p,                    /* 812 */
+    PARROT_OP_repeat_s_s_i,                    /* 813 */
+    PARROT_OP_repeat_s_sc_i,                   /* 814 */
+    PARROT_OP_repeat_s_s_ic,                   /* 815 */
+    PARROT_OP_repeat_s_sc_ic,                  /* 816 */
+    PARROT_OP_repeat_p_p_i,                    /* 817 */
+    PARROT_OP_repeat_p_p_ic,                   /* 818 */
+    PARROT_OP_repeat_p_p_p,                    /* 819 */
+    PARROT_OP_repeat_p_i,                      /* 820 */
+    PARROT_OP_repeat_p_ic,                     /* 821 */
+    PARROT_OP_repeat_p_p,                      /* 822 */
+    PARROT_OP_length_i_s,                      /* 823 */
+    PARROT_OP_length_i_sc,                     /* 824 */
+    PARROT_OP_bytelength_i_s,                  /* 825 */
+    PARROT_OP_bytelength_i_sc,                 /* 826 */
+    PARROT_OP_pin_s,                           /* 827 */
+    PARROT_OP_unpin_s,                         /* 828 */
+    PARROT_OP_substr_s_s_i,                    /* 829 */
+    PARROT_OP_substr_s_sc_i,                   /* 830 */
+    PARROT_OP_substr_s_s_ic,                   /* 831 */
+    PARROT_OP_substr_s_sc_ic,                  /* 832 */
+    PARROT_OP_substr_s_s_i_i,                  /* 833 */
+    PARROT_OP_substr_s_sc_i_i,                 /* 834 */
+    PARROT_OP_substr_s_s_ic_i,                 /* 835 */
+    PARROT_OP_substr_s_sc_ic_i,                /* 836 */
+    PARROT_OP_substr_s_s_i_ic,                 /* 837 */
+    PARROT_OP_substr_s_sc_i_ic,                /* 838 */
+    PARROT_OP_substr_s_s_ic_ic,                /* 839 */
+    PARROT_OP_substr_s_sc_ic_ic,               /* 840 */
+    PARROT_OP_substr_s_p_i_i,                  /* 841 */
+    PARROT_OP_substr_s_p_ic_i,                 /* 842 */
+    PARROT_OP_substr_s_p_i_ic,                 /* 843 */
+    PARROT_OP_substr_s_p_ic_ic,                /* 844 */
+    PARROT_OP_replace_s_s_i_i_s,               /* 845 */
+    PARROT_OP_replace_s_sc_i_i_s,              /* 846 */
+    PARROT_OP_replace_s_s_ic_i_s,              /* 847 */
+    PARROT_OP_replace_s_sc_ic_i_s,             /* 848 */
+    PARROT_OP_replace_s_s_i_ic_s,              /* 849 */
+    PARROT_OP_replace_s_sc_i_ic_s,             /* 850 */
+    PARROT_OP_replace_s_s_ic_ic_s,             /* 851 */
+    PARROT_OP_replace_s_sc_ic_ic_s,            /* 852 */
+    PARROT_OP_replace_s_s_i_i_sc,              /* 853 */
+    PARROT_OP_replace_s_sc_i_i_sc,             /* 854 */
+    PARROT_OP_replace_s_s_ic_i_sc,             /* 855 */
+    PARROT_OP_replace_s_sc_ic_i_sc,            /* 856 */
+    PARROT_OP_replace_s_s_i_ic_sc,             /* 857 */
+    PARROT_OP_replace_s_sc_i_ic_sc,            /* 858 */
+    PARROT_OP_replace_s_s_ic_ic_sc,            /* 859 */
+    PARROT_OP_replace_s_sc_ic_ic_sc,           /* 860 */
+    PARROT_OP_index_i_s_s,                     /* 861 */
+    PARROT_OP_index_i_sc_s,                    /* 862 */
+    PARROT_OP_index_i_s_sc,                    /* 863 */
+    PARROT_OP_index_i_sc_sc,                   /* 864 */
+    PARROT_OP_index_i_s_s_i,                   /* 865 */
+    PARROT_OP_index_i_sc_s_i,                  /* 866 */
+    PARROT_OP_index_i_s_sc_i,                  /* 867 */
+    PARROT_OP_index_i_sc_sc_i,                 /* 868 */
+    PARROT_OP_index_i_s_s_ic,                  /* 869 */
+    PARROT_OP_index_i_sc_s_ic,                 /* 870 */
+    PARROT_OP_index_i_s_sc_ic,                 /* 871 */
+    PARROT_OP_index_i_sc_sc_ic,                /* 872 */
+    PARROT_OP_rindex_i_s_s,                    /* 873 */
+    PARROT_OP_rindex_i_sc_s,                   /* 874 */
+    PARROT_OP_rindex_i_s_sc,                   /* 875 */
+    PARROT_OP_rindex_i_sc_sc,                  /* 876 */
+    PARROT_OP_rindex_i_s_s_i,                  /* 877 */
+    PARROT_OP_rindex_i_sc_s_i,                 /* 878 */
+    PARROT_OP_rindex_i_s_sc_i,                 /* 879 */
+    PARROT_OP_rindex_i_sc_sc_i,                /* 880 */
+    PARROT_OP_rindex_i_s_s_ic,                 /* 881 */
+    PARROT_OP_rindex_i_sc_s_ic,                /* 882 */
+    PARROT_OP_rindex_i_s_sc_ic,                /* 883 */
+    PARROT_OP_rindex_i_sc_sc_ic,               /* 884 */
+    PARROT_OP_sprintf_s_s_p,                   /* 885 */
+    PARROT_OP_sprintf_s_sc_p,                  /* 886 */
+    PARROT_OP_sprintf_p_p_p,                   /* 887 */
+    PARROT_OP_new_s,                           /* 888 */
+    PARROT_OP_stringinfo_i_s_i,                /* 889 */
+    PARROT_OP_stringinfo_i_sc_i,               /* 890 */
+    PARROT_OP_stringinfo_i_s_ic,               /* 891 */
+    PARROT_OP_stringinfo_i_sc_ic,              /* 892 */
+    PARROT_OP_upcase_s_s,                      /* 893 */
+    PARROT_OP_upcase_s_sc,                     /* 894 */
+    PARROT_OP_downcase_s_s,                    /* 895 */
+    PARROT_OP_downcase_s_sc,                   /* 896 */
+    PARROT_OP_titlecase_s_s,                   /* 897 */
+    PARROT_OP_titlecase_s_sc,                  /* 898 */
+    PARROT_OP_foldcase_s_s,                    /* 899 */
+    PARROT_OP_foldcase_s_sc,                   /* 900 */
+    PARROT_OP_join_s_s_p,                      /* 901 */
+    PARROT_OP_join_s_sc_p,                     /* 902 */
+    PARROT_OP_split_p_s_s,                     /* 903 */
+    PARROT_OP_split_p_sc_s,                    /* 904 */
+    PARROT_OP_split_p_s_sc,                    /* 905 */
+    PARROT_OP_split_p_sc_sc,                   /* 906 */
+    PARROT_OP_encoding_i_s,                    /* 907 */
+    PARROT_OP_encoding_i_sc,                   /* 908 */
+    PARROT_OP_encodingname_s_i,                /* 909 */
+    PARROT_OP_encodingname_s_ic,               /* 910 */
+    PARROT_OP_find_encoding_i_s,               /* 911 */
+    PARROT_OP_find_encoding_i_sc,              /* 912 */
+    PARROT_OP_trans_encoding_s_s_i,            /* 913 */
+    PARROT_OP_trans_encoding_s_sc_i,           /* 914 */
+    PARROT_OP_trans_encoding_s_s_ic,           /* 915 */
+    PARROT_OP_trans_encoding_s_sc_ic,          /* 916 */
+    PARROT_OP_is_cclass_i_i_s_i,               /* 917 */
+    PARROT_OP_is_cclass_i_ic_s_i,              /* 918 */
+    PARROT_OP_is_cclass_i_i_sc_i,              /* 919 */
+    PARROT_OP_is_cclass_i_ic_sc_i,             /* 920 */
+    PARROT_OP_is_cclass_i_i_s_ic,              /* 921 */
+    PARROT_OP_is_cclass_i_ic_s_ic,             /* 922 */
+    PARROT_OP_is_cclass_i_i_sc_ic,             /* 923 */
+    PARROT_OP_is_cclass_i_ic_sc_ic,            /* 924 */
+    PARROT_OP_find_cclass_i_i_s_i_i,           /* 925 */
+    PARROT_OP_find_cclass_i_ic_s_i_i,          /* 926 */
+    PARROT_OP_find_cclass_i_i_sc_i_i,          /* 927 */
+    PARROT_OP_find_cclass_i_ic_sc_i_i,         /* 928 */
+    PARROT_OP_find_cclass_i_i_s_ic_i,          /* 929 */
+    PARROT_OP_find_cclass_i_ic_s_ic_i,         /* 930 */
+    PARROT_OP_find_cclass_i_i_sc_ic_i,         /* 931 */
+    PARROT_OP_find_cclass_i_ic_sc_ic_i,        /* 932 */
+    PARROT_OP_find_cclass_i_i_s_i_ic,          /* 933 */
+    PARROT_OP_find_cclass_i_ic_s_i_ic,         /* 934 */
+    PARROT_OP_find_cclass_i_i_sc_i_ic,         /* 935 */
+    PARROT_OP_find_cclass_i_ic_sc_i_ic,        /* 936 */
+    PARROT_OP_find_cclass_i_i_s_ic_ic,         /* 937 */
+    PARROT_OP_find_cclass_i_ic_s_ic_ic,        /* 938 */
+    PARROT_OP_find_cclass_i_i_sc_ic_ic,        /* 939 */
+    PARROT_OP_find_cclass_i_ic_sc_ic_ic,       /* 940 */
+    PARROT_OP_find_not_cclass_i_i_s_i_i,       /* 941 */
+    PARROT_OP_find_not_cclass_i_ic_s_i_i,      /* 942 */
+    PARROT_OP_find_not_cclass_i_i_sc_i_i,      /* 943 */
+    PARROT_OP_find_not_cclass_i_ic_sc_i_i,     /* 944 */
+    PARROT_OP_find_not_cclass_i_i_s_ic_i,      /* 945 */
+    PARROT_OP_find_not_cclass_i_ic_s_ic_i,     /* 946 */
+    PARROT_OP_find_not_cclass_i_i_sc_ic_i,     /* 947 */
+    PARROT_OP_find_not_cclass_i_ic_sc_ic_i,    /* 948 */
+    PARROT_OP_find_not_cclass_i_i_s_i_ic,      /* 949 */
+    PARROT_OP_find_not_cclass_i_ic_s_i_ic,     /* 950 */
+    PARROT_OP_find_not_cclass_i_i_sc_i_ic,     /* 951 */
+    PARROT_OP_find_not_cclass_i_ic_sc_i_ic,    /* 952 */
+    PARROT_OP_find_not_cclass_i_i_s_ic_ic,     /* 953 */
+    PARROT_OP_find_not_cclass_i_ic_s_ic_ic,    /* 954 */
+    PARROT_OP_find_not_cclass_i_i_sc_ic_ic,    /* 955 */
+    PARROT_OP_find_not_cclass_i_ic_sc_ic_ic,   /* 956 */
+    PARROT_OP_escape_s_s,                      /* 957 */
+    PARROT_OP_compose_s_s,                     /* 958 */
+    PARROT_OP_compose_s_sc,                    /* 959 */
+    PARROT_OP_find_codepoint_i_s,              /* 960 */
+    PARROT_OP_find_codepoint_i_sc,             /* 961 */
+    PARROT_OP_spawnw_i_s,                      /* 962 */
+    PARROT_OP_spawnw_i_sc,                     /* 963 */
+    PARROT_OP_spawnw_i_p,                      /* 964 */
+    PARROT_OP_err_i,                           /* 965 */
+    PARROT_OP_err_s,                           /* 966 */
+    PARROT_OP_err_s_i,                         /* 967 */
+    PARROT_OP_err_s_ic,                        /* 968 */
+    PARROT_OP_time_i,                          /* 969 */
+    PARROT_OP_time_n,                          /* 970 */
+    PARROT_OP_sleep_i,                         /* 971 */
+    PARROT_OP_sleep_ic,                        /* 972 */
+    PARROT_OP_sleep_n,                         /* 973 */
+    PARROT_OP_sleep_nc,                        /* 974 */
+    PARROT_OP_store_lex_s_p,                   /* 975 */
+    PARROT_OP_store_lex_sc_p,                  /* 976 */
+    PARROT_OP_store_lex_s_s,                   /* 977 */
+    PARROT_OP_store_lex_sc_s,                  /* 978 */
+    PARROT_OP_store_lex_s_sc,                  /* 979 */
+    PARROT_OP_store_lex_sc_sc,                 /* 980 */
+    PARROT_OP_store_lex_s_i,                   /* 981 */
+    PARROT_OP_store_lex_sc_i,                  /* 982 */
+    PARROT_OP_store_lex_s_ic,                  /* 983 */
+    PARROT_OP_store_lex_sc_ic,                 /* 984 */
+    PARROT_OP_store_lex_s_n,                   /* 985 */
+    PARROT_OP_store_lex_sc_n,                  /* 986 */
+    PARROT_OP_store_lex_s_nc,                  /* 987 */
+    PARROT_OP_store_lex_sc_nc,                 /* 988 */
+    PARROT_OP_store_dynamic_lex_s_p,           /* 989 */
+    PARROT_OP_store_dynamic_lex_sc_p,          /* 990 */
+    PARROT_OP_find_lex_p_s,                    /* 991 */
+    PARROT_OP_find_lex_p_sc,                   /* 992 */
+    PARROT_OP_find_lex_s_s,                    /* 993 */
+    PARROT_OP_find_lex_s_sc,                   /* 994 */
+    PARROT_OP_find_lex_i_s,                    /* 995 */
+    PARROT_OP_find_lex_i_sc,                   /* 996 */
+    PARROT_OP_find_lex_n_s,                    /* 997 */
+    PARROT_OP_find_lex_n_sc,                   /* 998 */
+    PARROT_OP_find_lex_idx_p_sc_pc_ic_ic,      /* 999 */
+    PARROT_OP_find_lex_idx_s_sc_pc_ic_ic,      /* 1000 */
+    PARROT_OP_find_lex_idx_i_sc_pc_ic_ic,      /* 1001 */
+    PARROT_OP_find_lex_idx_n_sc_pc_ic_ic,      /* 1002 */
+    PARROT_OP_store_lex_idx_sc_p_pc_ic_ic,     /* 1003 */
+    PARROT_OP_store_lex_idx_sc_s_pc_ic_ic,     /* 1004 */
+    PARROT_OP_store_lex_idx_sc_sc_pc_ic_ic,    /* 1005 */
+    PARROT_OP_store_lex_idx_sc_i_pc_ic_ic,     /* 1006 */
+    PARROT_OP_store_lex_idx_sc_ic_pc_ic_ic,    /* 1007 */
+    PARROT_OP_store_lex_idx_sc_n_pc_ic_ic,     /* 1008 */
+    PARROT_OP_store_lex_idx_sc_nc_pc_ic_ic,    /* 1009 */
+    PARROT_OP_find_dynamic_lex_p_s,            /* 1010 */
+    PARROT_OP_find_dynamic_lex_p_sc,           /* 1011 */
+    PARROT_OP_find_caller_lex_p_s,             /* 1012 */
+    PARROT_OP_find_caller_lex_p_sc,            /* 1013 */
+    PARROT_OP_get_namespace_p,                 /* 1014 */
+    PARROT_OP_get_namespace_p_p,               /* 1015 */
+    PARROT_OP_get_namespace_p_pc,              /* 1016 */
+    PARROT_OP_get_hll_namespace_p,             /* 1017 */
+    PARROT_OP_get_hll_namespace_p_p,           /* 1018 */
+    PARROT_OP_get_hll_namespace_p_pc,          /* 1019 */
+    PARROT_OP_get_root_namespace_p,            /* 1020 */
+    PARROT_OP_get_root_namespace_p_p,          /* 1021 */
+    PARROT_OP_get_root_namespace_p_pc,         /* 1022 */
+    PARROT_OP_get_global_p_s,                  /* 1023 */
+    PARROT_OP_get_global_p_sc,                 /* 1024 */
+    PARROT_OP_get_global_p_p_s,                /* 1025 */
+    PARROT_OP_get_global_p_pc_s,               /* 1026 */
+    PARROT_OP_get_global_p_p_sc,               /* 1027 */
+    PARROT_OP_get_global_p_pc_sc,              /* 1028 */
+    PARROT_OP_get_hll_global_p_s,              /* 1029 */
+    PARROT_OP_get_hll_global_p_sc,             /* 1030 */
+    PARROT_OP_get_hll_global_p_p_s,            /* 1031 */
+    PARROT_OP_get_hll_global_p_pc_s,           /* 1032 */
+    PARROT_OP_get_hll_global_p_p_sc,           /* 1033 */
+    PARROT_OP_get_hll_global_p_pc_sc,          /* 1034 */
+    PARROT_OP_get_root_global_p_s,             /* 1035 */
+    PARROT_OP_get_root_global_p_sc,            /* 1036 */
+    PARROT_OP_get_root_global_p_p_s,           /* 1037 */
+    PARROT_OP_get_root_global_p_pc_s,          /* 1038 */
+    PARROT_OP_get_root_global_p_p_sc,          /* 1039 */
+    PARROT_OP_get_root_global_p_pc_sc,         /* 1040 */
+    PARROT_OP_get_global_ic_p_sc_ic,           /* 1041 */
+    PARROT_OP_get_global_ic_p_pc_sc_ic,        /* 1042 */
+    PARROT_OP_get_hll_global_ic_p_sc_ic,       /* 1043 */
+    PARROT_OP_get_hll_global_ic_p_pc_sc_ic,    /* 1044 */
+    PARROT_OP_get_root_global_ic_p_sc_ic,      /* 1045 */
+    PARROT_OP_get_root_global_ic_p_pc_sc_ic,   /* 1046 */
+    PARROT_OP_set_global_s_p,                  /* 1047 */
+    PARROT_OP_set_global_sc_p,                 /* 1048 */
+    PARROT_OP_set_global_p_s_p,                /* 1049 */
+    PARROT_OP_set_global_pc_s_p,               /* 1050 */
+    PARROT_OP_set_global_p_sc_p,               /* 1051 */
+    PARROT_OP_set_global_pc_sc_p,              /* 1052 */
+    PARROT_OP_set_hll_global_s_p,              /* 1053 */
+    PARROT_OP_set_hll_global_sc_p,             /* 1054 */
+    PARROT_OP_set_hll_global_p_s_p,            /* 1055 */
+    PARROT_OP_set_hll_global_pc_s_p,           /* 1056 */
+    PARROT_OP_set_hll_global_p_sc_p,           /* 1057 */
+    PARROT_OP_set_hll_global_pc_sc_p,          /* 1058 */
+    PARROT_OP_set_root_global_s_p,             /* 1059 */
+    PARROT_OP_set_root_global_sc_p,            /* 1060 */
+    PARROT_OP_set_root_global_p_s_p,           /* 1061 */
+    PARROT_OP_set_root_global_pc_s_p,          /* 1062 */
+    PARROT_OP_set_root_global_p_sc_p,          /* 1063 */
+    PARROT_OP_set_root_global_pc_sc_p,         /* 1064 */
+    PARROT_OP_find_name_p_s,                   /* 1065 */
+    PARROT_OP_find_name_p_sc,                  /* 1066 */
+    PARROT_OP_find_sub_not_null_p_s,           /* 1067 */
+    PARROT_OP_find_sub_not_null_p_sc,          /* 1068 */
+    PARROT_OP_trap,                            /* 1069 */
+    PARROT_OP_set_label_p_ic,                  /* 1070 */
+    PARROT_OP_get_label_i_p,                   /* 1071 */
+    PARROT_OP_get_id_i_p,                      /* 1072 */
+    PARROT_OP_get_id_i_pc,                     /* 1073 */
+    PARROT_OP_fetch_p_p_p_p,                   /* 1074 */
+    PARROT_OP_fetch_p_pc_p_p,                  /* 1075 */
+    PARROT_OP_fetch_p_p_pc_p,                  /* 1076 */
+    PARROT_OP_fetch_p_pc_pc_p,                 /* 1077 */
+    PARROT_OP_fetch_p_p_p_pc,                  /* 1078 */
+    PARROT_OP_fetch_p_pc_p_pc,                 /* 1079 */
+    PARROT_OP_fetch_p_p_pc_pc,                 /* 1080 */
+    PARROT_OP_fetch_p_pc_pc_pc,                /* 1081 */
+    PARROT_OP_fetch_p_p_i_p,                   /* 1082 */
+    PARROT_OP_fetch_p_pc_i_p,                  /* 1083 */
+    PARROT_OP_fetch_p_p_ic_p,                  /* 1084 */
+    PARROT_OP_fetch_p_pc_ic_p,                 /* 1085 */
+    PARROT_OP_fetch_p_p_i_pc,                  /* 1086 */
+    PARROT_OP_fetch_p_pc_i_pc,                 /* 1087 */
+    PARROT_OP_fetch_p_p_ic_pc,                 /* 1088 */
+    PARROT_OP_fetch_p_pc_ic_pc,                /* 1089 */
+    PARROT_OP_fetch_p_p_s_p,                   /* 1090 */
+    PARROT_OP_fetch_p_pc_s_p,                  /* 1091 */
+    PARROT_OP_fetch_p_p_sc_p,                  /* 1092 */
+    PARROT_OP_fetch_p_pc_sc_p,                 /* 1093 */
+    PARROT_OP_fetch_p_p_s_pc,                  /* 1094 */
+    PARROT_OP_fetch_p_pc_s_pc,                 /* 1095 */
+    PARROT_OP_fetch_p_p_sc_pc,                 /* 1096 */
+    PARROT_OP_fetch_p_pc_sc_pc,                /* 1097 */
+    PARROT_OP_vivify_p_p_p_p,                  /* 1098 */
+    PARROT_OP_vivify_p_pc_p_p,                 /* 1099 */
+    PARROT_OP_vivify_p_p_pc_p,                 /* 1100 */
+    PARROT_OP_vivify_p_pc_pc_p,                /* 1101 */
+    PARROT_OP_vivify_p_p_p_pc,                 /* 1102 */
+    PARROT_OP_vivify_p_pc_p_pc,                /* 1103 */
+    PARROT_OP_vivify_p_p_pc_pc,                /* 1104 */
+    PARROT_OP_vivify_p_pc_pc_pc,               /* 1105 */
+    PARROT_OP_vivify_p_p_i_p,                  /* 1106 */
+    PARROT_OP_vivify_p_pc_i_p,                 /* 1107 */
+    PARROT_OP_vivify_p_p_ic_p,                 /* 1108 */
+    PARROT_OP_vivify_p_pc_ic_p,                /* 1109 */
+    PARROT_OP_vivify_p_p_i_pc,                 /* 1110 */
+    PARROT_OP_vivify_p_pc_i_pc,                /* 1111 */
+    PARROT_OP_vivify_p_p_ic_pc,                /* 1112 */
+    PARROT_OP_vivify_p_pc_ic_pc,               /* 1113 */
+    PARROT_OP_vivify_p_p_s_p,                  /* 1114 */
+    PARROT_OP_vivify_p_pc_s_p,                 /* 1115 */
+    PARROT_OP_vivify_p_p_sc_p,                 /* 1116 */
+    PARROT_OP_vivify_p_pc_sc_p,                /* 1117 */
+    PARROT_OP_vivify_p_p_s_pc,                 /* 1118 */
+    PARROT_OP_vivify_p_pc_s_pc,                /* 1119 */
+    PARROT_OP_vivify_p_p_sc_pc,                /* 1120 */
+    PARROT_OP_vivify_p_pc_sc_pc,               /* 1121 */
+    PARROT_OP_new_p_s_i,                       /* 1122 */
+    PARROT_OP_new_p_sc_i,                      /* 1123 */
+    PARROT_OP_new_p_s_ic,                      /* 1124 */
+    PARROT_OP_new_p_sc_ic,                     /* 1125 */
+    PARROT_OP_new_p_p_i,                       /* 1126 */
+    PARROT_OP_new_p_pc_i,                      /* 1127 */
+    PARROT_OP_new_p_p_ic,                      /* 1128 */
+    PARROT_OP_new_p_pc_ic,                     /* 1129 */
+    PARROT_OP_root_new_p_p_i,                  /* 1130 */
+    PARROT_OP_root_new_p_pc_i,                 /* 1131 */
+    PARROT_OP_root_new_p_p_ic,                 /* 1132 */
+    PARROT_OP_root_new_p_pc_ic,                /* 1133 */
+    PARROT_OP_get_context_p,                   /* 1134 */
+    PARROT_OP_new_call_context_p,              /* 1135 */
+    PARROT_OP_invokecc_p_p,                    /* 1136 */
+    PARROT_OP_flatten_array_into_p_p_i,        /* 1137 */
+    PARROT_OP_flatten_array_into_p_p_ic,       /* 1138 */
+    PARROT_OP_flatten_hash_into_p_p_i,         /* 1139 */
+    PARROT_OP_flatten_hash_into_p_p_ic,        /* 1140 */
+    PARROT_OP_slurp_array_from_p_p_i,          /* 1141 */
+    PARROT_OP_slurp_array_from_p_p_ic,         /* 1142 */
+    PARROT_OP_receive_p,                       /* 1143 */
+    PARROT_OP_wait_p,                          /* 1144 */
+    PARROT_OP_wait_pc,                         /* 1145 */
+    PARROT_OP_pass,                            /* 1146 */
+    PARROT_OP_disable_preemption,              /* 1147 */
+    PARROT_OP_enable_preemption,               /* 1148 */
+    PARROT_OP_terminate,                       /* 1149 */
+    PARROT_OP_throw_control_i,                 /* 1150 */
+    PARROT_OP_throw_control_ic,                /* 1151 */
+    PARROT_OP_throw_control_i_p,               /* 1152 */
+    PARROT_OP_throw_control_ic_p,              /* 1153 */
+    PARROT_OP_resume_p_p,                      /* 1154 */
+    PARROT_OP_yield_p,                         /* 1155 */
+    PARROT_OP_share_ro_p_p                     /* 1156 */
 
 } parrot_opcode_enums;
 
@@ -690,460 +690,486 @@ enum OPS_ENUM {
     enum_ops_freeze_s_p                    =  674,
     enum_ops_thaw_p_s                      =  675,
     enum_ops_thaw_p_sc                     =  676,
-    enum_ops_add_multi_s_s_p               =  677,
-    enum_ops_add_multi_sc_s_p              =  678,
-    enum_ops_add_multi_s_sc_p              =  679,
-    enum_ops_add_multi_sc_sc_p             =  680,
-    enum_ops_find_multi_p_s_s              =  681,
-    enum_ops_find_multi_p_sc_s             =  682,
-    enum_ops_find_multi_p_s_sc             =  683,
-    enum_ops_find_multi_p_sc_sc            =  684,
-    enum_ops_register_p                    =  685,
-    enum_ops_unregister_p                  =  686,
-    enum_ops_box_p_i                       =  687,
-    enum_ops_box_p_ic                      =  688,
-    enum_ops_box_p_n                       =  689,
-    enum_ops_box_p_nc                      =  690,
-    enum_ops_box_p_s                       =  691,
-    enum_ops_box_p_sc                      =  692,
-    enum_ops_iter_p_p                      =  693,
-    enum_ops_morph_p_p                     =  694,
-    enum_ops_morph_p_pc                    =  695,
-    enum_ops_clone_s_s                     =  696,
-    enum_ops_clone_s_sc                    =  697,
-    enum_ops_set_i_i                       =  698,
-    enum_ops_set_i_ic                      =  699,
-    enum_ops_set_i_n                       =  700,
-    enum_ops_set_i_nc                      =  701,
-    enum_ops_set_i_s                       =  702,
-    enum_ops_set_i_sc                      =  703,
-    enum_ops_set_n_n                       =  704,
-    enum_ops_set_n_nc                      =  705,
-    enum_ops_set_n_i                       =  706,
-    enum_ops_set_n_ic                      =  707,
-    enum_ops_set_n_s                       =  708,
-    enum_ops_set_n_sc                      =  709,
-    enum_ops_set_n_p                       =  710,
-    enum_ops_set_s_p                       =  711,
-    enum_ops_set_s_s                       =  712,
-    enum_ops_set_s_sc                      =  713,
-    enum_ops_set_s_i                       =  714,
-    enum_ops_set_s_ic                      =  715,
-    enum_ops_set_s_n                       =  716,
-    enum_ops_set_s_nc                      =  717,
-    enum_ops_set_p_pc                      =  718,
-    enum_ops_set_p_p                       =  719,
-    enum_ops_set_p_i                       =  720,
-    enum_ops_set_p_ic                      =  721,
-    enum_ops_set_p_n                       =  722,
-    enum_ops_set_p_nc                      =  723,
-    enum_ops_set_p_s                       =  724,
-    enum_ops_set_p_sc                      =  725,
-    enum_ops_set_i_p                       =  726,
-    enum_ops_assign_p_p                    =  727,
-    enum_ops_assign_p_i                    =  728,
-    enum_ops_assign_p_ic                   =  729,
-    enum_ops_assign_p_n                    =  730,
-    enum_ops_assign_p_nc                   =  731,
-    enum_ops_assign_p_s                    =  732,
-    enum_ops_assign_p_sc                   =  733,
-    enum_ops_assign_s_s                    =  734,
-    enum_ops_assign_s_sc                   =  735,
-    enum_ops_setref_p_p                    =  736,
-    enum_ops_deref_p_p                     =  737,
-    enum_ops_set_p_ki_i                    =  738,
-    enum_ops_set_p_kic_i                   =  739,
-    enum_ops_set_p_ki_ic                   =  740,
-    enum_ops_set_p_kic_ic                  =  741,
-    enum_ops_set_p_ki_n                    =  742,
-    enum_ops_set_p_kic_n                   =  743,
-    enum_ops_set_p_ki_nc                   =  744,
-    enum_ops_set_p_kic_nc                  =  745,
-    enum_ops_set_p_ki_s                    =  746,
-    enum_ops_set_p_kic_s                   =  747,
-    enum_ops_set_p_ki_sc                   =  748,
-    enum_ops_set_p_kic_sc                  =  749,
-    enum_ops_set_p_ki_p                    =  750,
-    enum_ops_set_p_kic_p                   =  751,
-    enum_ops_set_i_p_ki                    =  752,
-    enum_ops_set_i_p_kic                   =  753,
-    enum_ops_set_n_p_ki                    =  754,
-    enum_ops_set_n_p_kic                   =  755,
-    enum_ops_set_s_p_ki                    =  756,
-    enum_ops_set_s_p_kic                   =  757,
-    enum_ops_set_p_p_ki                    =  758,
-    enum_ops_set_p_p_kic                   =  759,
-    enum_ops_set_p_k_i                     =  760,
-    enum_ops_set_p_kc_i                    =  761,
-    enum_ops_set_p_k_ic                    =  762,
-    enum_ops_set_p_kc_ic                   =  763,
-    enum_ops_set_p_k_n                     =  764,
-    enum_ops_set_p_kc_n                    =  765,
-    enum_ops_set_p_k_nc                    =  766,
-    enum_ops_set_p_kc_nc                   =  767,
-    enum_ops_set_p_k_s                     =  768,
-    enum_ops_set_p_kc_s                    =  769,
-    enum_ops_set_p_k_sc                    =  770,
-    enum_ops_set_p_kc_sc                   =  771,
-    enum_ops_set_p_k_p                     =  772,
-    enum_ops_set_p_kc_p                    =  773,
-    enum_ops_set_i_p_k                     =  774,
-    enum_ops_set_i_p_kc                    =  775,
-    enum_ops_set_n_p_k                     =  776,
-    enum_ops_set_n_p_kc                    =  777,
-    enum_ops_set_s_p_k                     =  778,
-    enum_ops_set_s_p_kc                    =  779,
-    enum_ops_set_p_p_k                     =  780,
-    enum_ops_set_p_p_kc                    =  781,
-    enum_ops_clone_p_p                     =  782,
-    enum_ops_clone_p_p_p                   =  783,
-    enum_ops_clone_p_p_pc                  =  784,
-    enum_ops_copy_p_p                      =  785,
-    enum_ops_null_s                        =  786,
-    enum_ops_null_i                        =  787,
-    enum_ops_null_p                        =  788,
-    enum_ops_null_n                        =  789,
-    enum_ops_ord_i_s                       =  790,
-    enum_ops_ord_i_sc                      =  791,
-    enum_ops_ord_i_s_i                     =  792,
-    enum_ops_ord_i_sc_i                    =  793,
-    enum_ops_ord_i_s_ic                    =  794,
-    enum_ops_ord_i_sc_ic                   =  795,
-    enum_ops_chr_s_i                       =  796,
-    enum_ops_chr_s_ic                      =  797,
-    enum_ops_chopn_s_s_i                   =  798,
-    enum_ops_chopn_s_sc_i                  =  799,
-    enum_ops_chopn_s_s_ic                  =  800,
-    enum_ops_chopn_s_sc_ic                 =  801,
-    enum_ops_concat_p_p                    =  802,
-    enum_ops_concat_p_s                    =  803,
-    enum_ops_concat_p_sc                   =  804,
-    enum_ops_concat_s_s_s                  =  805,
-    enum_ops_concat_s_sc_s                 =  806,
-    enum_ops_concat_s_s_sc                 =  807,
-    enum_ops_concat_p_p_s                  =  808,
-    enum_ops_concat_p_p_sc                 =  809,
-    enum_ops_concat_p_p_p                  =  810,
-    enum_ops_repeat_s_s_i                  =  811,
-    enum_ops_repeat_s_sc_i                 =  812,
-    enum_ops_repeat_s_s_ic                 =  813,
-    enum_ops_repeat_s_sc_ic                =  814,
-    enum_ops_repeat_p_p_i                  =  815,
-    enum_ops_repeat_p_p_ic                 =  816,
-    enum_ops_repeat_p_p_p                  =  817,
-    enum_ops_repeat_p_i                    =  818,
-    enum_ops_repeat_p_ic                   =  819,
-    enum_ops_repeat_p_p                    =  820,
-    enum_ops_length_i_s                    =  821,
-    enum_ops_length_i_sc                   =  822,
-    enum_ops_bytelength_i_s                =  823,
-    enum_ops_bytelength_i_sc               =  824,
-    enum_ops_pin_s                         =  825,
-    enum_ops_unpin_s                       =  826,
-    enum_ops_substr_s_s_i                  =  827,
-    enum_ops_substr_s_sc_i                 =  828,
-    enum_ops_substr_s_s_ic                 =  829,
-    enum_ops_substr_s_sc_ic                =  830,
-    enum_ops_substr_s_s_i_i                =  831,
-    enum_ops_substr_s_sc_i_i               =  832,
-    enum_ops_substr_s_s_ic_i               =  833,
-    enum_ops_substr_s_sc_ic_i              =  834,
-    enum_ops_substr_s_s_i_ic               =  835,
-    enum_ops_substr_s_sc_i_ic              =  836,
-    enum_ops_substr_s_s_ic_ic              =  837,
-    enum_ops_substr_s_sc_ic_ic             =  838,
-    enum_ops_substr_s_p_i_i                =  839,
-    enum_ops_substr_s_p_ic_i               =  840,
-    enum_ops_substr_s_p_i_ic               =  841,
-    enum_ops_substr_s_p_ic_ic              =  842,
-    enum_ops_replace_s_s_i_i_s             =  843,
-    enum_ops_replace_s_sc_i_i_s            =  844,
-    enum_ops_replace_s_s_ic_i_s            =  845,
-    enum_ops_replace_s_sc_ic_i_s           =  846,
-    enum_ops_replace_s_s_i_ic_s            =  847,
-    enum_ops_replace_s_sc_i_ic_s           =  848,
-    enum_ops_replace_s_s_ic_ic_s           =  849,
-    enum_ops_replace_s_sc_ic_ic_s          =  850,
-    enum_ops_replace_s_s_i_i_sc            =  851,
-    enum_ops_replace_s_sc_i_i_sc           =  852,
-    enum_ops_replace_s_s_ic_i_sc           =  853,
-    enum_ops_replace_s_sc_ic_i_sc          =  854,
-    enum_ops_replace_s_s_i_ic_sc           =  855,
-    enum_ops_replace_s_sc_i_ic_sc          =  856,
-    enum_ops_replace_s_s_ic_ic_sc          =  857,
-    enum_ops_replace_s_sc_ic_ic_sc         =  858,
-    enum_ops_index_i_s_s                   =  859,
-    enum_ops_index_i_sc_s                  =  860,
-    enum_ops_index_i_s_sc                  =  861,
-    enum_ops_index_i_sc_sc                 =  862,
-    enum_ops_index_i_s_s_i                 =  863,
-    enum_ops_index_i_sc_s_i                =  864,
-    enum_ops_index_i_s_sc_i                =  865,
-    enum_ops_index_i_sc_sc_i               =  866,
-    enum_ops_index_i_s_s_ic                =  867,
-    enum_ops_index_i_sc_s_ic               =  868,
-    enum_ops_index_i_s_sc_ic               =  869,
-    enum_ops_index_i_sc_sc_ic              =  870,
-    enum_ops_rindex_i_s_s                  =  871,
-    enum_ops_rindex_i_sc_s                 =  872,
-    enum_ops_rindex_i_s_sc                 =  873,
-    enum_ops_rindex_i_sc_sc                =  874,
-    enum_ops_rindex_i_s_s_i                =  875,
-    enum_ops_rindex_i_sc_s_i               =  876,
-    enum_ops_rindex_i_s_sc_i               =  877,
-    enum_ops_rindex_i_sc_sc_i              =  878,
-    enum_ops_rindex_i_s_s_ic               =  879,
-    enum_ops_rindex_i_sc_s_ic              =  880,
-    enum_ops_rindex_i_s_sc_ic              =  881,
-    enum_ops_rindex_i_sc_sc_ic             =  882,
-    enum_ops_sprintf_s_s_p                 =  883,
-    enum_ops_sprintf_s_sc_p                =  884,
-    enum_ops_sprintf_p_p_p                 =  885,
-    enum_ops_new_s                         =  886,
-    enum_ops_stringinfo_i_s_i              =  887,
-    enum_ops_stringinfo_i_sc_i             =  888,
-    enum_ops_stringinfo_i_s_ic             =  889,
-    enum_ops_stringinfo_i_sc_ic            =  890,
-    enum_ops_upcase_s_s                    =  891,
-    enum_ops_upcase_s_sc                   =  892,
-    enum_ops_downcase_s_s                  =  893,
-    enum_ops_downcase_s_sc                 =  894,
-    enum_ops_titlecase_s_s                 =  895,
-    enum_ops_titlecase_s_sc                =  896,
-    enum_ops_foldcase_s_s                  =  897,
-    enum_ops_foldcase_s_sc                 =  898,
-    enum_ops_join_s_s_p                    =  899,
-    enum_ops_join_s_sc_p                   =  900,
-    enum_ops_split_p_s_s                   =  901,
-    enum_ops_split_p_sc_s                  =  902,
-    enum_ops_split_p_s_sc                  =  903,
-    enum_ops_split_p_sc_sc                 =  904,
-    enum_ops_encoding_i_s                  =  905,
-    enum_ops_encoding_i_sc                 =  906,
-    enum_ops_encodingname_s_i              =  907,
-    enum_ops_encodingname_s_ic             =  908,
-    enum_ops_find_encoding_i_s             =  909,
-    enum_ops_find_encoding_i_sc            =  910,
-    enum_ops_trans_encoding_s_s_i          =  911,
-    enum_ops_trans_encoding_s_sc_i         =  912,
-    enum_ops_trans_encoding_s_s_ic         =  913,
-    enum_ops_trans_encoding_s_sc_ic        =  914,
-    enum_ops_is_cclass_i_i_s_i             =  915,
-    enum_ops_is_cclass_i_ic_s_i            =  916,
-    enum_ops_is_cclass_i_i_sc_i            =  917,
-    enum_ops_is_cclass_i_ic_sc_i           =  918,
-    enum_ops_is_cclass_i_i_s_ic            =  919,
-    enum_ops_is_cclass_i_ic_s_ic           =  920,
-    enum_ops_is_cclass_i_i_sc_ic           =  921,
-    enum_ops_is_cclass_i_ic_sc_ic          =  922,
-    enum_ops_find_cclass_i_i_s_i_i         =  923,
-    enum_ops_find_cclass_i_ic_s_i_i        =  924,
-    enum_ops_find_cclass_i_i_sc_i_i        =  925,
-    enum_ops_find_cclass_i_ic_sc_i_i       =  926,
-    enum_ops_find_cclass_i_i_s_ic_i        =  927,
-    enum_ops_find_cclass_i_ic_s_ic_i       =  928,
-    enum_ops_find_cclass_i_i_sc_ic_i       =  929,
-    enum_ops_find_cclass_i_ic_sc_ic_i      =  930,
-    enum_ops_find_cclass_i_i_s_i_ic        =  931,
-    enum_ops_find_cclass_i_ic_s_i_ic       =  932,
-    enum_ops_find_cclass_i_i_sc_i_ic       =  933,
-    enum_ops_find_cclass_i_ic_sc_i_ic      =  934,
-    enum_ops_find_cclass_i_i_s_ic_ic       =  935,
-    enum_ops_find_cclass_i_ic_s_ic_ic      =  936,
-    enum_ops_find_cclass_i_i_sc_ic_ic      =  937,
-    enum_ops_find_cclass_i_ic_sc_ic_ic     =  938,
-    enum_ops_find_not_cclass_i_i_s_i_i     =  939,
-    enum_ops_find_not_cclass_i_ic_s_i_i    =  940,
-    enum_ops_find_not_cclass_i_i_sc_i_i    =  941,
-    enum_ops_find_not_cclass_i_ic_sc_i_i   =  942,
-    enum_ops_find_not_cclass_i_i_s_ic_i    =  943,
-    enum_ops_find_not_cclass_i_ic_s_ic_i   =  944,
-    enum_ops_find_not_cclass_i_i_sc_ic_i   =  945,
-    enum_ops_find_not_cclass_i_ic_sc_ic_i  =  946,
-    enum_ops_find_not_cclass_i_i_s_i_ic    =  947,
-    enum_ops_find_not_cclass_i_ic_s_i_ic   =  948,
-    enum_ops_find_not_cclass_i_i_sc_i_ic   =  949,
-    enum_ops_find_not_cclass_i_ic_sc_i_ic  =  950,
-    enum_ops_find_not_cclass_i_i_s_ic_ic   =  951,
-    enum_ops_find_not_cclass_i_ic_s_ic_ic  =  952,
-    enum_ops_find_not_cclass_i_i_sc_ic_ic  =  953,
-    enum_ops_find_not_cclass_i_ic_sc_ic_ic =  954,
-    enum_ops_escape_s_s                    =  955,
-    enum_ops_compose_s_s                   =  956,
-    enum_ops_compose_s_sc                  =  957,
-    enum_ops_find_codepoint_i_s            =  958,
-    enum_ops_find_codepoint_i_sc           =  959,
-    enum_ops_spawnw_i_s                    =  960,
-    enum_ops_spawnw_i_sc                   =  961,
-    enum_ops_spawnw_i_p                    =  962,
-    enum_ops_err_i                         =  963,
-    enum_ops_err_s                         =  964,
-    enum_ops_err_s_i                       =  965,
-    enum_ops_err_s_ic                      =  966,
-    enum_ops_time_i                        =  967,
-    enum_ops_time_n                        =  968,
-    enum_ops_sleep_i                       =  969,
-    enum_ops_sleep_ic                      =  970,
-    enum_ops_sleep_n                       =  971,
-    enum_ops_sleep_nc                      =  972,
-    enum_ops_store_lex_s_p                 =  973,
-    enum_ops_store_lex_sc_p                =  974,
-    enum_ops_store_lex_s_s                 =  975,
-    enum_ops_store_lex_sc_s                =  976,
-    enum_ops_store_lex_s_sc                =  977,
-    enum_ops_store_lex_sc_sc               =  978,
-    enum_ops_store_lex_s_i                 =  979,
-    enum_ops_store_lex_sc_i                =  980,
-    enum_ops_store_lex_s_ic                =  981,
-    enum_ops_store_lex_sc_ic               =  982,
-    enum_ops_store_lex_s_n                 =  983,
-    enum_ops_store_lex_sc_n                =  984,
-    enum_ops_store_lex_s_nc                =  985,
-    enum_ops_store_lex_sc_nc               =  986,
-    enum_ops_store_dynamic_lex_s_p         =  987,
-    enum_ops_store_dynamic_lex_sc_p        =  988,
-    enum_ops_find_lex_p_s                  =  989,
-    enum_ops_find_lex_p_sc                 =  990,
-    enum_ops_find_lex_s_s                  =  991,
-    enum_ops_find_lex_s_sc                 =  992,
-    enum_ops_find_lex_i_s                  =  993,
-    enum_ops_find_lex_i_sc                 =  994,
-    enum_ops_find_lex_n_s                  =  995,
-    enum_ops_find_lex_n_sc                 =  996,
-    enum_ops_find_dynamic_lex_p_s          =  997,
-    enum_ops_find_dynamic_lex_p_sc         =  998,
-    enum_ops_find_caller_lex_p_s           =  999,
-    enum_ops_find_caller_lex_p_sc          = 1000,
-    enum_ops_get_namespace_p               = 1001,
-    enum_ops_get_namespace_p_p             = 1002,
-    enum_ops_get_namespace_p_pc            = 1003,
-    enum_ops_get_hll_namespace_p           = 1004,
-    enum_ops_get_hll_namespace_p_p         = 1005,
-    enum_ops_get_hll_namespace_p_pc        = 1006,
-    enum_ops_get_root_namespace_p          = 1007,
-    enum_ops_get_root_namespace_p_p        = 1008,
-    enum_ops_get_root_namespace_p_pc       = 1009,
-    enum_ops_get_global_p_s                = 1010,
-    enum_ops_get_global_p_sc               = 1011,
-    enum_ops_get_global_p_p_s              = 1012,
-    enum_ops_get_global_p_pc_s             = 1013,
-    enum_ops_get_global_p_p_sc             = 1014,
-    enum_ops_get_global_p_pc_sc            = 1015,
-    enum_ops_get_hll_global_p_s            = 1016,
-    enum_ops_get_hll_global_p_sc           = 1017,
-    enum_ops_get_hll_global_p_p_s          = 1018,
-    enum_ops_get_hll_global_p_pc_s         = 1019,
-    enum_ops_get_hll_global_p_p_sc         = 1020,
-    enum_ops_get_hll_global_p_pc_sc        = 1021,
-    enum_ops_get_root_global_p_s           = 1022,
-    enum_ops_get_root_global_p_sc          = 1023,
-    enum_ops_get_root_global_p_p_s         = 1024,
-    enum_ops_get_root_global_p_pc_s        = 1025,
-    enum_ops_get_root_global_p_p_sc        = 1026,
-    enum_ops_get_root_global_p_pc_sc       = 1027,
-    enum_ops_set_global_s_p                = 1028,
-    enum_ops_set_global_sc_p               = 1029,
-    enum_ops_set_global_p_s_p              = 1030,
-    enum_ops_set_global_pc_s_p             = 1031,
-    enum_ops_set_global_p_sc_p             = 1032,
-    enum_ops_set_global_pc_sc_p            = 1033,
-    enum_ops_set_hll_global_s_p            = 1034,
-    enum_ops_set_hll_global_sc_p           = 1035,
-    enum_ops_set_hll_global_p_s_p          = 1036,
-    enum_ops_set_hll_global_pc_s_p         = 1037,
-    enum_ops_set_hll_global_p_sc_p         = 1038,
-    enum_ops_set_hll_global_pc_sc_p        = 1039,
-    enum_ops_set_root_global_s_p           = 1040,
-    enum_ops_set_root_global_sc_p          = 1041,
-    enum_ops_set_root_global_p_s_p         = 1042,
-    enum_ops_set_root_global_pc_s_p        = 1043,
-    enum_ops_set_root_global_p_sc_p        = 1044,
-    enum_ops_set_root_global_pc_sc_p       = 1045,
-    enum_ops_find_name_p_s                 = 1046,
-    enum_ops_find_name_p_sc                = 1047,
-    enum_ops_find_sub_not_null_p_s         = 1048,
-    enum_ops_find_sub_not_null_p_sc        = 1049,
-    enum_ops_trap                          = 1050,
-    enum_ops_set_label_p_ic                = 1051,
-    enum_ops_get_label_i_p                 = 1052,
-    enum_ops_get_id_i_p                    = 1053,
-    enum_ops_get_id_i_pc                   = 1054,
-    enum_ops_fetch_p_p_p_p                 = 1055,
-    enum_ops_fetch_p_pc_p_p                = 1056,
-    enum_ops_fetch_p_p_pc_p                = 1057,
-    enum_ops_fetch_p_pc_pc_p               = 1058,
-    enum_ops_fetch_p_p_p_pc                = 1059,
-    enum_ops_fetch_p_pc_p_pc               = 1060,
-    enum_ops_fetch_p_p_pc_pc               = 1061,
-    enum_ops_fetch_p_pc_pc_pc              = 1062,
-    enum_ops_fetch_p_p_i_p                 = 1063,
-    enum_ops_fetch_p_pc_i_p                = 1064,
-    enum_ops_fetch_p_p_ic_p                = 1065,
-    enum_ops_fetch_p_pc_ic_p               = 1066,
-    enum_ops_fetch_p_p_i_pc                = 1067,
-    enum_ops_fetch_p_pc_i_pc               = 1068,
-    enum_ops_fetch_p_p_ic_pc               = 1069,
-    enum_ops_fetch_p_pc_ic_pc              = 1070,
-    enum_ops_fetch_p_p_s_p                 = 1071,
-    enum_ops_fetch_p_pc_s_p                = 1072,
-    enum_ops_fetch_p_p_sc_p                = 1073,
-    enum_ops_fetch_p_pc_sc_p               = 1074,
-    enum_ops_fetch_p_p_s_pc                = 1075,
-    enum_ops_fetch_p_pc_s_pc               = 1076,
-    enum_ops_fetch_p_p_sc_pc               = 1077,
-    enum_ops_fetch_p_pc_sc_pc              = 1078,
-    enum_ops_vivify_p_p_p_p                = 1079,
-    enum_ops_vivify_p_pc_p_p               = 1080,
-    enum_ops_vivify_p_p_pc_p               = 1081,
-    enum_ops_vivify_p_pc_pc_p              = 1082,
-    enum_ops_vivify_p_p_p_pc               = 1083,
-    enum_ops_vivify_p_pc_p_pc              = 1084,
-    enum_ops_vivify_p_p_pc_pc              = 1085,
-    enum_ops_vivify_p_pc_pc_pc             = 1086,
-    enum_ops_vivify_p_p_i_p                = 1087,
-    enum_ops_vivify_p_pc_i_p               = 1088,
-    enum_ops_vivify_p_p_ic_p               = 1089,
-    enum_ops_vivify_p_pc_ic_p              = 1090,
-    enum_ops_vivify_p_p_i_pc               = 1091,
-    enum_ops_vivify_p_pc_i_pc              = 1092,
-    enum_ops_vivify_p_p_ic_pc              = 1093,
-    enum_ops_vivify_p_pc_ic_pc             = 1094,
-    enum_ops_vivify_p_p_s_p                = 1095,
-    enum_ops_vivify_p_pc_s_p               = 1096,
-    enum_ops_vivify_p_p_sc_p               = 1097,
-    enum_ops_vivify_p_pc_sc_p              = 1098,
-    enum_ops_vivify_p_p_s_pc               = 1099,
-    enum_ops_vivify_p_pc_s_pc              = 1100,
-    enum_ops_vivify_p_p_sc_pc              = 1101,
-    enum_ops_vivify_p_pc_sc_pc             = 1102,
-    enum_ops_new_p_s_i                     = 1103,
-    enum_ops_new_p_sc_i                    = 1104,
-    enum_ops_new_p_s_ic                    = 1105,
-    enum_ops_new_p_sc_ic                   = 1106,
-    enum_ops_new_p_p_i                     = 1107,
-    enum_ops_new_p_pc_i                    = 1108,
-    enum_ops_new_p_p_ic                    = 1109,
-    enum_ops_new_p_pc_ic                   = 1110,
-    enum_ops_root_new_p_p_i                = 1111,
-    enum_ops_root_new_p_pc_i               = 1112,
-    enum_ops_root_new_p_p_ic               = 1113,
-    enum_ops_root_new_p_pc_ic              = 1114,
-    enum_ops_get_context_p                 = 1115,
-    enum_ops_new_call_context_p            = 1116,
-    enum_ops_invokecc_p_p                  = 1117,
-    enum_ops_flatten_array_into_p_p_i      = 1118,
-    enum_ops_flatten_array_into_p_p_ic     = 1119,
-    enum_ops_flatten_hash_into_p_p_i       = 1120,
-    enum_ops_flatten_hash_into_p_p_ic      = 1121,
-    enum_ops_slurp_array_from_p_p_i        = 1122,
-    enum_ops_slurp_array_from_p_p_ic       = 1123,
-    enum_ops_receive_p                     = 1124,
-    enum_ops_wait_p                        = 1125,
-    enum_ops_wait_pc                       = 1126,
-    enum_ops_pass                          = 1127,
-    enum_ops_disable_preemption            = 1128,
-    enum_ops_enable_preemption             = 1129,
-    enum_ops_terminate                     = 1130,
+    enum_ops_freeze_p_p                    =  677,
+    enum_ops_thaw_p_p                      =  678,
+    enum_ops_add_multi_s_s_p               =  679,
+    enum_ops_add_multi_sc_s_p              =  680,
+    enum_ops_add_multi_s_sc_p              =  681,
+    enum_ops_add_multi_sc_sc_p             =  682,
+    enum_ops_find_multi_p_s_s              =  683,
+    enum_ops_find_multi_p_sc_s             =  684,
+    enum_ops_find_multi_p_s_sc             =  685,
+    enum_ops_find_multi_p_sc_sc            =  686,
+    enum_ops_register_p                    =  687,
+    enum_ops_unregister_p                  =  688,
+    enum_ops_box_p_i                       =  689,
+    enum_ops_box_p_ic                      =  690,
+    enum_ops_box_p_n                       =  691,
+    enum_ops_box_p_nc                      =  692,
+    enum_ops_box_p_s                       =  693,
+    enum_ops_box_p_sc                      =  694,
+    enum_ops_iter_p_p                      =  695,
+    enum_ops_morph_p_p                     =  696,
+    enum_ops_morph_p_pc                    =  697,
+    enum_ops_clone_s_s                     =  698,
+    enum_ops_clone_s_sc                    =  699,
+    enum_ops_set_i_i                       =  700,
+    enum_ops_set_i_ic                      =  701,
+    enum_ops_set_i_n                       =  702,
+    enum_ops_set_i_nc                      =  703,
+    enum_ops_set_i_s                       =  704,
+    enum_ops_set_i_sc                      =  705,
+    enum_ops_set_n_n                       =  706,
+    enum_ops_set_n_nc                      =  707,
+    enum_ops_set_n_i                       =  708,
+    enum_ops_set_n_ic                      =  709,
+    enum_ops_set_n_s                       =  710,
+    enum_ops_set_n_sc                      =  711,
+    enum_ops_set_n_p                       =  712,
+    enum_ops_set_s_p                       =  713,
+    enum_ops_set_s_s                       =  714,
+    enum_ops_set_s_sc                      =  715,
+    enum_ops_set_s_i                       =  716,
+    enum_ops_set_s_ic                      =  717,
+    enum_ops_set_s_n                       =  718,
+    enum_ops_set_s_nc                      =  719,
+    enum_ops_set_p_pc                      =  720,
+    enum_ops_set_p_p                       =  721,
+    enum_ops_set_p_i                       =  722,
+    enum_ops_set_p_ic                      =  723,
+    enum_ops_set_p_n                       =  724,
+    enum_ops_set_p_nc                      =  725,
+    enum_ops_set_p_s                       =  726,
+    enum_ops_set_p_sc                      =  727,
+    enum_ops_set_i_p                       =  728,
+    enum_ops_assign_p_p                    =  729,
+    enum_ops_assign_p_i                    =  730,
+    enum_ops_assign_p_ic                   =  731,
+    enum_ops_assign_p_n                    =  732,
+    enum_ops_assign_p_nc                   =  733,
+    enum_ops_assign_p_s                    =  734,
+    enum_ops_assign_p_sc                   =  735,
+    enum_ops_assign_s_s                    =  736,
+    enum_ops_assign_s_sc                   =  737,
+    enum_ops_setref_p_p                    =  738,
+    enum_ops_deref_p_p                     =  739,
+    enum_ops_set_p_ki_i                    =  740,
+    enum_ops_set_p_kic_i                   =  741,
+    enum_ops_set_p_ki_ic                   =  742,
+    enum_ops_set_p_kic_ic                  =  743,
+    enum_ops_set_p_ki_n                    =  744,
+    enum_ops_set_p_kic_n                   =  745,
+    enum_ops_set_p_ki_nc                   =  746,
+    enum_ops_set_p_kic_nc                  =  747,
+    enum_ops_set_p_ki_s                    =  748,
+    enum_ops_set_p_kic_s                   =  749,
+    enum_ops_set_p_ki_sc                   =  750,
+    enum_ops_set_p_kic_sc                  =  751,
+    enum_ops_set_p_ki_p                    =  752,
+    enum_ops_set_p_kic_p                   =  753,
+    enum_ops_set_i_p_ki                    =  754,
+    enum_ops_set_i_p_kic                   =  755,
+    enum_ops_set_n_p_ki                    =  756,
+    enum_ops_set_n_p_kic                   =  757,
+    enum_ops_set_s_p_ki                    =  758,
+    enum_ops_set_s_p_kic                   =  759,
+    enum_ops_set_p_p_ki                    =  760,
+    enum_ops_set_p_p_kic                   =  761,
+    enum_ops_set_p_k_i                     =  762,
+    enum_ops_set_p_kc_i                    =  763,
+    enum_ops_set_p_k_ic                    =  764,
+    enum_ops_set_p_kc_ic                   =  765,
+    enum_ops_set_p_k_n                     =  766,
+    enum_ops_set_p_kc_n                    =  767,
+    enum_ops_set_p_k_nc                    =  768,
+    enum_ops_set_p_kc_nc                   =  769,
+    enum_ops_set_p_k_s                     =  770,
+    enum_ops_set_p_kc_s                    =  771,
+    enum_ops_set_p_k_sc                    =  772,
+    enum_ops_set_p_kc_sc                   =  773,
+    enum_ops_set_p_k_p                     =  774,
+    enum_ops_set_p_kc_p                    =  775,
+    enum_ops_set_i_p_k                     =  776,
+    enum_ops_set_i_p_kc                    =  777,
+    enum_ops_set_n_p_k                     =  778,
+    enum_ops_set_n_p_kc                    =  779,
+    enum_ops_set_s_p_k                     =  780,
+    enum_ops_set_s_p_kc                    =  781,
+    enum_ops_set_p_p_k                     =  782,
+    enum_ops_set_p_p_kc                    =  783,
+    enum_ops_clone_p_p                     =  784,
+    enum_ops_clone_p_p_p                   =  785,
+    enum_ops_clone_p_p_pc                  =  786,
+    enum_ops_copy_p_p                      =  787,
+    enum_ops_null_s                        =  788,
+    enum_ops_null_i                        =  789,
+    enum_ops_null_p                        =  790,
+    enum_ops_null_n                        =  791,
+    enum_ops_ord_i_s                       =  792,
+    enum_ops_ord_i_sc                      =  793,
+    enum_ops_ord_i_s_i                     =  794,
+    enum_ops_ord_i_sc_i                    =  795,
+    enum_ops_ord_i_s_ic                    =  796,
+    enum_ops_ord_i_sc_ic                   =  797,
+    enum_ops_chr_s_i                       =  798,
+    enum_ops_chr_s_ic                      =  799,
+    enum_ops_chopn_s_s_i                   =  800,
+    enum_ops_chopn_s_sc_i                  =  801,
+    enum_ops_chopn_s_s_ic                  =  802,
+    enum_ops_chopn_s_sc_ic                 =  803,
+    enum_ops_concat_p_p                    =  804,
+    enum_ops_concat_p_s                    =  805,
+    enum_ops_concat_p_sc                   =  806,
+    enum_ops_concat_s_s_s                  =  807,
+    enum_ops_concat_s_sc_s                 =  808,
+    enum_ops_concat_s_s_sc                 =  809,
+    enum_ops_concat_p_p_s                  =  810,
+    enum_ops_concat_p_p_sc                 =  811,
+    enum_ops_concat_p_p_p                  =  812,
+    enum_ops_repeat_s_s_i                  =  813,
+    enum_ops_repeat_s_sc_i                 =  814,
+    enum_ops_repeat_s_s_ic                 =  815,
+    enum_ops_repeat_s_sc_ic                =  816,
+    enum_ops_repeat_p_p_i                  =  817,
+    enum_ops_repeat_p_p_ic                 =  818,
+    enum_ops_repeat_p_p_p                  =  819,
+    enum_ops_repeat_p_i                    =  820,
+    enum_ops_repeat_p_ic                   =  821,
+    enum_ops_repeat_p_p                    =  822,
+    enum_ops_length_i_s                    =  823,
+    enum_ops_length_i_sc                   =  824,
+    enum_ops_bytelength_i_s                =  825,
+    enum_ops_bytelength_i_sc               =  826,
+    enum_ops_pin_s                         =  827,
+    enum_ops_unpin_s                       =  828,
+    enum_ops_substr_s_s_i                  =  829,
+    enum_ops_substr_s_sc_i                 =  830,
+    enum_ops_substr_s_s_ic                 =  831,
+    enum_ops_substr_s_sc_ic                =  832,
+    enum_ops_substr_s_s_i_i                =  833,
+    enum_ops_substr_s_sc_i_i               =  834,
+    enum_ops_substr_s_s_ic_i               =  835,
+    enum_ops_substr_s_sc_ic_i              =  836,
+    enum_ops_substr_s_s_i_ic               =  837,
+    enum_ops_substr_s_sc_i_ic              =  838,
+    enum_ops_substr_s_s_ic_ic              =  839,
+    enum_ops_substr_s_sc_ic_ic             =  840,
+    enum_ops_substr_s_p_i_i                =  841,
+    enum_ops_substr_s_p_ic_i               =  842,
+    enum_ops_substr_s_p_i_ic               =  843,
+    enum_ops_substr_s_p_ic_ic              =  844,
+    enum_ops_replace_s_s_i_i_s             =  845,
+    enum_ops_replace_s_sc_i_i_s            =  846,
+    enum_ops_replace_s_s_ic_i_s            =  847,
+    enum_ops_replace_s_sc_ic_i_s           =  848,
+    enum_ops_replace_s_s_i_ic_s            =  849,
+    enum_ops_replace_s_sc_i_ic_s           =  850,
+    enum_ops_replace_s_s_ic_ic_s           =  851,
+    enum_ops_replace_s_sc_ic_ic_s          =  852,
+    enum_ops_replace_s_s_i_i_sc            =  853,
+    enum_ops_replace_s_sc_i_i_sc           =  854,
+    enum_ops_replace_s_s_ic_i_sc           =  855,
+    enum_ops_replace_s_sc_ic_i_sc          =  856,
+    enum_ops_replace_s_s_i_ic_sc           =  857,
+    enum_ops_replace_s_sc_i_ic_sc          =  858,
+    enum_ops_replace_s_s_ic_ic_sc          =  859,
+    enum_ops_replace_s_sc_ic_ic_sc         =  860,
+    enum_ops_index_i_s_s                   =  861,
+    enum_ops_index_i_sc_s                  =  862,
+    enum_ops_index_i_s_sc                  =  863,
+    enum_ops_index_i_sc_sc                 =  864,
+    enum_ops_index_i_s_s_i                 =  865,
+    enum_ops_index_i_sc_s_i                =  866,
+    enum_ops_index_i_s_sc_i                =  867,
+    enum_ops_index_i_sc_sc_i               =  868,
+    enum_ops_index_i_s_s_ic                =  869,
+    enum_ops_index_i_sc_s_ic               =  870,
+    enum_ops_index_i_s_sc_ic               =  871,
+    enum_ops_index_i_sc_sc_ic              =  872,
+    enum_ops_rindex_i_s_s                  =  873,
+    enum_ops_rindex_i_sc_s                 =  874,
+    enum_ops_rindex_i_s_sc                 =  875,
+    enum_ops_rindex_i_sc_sc                =  876,
+    enum_ops_rindex_i_s_s_i                =  877,
+    enum_ops_rindex_i_sc_s_i               =  878,
+    enum_ops_rindex_i_s_sc_i               =  879,
+    enum_ops_rindex_i_sc_sc_i              =  880,
+    enum_ops_rindex_i_s_s_ic               =  881,
+    enum_ops_rindex_i_sc_s_ic              =  882,
+    enum_ops_rindex_i_s_sc_ic              =  883,
+    enum_ops_rindex_i_sc_sc_ic             =  884,
+    enum_ops_sprintf_s_s_p                 =  885,
+    enum_ops_sprintf_s_sc_p                =  886,
+    enum_ops_sprintf_p_p_p                 =  887,
+    enum_ops_new_s                         =  888,
+    enum_ops_stringinfo_i_s_i              =  889,
+    enum_ops_stringinfo_i_sc_i             =  890,
+    enum_ops_stringinfo_i_s_ic             =  891,
+    enum_ops_stringinfo_i_sc_ic            =  892,
+    enum_ops_upcase_s_s                    =  893,
+    enum_ops_upcase_s_sc                   =  894,
+    enum_ops_downcase_s_s                  =  895,
+    enum_ops_downcase_s_sc                 =  896,
+    enum_ops_titlecase_s_s                 =  897,
+    enum_ops_titlecase_s_sc                =  898,
+    enum_ops_foldcase_s_s                  =  899,
+    enum_ops_foldcase_s_sc                 =  900,
+    enum_ops_join_s_s_p                    =  901,
+    enum_ops_join_s_sc_p                   =  902,
+    enum_ops_split_p_s_s                   =  903,
+    enum_ops_split_p_sc_s                  =  904,
+    enum_ops_split_p_s_sc                  =  905,
+    enum_ops_split_p_sc_sc                 =  906,
+    enum_ops_encoding_i_s                  =  907,
+    enum_ops_encoding_i_sc                 =  908,
+    enum_ops_encodingname_s_i              =  909,
+    enum_ops_encodingname_s_ic             =  910,
+    enum_ops_find_encoding_i_s             =  911,
+    enum_ops_find_encoding_i_sc            =  912,
+    enum_ops_trans_encoding_s_s_i          =  913,
+    enum_ops_trans_encoding_s_sc_i         =  914,
+    enum_ops_trans_encoding_s_s_ic         =  915,
+    enum_ops_trans_encoding_s_sc_ic        =  916,
+    enum_ops_is_cclass_i_i_s_i             =  917,
+    enum_ops_is_cclass_i_ic_s_i            =  918,
+    enum_ops_is_cclass_i_i_sc_i            =  919,
+    enum_ops_is_cclass_i_ic_sc_i           =  920,
+    enum_ops_is_cclass_i_i_s_ic            =  921,
+    enum_ops_is_cclass_i_ic_s_ic           =  922,
+    enum_ops_is_cclass_i_i_sc_ic           =  923,
+    enum_ops_is_cclass_i_ic_sc_ic          =  924,
+    enum_ops_find_cclass_i_i_s_i_i         =  925,
+    enum_ops_find_cclass_i_ic_s_i_i        =  926,
+    enum_ops_find_cclass_i_i_sc_i_i        =  927,
+    enum_ops_find_cclass_i_ic_sc_i_i       =  928,
+    enum_ops_find_cclass_i_i_s_ic_i        =  929,
+    enum_ops_find_cclass_i_ic_s_ic_i       =  930,
+    enum_ops_find_cclass_i_i_sc_ic_i       =  931,
+    enum_ops_find_cclass_i_ic_sc_ic_i      =  932,
+    enum_ops_find_cclass_i_i_s_i_ic        =  933,
+    enum_ops_find_cclass_i_ic_s_i_ic       =  934,
+    enum_ops_find_cclass_i_i_sc_i_ic       =  935,
+    enum_ops_find_cclass_i_ic_sc_i_ic      =  936,
+    enum_ops_find_cclass_i_i_s_ic_ic       =  937,
+    enum_ops_find_cclass_i_ic_s_ic_ic      =  938,
+    enum_ops_find_cclass_i_i_sc_ic_ic      =  939,
+    enum_ops_find_cclass_i_ic_sc_ic_ic     =  940,
+    enum_ops_find_not_cclass_i_i_s_i_i     =  941,
+    enum_ops_find_not_cclass_i_ic_s_i_i    =  942,
+    enum_ops_find_not_cclass_i_i_sc_i_i    =  943,
+    enum_ops_find_not_cclass_i_ic_sc_i_i   =  944,
+    enum_ops_find_not_cclass_i_i_s_ic_i    =  945,
+    enum_ops_find_not_cclass_i_ic_s_ic_i   =  946,
+    enum_ops_find_not_cclass_i_i_sc_ic_i   =  947,
+    enum_ops_find_not_cclass_i_ic_sc_ic_i  =  948,
+    enum_ops_find_not_cclass_i_i_s_i_ic    =  949,
+    enum_ops_find_not_cclass_i_ic_s_i_ic   =  950,
+    enum_ops_find_not_cclass_i_i_sc_i_ic   =  951,
+    enum_ops_find_not_cclass_i_ic_sc_i_ic  =  952,
+    enum_ops_find_not_cclass_i_i_s_ic_ic   =  953,
+    enum_ops_find_not_cclass_i_ic_s_ic_ic  =  954,
+    enum_ops_find_not_cclass_i_i_sc_ic_ic  =  955,
+    enum_ops_find_not_cclass_i_ic_sc_ic_ic =  956,
+    enum_ops_escape_s_s                    =  957,
+    enum_ops_compose_s_s                   =  958,
+    enum_ops_compose_s_sc                  =  959,
+    enum_ops_find_codepoint_i_s            =  960,
+    enum_ops_find_codepoint_i_sc           =  961,
+    enum_ops_spawnw_i_s                    =  962,
+    enum_ops_spawnw_i_sc                   =  963,
+    enum_ops_spawnw_i_p                    =  964,
+    enum_ops_err_i                         =  965,
+    enum_ops_err_s                         =  966,
+    enum_ops_err_s_i                       =  967,
+    enum_ops_err_s_ic                      =  968,
+    enum_ops_time_i                        =  969,
+    enum_ops_time_n                        =  970,
+    enum_ops_sleep_i                       =  971,
+    enum_ops_sleep_ic                      =  972,
+    enum_ops_sleep_n                       =  973,
+    enum_ops_sleep_nc                      =  974,
+    enum_ops_store_lex_s_p                 =  975,
+    enum_ops_store_lex_sc_p                =  976,
+    enum_ops_store_lex_s_s                 =  977,
+    enum_ops_store_lex_sc_s                =  978,
+    enum_ops_store_lex_s_sc                =  979,
+    enum_ops_store_lex_sc_sc               =  980,
+    enum_ops_store_lex_s_i                 =  981,
+    enum_ops_store_lex_sc_i                =  982,
+    enum_ops_store_lex_s_ic                =  983,
+    enum_ops_store_lex_sc_ic               =  984,
+    enum_ops_store_lex_s_n                 =  985,
+    enum_ops_store_lex_sc_n                =  986,
+    enum_ops_store_lex_s_nc                =  987,
+    enum_ops_store_lex_sc_nc               =  988,
+    enum_ops_store_dynamic_lex_s_p         =  989,
+    enum_ops_store_dynamic_lex_sc_p        =  990,
+    enum_ops_find_lex_p_s                  =  991,
+    enum_ops_find_lex_p_sc                 =  992,
+    enum_ops_find_lex_s_s                  =  993,
+    enum_ops_find_lex_s_sc                 =  994,
+    enum_ops_find_lex_i_s                  =  995,
+    enum_ops_find_lex_i_sc                 =  996,
+    enum_ops_find_lex_n_s                  =  997,
+    enum_ops_find_lex_n_sc                 =  998,
+    enum_ops_find_lex_idx_p_sc_pc_ic_ic    =  999,
+    enum_ops_find_lex_idx_s_sc_pc_ic_ic    = 1000,
+    enum_ops_find_lex_idx_i_sc_pc_ic_ic    = 1001,
+    enum_ops_find_lex_idx_n_sc_pc_ic_ic    = 1002,
+    enum_ops_store_lex_idx_sc_p_pc_ic_ic   = 1003,
+    enum_ops_store_lex_idx_sc_s_pc_ic_ic   = 1004,
+    enum_ops_store_lex_idx_sc_sc_pc_ic_ic  = 1005,
+    enum_ops_store_lex_idx_sc_i_pc_ic_ic   = 1006,
+    enum_ops_store_lex_idx_sc_ic_pc_ic_ic  = 1007,
+    enum_ops_store_lex_idx_sc_n_pc_ic_ic   = 1008,
+    enum_ops_store_lex_idx_sc_nc_pc_ic_ic  = 1009,
+    enum_ops_find_dynamic_lex_p_s          = 1010,
+    enum_ops_find_dynamic_lex_p_sc         = 1011,
+    enum_ops_find_caller_lex_p_s           = 1012,
+    enum_ops_find_caller_lex_p_sc          = 1013,
+    enum_ops_get_namespace_p               = 1014,
+    enum_ops_get_namespace_p_p             = 1015,
+    enum_ops_get_namespace_p_pc            = 1016,
+    enum_ops_get_hll_namespace_p           = 1017,
+    enum_ops_get_hll_namespace_p_p         = 1018,
+    enum_ops_get_hll_namespace_p_pc        = 1019,
+    enum_ops_get_root_namespace_p          = 1020,
+    enum_ops_get_root_namespace_p_p        = 1021,
+    enum_ops_get_root_namespace_p_pc       = 1022,
+    enum_ops_get_global_p_s                = 1023,
+    enum_ops_get_global_p_sc               = 1024,
+    enum_ops_get_global_p_p_s              = 1025,
+    enum_ops_get_global_p_pc_s             = 1026,
+    enum_ops_get_global_p_p_sc             = 1027,
+    enum_ops_get_global_p_pc_sc            = 1028,
+    enum_ops_get_hll_global_p_s            = 1029,
+    enum_ops_get_hll_global_p_sc           = 1030,
+    enum_ops_get_hll_global_p_p_s          = 1031,
+    enum_ops_get_hll_global_p_pc_s         = 1032,
+    enum_ops_get_hll_global_p_p_sc         = 1033,
+    enum_ops_get_hll_global_p_pc_sc        = 1034,
+    enum_ops_get_root_global_p_s           = 1035,
+    enum_ops_get_root_global_p_sc          = 1036,
+    enum_ops_get_root_global_p_p_s         = 1037,
+    enum_ops_get_root_global_p_pc_s        = 1038,
+    enum_ops_get_root_global_p_p_sc        = 1039,
+    enum_ops_get_root_global_p_pc_sc       = 1040,
+    enum_ops_get_global_ic_p_sc_ic         = 1041,
+    enum_ops_get_global_ic_p_pc_sc_ic      = 1042,
+    enum_ops_get_hll_global_ic_p_sc_ic     = 1043,
+    enum_ops_get_hll_global_ic_p_pc_sc_ic  = 1044,
+    enum_ops_get_root_global_ic_p_sc_ic    = 1045,
+    enum_ops_get_root_global_ic_p_pc_sc_ic = 1046,
+    enum_ops_set_global_s_p                = 1047,
+    enum_ops_set_global_sc_p               = 1048,
+    enum_ops_set_global_p_s_p              = 1049,
+    enum_ops_set_global_pc_s_p             = 1050,
+    enum_ops_set_global_p_sc_p             = 1051,
+    enum_ops_set_global_pc_sc_p            = 1052,
+    enum_ops_set_hll_global_s_p            = 1053,
+    enum_ops_set_hll_global_sc_p           = 1054,
+    enum_ops_set_hll_global_p_s_p          = 1055,
+    enum_ops_set_hll_global_pc_s_p         = 1056,
+    enum_ops_set_hll_global_p_sc_p         = 1057,
+    enum_ops_set_hll_global_pc_sc_p        = 1058,
+    enum_ops_set_root_global_s_p           = 1059,
+    enum_ops_set_root_global_sc_p          = 1060,
+    enum_ops_set_root_global_p_s_p         = 1061,
+    enum_ops_set_root_global_pc_s_p        = 1062,
+    enum_ops_set_root_global_p_sc_p        = 1063,
+    enum_ops_set_root_global_pc_sc_p       = 1064,
+    enum_ops_find_name_p_s                 = 1065,
+    enum_ops_find_name_p_sc                = 1066,
+    enum_ops_find_sub_not_null_p_s         = 1067,
+    enum_ops_find_sub_not_null_p_sc        = 1068,
+    enum_ops_trap                          = 1069,
+    enum_ops_set_label_p_ic                = 1070,
+    enum_ops_get_label_i_p                 = 1071,
+    enum_ops_get_id_i_p                    = 1072,
+    enum_ops_get_id_i_pc                   = 1073,
+    enum_ops_fetch_p_p_p_p                 = 1074,
+    enum_ops_fetch_p_pc_p_p                = 1075,
+    enum_ops_fetch_p_p_pc_p                = 1076,
+    enum_ops_fetch_p_pc_pc_p               = 1077,
+    enum_ops_fetch_p_p_p_pc                = 1078,
+    enum_ops_fetch_p_pc_p_pc               = 1079,
+    enum_ops_fetch_p_p_pc_pc               = 1080,
+    enum_ops_fetch_p_pc_pc_pc              = 1081,
+    enum_ops_fetch_p_p_i_p                 = 1082,
+    enum_ops_fetch_p_pc_i_p                = 1083,
+    enum_ops_fetch_p_p_ic_p                = 1084,
+    enum_ops_fetch_p_pc_ic_p               = 1085,
+    enum_ops_fetch_p_p_i_pc                = 1086,
+    enum_ops_fetch_p_pc_i_pc               = 1087,
+    enum_ops_fetch_p_p_ic_pc               = 1088,
+    enum_ops_fetch_p_pc_ic_pc              = 1089,
+    enum_ops_fetch_p_p_s_p                 = 1090,
+    enum_ops_fetch_p_pc_s_p                = 1091,
+    enum_ops_fetch_p_p_sc_p                = 1092,
+    enum_ops_fetch_p_pc_sc_p               = 1093,
+    enum_ops_fetch_p_p_s_pc                = 1094,
+    enum_ops_fetch_p_pc_s_pc               = 1095,
+    enum_ops_fetch_p_p_sc_pc               = 1096,
+    enum_ops_fetch_p_pc_sc_pc              = 1097,
+    enum_ops_vivify_p_p_p_p                = 1098,
+    enum_ops_vivify_p_pc_p_p               = 1099,
+    enum_ops_vivify_p_p_pc_p               = 1100,
+    enum_ops_vivify_p_pc_pc_p              = 1101,
+    enum_ops_vivify_p_p_p_pc               = 1102,
+    enum_ops_vivify_p_pc_p_pc              = 1103,
+    enum_ops_vivify_p_p_pc_pc              = 1104,
+    enum_ops_vivify_p_pc_pc_pc             = 1105,
+    enum_ops_vivify_p_p_i_p                = 1106,
+    enum_ops_vivify_p_pc_i_p               = 1107,
+    enum_ops_vivify_p_p_ic_p               = 1108,
+    enum_ops_vivify_p_pc_ic_p              = 1109,
+    enum_ops_vivify_p_p_i_pc               = 1110,
+    enum_ops_vivify_p_pc_i_pc              = 1111,
+    enum_ops_vivify_p_p_ic_pc              = 1112,
+    enum_ops_vivify_p_pc_ic_pc             = 1113,
+    enum_ops_vivify_p_p_s_p                = 1114,
+    enum_ops_vivify_p_pc_s_p               = 1115,
+    enum_ops_vivify_p_p_sc_p               = 1116,
+    enum_ops_vivify_p_pc_sc_p              = 1117,
+    enum_ops_vivify_p_p_s_pc               = 1118,
+    enum_ops_vivify_p_pc_s_pc              = 1119,
+    enum_ops_vivify_p_p_sc_pc              = 1120,
+    enum_ops_vivify_p_pc_sc_pc             = 1121,
+    enum_ops_new_p_s_i                     = 1122,
+    enum_ops_new_p_sc_i                    = 1123,
+    enum_ops_new_p_s_ic                    = 1124,
+    enum_ops_new_p_sc_ic                   = 1125,
+    enum_ops_new_p_p_i                     = 1126,
+    enum_ops_new_p_pc_i                    = 1127,
+    enum_ops_new_p_p_ic                    = 1128,
+    enum_ops_new_p_pc_ic                   = 1129,
+    enum_ops_root_new_p_p_i                = 1130,
+    enum_ops_root_new_p_pc_i               = 1131,
+    enum_ops_root_new_p_p_ic               = 1132,
+    enum_ops_root_new_p_pc_ic              = 1133,
+    enum_ops_get_context_p                 = 1134,
+    enum_ops_new_call_context_p            = 1135,
+    enum_ops_invokecc_p_p                  = 1136,
+    enum_ops_flatten_array_into_p_p_i      = 1137,
+    enum_ops_flatten_array_into_p_p_ic     = 1138,
+    enum_ops_flatten_hash_into_p_p_i       = 1139,
+    enum_ops_flatten_hash_into_p_p_ic      = 1140,
+    enum_ops_slurp_array_from_p_p_i        = 1141,
+    enum_ops_slurp_array_from_p_p_ic       = 1142,
+    enum_ops_receive_p                     = 1143,
+    enum_ops_wait_p                        = 1144,
+    enum_ops_wait_pc                       = 1145,
+    enum_ops_pass                          = 1146,
+    enum_ops_disable_preemption            = 1147,
+    enum_ops_enable_preemption             = 1148,
+    enum_ops_terminate                     = 1149,
+    enum_ops_throw_control_i               = 1150,
+    enum_ops_throw_control_ic              = 1151,
+    enum_ops_throw_control_i_p             = 1152,
+    enum_ops_throw_control_ic_p            = 1153,
+    enum_ops_resume_p_p                    = 1154,
+    enum_ops_yield_p                       = 1155,
+    enum_ops_share_ro_p_p                  = 1156,
 };
 
 
@@ -325,6 +325,9 @@ INTVAL Parrot_intval_time(void);
 PARROT_EXPORT
 FLOATVAL Parrot_floatval_time(void);
 
+PARROT_EXPORT
+FLOATVAL Parrot_floatval_monotonic_time(void);
+
 PARROT_EXPORT
 struct tm * Parrot_gmtime_r(const time_t *, struct tm *);
 
@@ -425,6 +428,9 @@ UINTVAL Parrot_get_user_id(void);
 PARROT_EXPORT
 size_t Parrot_sysmem_amount(Interp*);
 
+PARROT_EXPORT
+size_t Parrot_sysmem_max_rss(Interp*);
+
 /*
  * Entropy
  */
@@ -0,0 +1,80 @@
+/* runcore_counters.h
+ *  Copyright (C) 2026, Parrot Foundation.
+ *  Overview:
+ *     Hardware performance counters runcores can attach to.
+ */
+
+#ifndef PARROT_RUNCORE_COUNTERS_H_GUARD
+#define PARROT_RUNCORE_COUNTERS_H_GUARD
+
+/* the counters we know how to open, in the order they are reported */
+typedef enum {
+    PARROT_COUNTER_CYCLES,
+    PARROT_COUNTER_INSTRUCTIONS,
+    PARROT_COUNTER_CACHE_MISSES,
+    PARROT_COUNTER_BRANCH_MISSES,
+    PARROT_COUNTER_TASK_CLOCK,
+    PARROT_COUNTER_PAGE_FAULTS,
+    PARROT_MAX_COUNTERS
+} Parrot_runcore_counter;
+
+typedef struct Parrot_runcore_counters {
+    /* the group leader, reading it reads the whole group */
+    int                     leader;
+    /* number of counters actually opened */
+    unsigned int            num;
+    int                     fd[PARROT_MAX_COUNTERS];
+    Parrot_runcore_counter  counter[PARROT_MAX_COUNTERS];
+    /* values of the last successful read, handed out again if a read fails */
+    UHUGEINTVAL             last[PARROT_MAX_COUNTERS];
+} Parrot_runcore_counters;
+
+/* HEADERIZER BEGIN: src/runcore/counters.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+PARROT_CONST_FUNCTION
+PARROT_CANNOT_RETURN_NULL
+const char * Parrot_runcore_counter_name(Parrot_runcore_counter counter);
+
+PARROT_EXPORT
+void Parrot_runcore_counters_close(PARROT_INTERP,
+    ARGFREE(Parrot_runcore_counters *c))
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+Parrot_runcore_counters * Parrot_runcore_counters_open(PARROT_INTERP,
+    ARGIN(STRING *spec))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_EXPORT
+unsigned int Parrot_runcore_counters_read(
+    ARGMOD(Parrot_runcore_counters *c),
+    ARGOUT(UHUGEINTVAL *values))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*c)
+        FUNC_MODIFIES(*values);
+
+#define ASSERT_ARGS_Parrot_runcore_counter_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_runcore_counters_close __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_counters_open __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(spec))
+#define ASSERT_ARGS_Parrot_runcore_counters_read __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(c) \
+    , PARROT_ASSERT_ARG(values))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/counters.c */
+
+#endif /* PARROT_RUNCORE_COUNTERS_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
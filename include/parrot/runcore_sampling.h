@@ -0,0 +1,79 @@
+/* runcore_sampling.h
+ *  Copyright (C) 2026, Parrot Foundation.
+ *  Overview:
+ *     Data structures of the sampling profiler runcore.
+ */
+
+#ifndef PARROT_RUNCORE_SAMPLING_H_GUARD
+#define PARROT_RUNCORE_SAMPLING_H_GUARD
+
+typedef struct sampling_runcore_t Parrot_sampling_runcore_t;
+
+/* ops run between two looks at the alarm serial */
+#define SAMPLING_CHECK_OPS          128
+
+/* deepest call chain recorded by a sample, innermost frames are kept */
+#define SAMPLING_MAX_DEPTH          128
+
+/* UINTVALs in the sample ring, must be a power of two */
+#define SAMPLING_RING_SIZE          65536
+
+/* default time between two samples, in seconds */
+#define SAMPLING_DEFAULT_INTERVAL   0.001
+
+struct sampling_runcore_t {
+    STRING                      *name;
+    int                          id;
+    oplib_init_f                 opinit;
+    Parrot_runcore_runops_fn_t   runops;
+    Parrot_runcore_destroy_fn_t  destroy;
+    Parrot_runcore_prepare_fn_t  prepare_run;
+    INTVAL                       flags;
+
+    /* the interpreter being sampled, NULL until the first run */
+    Interp      *interp;
+    /* where the folded stacks are written */
+    FILE        *out;
+
+    /* seconds between two samples, and when the next one is due */
+    FLOATVAL     interval;
+    FLOATVAL     next_sample;
+    /* alarm serial last seen by the runloop */
+    UINTVAL      last_alarm;
+
+    /* sample records: a depth followed by that many (sub, pc) pairs.
+     * head and tail only ever grow and are masked on access */
+    UINTVAL     *ring;
+    UINTVAL      head;
+    UINTVAL      tail;
+    /* scratch space for a single call chain */
+    UINTVAL     *chain;
+
+    /* interned Subs: maps a Sub PMC to its index + 1 in subs */
+    Hash        *sub_index;
+    PMC         *subs;
+    /* maps a packed call chain to the number of samples that hit it */
+    PMC         *stacks;
+
+    UINTVAL      samples;
+};
+
+/* HEADERIZER BEGIN: src/runcore/sampling.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_runcore_sampling_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_runcore_sampling_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/sampling.c */
+
+#endif /* PARROT_RUNCORE_SAMPLING_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -9,6 +9,11 @@
 
 
 #include "pmc/pmc_sub.h"
+#include "parrot/runcore_counters.h"
+
+/* events measured for lines and calls: CPU ticks, then the counters */
+#define SUBPROF_EVENT_TICKS 0
+#define SUBPROF_MAX_EVENTS  (1 + PARROT_MAX_COUNTERS)
 
 typedef struct subprofile subprofile;
 typedef struct callinfo callinfo;
@@ -23,8 +28,8 @@ struct callinfo {
     UINTVAL       count;
     /* how many ops where executed in it (including subcalls) */
     UINTVAL       ops;
-    /* how many ticks where spent in it (including subcalls) */
-    UHUGEINTVAL   ticks;
+    /* how many ticks and counted events where spent in it (including subcalls) */
+    UHUGEINTVAL   events[SUBPROF_MAX_EVENTS];
 };
 
 struct lineinfo {
@@ -34,8 +39,8 @@ struct lineinfo {
     callinfo              *calls;
     /* number of ops executed in this line */
     UINTVAL                ops;
-    /* number of CPU ticks spent in this line */
-    UHUGEINTVAL            ticks;
+    /* number of CPU ticks and counted events spent in this line */
+    UHUGEINTVAL            events[SUBPROF_MAX_EVENTS];
 };
 
 struct subprofile {
@@ -65,9 +70,9 @@ struct subprofile {
     /* the active Context for the Sub being profiled */
     PMC                   *ctx;
 
-    /* ops/ticks we need to distribute to the caller */
+    /* ops/events we need to distribute to the caller */
     UINTVAL                callerops;
-    UHUGEINTVAL            callerticks;
+    UHUGEINTVAL            callerevents[SUBPROF_MAX_EVENTS];
 };
 
 #define SUBPROF_TYPE_SUB 1
@@ -95,10 +100,15 @@ struct subprofiledata {
     PMC         *curctx;
     subprofile  *cursp;
 
-    /* ticks are added at the end of the op */
-    UHUGEINTVAL *tickadd;
-    UHUGEINTVAL *tickadd2;
-    UHUGEINTVAL  starttick;
+    /* events are added at the end of the op */
+    UHUGEINTVAL *eventadd;
+    UHUGEINTVAL *eventadd2;
+    UHUGEINTVAL  startevents[SUBPROF_MAX_EVENTS];
+
+    /* the hardware counters, NULL if not asked for or not available */
+    Parrot_runcore_counters *counters;
+    /* ticks plus the number of open counters */
+    unsigned int nevents;
 };
 
 struct subprof_runcore_t {
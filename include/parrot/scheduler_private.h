@@ -60,7 +60,8 @@ typedef enum {
 typedef enum {
     TASK_active_FLAG     = PObj_private0_FLAG,
     TASK_in_preempt_FLAG = PObj_private1_FLAG,
-    TASK_recv_block_FLAG = PObj_private2_FLAG
+    TASK_recv_block_FLAG = PObj_private2_FLAG,
+    TASK_fiber_FLAG      = PObj_private3_FLAG
 } task_flags_enum;
 
 #define TASK_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -84,6 +85,30 @@ typedef enum {
 #define TASK_recv_block_SET(o)   TASK_flag_SET(recv_block, o)
 #define TASK_recv_block_CLEAR(o) TASK_flag_CLEAR(recv_block, o)
 
+/* Flag is set if the task runs on a fiber of its own, see src/fiber.c */
+#define TASK_fiber_TEST(o)  TASK_flag_TEST(fiber, o)
+#define TASK_fiber_SET(o)   TASK_flag_SET(fiber, o)
+#define TASK_fiber_CLEAR(o) TASK_flag_CLEAR(fiber, o)
+
+/*
+ * Alarm private flags
+ *
+ */
+typedef enum {
+    ALARM_recycle_FLAG = PObj_private0_FLAG
+} alarm_flags_enum;
+
+#define ALARM_get_FLAGS(o) (PObj_get_FLAGS(o))
+#define ALARM_flag_TEST(flag, o) (ALARM_get_FLAGS(o) & ALARM_ ## flag ## _FLAG)
+#define ALARM_flag_SET(flag, o) (ALARM_get_FLAGS(o) |= ALARM_ ## flag ## _FLAG)
+#define ALARM_flag_CLEAR(flag, o) (ALARM_get_FLAGS(o) &= ~(UINTVAL)(ALARM_ ## flag ## _FLAG))
+
+/* Flag is set if nobody but the scheduler knows the alarm, so it can be
+ * reused once it fired. Used for the alarms of the sleep opcode. */
+#define ALARM_recycle_TEST(o)  ALARM_flag_TEST(recycle, o)
+#define ALARM_recycle_SET(o)   ALARM_flag_SET(recycle, o)
+#define ALARM_recycle_CLEAR(o) ALARM_flag_CLEAR(recycle, o)
+
 
 #endif /* PARROT_SCHEDULER_PRIVATE_H_GUARD */
 
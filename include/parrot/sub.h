@@ -202,6 +202,31 @@ PMC* Parrot_sub_new_closure(PARROT_INTERP, ARGIN(PMC *sub_pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+opcode_t * Parrot_sub_resume_coroutine(PARROT_INTERP,
+    ARGIN(PMC *coro),
+    ARGOUT(PMC **result),
+    ARGIN(opcode_t *here),
+    ARGIN(opcode_t *next))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*result);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+opcode_t * Parrot_sub_yield_coroutine(PARROT_INTERP,
+    ARGIN(PMC *value),
+    ARGIN(opcode_t *next))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 void Parrot_sub_continuation_check(PARROT_INTERP, ARGIN(const PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -220,6 +245,16 @@ PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_sub_find_lex_ctx(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    ARGIN(PMC *lex_info),
+    INTVAL depth)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC* Parrot_sub_find_pad(PARROT_INTERP,
@@ -259,6 +294,16 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_sub_new_closure __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_Parrot_sub_resume_coroutine __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(coro) \
+    , PARROT_ASSERT_ARG(result) \
+    , PARROT_ASSERT_ARG(here) \
+    , PARROT_ASSERT_ARG(next))
+#define ASSERT_ARGS_Parrot_sub_yield_coroutine __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(value) \
+    , PARROT_ASSERT_ARG(next))
 #define ASSERT_ARGS_Parrot_sub_continuation_check __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
@@ -270,6 +315,10 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_sub_find_lex_ctx __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(lex_info))
 #define ASSERT_ARGS_Parrot_sub_find_pad __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
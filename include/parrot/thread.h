@@ -114,6 +114,11 @@ VAR_SCOPE Shared_gc_info *shared_gc_info;
 /* HEADERIZER BEGIN: src/thread.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_thread_share_ro(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+        __attribute__nonnull__(1);
+
 void Parrot_clone_code(Parrot_Interp d, Parrot_Interp s);
 int Parrot_get_num_threads(PARROT_INTERP);
 int Parrot_set_num_threads(PARROT_INTERP, INTVAL number_of_threads);
@@ -197,6 +202,8 @@ PMC * Parrot_thread_transfer_sub(
 void Parrot_thread_wait_for_notification(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_Parrot_thread_share_ro __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_clone_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_get_num_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_set_num_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -249,6 +256,10 @@ void Parrot_thread_wait_for_notification(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/thread.c */
 
+/* Is the PMC part of a graph published read-only with Parrot_thread_share_ro? */
+#define Parrot_thread_is_shared_ro(pmc) \
+    (PObj_is_shared_TEST(pmc) && ((pmc)->vtable->flags & VTABLE_IS_READONLY_FLAG))
+
 #define Parrot_thread_maybe_create_proxy(i, thread, pmc) ( \
         (pmc)->vtable->base_type == enum_class_Proxy \
         ? (PARROT_PROXY(pmc)->interp == (thread) ? PARROT_PROXY(pmc)->target : (pmc)) \
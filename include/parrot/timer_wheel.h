@@ -0,0 +1,118 @@
+/* timer_wheel.h
+ *  Copyright (C) 2026, Parrot Foundation.
+ *  Overview:
+ *     The hierarchical timer wheel holding a scheduler's pending alarms
+ *  Data Structure and Algorithms:
+ *     See src/timer_wheel.c
+ */
+
+#ifndef PARROT_TIMER_WHEEL_H_GUARD
+#define PARROT_TIMER_WHEEL_H_GUARD
+
+/* Every level has 2 ** PARROT_TIMER_WHEEL_BITS slots, and every slot of a
+ * level spans a whole turn of the level below. Four levels of 64 slots of
+ * a millisecond cover 4.6 hours; alarms further out wait in the last level. */
+#define PARROT_TIMER_WHEEL_BITS   6
+#define PARROT_TIMER_WHEEL_SLOTS  (1 << PARROT_TIMER_WHEEL_BITS)
+#define PARROT_TIMER_WHEEL_MASK   (PARROT_TIMER_WHEEL_SLOTS - 1)
+#define PARROT_TIMER_WHEEL_LEVELS 4
+#define PARROT_TIMER_WHEEL_TICK   0.001     /* seconds */
+
+/* How many fired sleep alarms are kept for reuse */
+#define PARROT_TIMER_WHEEL_MAX_SPARE 64
+
+typedef struct Parrot_timer_wheel {
+    FLOATVAL start;         /* monotonic time of tick 0 */
+    INTVAL   now;           /* the next tick to expire */
+    INTVAL   count;         /* number of pending alarms */
+    INTVAL   num_spare;     /* number of alarms in spare */
+    PMC     *spare;         /* fired sleep alarms, linked through wheel_next */
+
+    /* doubly linked lists of alarms, through wheel_prev and wheel_next,
+     * level by level */
+    PMC     *slots[PARROT_TIMER_WHEEL_LEVELS * PARROT_TIMER_WHEEL_SLOTS];
+} Parrot_timer_wheel;
+
+/* HEADERIZER BEGIN: src/timer_wheel.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_timer_wheel_destroy(PARROT_INTERP,
+    ARGFREE(Parrot_timer_wheel *wheel))
+        __attribute__nonnull__(1);
+
+void Parrot_timer_wheel_expire(PARROT_INTERP,
+    ARGMOD(Parrot_timer_wheel *wheel))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*wheel);
+
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_timer_wheel_get_alarm(PARROT_INTERP,
+    ARGMOD(Parrot_timer_wheel *wheel))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*wheel);
+
+FLOATVAL Parrot_timer_wheel_insert(PARROT_INTERP,
+    ARGMOD(Parrot_timer_wheel *wheel),
+    ARGIN(PMC *alarm))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*wheel);
+
+void Parrot_timer_wheel_mark(PARROT_INTERP,
+    ARGIN(const Parrot_timer_wheel *wheel))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_timer_wheel * Parrot_timer_wheel_new(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+FLOATVAL Parrot_timer_wheel_next_time(PARROT_INTERP,
+    ARGIN(const Parrot_timer_wheel *wheel))
+        __attribute__nonnull__(2);
+
+INTVAL Parrot_timer_wheel_remove(PARROT_INTERP,
+    ARGMOD(Parrot_timer_wheel *wheel),
+    ARGIN(PMC *alarm))
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*wheel);
+
+#define ASSERT_ARGS_Parrot_timer_wheel_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_timer_wheel_expire __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_Parrot_timer_wheel_get_alarm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_Parrot_timer_wheel_insert __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(wheel) \
+    , PARROT_ASSERT_ARG(alarm))
+#define ASSERT_ARGS_Parrot_timer_wheel_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_Parrot_timer_wheel_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_timer_wheel_next_time __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_Parrot_timer_wheel_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel) \
+    , PARROT_ASSERT_ARG(alarm))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/timer_wheel.c */
+
+#endif /* PARROT_TIMER_WHEEL_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
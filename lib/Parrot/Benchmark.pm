@@ -0,0 +1,320 @@
+# Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+Parrot::Benchmark - Run benchmarks repeatably and compare the results
+
+=head1 SYNOPSIS
+
+    use Parrot::Benchmark qw( find_benchmarks benchmark compare );
+
+    my @files  = find_benchmarks('examples/benchmarks', 'fib', 'gc_');
+    my $result = benchmark(
+        parrot  => './parrot',
+        file    => $files[0],
+        runcore => 'fast',
+        gc      => 'gms',
+        warmup  => 1,
+        runs    => 5,
+    );
+
+    my $verdict = compare($baseline, $result, 0.05);
+
+=head1 DESCRIPTION
+
+The building blocks of F<tools/dev/bench.pl>.
+
+Every benchmark is run as its own C<parrot> process with its output thrown
+away. The wall clock and CPU time of each run are measured from the
+outside; the GC counters and the peak resident set size are written by
+Parrot itself to the file named in C<PARROT_STATS_FILE> when it exits.
+
+Times are summarized by their median and median absolute deviation, which
+are not thrown off by the odd run disturbed by the rest of the system. Two
+sets of times are compared with the Mann-Whitney U test, which does not
+assume they are normally distributed.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+package Parrot::Benchmark;
+
+use strict;
+use warnings;
+
+use Exporter;
+use File::Basename qw( basename );
+use File::Spec;
+use File::Temp qw( tempfile );
+use JSON::PP ();
+use POSIX ();
+use Time::HiRes ();
+
+our @ISA       = qw(Exporter);
+our @EXPORT_OK = qw(
+    median
+    mad
+    mann_whitney
+    find_benchmarks
+    run_once
+    benchmark
+    compare
+);
+
+=item C<median(@values)>
+
+Returns the median of C<@values>, or C<undef> if there are none.
+
+=cut
+
+sub median {
+    my @sorted = sort { $a <=> $b } @_;
+    return unless @sorted;
+
+    my $mid = int( @sorted / 2 );
+    return @sorted % 2 ? $sorted[$mid] : ( $sorted[ $mid - 1 ] + $sorted[$mid] ) / 2;
+}
+
+=item C<mad(@values)>
+
+Returns the median absolute deviation of C<@values> from their median.
+
+=cut
+
+sub mad {
+    my $median = median(@_);
+    return unless defined $median;
+
+    return median( map { abs( $_ - $median ) } @_ );
+}
+
+=item C<mann_whitney(\@x, \@y)>
+
+Compares two samples with the two sided Mann-Whitney U test. Returns the U
+statistic of C<@x> and the probability of seeing a difference at least as
+large if both samples came from the same distribution, using the normal
+approximation with a correction for ties.
+
+The approximation needs a few values in each sample; with fewer than three
+runs on either side the probability is always 1.
+
+=cut
+
+sub mann_whitney {
+    my ( $x, $y ) = @_;
+    my ( $n1, $n2 ) = ( scalar @$x, scalar @$y );
+
+    return ( 0, 1 ) if $n1 < 3 || $n2 < 3;
+
+    # rank the pooled sample, ties get the average of their ranks
+    my @pooled = sort { $a->[0] <=> $b->[0] }
+        ( map { [ $_, 0 ] } @$x ), ( map { [ $_, 1 ] } @$y );
+    my ( $rank_sum, $ties ) = ( 0, 0 );
+
+    for ( my $i = 0; $i < @pooled; ) {
+        my $j = $i;
+        $j++ while $j + 1 < @pooled && $pooled[ $j + 1 ][0] == $pooled[$i][0];
+
+        my $rank = ( $i + $j ) / 2 + 1;
+        my $t    = $j - $i + 1;
+        $ties += $t**3 - $t;
+        $rank_sum += $rank for grep { !$_->[1] } @pooled[ $i .. $j ];
+        $i = $j + 1;
+    }
+
+    my $n     = $n1 + $n2;
+    my $u     = $rank_sum - $n1 * ( $n1 + 1 ) / 2;
+    my $mean  = $n1 * $n2 / 2;
+    my $var   = $n1 * $n2 / 12 * ( ( $n + 1 ) - $ties / ( $n * ( $n - 1 ) ) );
+
+    return ( $u, 1 ) if $var <= 0;
+
+    my $z = ( abs( $u - $mean ) - 0.5 ) / sqrt($var);
+    $z = 0 if $z < 0;
+
+    return ( $u, _erfc( $z / sqrt(2) ) );
+}
+
+# complementary error function, Numerical Recipes' erfcc, good to 1.2e-7
+sub _erfc {
+    my ($x) = @_;
+    my $t   = 1 / ( 1 + 0.5 * abs($x) );
+    my $r   = $t * exp( -$x * $x - 1.26551223 + $t * ( 1.00002368 + $t * ( 0.37409196
+        + $t * ( 0.09678418 + $t * ( -0.18628806 + $t * ( 0.27886807 + $t * ( -1.13520398
+        + $t * ( 1.48851587 + $t * ( -0.82215223 + $t * 0.17087277 ) ) ) ) ) ) ) ) );
+
+    return $x >= 0 ? $r : 2 - $r;
+}
+
+=item C<find_benchmarks($dir, @patterns)>
+
+Returns the sorted PIR and PASM files in C<$dir> whose names match any of
+the regular expressions in C<@patterns>, or all of them if there are none.
+
+=cut
+
+sub find_benchmarks {
+    my ( $dir, @patterns ) = @_;
+
+    opendir my $dh, $dir or die "can't read $dir: $!\n";
+    my @files = sort grep { /\.(?:pir|pasm)$/ } readdir $dh;
+    closedir $dh;
+
+    if (@patterns) {
+        my $match = join '|', map { "(?:$_)" } @patterns;
+        @files = grep { /$match/ } @files;
+    }
+
+    return map { File::Spec->catfile( $dir, $_ ) } @files;
+}
+
+=item C<run_once(parrot =E<gt> $parrot, file =E<gt> $file, runcore =E<gt> $core, gc =E<gt> $gc)>
+
+Runs C<$file> once and returns a hash with its wall clock C<time> and
+C<cpu> time in seconds, its exit C<status>, and the statistics Parrot
+wrote on exit: C<gc_mark_runs>, C<gc_collect_runs>, C<total_mem_alloc>,
+C<max_rss> and friends.
+
+=cut
+
+sub run_once {
+    my %args = @_;
+
+    my ( $fh, $stats_file ) = tempfile( SUFFIX => '.json', UNLINK => 1 );
+    close $fh;
+
+    my @cmd = ( $args{parrot} );
+    push @cmd, '-R',   $args{runcore} if $args{runcore};
+    push @cmd, '--gc', $args{gc}      if $args{gc};
+    push @cmd, $args{file};
+
+    local $ENV{PARROT_STATS_FILE} = $stats_file;
+
+    my @times = times;
+    my $start = Time::HiRes::time();
+
+    my $pid = fork;
+    die "can't fork: $!\n" unless defined $pid;
+
+    unless ($pid) {
+        open STDOUT, '>', File::Spec->devnull;
+        open STDERR, '>', File::Spec->devnull;
+        exec {$cmd[0]} @cmd or POSIX::_exit(127);
+    }
+    waitpid $pid, 0;
+
+    my %run = (
+        status => $? >> 8,
+        time   => Time::HiRes::time() - $start,
+    );
+    my @after = times;
+    $run{cpu} = ( $after[2] - $times[2] ) + ( $after[3] - $times[3] );
+
+    if ( open my $in, '<', $stats_file ) {
+        local $/;
+        my $json = <$in>;
+        close $in;
+
+        if ( $json =~ /\S/ ) {
+            my $stats = JSON::PP::decode_json($json);
+            @run{ keys %$stats } = values %$stats;
+        }
+    }
+    unlink $stats_file;
+
+    return \%run;
+}
+
+=item C<benchmark(parrot =E<gt> $parrot, file =E<gt> $file, runcore =E<gt> $core, gc =E<gt> $gc, warmup =E<gt> $w, runs =E<gt> $n)>
+
+Runs C<$file> C<$w> times without looking at the results, then C<$n> times
+for real. Returns a hash describing the benchmark with all the C<times>,
+their C<median> and C<mad>, the median C<cpu> time, the highest C<max_rss>
+and the median GC counters. If any run fails, C<failed> holds its exit
+status and no more runs are made.
+
+=cut
+
+sub benchmark {
+    my %args = @_;
+    my $runs = $args{runs} || 5;
+
+    my %result = (
+        benchmark => basename( $args{file} ),
+        runcore   => $args{runcore},
+        gc        => $args{gc},
+    );
+    my @runs;
+
+    for my $i ( 1 .. ( $args{warmup} || 0 ) + $runs ) {
+        my $run = run_once(%args);
+
+        if ( $run->{status} ) {
+            $result{failed} = $run->{status};
+            return \%result;
+        }
+
+        push @runs, $run if $i > ( $args{warmup} || 0 );
+    }
+
+    $result{times}  = [ map { $_->{time} } @runs ];
+    $result{median} = median( @{ $result{times} } );
+    $result{mad}    = mad( @{ $result{times} } );
+    $result{cpu}    = median( map { $_->{cpu} } @runs );
+
+    for my $counter (qw( gc_mark_runs gc_lazy_mark_runs gc_collect_runs total_mem_alloc )) {
+        my @values = grep { defined } map { $_->{$counter} } @runs;
+        $result{$counter} = median(@values) if @values;
+    }
+
+    my ($max_rss) = sort { $b <=> $a } grep { defined } map { $_->{max_rss} } @runs;
+    $result{max_rss} = $max_rss if defined $max_rss;
+
+    return \%result;
+}
+
+=item C<compare($baseline, $current, $alpha)>
+
+Compares the times of two results of the same benchmark. Returns a hash
+with the C<ratio> of the medians, the C<p> value of the Mann-Whitney test
+and a C<verdict>: C<slower> or C<faster> if the difference is significant
+at level C<$alpha> (0.05 by default), C<same> otherwise.
+
+=cut
+
+sub compare {
+    my ( $base, $cur, $alpha ) = @_;
+    $alpha = 0.05 unless defined $alpha;
+
+    return { verdict => 'failed' } if $cur->{failed};
+    return { verdict => 'new' }    if !$base || $base->{failed} || !$base->{median};
+
+    my ( undef, $p ) = mann_whitney( $base->{times}, $cur->{times} );
+    my $ratio = $cur->{median} / $base->{median};
+
+    my $verdict = $p >= $alpha ? 'same'
+                : $ratio > 1   ? 'slower'
+                :                'faster';
+
+    return { ratio => $ratio, p => $p, verdict => $verdict };
+}
+
+=back
+
+=head1 SEE ALSO
+
+F<tools/dev/bench.pl>, F<examples/benchmarks>
+
+=cut
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
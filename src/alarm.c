@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2010-2015, Parrot Foundation.
+Copyright (C) 2010-2026, Parrot Foundation.
 
 =head1 NAME
 
@@ -9,6 +9,13 @@ src/alarm.c - Portable alarm, setting a flag after a delay.
 
 This program implements a mechanism for alarms, setting a flag after a delay.
 
+Every interpreter has at most one pending alarm, the earliest one asked for.
+A single alarm thread keeps the interpreters with a pending alarm in a list
+and sleeps until the earliest of them is due. When an alarm expires, only the
+interpreter that set it has its C<alarm_serial> bumped and is woken up.
+Whoever set a later alarm that got overridden, like the scheduler, is
+expected to set it again once the earlier one fired.
+
 =cut
 
 */
@@ -17,11 +24,6 @@ This program implements a mechanism for alarms, setting a flag after a delay.
 #include "parrot/alarm.h"
 #include "parrot/thread.h"
 
-/* Some per-process state */
-static volatile UINTVAL  alarm_serial = 0;
-static volatile FLOATVAL alarm_set_to = 0.0;
-static volatile FLOATVAL current_alarm = 0.0;
-
 /* HEADERIZER HFILE: include/parrot/alarm.h */
 
 /* HEADERIZER BEGIN: static */
@@ -51,6 +53,11 @@ pthread. Any other pthreads should make sure to mask out SIGALRM.
 static Parrot_mutex alarm_lock;
 static Parrot_cond sleep_cond;
 
+/* The interpreters with an alarm set, unordered, and the time the alarm
+   thread currently sleeps till. Both are protected by alarm_lock. */
+static Interp  *armed_interps = NULL;
+static FLOATVAL waiting_for   = 0.0;
+
 void
 Parrot_alarm_init(void)
 {
@@ -79,70 +86,66 @@ Parrot_alarm_runloop(SHIM(void *arg))
 {
     ASSERT_ARGS(Parrot_alarm_runloop)
 
-    while (1) {
-        int rc = 0;
-        INTVAL notify = 0;
-
-        LOCK(alarm_lock);
+    LOCK(alarm_lock);
 
-        /* First, check if we have any outstanding alarms, and wait for those. */
-        if (alarm_set_to > 0) {
-            struct timespec ts;
-            ts.tv_sec = (time_t)alarm_set_to;
-            ts.tv_nsec = (long)((alarm_set_to - ts.tv_sec) * 1000000000.0f);
-            current_alarm = alarm_set_to;
-            alarm_set_to = 0;
-            rc = 0;
-            while (alarm_set_to == 0 && rc == 0)
-                COND_TIMED_WAIT(sleep_cond, alarm_lock, &ts, rc);
-        }
-        else {
-            /* no alarms set, just wait for new alarms */
-            while (alarm_set_to == 0)
-                COND_WAIT(sleep_cond, alarm_lock);
+    while (1) {
+        Interp  *it;
+        Interp **link;
+        FLOATVAL next = 0.0;
+        FLOATVAL now;
+
+        for (it = armed_interps; it; it = it->alarm_next)
+            if (next == 0.0 || it->alarm_time < next)
+                next = it->alarm_time;
+
+        /* no alarms set, just wait for new alarms */
+        if (next == 0.0) {
+            waiting_for = 0.0;
+            COND_WAIT(sleep_cond, alarm_lock);
+            continue;
         }
 
-        /* Check if we need to notify threads. We need to notify threads if
-           an alarm time has passed, or if there has been a timeout error in
-           waiting for alarms. */
-        if (alarm_set_to > 0 && alarm_set_to <= Parrot_floatval_time()) {
-            /* New alarm is already in the past. Don't bother waiting, notify
-               immediately */
-            notify = 1;
-            alarm_set_to = 0;
-        }
-        else {
-            /* notify on timeout but not on setting new alarm */
-            notify = (rc != 0);
+        /* Wait for the earliest alarm. Setting an even earlier one wakes us
+           up early, after which we look again. */
+        now = Parrot_floatval_time();
+        if (next > now) {
+            struct timespec ts;
+            int rc = 0;
+            ts.tv_sec = (time_t)next;
+            ts.tv_nsec = (long)((next - ts.tv_sec) * 1000000000.0f);
+            waiting_for = next;
+            COND_TIMED_WAIT(sleep_cond, alarm_lock, &ts, rc);
+            UNUSED(rc);
+            continue;
         }
 
-        if (notify)
-            current_alarm = 0;
-
-        UNLOCK(alarm_lock);
-
-        /* If we need to notify, do that here. Otherwise, back to the top of
-           the loop*/
-        if (notify) {
-            /* possible racy write with read in Parrot_alarm_check */
-            LOCK(alarm_lock);
-            alarm_serial += 1;
-            UNLOCK(alarm_lock);
-            Parrot_thread_notify_threads(NULL);
+        /* Notify the interpreters whose alarm has passed, and only those.
+           This happens with alarm_lock held, so none of them can be
+           destroyed under our feet, see Parrot_alarm_clear. */
+        waiting_for = 0.0;
+        link = &armed_interps;
+        while ((it = *link) != NULL) {
+            if (it->alarm_time <= now) {
+                *link           = it->alarm_next;
+                it->alarm_next  = NULL;
+                it->alarm_time  = 0.0;
+                it->alarm_serial++;
+                Parrot_thread_notify_thread(it);
+            }
+            else
+                link = &it->alarm_next;
         }
     }
 
+    UNLOCK(alarm_lock);
     return NULL;
 }
 
 /*
 
-=item C<int Parrot_alarm_check(UINTVAL* last_serial)>
+=item C<int Parrot_alarm_check(PARROT_INTERP, UINTVAL* last_serial)>
 
-Determine if any alarms have passed since last checked.
-
-Possible design improvement: Alert only the thread that
-set the alarm.
+Determine if any alarm of C<interp> has passed since last checked.
 
 =cut
 
@@ -150,25 +153,29 @@ set the alarm.
 
 PARROT_EXPORT
 int
-Parrot_alarm_check(ARGMOD(UINTVAL* last_serial))
+Parrot_alarm_check(PARROT_INTERP, ARGMOD(UINTVAL* last_serial))
 {
     ASSERT_ARGS(Parrot_alarm_check)
 
 #ifdef PARROT_HAS_THREADS
-    if (*last_serial == alarm_serial)
+    const UINTVAL serial = interp->alarm_serial;
+
+    if (*last_serial == serial)
         return 0;
-    *last_serial = alarm_serial;
+    *last_serial = serial;
     return 1;
 #else
-    return (alarm_set_to <= Parrot_floatval_time());
+    UNUSED(last_serial);
+    return (interp->alarm_time <= Parrot_floatval_time());
 #endif
 }
 
 /*
 
-=item C<void Parrot_alarm_set(FLOATVAL when)>
+=item C<void Parrot_alarm_set(PARROT_INTERP, FLOATVAL when)>
 
-Sets an alarm to trigger at time 'when'.
+Sets an alarm for C<interp> to trigger at time 'when'. If the interpreter
+already has an earlier alarm pending, this does nothing.
 
 =cut
 
@@ -176,20 +183,64 @@ Sets an alarm to trigger at time 'when'.
 
 PARROT_EXPORT
 void
-Parrot_alarm_set(FLOATVAL when)
+Parrot_alarm_set(PARROT_INTERP, FLOATVAL when)
 {
     ASSERT_ARGS(Parrot_alarm_set)
 
     LOCK(alarm_lock);
     {
-        if (current_alarm > 0 && current_alarm <= when) {
+#ifndef PARROT_HAS_THREADS
+        /* without the alarm thread, nobody clears an alarm that has passed */
+        if (interp->alarm_time > 0 && interp->alarm_time <= Parrot_floatval_time())
+            interp->alarm_time = when;
+#endif
+
+        if (interp->alarm_time > 0 && interp->alarm_time <= when) {
             /* there's already an active alarm for an earlier point in time */
             UNLOCK(alarm_lock);
             return;
         }
 
-        alarm_set_to = when;
-        COND_SIGNAL(sleep_cond);
+        if (interp->alarm_time == 0) {
+            interp->alarm_next = armed_interps;
+            armed_interps      = interp;
+        }
+        interp->alarm_time = when;
+
+        /* only wake up the alarm thread if it sleeps too long */
+        if (waiting_for == 0 || when < waiting_for)
+            COND_SIGNAL(sleep_cond);
+    }
+    UNLOCK(alarm_lock);
+}
+
+/*
+
+=item C<void Parrot_alarm_clear(PARROT_INTERP)>
+
+Forgets the pending alarm of C<interp>. Called before the interpreter is
+destroyed.
+
+=cut
+
+*/
+
+void
+Parrot_alarm_clear(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_alarm_clear)
+
+    LOCK(alarm_lock);
+    if (interp->alarm_time > 0) {
+        Interp **link = &armed_interps;
+
+        while (*link && *link != interp)
+            link = &(*link)->alarm_next;
+        if (*link)
+            *link = interp->alarm_next;
+
+        interp->alarm_next = NULL;
+        interp->alarm_time = 0.0;
     }
     UNLOCK(alarm_lock);
 }
@@ -209,11 +260,11 @@ mechanism will be used instead.
 
 PARROT_EXPORT
 void
-Parrot_alarm_wait_for_next_alarm(SHIM_INTERP)
+Parrot_alarm_wait_for_next_alarm(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_alarm_wait_for_next_alarm)
     const FLOATVAL now_time  = Parrot_floatval_time();
-    const FLOATVAL time = alarm_set_to - now_time;
+    const FLOATVAL time = interp->alarm_time - now_time;
 
     if (time > 0)
         Parrot_usleep(time * 1000000);
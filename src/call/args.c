@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2014, Parrot Foundation.
+Copyright (C) 2001-2026, Parrot Foundation.
 
 =head1 NAME
 
@@ -20,13 +20,27 @@ passing to and from subroutines following the Parrot Calling Conventions.
 
 #include "parrot/parrot.h"
 #include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
 #include "args.str"
 #include "pmc/pmc_key.h"
 #include "pmc/pmc_fixedintegerarray.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_sub.h"
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
+/* The shapes of get_params signatures, worked out once per Sub. Each but
+ * PARAMS_GENERIC has a binder of its own for the calls that match it
+ * exactly; the others, and the errors, go through fill_params. */
+typedef enum {
+    PARAMS_GENERIC,             /* anything */
+    PARAMS_POSITIONAL,          /* required positionals only */
+    PARAMS_POSITIONAL_PMC       /* required positional PMCs only */
+} params_shape;
+
+/* The flags a parameter of a PARAMS_POSITIONAL signature may have */
+#define PARAMS_POSITIONAL_FLAGS (PARROT_ARG_TYPE_MASK | PARROT_ARG_INVOCANT)
+
 /*
 Set of functions used in generic versions of fill_params and fill_returns.
 */
@@ -64,6 +78,32 @@ static void assign_default_param_value(PARROT_INTERP,
         __attribute__nonnull__(4)
         __attribute__nonnull__(5);
 
+PARROT_HOT
+static int bind_direct_params(PARROT_INTERP,
+    ARGMOD(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_params))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*call_object);
+
+PARROT_HOT
+static int bind_positional_params(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_params),
+    int all_pmc)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL classify_params(PARROT_INTERP, ARGIN(PMC *raw_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void dissect_aggregate_arg(PARROT_INTERP,
     ARGMOD(PMC *call_object),
     ARGIN(PMC *aggregate))
@@ -124,6 +164,22 @@ static INTVAL* intval_param_from_op(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static int is_direct_call(PARROT_INTERP,
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_tailcall_in_place(PARROT_INTERP,
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_COLD
 PARROT_DOES_NOT_RETURN
 static void named_argument_arity_error(PARROT_INTERP,
@@ -133,6 +189,18 @@ static void named_argument_arity_error(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(4);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const opcode_t * next_call_op(PARROT_INTERP,
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_args),
+    ARGOUT(INTVAL *lookup_reg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*lookup_reg);
+
 PARROT_WARN_UNUSED_RESULT
 static FLOATVAL numval_constant_from_op(PARROT_INTERP,
     ARGIN(const opcode_t *raw_params),
@@ -243,6 +311,18 @@ static STRING** string_param_from_op(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(arg_info) \
     , PARROT_ASSERT_ARG(accessor))
+#define ASSERT_ARGS_bind_direct_params __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_bind_positional_params __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_classify_params __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig))
 #define ASSERT_ARGS_dissect_aggregate_arg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(call_object) \
@@ -267,9 +347,22 @@ static STRING** string_param_from_op(PARROT_INTERP,
 #define ASSERT_ARGS_intval_param_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_is_direct_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args))
+#define ASSERT_ARGS_is_tailcall_in_place __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args))
 #define ASSERT_ARGS_named_argument_arity_error __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(named_arg_list))
+#define ASSERT_ARGS_next_call_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_args) \
+    , PARROT_ASSERT_ARG(lookup_reg))
 #define ASSERT_ARGS_numval_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
@@ -425,6 +518,257 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
 
 /*
 
+=item C<PMC* Parrot_pcc_build_call_from_op(PARROT_INTERP, PMC *raw_sig, opcode_t
+*raw_args)>
+
+Takes the raw signature and argument list of a set_args opcode, like
+C<Parrot_pcc_build_sig_object_from_op>. When the arguments are plain
+positionals that stay untouched in the caller's registers until the call,
+the CallContext only remembers where they are: a get_params with the same
+types then copies them from register to register, and anything else looking
+at the positionals gets them through C<Parrot_pcc_materialize_args>.
+
+For a tail call that can run in the current context (see
+C<is_tailcall_in_place>) the arguments go into that context itself, and the
+tailcall opcode doesn't need a new one.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_HOT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC*
+Parrot_pcc_build_call_from_op(PARROT_INTERP, ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_args))
+{
+    ASSERT_ARGS(Parrot_pcc_build_call_from_op)
+
+    if (is_tailcall_in_place(interp, raw_sig, raw_args)) {
+        PMC * const ctx = CURRENT_CONTEXT(interp);
+        PMC        *call_object, *return_flags;
+
+        /* the callee runs in this context, so it takes the arguments too;
+         * the caller of the context still wants its results the same way */
+        GETATTR_CallContext_return_flags(interp, ctx, return_flags);
+        call_object = Parrot_pcc_build_sig_object_from_op(interp, ctx, raw_sig, raw_args);
+        SETATTR_CallContext_return_flags(interp, call_object, return_flags);
+
+        return call_object;
+    }
+
+    if (is_direct_call(interp, raw_sig, raw_args)) {
+        PMC * const call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+
+        PARROT_GC_WRITE_BARRIER(interp, call_object);
+        SETATTR_CallContext_arg_flags(interp, call_object, raw_sig);
+        SETATTR_CallContext_direct_args(interp, call_object, raw_args);
+        SETATTR_CallContext_direct_ctx(interp, call_object, CURRENT_CONTEXT(interp));
+
+        return call_object;
+    }
+
+    return Parrot_pcc_build_sig_object_from_op(interp, PMCNULL, raw_sig, raw_args);
+}
+
+/*
+
+=item C<static const opcode_t * next_call_op(PARROT_INTERP, PMC *raw_sig, const
+opcode_t *raw_args, INTVAL *lookup_reg)>
+
+Returns the op after the set_args opcode at C<raw_args>, skipping the op that
+looks up the sub, if there is one. That's where the call op is, if the
+arguments go straight to a call. C<lookup_reg> gets the register the lookup
+op writes to, or -1.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static const opcode_t *
+next_call_op(PARROT_INTERP, ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_args),
+        ARGOUT(INTVAL *lookup_reg))
+{
+    ASSERT_ARGS(next_call_op)
+    op_lib_t          * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PackFile_ByteCode * const seg      = interp->code;
+    const opcode_t    *pc;
+    INTVAL             arg_count;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    pc          = raw_args + arg_count + 2;
+    *lookup_reg = -1;
+
+    if (OPCODE_IS(interp, seg, *pc, core_ops, PARROT_OP_set_p_pc)
+    ||  OPCODE_IS(interp, seg, *pc, core_ops, PARROT_OP_find_sub_not_null_p_sc)) {
+        *lookup_reg  = pc[1];
+        pc          += 3;
+    }
+
+    return pc;
+}
+
+/*
+
+=item C<static int is_tailcall_in_place(PARROT_INTERP, PMC *raw_sig, const
+opcode_t *raw_args)>
+
+Returns true if the set_args opcode at C<raw_args> is followed by a tailcall,
+possibly with the op that looks up the sub in between (see C<next_call_op>),
+and the current
+context can be reused for the callee: nothing captured it, it runs a plain
+Sub and its caller passed the arguments in the context itself, so the results
+of the callee go where the caller expects them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_tailcall_in_place(PARROT_INTERP, ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_args))
+{
+    ASSERT_ARGS(is_tailcall_in_place)
+    op_lib_t          * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PackFile_ByteCode * const seg      = interp->code;
+    PMC               * const ctx      = CURRENT_CONTEXT(interp);
+    PMC               *caller_ctx, *sub;
+    INTVAL             lookup_reg;
+    const opcode_t    * const pc       = next_call_op(interp, raw_sig, raw_args, &lookup_reg);
+
+    if (!OPCODE_IS(interp, seg, *pc, core_ops, PARROT_OP_tailcall_p)
+    ||  CALLSIGNATURE_captured_TEST(ctx))
+        return 0;
+
+    sub        = Parrot_pcc_get_sub(interp, ctx);
+    caller_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+
+    return !PMC_IS_NULL(sub)
+        &&  sub->vtable->base_type == enum_class_Sub
+        &&  !PMC_IS_NULL(caller_ctx)
+        &&  Parrot_pcc_get_signature(interp, caller_ctx) == ctx;
+}
+
+/*
+
+=item C<static int is_direct_call(PARROT_INTERP, PMC *raw_sig, const opcode_t
+*raw_args)>
+
+Returns true if the set_args opcode at C<raw_args> passes positionals only
+and is followed by an invokecc, possibly with the op that looks up the sub in
+between (see C<next_call_op>). No other op runs in the caller before the callee takes its
+arguments, so they can be read from the caller's registers then; the lookup
+op must not write over one of them.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_direct_call(PARROT_INTERP, ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_args))
+{
+    ASSERT_ARGS(is_direct_call)
+    op_lib_t          * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PackFile_ByteCode * const seg      = interp->code;
+    const opcode_t    *pc;
+    INTVAL            *raw_flags;
+    INTVAL             arg_count, i;
+    INTVAL             lookup_reg;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
+    if (arg_count == 0)
+        return 0;
+
+    pc = next_call_op(interp, raw_sig, raw_args, &lookup_reg);
+
+    if (!OPCODE_IS(interp, seg, *pc, core_ops, PARROT_OP_invokecc_p))
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, raw_flags);
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL flags = raw_flags[i];
+
+        if (flags & ~(PARAMS_POSITIONAL_FLAGS | PARROT_ARG_CONSTANT))
+            return 0;
+
+        if (raw_args[i + 2] == lookup_reg
+        &&  PARROT_ARG_TYPE(flags) == PARROT_ARG_PMC
+        &&  !PARROT_ARG_CONSTANT_ISSET(flags))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_pcc_materialize_args(PARROT_INTERP, PMC *call_object)>
+
+Copies the arguments of a direct call (see C<Parrot_pcc_build_call_from_op>)
+from the caller's registers into the positionals of C<call_object>. Does
+nothing if they are there already.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_materialize_args(PARROT_INTERP, ARGMOD(PMC *call_object))
+{
+    ASSERT_ARGS(Parrot_pcc_materialize_args)
+    Parrot_CallContext_attributes * const attrs = PARROT_CALLCONTEXT(call_object);
+    const opcode_t * const raw_args = attrs->direct_args;
+    PMC            * const ctx      = attrs->direct_ctx;
+    INTVAL         *raw_flags;
+    INTVAL          arg_count, i;
+
+    if (!raw_args)
+        return;
+
+    attrs->direct_args = NULL;
+    attrs->direct_ctx  = NULL;
+
+    GETATTR_FixedIntegerArray_size(interp, attrs->arg_flags, arg_count);
+    GETATTR_FixedIntegerArray_int_array(interp, attrs->arg_flags, raw_flags);
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL flags    = raw_flags[i];
+        const int    constant = 0 != PARROT_ARG_CONSTANT_ISSET(flags);
+        const INTVAL index    = raw_args[i + 2];
+
+        switch (PARROT_ARG_TYPE(flags)) {
+          case PARROT_ARG_INTVAL:
+            Parrot_CallContext_push_integer(interp, call_object, constant
+                    ? index
+                    : CTX_REG_INT(interp, ctx, index));
+            break;
+          case PARROT_ARG_FLOATVAL:
+            Parrot_CallContext_push_float(interp, call_object, constant
+                    ? Parrot_pcc_get_num_constant(interp, ctx, index)
+                    : CTX_REG_NUM(interp, ctx, index));
+            break;
+          case PARROT_ARG_STRING:
+            Parrot_CallContext_push_string(interp, call_object, constant
+                    ? Parrot_pcc_get_string_constant(interp, ctx, index)
+                    : CTX_REG_STR(interp, ctx, index));
+            break;
+          default:
+            Parrot_CallContext_push_pmc(interp, call_object, constant
+                    ? Parrot_pcc_get_pmc_constant(interp, ctx, index)
+                    : CTX_REG_PMC(interp, ctx, index));
+            break;
+        }
+    }
+}
+
+/*
+
 =item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *call_object,
 STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
 
@@ -839,6 +1183,7 @@ fill_params(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
         call_object = NULL;  /* so we don't need to use PMC_IS_NULL below */
     }
     else {
+        Parrot_pcc_materialize_args(interp, call_object);
         GETATTR_CallContext_num_positionals(interp, call_object, positional_args);
     }
 
@@ -853,6 +1198,8 @@ fill_params(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
     else {
         const INTVAL second_flag = raw_params[param_count - 1];
         if (second_flag & PARROT_ARG_CALL_SIG) {
+            if (call_object)
+                Parrot_pcc_capture_context(interp, call_object);
             *accessor->pmc(interp, arg_info, param_count - 1) = call_object ? call_object : PMCNULL;
             if (param_count == 1)
                 return;
@@ -1332,6 +1679,242 @@ Parrot_pcc_fill_params_from_op(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
 
 /*
 
+=item C<void Parrot_pcc_fill_sub_params_from_op(PARROT_INTERP, PMC *sub, PMC
+*call_object, PMC *raw_sig, opcode_t *raw_params)>
+
+Fills the parameters of the get_params op at C<raw_params> in C<sub>, as
+C<Parrot_pcc_fill_params_from_op> does. The shape of the signature is worked
+out on the first call and kept in the Sub; calls that match a simple shape
+exactly are bound without going through C<fill_params>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_fill_sub_params_from_op(PARROT_INTERP, ARGIN(PMC *sub),
+        ARGMOD_NULLOK(PMC *call_object), ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_params))
+{
+    ASSERT_ARGS(Parrot_pcc_fill_sub_params_from_op)
+    INTVAL shape = PARAMS_GENERIC;
+
+    if (sub->vtable->base_type == enum_class_Sub
+    ||  sub->vtable->base_type == enum_class_Coroutine) {
+        Parrot_Sub_attributes * const sub_attrs = PARROT_SUB(sub);
+
+        if (sub_attrs->param_site == raw_params)
+            shape = sub_attrs->param_shape;
+        else {
+            shape                  = classify_params(interp, raw_sig);
+            sub_attrs->param_shape = shape;
+            sub_attrs->param_site  = raw_params;
+        }
+    }
+
+    if (shape != PARAMS_GENERIC
+    &&  bind_positional_params(interp, call_object, raw_sig, raw_params,
+            shape == PARAMS_POSITIONAL_PMC))
+        return;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, raw_sig, raw_params,
+            PARROT_ERRORS_PARAM_COUNT_FLAG);
+}
+
+/*
+
+=item C<static INTVAL classify_params(PARROT_INTERP, PMC *raw_sig)>
+
+Returns the C<params_shape> of the get_params signature C<raw_sig>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+classify_params(PARROT_INTERP, ARGIN(PMC *raw_sig))
+{
+    ASSERT_ARGS(classify_params)
+    INTVAL *raw_flags;
+    INTVAL  param_count, i;
+    INTVAL  shape = PARAMS_POSITIONAL_PMC;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, raw_flags);
+
+    if (param_count == 0)
+        return PARAMS_GENERIC;
+
+    for (i = 0; i < param_count; ++i) {
+        const INTVAL flags = raw_flags[i];
+
+        if (flags & ~PARAMS_POSITIONAL_FLAGS
+        ||  PARROT_ARG_TYPE(flags) > PARROT_ARG_FLOATVAL)
+            return PARAMS_GENERIC;
+
+        if (PARROT_ARG_TYPE(flags) != PARROT_ARG_PMC)
+            shape = PARAMS_POSITIONAL;
+    }
+
+    return shape;
+}
+
+/*
+
+=item C<static int bind_positional_params(PARROT_INTERP, PMC *call_object, PMC
+*raw_sig, const opcode_t *raw_params, int all_pmc)>
+
+Binds the arguments in C<call_object> to the registers of a PARAMS_POSITIONAL
+or, if C<all_pmc>, a PARAMS_POSITIONAL_PMC signature. Returns 0 without
+binding anything unless the call passes exactly as many positional arguments
+and no named ones, leaving the rest and the errors to C<fill_params>.
+
+=cut
+
+*/
+
+PARROT_HOT
+static int
+bind_positional_params(PARROT_INTERP, ARGIN_NULLOK(PMC *call_object),
+        ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_params), int all_pmc)
+{
+    ASSERT_ARGS(bind_positional_params)
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    INTVAL     *raw_flags;
+    Hash       *named;
+    INTVAL      param_count, positional_args, i;
+
+    if (PMC_IS_NULL(call_object))
+        return 0;
+
+    if (PARROT_CALLCONTEXT(call_object)->direct_args) {
+        if (bind_direct_params(interp, call_object, raw_sig, raw_params))
+            return 1;
+        Parrot_pcc_materialize_args(interp, call_object);
+    }
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    GETATTR_CallContext_num_positionals(interp, call_object, positional_args);
+    if (positional_args != param_count)
+        return 0;
+
+    GETATTR_CallContext_hash(interp, call_object, named);
+    if (named && named->entries)
+        return 0;
+
+    /* the register numbers follow the opcode and the signature */
+    raw_params += 2;
+
+    if (all_pmc) {
+        for (i = 0; i < param_count; ++i)
+            CTX_REG_PMC(interp, ctx, raw_params[i]) =
+                Parrot_CallContext_get_pmc_keyed_int(interp, call_object, i);
+        return 1;
+    }
+
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, raw_flags);
+
+    for (i = 0; i < param_count; ++i) {
+        switch (PARROT_ARG_TYPE(raw_flags[i])) {
+          case PARROT_ARG_PMC:
+            CTX_REG_PMC(interp, ctx, raw_params[i]) =
+                Parrot_CallContext_get_pmc_keyed_int(interp, call_object, i);
+            break;
+          case PARROT_ARG_STRING:
+            CTX_REG_STR(interp, ctx, raw_params[i]) =
+                Parrot_CallContext_get_string_keyed_int(interp, call_object, i);
+            break;
+          case PARROT_ARG_INTVAL:
+            CTX_REG_INT(interp, ctx, raw_params[i]) =
+                Parrot_CallContext_get_integer_keyed_int(interp, call_object, i);
+            break;
+          default:
+            CTX_REG_NUM(interp, ctx, raw_params[i]) =
+                Parrot_CallContext_get_number_keyed_int(interp, call_object, i);
+            break;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static int bind_direct_params(PARROT_INTERP, PMC *call_object, PMC
+*raw_sig, const opcode_t *raw_params)>
+
+Binds the arguments of a direct call straight from the caller's registers to
+those of the parameters. Returns 0 without touching C<call_object> unless
+there are as many arguments as parameters, each of the same type; the
+registers of the parameters may have been written then.
+
+=cut
+
+*/
+
+PARROT_HOT
+static int
+bind_direct_params(PARROT_INTERP, ARGMOD(PMC *call_object), ARGIN(PMC *raw_sig),
+        ARGIN(const opcode_t *raw_params))
+{
+    ASSERT_ARGS(bind_direct_params)
+    Parrot_CallContext_attributes * const attrs = PARROT_CALLCONTEXT(call_object);
+    const opcode_t * const raw_args = attrs->direct_args;
+    PMC            * const from     = attrs->direct_ctx;
+    PMC            * const ctx      = CURRENT_CONTEXT(interp);
+    INTVAL         *arg_flags, *param_flags;
+    INTVAL          arg_count, param_count, i;
+
+    GETATTR_FixedIntegerArray_size(interp, attrs->arg_flags, arg_count);
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    if (arg_count != param_count)
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, attrs->arg_flags, arg_flags);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, param_flags);
+
+    for (i = 0; i < param_count; ++i) {
+        const INTVAL flags    = arg_flags[i];
+        const int    constant = 0 != PARROT_ARG_CONSTANT_ISSET(flags);
+        const INTVAL index    = raw_args[i + 2];
+        const INTVAL reg      = raw_params[i + 2];
+
+        if (PARROT_ARG_TYPE(flags) != PARROT_ARG_TYPE(param_flags[i]))
+            return 0;
+
+        switch (PARROT_ARG_TYPE(flags)) {
+          case PARROT_ARG_PMC:
+            CTX_REG_PMC(interp, ctx, reg) = constant
+                    ? Parrot_pcc_get_pmc_constant(interp, from, index)
+                    : CTX_REG_PMC(interp, from, index);
+            break;
+          case PARROT_ARG_STRING:
+            CTX_REG_STR(interp, ctx, reg) = constant
+                    ? Parrot_pcc_get_string_constant(interp, from, index)
+                    : CTX_REG_STR(interp, from, index);
+            break;
+          case PARROT_ARG_INTVAL:
+            CTX_REG_INT(interp, ctx, reg) = constant
+                    ? index
+                    : CTX_REG_INT(interp, from, index);
+            break;
+          default:
+            CTX_REG_NUM(interp, ctx, reg) = constant
+                    ? Parrot_pcc_get_num_constant(interp, from, index)
+                    : CTX_REG_NUM(interp, from, index);
+            break;
+        }
+    }
+
+    attrs->direct_args = NULL;
+    attrs->direct_ctx  = NULL;
+
+    return 1;
+}
+
+/*
+
 =item C<void Parrot_pcc_fill_params_from_c_args(PARROT_INTERP, PMC *call_object,
 const char *signature, ...)>
 
@@ -50,14 +50,23 @@ The macro CONTEXT() hides these details
 Round register allocation size up to the nearest multiple of 8. A granularity
 of 8 is arbitrary, it could have been some bigger power of 2. A "slot" is an
 index into the free_list array. Each slot in free_list has a linked list of
-pointers to already allocated contexts available for (re)use.  The slot where
-an available context is stored corresponds to the size of the context.
+pointers to already allocated register frames available for (re)use.  The slot
+where an available frame is stored corresponds to the size of the frame.
+
+Frames of dead contexts are put back into their slot instead of the GC's fixed
+size allocator, so that call-heavy code reuses a handful of frames without
+adding to the memory pressure which triggers collections. At most
+C<MAX_FREE_FRAMES> frames are kept per slot and frames bigger than
+C<MAX_FREE_SLOTS> slots are never kept, which bounds the memory held by the
+free lists.
 
 =cut
 
 */
 
 #define SLOT_CHUNK_SIZE 8
+#define MAX_FREE_SLOTS  256
+#define MAX_FREE_FRAMES 16
 
 #define ROUND_ALLOC_SIZE(size) ((((size) + SLOT_CHUNK_SIZE - 1) \
         / SLOT_CHUNK_SIZE) * SLOT_CHUNK_SIZE)
@@ -69,6 +78,11 @@ an available context is stored corresponds to the size of the context.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static void * allocate_frame(PARROT_INTERP, size_t size)
+        __attribute__nonnull__(1);
+
 static void allocate_registers(PARROT_INTERP,
     ARGIN(PMC *pmcctx),
     ARGIN(const UINTVAL *number_regs_used))
@@ -87,6 +101,9 @@ static void clear_regs(PARROT_INTERP, ARGMOD(Parrot_Context *ctx))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ctx);
 
+static void free_frame(PARROT_INTERP, size_t size, ARGFREE(void *frame))
+        __attribute__nonnull__(1);
+
 PARROT_CANNOT_RETURN_NULL
 static PMC* init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         __attribute__nonnull__(1)
@@ -103,6 +120,8 @@ static void set_context(PARROT_INTERP, ARGIN(PMC *ctx))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_allocate_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_allocate_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx) \
@@ -112,6 +131,8 @@ static void set_context(PARROT_INTERP, ARGIN(PMC *ctx))
 #define ASSERT_ARGS_clear_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_free_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_pcc_calculate_registers_size \
@@ -208,19 +229,65 @@ create_initial_context(PARROT_INTERP)
 {
     ASSERT_ARGS(create_initial_context)
     static const UINTVAL num_regs[] = {32, 32, 32, 32};
+    PMC *ctx;
 
     /* Create some initial free_list slots. */
 #define INITIAL_FREE_SLOTS 8
 
+    interp->ctx_mem.n_free_slots = INITIAL_FREE_SLOTS;
+    interp->ctx_mem.free_list    = mem_gc_allocate_n_zeroed_typed(interp,
+                                        INITIAL_FREE_SLOTS, void *);
+    interp->ctx_mem.n_free       = mem_gc_allocate_n_zeroed_typed(interp,
+                                        INITIAL_FREE_SLOTS, UINTVAL);
+
     /* For now create context with 32 regs each. Some src tests (and maybe
      * other extenders) assume the presence of these registers */
-    PMC * const ctx = Parrot_set_new_context(interp, num_regs);
+    ctx = Parrot_set_new_context(interp, num_regs);
     if (!ctx)
         Parrot_x_panic_and_exit(interp, "Out of mem", __FILE__, __LINE__);
 }
 
 /*
 
+=item C<void Parrot_pcc_destroy_frame_pool(PARROT_INTERP)>
+
+Gives all register frames kept for reuse back to the GC and releases the free
+lists. Frames of contexts destroyed afterwards are freed immediately.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_destroy_frame_pool(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_destroy_frame_pool)
+    context_mem * const mem = &interp->ctx_mem;
+    UINTVAL             slot;
+
+    if (!mem->free_list)
+        return;
+
+    for (slot = 0; slot < mem->n_free_slots; ++slot) {
+        void *frame = mem->free_list[slot];
+
+        while (frame) {
+            void * const next = *(void **)frame;
+            Parrot_gc_free_fixed_size_storage(interp,
+                    slot * SLOT_CHUNK_SIZE, frame);
+            frame = next;
+        }
+    }
+
+    mem_gc_free(interp, mem->free_list);
+    mem_gc_free(interp, mem->n_free);
+    mem->free_list    = NULL;
+    mem->n_free       = NULL;
+    mem->n_free_slots = 0;
+}
+
+/*
+
 =item C<static PMC* init_context(PMC *pmcctx, PMC *pmcold)>
 
 Initializes a freshly allocated or recycled context and returns the new one.
@@ -251,6 +318,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
     ctx->outer_ctx         = NULL;
     ctx->current_cont      = NULL;
     ctx->handlers          = PMCNULL;
+    ctx->num_eh_records    = 0;
     ctx->caller_ctx        = NULL;
     ctx->current_sig       = PMCNULL;
     ctx->current_sub       = PMCNULL;
@@ -420,7 +488,7 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
         return;
     }
     /* don't allocate any storage if there are no registers */
-    ctx->registers = (Parrot_Context *)Parrot_gc_allocate_fixed_size_storage(interp, reg_alloc);
+    ctx->registers = (Parrot_Context *)allocate_frame(interp, reg_alloc);
 
     /* ctx.bp points to I0, which has Nx on the left */
     ctx->bp.regs_i = (INTVAL *)((char *)ctx->registers + size_n);
@@ -432,6 +500,80 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
 }
 
 
+/*
+
+=item C<static void * allocate_frame(PARROT_INTERP, size_t size)>
+
+Returns a register frame of C<size> bytes, reusing one from the free list of
+its slot if available.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static void *
+allocate_frame(PARROT_INTERP, size_t size)
+{
+    ASSERT_ARGS(allocate_frame)
+    context_mem * const mem  = &interp->ctx_mem;
+    const UINTVAL       slot = CALCULATE_SLOT_NUM(size);
+
+    if (slot < mem->n_free_slots && mem->free_list[slot]) {
+        void * const frame   = mem->free_list[slot];
+        mem->free_list[slot] = *(void **)frame;
+        --mem->n_free[slot];
+        return frame;
+    }
+
+    return Parrot_gc_allocate_fixed_size_storage(interp, size);
+}
+
+
+/*
+
+=item C<static void free_frame(PARROT_INTERP, size_t size, void *frame)>
+
+Puts a register frame of C<size> bytes back into the free list of its slot, or
+gives it back to the GC if the slot is full or the frame too big to be kept.
+
+=cut
+
+*/
+
+static void
+free_frame(PARROT_INTERP, size_t size, ARGFREE(void *frame))
+{
+    ASSERT_ARGS(free_frame)
+    context_mem * const mem  = &interp->ctx_mem;
+    const UINTVAL       slot = CALCULATE_SLOT_NUM(size);
+
+    if (!mem->free_list || slot >= MAX_FREE_SLOTS) {
+        Parrot_gc_free_fixed_size_storage(interp, size, frame);
+        return;
+    }
+
+    if (slot >= mem->n_free_slots) {
+        const UINTVAL n = slot + 1;
+        mem->free_list  = mem_gc_realloc_n_typed_zeroed(interp,
+                            mem->free_list, n, mem->n_free_slots, void *);
+        mem->n_free     = mem_gc_realloc_n_typed_zeroed(interp,
+                            mem->n_free, n, mem->n_free_slots, UINTVAL);
+        mem->n_free_slots = n;
+    }
+
+    if (mem->n_free[slot] >= MAX_FREE_FRAMES) {
+        Parrot_gc_free_fixed_size_storage(interp, size, frame);
+        return;
+    }
+
+    *(void **)frame      = mem->free_list[slot];
+    mem->free_list[slot] = frame;
+    ++mem->n_free[slot];
+}
+
+
 /*
 
 =item C<static void clear_regs(PARROT_INTERP, Parrot_Context *ctx)>
@@ -498,7 +640,8 @@ Parrot_pcc_allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
 
 =item C<void Parrot_pcc_free_registers(PARROT_INTERP, PMC *pmcctx)>
 
-Free memory allocated for registers in Context.
+Free memory allocated for registers in Context. The register frame is kept
+for reuse by the next context of the same size.
 
 =cut
 
@@ -514,7 +657,54 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
         Parrot_pcc_calculate_registers_size(interp, ctx->n_regs_used);
 
     if (reg_size)
-        Parrot_gc_free_fixed_size_storage(interp, reg_size, ctx->registers);
+        free_frame(interp, reg_size, ctx->registers);
+
+    /* the frame may be handed out again, don't let this context see it */
+    ctx->registers              = NULL;
+    ctx->n_regs_used[REGNO_INT] = 0;
+    ctx->n_regs_used[REGNO_NUM] = 0;
+    ctx->n_regs_used[REGNO_STR] = 0;
+    ctx->n_regs_used[REGNO_PMC] = 0;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_recycle_context(PARROT_INTERP, PMC *pmcctx, const
+UINTVAL *number_regs_used)>
+
+Prepares the running context C<pmcctx> for a tail call that runs the next sub
+in it instead of in a new context. The caller, the continuation, the
+recursion depth and the inherited settings stay; the registers are cleared,
+or swapped for a frame of the new size, and the lexicals and exception
+handlers of the previous sub are dropped.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_recycle_context(PARROT_INTERP, ARGIN(PMC *pmcctx),
+        ARGIN(const UINTVAL *number_regs_used))
+{
+    ASSERT_ARGS(Parrot_pcc_recycle_context)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    if (ctx->n_regs_used[REGNO_INT] == number_regs_used[REGNO_INT]
+    &&  ctx->n_regs_used[REGNO_NUM] == number_regs_used[REGNO_NUM]
+    &&  ctx->n_regs_used[REGNO_STR] == number_regs_used[REGNO_STR]
+    &&  ctx->n_regs_used[REGNO_PMC] == number_regs_used[REGNO_PMC])
+        clear_regs(interp, ctx);
+    else {
+        Parrot_pcc_free_registers(interp, pmcctx);
+        Parrot_pcc_allocate_registers(interp, pmcctx, number_regs_used);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, pmcctx);
+    ctx->lex_pad        = PMCNULL;
+    ctx->outer_ctx      = NULL;
+    ctx->handlers       = PMCNULL;
+    ctx->num_eh_records = 0;
 }
 
 
@@ -885,11 +1075,11 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
         INTVAL  invoked;
         GETATTR_Continuation_invoked(interp, cont, invoked);
         /* Reuse if invoked. And not tailcalled? */
-        reuse = invoked && !(PObj_get_FLAGS(cont) |= SUB_FLAG_TAILCALL);
+        reuse = invoked && !(PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL);
     }
 
     if (!reuse || !PMC_data(cont)) {
-        cont = Parrot_pmc_new(interp, enum_class_Continuation);
+        cont = Parrot_pcc_new_return_continuation(interp);
 #ifndef NDEBUG
         if (Interp_trace_TEST(interp, PARROT_TRACE_CORO_STATE_FLAG))
             Parrot_io_eprintf(interp, "# continuation not reused\n");
@@ -898,6 +1088,11 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
         if (Interp_trace_TEST(interp, PARROT_TRACE_CORO_STATE_FLAG))
             Parrot_io_eprintf(interp, "# continuation reused\n");
 #endif
+        c->continuation = PMCNULL;
+        SETATTR_Continuation_to_call_object(interp, cont, c->current_sig);
+        SETATTR_Continuation_from_ctx(interp, cont, call_context);
+        SETATTR_Continuation_seg(interp, cont, interp->code);
+        SETATTR_Continuation_invoked(interp, cont, 0);
     }
 
     /* inlined VTABLE_set_pointer(interp, c->continuation, next) */
@@ -911,6 +1106,101 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
 
 /*
 
+=item C<PMC * Parrot_pcc_new_return_continuation(PARROT_INTERP)>
+
+Creates a Continuation returning to the current context, to be passed to a
+called sub.  Unlike a Continuation created with C<new>, it doesn't mark the
+current context as captured.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pcc_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_new_return_continuation)
+    PMC * const ctx  = CURRENT_CONTEXT(interp);
+    PMC * const cont = Parrot_pmc_new_noinit(interp, enum_class_Continuation);
+
+    SETATTR_Continuation_to_ctx(interp, cont, ctx);
+    SETATTR_Continuation_to_call_object(interp, cont,
+            Parrot_pcc_get_signature(interp, ctx));
+    SETATTR_Continuation_from_ctx(interp, cont, ctx);
+    SETATTR_Continuation_seg(interp, cont, interp->code);
+    PObj_custom_mark_SET(cont);
+
+    return cont;
+}
+
+/*
+
+=item C<void Parrot_pcc_capture_context(PARROT_INTERP, PMC *ctx)>
+
+Marks C<ctx> and its callers as captured: something outside of the call may
+refer to the context (or to a continuation returning into it) after the call
+returned, so the context has to keep its registers until it's collected.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_capture_context(PARROT_INTERP, ARGIN_NULLOK(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_capture_context)
+
+    /* the callers of a captured context are already captured */
+    while (!PMC_IS_NULL(ctx) && !CALLSIGNATURE_captured_TEST(ctx)) {
+        CALLSIGNATURE_captured_SET(ctx);
+        ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+    }
+}
+
+/*
+
+=item C<void Parrot_pcc_release_context(PARROT_INTERP, PMC *ctx, PMC *cont)>
+
+Called when C<ctx> returned through the Continuation C<cont>.  If C<cont> is
+the return continuation of the context and the context wasn't captured,
+nothing can refer to its registers anymore: the register frame goes back to
+the free list right away and C<cont> is kept for the next call of the context
+it returned to.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_release_context(PARROT_INTERP, ARGIN(PMC *ctx), ARGIN(PMC *cont))
+{
+    ASSERT_ARGS(Parrot_pcc_release_context)
+    Parrot_CallContext_attributes * const c = CONTEXT_STRUCT(ctx);
+    PMC *to_ctx;
+
+    if (ctx->vtable->base_type != enum_class_CallContext
+    ||  CALLSIGNATURE_captured_TEST(ctx)
+    ||  c->current_cont != cont
+    ||  PARROT_CONTINUATION(cont)->from_ctx != ctx)
+        return;
+
+    Parrot_pcc_free_registers(interp, ctx);
+
+    to_ctx = PARROT_CONTINUATION(cont)->to_ctx;
+    if (!(PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)
+    &&  cont->vtable->base_type == enum_class_Continuation
+    &&  to_ctx != ctx) {
+        PARROT_GC_WRITE_BARRIER(interp, to_ctx);
+        CONTEXT_STRUCT(to_ctx)->continuation = cont;
+    }
+}
+
+/*
+
 =item C<static void set_context(PARROT_INTERP, PMC *ctx)>
 
 Helper function to set breakpoint to.
@@ -286,7 +286,7 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
     ASSERT_ARGS(Parrot_pcc_invoke_from_sig_object)
 
     opcode_t    *dest;
-    PMC * const  ret_cont = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC * const  ret_cont = Parrot_pcc_new_return_continuation(interp);
     if (UNLIKELY(PMC_IS_NULL(call_object)))
         call_object = Parrot_pmc_new(interp, enum_class_CallContext);
 
@@ -326,7 +326,11 @@ PMC *
 Parrot_pcc_new_call_object(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_pcc_new_call_object)
-    return Parrot_pmc_new(interp, enum_class_CallContext);
+    PMC * const call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+
+    /* the caller may look at it after the call returned */
+    Parrot_pcc_capture_context(interp, call_object);
+    return call_object;
 }
 
 /*
@@ -207,6 +207,8 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
 #endif
         else if (STREQ(corename, "profiling"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
+        else if (STREQ(corename, "sampling"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
         else if (STREQ(corename, "gc_debug"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, corename));
         else if (STREQ(corename, "jit")
@@ -22,6 +22,7 @@ to the appropriate handler asynchronously.
 
 #include "events.str"
 #include "pmc/pmc_exception.h"
+#include "pmc/pmc_continuation.h"
 
 
 /* HEADERIZER HFILE: include/parrot/events.h */
@@ -43,11 +44,122 @@ void
 Parrot_cx_add_handler_local(PARROT_INTERP, ARGIN(PMC *handler))
 {
     ASSERT_ARGS(Parrot_cx_add_handler_local)
-    if (PMC_IS_NULL(Parrot_pcc_get_handlers(interp, interp->ctx)))
-        Parrot_pcc_set_handlers(interp, interp->ctx,
-                                Parrot_pmc_new(interp, enum_class_ResizablePMCArray));
+    PMC *handlers = Parrot_cx_get_handlers_local(interp, interp->ctx);
 
-    VTABLE_unshift_pmc(interp, Parrot_pcc_get_handlers(interp, interp->ctx), handler);
+    if (PMC_IS_NULL(handlers)) {
+        handlers = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        Parrot_pcc_set_handlers(interp, interp->ctx, handlers);
+    }
+
+    VTABLE_unshift_pmc(interp, handlers, handler);
+}
+
+/*
+
+=item C<void Parrot_cx_record_handler_local(PARROT_INTERP, void *address, INTVAL
+flags)>
+
+Adds a handler starting at C<address> to the current context, like
+C<Parrot_cx_add_handler_local> with a fresh C<ExceptionHandler> catching
+everything would, without creating the C<ExceptionHandler>. A C handler
+passes its C<Parrot_runloop> as C<address> and C<SUB_FLAG_C_HANDLER> as
+C<flags>.
+
+Most handlers are popped again without ever seeing an exception, so pushing
+one only appends the address, the code segment and the runloop to an array
+of the context. The C<ExceptionHandler> PMC is built from this record once
+somebody looks at the handlers of the context, usually because an exception
+is searching for a handler, see C<Parrot_cx_get_handlers_local>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_cx_record_handler_local(PARROT_INTERP, ARGIN(void *address), INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_cx_record_handler_local)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(interp->ctx);
+    Parrot_eh_record      *record;
+
+    if (ctx->num_eh_records == ctx->allocated_eh_records) {
+        const INTVAL      size    = ctx->allocated_eh_records
+                                  ? ctx->allocated_eh_records * 2 : 4;
+        Parrot_eh_record * const records = (Parrot_eh_record *)
+            Parrot_gc_allocate_fixed_size_storage(interp, size * sizeof (Parrot_eh_record));
+
+        if (ctx->eh_records) {
+            memcpy(records, ctx->eh_records,
+                ctx->num_eh_records * sizeof (Parrot_eh_record));
+            Parrot_gc_free_fixed_size_storage(interp,
+                ctx->allocated_eh_records * sizeof (Parrot_eh_record), ctx->eh_records);
+        }
+
+        ctx->eh_records           = records;
+        ctx->allocated_eh_records = size;
+    }
+
+    record             = &ctx->eh_records[ctx->num_eh_records++];
+    record->address    = address;
+    record->seg        = interp->code;
+    record->runloop_id = interp->current_runloop_id;
+    record->flags      = flags;
+}
+
+/*
+
+=item C<PMC * Parrot_cx_get_handlers_local(PARROT_INTERP, PMC *ctx)>
+
+Returns the list of handlers of C<ctx>, newest first, or C<PMCNULL> if it
+never had any. Handlers recorded with C<Parrot_cx_record_handler_local> are
+turned into C<ExceptionHandler> PMCs and moved to the list first, just as if
+they had been created when they were pushed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_cx_get_handlers_local(PARROT_INTERP, ARGIN(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_cx_get_handlers_local)
+    Parrot_Context * const c        = CONTEXT_STRUCT(ctx);
+    PMC                   *handlers = c->handlers;
+    INTVAL                 i;
+
+    if (!c->num_eh_records)
+        return handlers;
+
+    if (PMC_IS_NULL(handlers)) {
+        handlers = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        Parrot_pcc_set_handlers(interp, ctx, handlers);
+    }
+
+    /* The handler outlives the ops that pushed it, and so does the context
+     * it returns to */
+    Parrot_pcc_capture_context(interp, ctx);
+
+    for (i = 0; i < c->num_eh_records; ++i) {
+        const Parrot_eh_record * const record = &c->eh_records[i];
+        PMC * const handler = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+
+        SETATTR_Continuation_to_ctx(interp, handler, ctx);
+        SETATTR_Continuation_to_call_object(interp, handler,
+                Parrot_pcc_get_signature(interp, ctx));
+        SETATTR_Continuation_from_ctx(interp, handler, ctx);
+        SETATTR_Continuation_seg(interp, handler, record->seg);
+        SETATTR_Continuation_address(interp, handler, (opcode_t *)record->address);
+        SETATTR_Continuation_runloop_id(interp, handler, record->runloop_id);
+        PObj_get_FLAGS(handler) |= record->flags;
+
+        VTABLE_unshift_pmc(interp, handlers, handler);
+    }
+
+    c->num_eh_records = 0;
+    return handlers;
 }
 
 /*
@@ -65,7 +177,16 @@ void
 Parrot_cx_delete_handler_local(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_delete_handler_local)
-    PMC *handlers  = Parrot_pcc_get_handlers(interp, interp->ctx);
+    Parrot_Context * const ctx = CONTEXT_STRUCT(interp->ctx);
+    PMC                   *handlers;
+
+    /* the newest handler is always the last one recorded, if any */
+    if (ctx->num_eh_records) {
+        --ctx->num_eh_records;
+        return;
+    }
+
+    handlers = Parrot_pcc_get_handlers(interp, interp->ctx);
 
     if (PMC_IS_NULL(handlers))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
@@ -97,7 +218,7 @@ void
 Parrot_cx_delete_upto_handler_local(PARROT_INTERP, ARGIN(PMC *handler))
 {
     ASSERT_ARGS(Parrot_cx_delete_upto_handler_local)
-    PMC *handlers  = Parrot_pcc_get_handlers(interp, interp->ctx);
+    PMC *handlers  = Parrot_cx_get_handlers_local(interp, interp->ctx);
     if (!PMC_IS_NULL(handlers)) {
         while (VTABLE_elements(interp, handlers)) {
             PMC * const cand = VTABLE_get_pmc_keyed_int(interp, handlers, 0);
@@ -126,12 +247,13 @@ INTVAL
 Parrot_cx_count_handlers_local(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_count_handlers_local)
-    PMC * const handlers = Parrot_pcc_get_handlers(interp, interp->ctx);
+    PMC * const  handlers = Parrot_pcc_get_handlers(interp, interp->ctx);
+    const INTVAL recorded = CONTEXT_STRUCT(interp->ctx)->num_eh_records;
 
     if (PMC_IS_NULL(handlers))
-        return 0;
+        return recorded;
 
-    return VTABLE_elements(interp, handlers);
+    return recorded + VTABLE_elements(interp, handlers);
 }
 
 
@@ -303,7 +425,7 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
         context = Parrot_pcc_get_caller_ctx(interp, keep_context);
         keep_context = NULL;
         if (context) {
-            handlers = Parrot_pcc_get_handlers(interp, context);
+            handlers = Parrot_cx_get_handlers_local(interp, context);
             elements = !PMC_IS_NULL(handlers) ? VTABLE_elements(interp, handlers) : 0;
             pos = 0;
         }
@@ -322,7 +444,7 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
         }
         if (handled == -1) {
             context = (PMC *)VTABLE_get_pointer(interp, task);
-            handlers = Parrot_pcc_get_handlers(interp, context);
+            handlers = Parrot_cx_get_handlers_local(interp, context);
             elements = !PMC_IS_NULL(handlers) ? VTABLE_elements(interp, handlers) : 0;
             if (task->vtable->base_type == enum_class_Exception)
                 GETATTR_Exception_handlers_left(interp, task, pos);
@@ -336,7 +458,7 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
         }
         else {
             context = CURRENT_CONTEXT(interp);
-            handlers = Parrot_pcc_get_handlers(interp, context);
+            handlers = Parrot_cx_get_handlers_local(interp, context);
             elements = !PMC_IS_NULL(handlers) ? VTABLE_elements(interp, handlers) : 0;
             pos = 0;
         }
@@ -350,8 +472,14 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
 
             if (!PMC_IS_NULL(handler)) {
                 INTVAL valid_handler = 0;
-                Parrot_pcc_invoke_method_from_c_args(interp, handler, CONST_STRING(interp, "can_handle"),
-                        "P->I", task, &valid_handler);
+
+                /* Spare core handlers the method call, as control exceptions
+                 * usually pass a few of them on their way up */
+                if (handler->vtable->base_type == enum_class_ExceptionHandler)
+                    valid_handler = Parrot_ex_handler_can_handle(interp, handler, task);
+                else
+                    Parrot_pcc_invoke_method_from_c_args(interp, handler, CONST_STRING(interp, "can_handle"),
+                            "P->I", task, &valid_handler);
 
                 if (valid_handler) {
                     if (is_exception) {
@@ -377,7 +505,7 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
         /* Continue the search in the next context up the chain. */
         context = Parrot_pcc_get_caller_ctx(interp, context);
         if (context) {
-            handlers = Parrot_pcc_get_handlers(interp, context);
+            handlers = Parrot_cx_get_handlers_local(interp, context);
             elements = !PMC_IS_NULL(handlers) ? VTABLE_elements(interp, handlers) : 0;
             pos = 0;
         }
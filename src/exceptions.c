@@ -21,6 +21,7 @@ Define the core subsystem for exceptions.
 #include "exceptions.str"
 #include "pmc/pmc_continuation.h"
 #include "pmc/pmc_exception.h"
+#include "pmc/pmc_exceptionhandler.h"
 #include "parrot/exceptions.h"
 #include "parrot/events.h"
 
@@ -46,11 +47,6 @@ static PMC * build_exception_from_args(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
-static void Parrot_ex_update_for_rethrow(PARROT_INTERP, ARGMOD(PMC * ex))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        FUNC_MODIFIES(* ex);
-
 PARROT_CAN_RETURN_NULL
 static void setup_exception_args(PARROT_INTERP, ARGIN(const char *sig), ...)
         __attribute__nonnull__(1)
@@ -62,9 +58,6 @@ static void setup_exception_args(PARROT_INTERP, ARGIN(const char *sig), ...)
 #define ASSERT_ARGS_build_exception_from_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(format))
-#define ASSERT_ARGS_Parrot_ex_update_for_rethrow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(ex))
 #define ASSERT_ARGS_setup_exception_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sig))
@@ -160,6 +153,15 @@ die_from_exception(PARROT_INTERP, ARGIN(PMC *exception))
             STRING * const newmessage = CONST_STRING(interp, "No exception handler and no message\n");
             VTABLE_set_string_native(interp, exception, newmessage);
         }
+
+        /* With no API call to jump back to, as on the thread running a
+         * Task, nobody else reports the exception. */
+        if (!interp->api_jmp_buf && severity != EXCEPT_exit) {
+            STRING * const backtrace =
+                Parrot_ex_build_complete_backtrace_string(interp, exception);
+            Parrot_io_eprintf(interp, "%Ss\n%Ss",
+                    VTABLE_get_string(interp, exception), backtrace);
+        }
     }
 
     Parrot_x_jump_out(interp, interp->exit_code);
@@ -182,11 +184,8 @@ void
 Parrot_ex_add_c_handler(PARROT_INTERP, ARGIN(Parrot_runloop *jp))
 {
     ASSERT_ARGS(Parrot_ex_add_c_handler)
-    PMC * const handler = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
     /* Flag to mark a C exception handler */
-    PObj_get_FLAGS(handler) |= SUB_FLAG_C_HANDLER;
-    VTABLE_set_pointer(interp, handler, jp);
-    Parrot_cx_add_handler_local(interp, handler);
+    Parrot_cx_record_handler_local(interp, jp, SUB_FLAG_C_HANDLER);
 }
 
 /*
@@ -214,6 +213,7 @@ Parrot_ex_throw_from_op(PARROT_INTERP, ARGIN(PMC *exception), ARGIN_NULLOK(void
     PMC        *handler;
 
     /* Note the thrower. */
+    Parrot_pcc_capture_context(interp, CURRENT_CONTEXT(interp));
     VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "thrower"), CURRENT_CONTEXT(interp));
 
     /* Locate the handler, if there is one. */
@@ -338,6 +338,63 @@ build_exception(PARROT_INTERP, int ex_type,
 
 /*
 
+=item C<opcode_t * Parrot_ex_throw_control_from_op(PARROT_INTERP, INTVAL type,
+PMC *payload, void *dest)>
+
+Throws a control exception of C<type>, like C<CONTROL_RETURN> or
+C<CONTROL_LOOP_NEXT>, carrying C<payload>, from inside an op. Returns the
+address of the handler, just like C<Parrot_ex_throw_from_op>.
+
+A control exception only carries control to a handler further up, so this
+skips what errors need. There is no continuation to resume the thrower. The
+thrower isn't noted for a backtrace either, which would mark the whole call
+chain as captured and keep its register frames from being reused. Without a
+handler, the exception dies like any other.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+opcode_t *
+Parrot_ex_throw_control_from_op(PARROT_INTERP, INTVAL type,
+        ARGIN_NULLOK(PMC *payload), ARGIN_NULLOK(void *dest))
+{
+    ASSERT_ARGS(Parrot_ex_throw_control_from_op)
+    const INTVAL  exception_type_id = Parrot_hll_get_ctx_HLL_type(interp, enum_class_Exception);
+    PMC          *exception, *handler;
+    opcode_t     *address;
+
+    if (exception_type_id == enum_class_Exception) {
+        exception = Parrot_pmc_new_init_int(interp, enum_class_Exception, type);
+        if (!PMC_IS_NULL(payload))
+            SETATTR_Exception_payload(interp, exception, payload);
+    }
+    else {
+        exception = Parrot_ex_build_exception(interp, EXCEPT_error, type, NULL);
+        if (!PMC_IS_NULL(payload))
+            VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "payload"), payload);
+    }
+
+    handler = Parrot_cx_find_handler_local(interp, exception);
+    if (PMC_IS_NULL(handler))
+        die_from_exception(interp, exception);
+
+    address = VTABLE_invoke(interp, handler, dest);
+    setup_exception_args(interp, "P", exception);
+
+    if (PObj_get_FLAGS(handler) & SUB_FLAG_C_HANDLER) {
+        Parrot_runloop * const jump_point = (Parrot_runloop *)address;
+        jump_point->exception = exception;
+        longjmp(jump_point->resume, PARROT_JMP_EXCEPTION_HANDLED);
+    }
+
+    return address;
+}
+
+/*
+
 =item C<void Parrot_ex_throw_from_c(PARROT_INTERP, PMC *exception)>
 
 Throws an exception object from any location in C code. A suitable handler
@@ -386,6 +443,7 @@ Parrot_ex_throw_from_c(PARROT_INTERP, ARGIN(PMC *exception))
 
     /* Note the thrower.
      * Don't split line. It will break CONST_STRING handling. */
+    Parrot_pcc_capture_context(interp, CURRENT_CONTEXT(interp));
     VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "thrower"), CURRENT_CONTEXT(interp));
 
     if (PMC_IS_NULL(handler))
@@ -567,6 +625,97 @@ Parrot_ex_mark_unhandled(PARROT_INTERP, ARGIN(PMC *exception))
 
 /*
 
+=item C<INTVAL Parrot_ex_handler_can_handle(PARROT_INTERP, PMC *handler, PMC
+*exception)>
+
+Reports whether the C<ExceptionHandler> C<handler> catches C<exception>,
+judging by its severity and type. This is the C<can_handle> method of
+C<ExceptionHandler>; C<Parrot_cx_find_handler_local> calls it directly
+instead of going through a method call for every handler it looks at.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_ex_handler_can_handle(PARROT_INTERP, ARGIN(PMC *handler), ARGIN(PMC *exception))
+{
+    ASSERT_ARGS(Parrot_ex_handler_can_handle)
+    const int is_core = exception->vtable->base_type == enum_class_Exception;
+    PMC      *handled_types, *handled_types_except;
+    INTVAL    severity, type, min_severity, max_severity;
+
+    /* We handle Exception and anything that claims to implement that role
+       here. Include the base_type check as a sort of optimization */
+    if (!is_core && !VTABLE_isa(interp, exception, CONST_STRING(interp, "Exception")))
+        return 0;
+
+    if (is_core)
+        GETATTR_Exception_severity(interp, exception, severity);
+    else
+        severity = VTABLE_get_integer_keyed_str(interp, exception, CONST_STRING(interp, "severity"));
+
+    GETATTR_ExceptionHandler_min_severity(interp, handler, min_severity);
+    GETATTR_ExceptionHandler_max_severity(interp, handler, max_severity);
+
+    if (severity < min_severity)
+        return 0;
+    if (max_severity > 0 && severity > max_severity)
+        return 0;
+
+    GETATTR_ExceptionHandler_handled_types(interp, handler, handled_types);
+    GETATTR_ExceptionHandler_handled_types_except(interp, handler, handled_types_except);
+    if (PMC_IS_NULL(handled_types) && PMC_IS_NULL(handled_types_except))
+        return 1;
+
+    if (is_core)
+        GETATTR_Exception_type(interp, exception, type);
+    else
+        type = VTABLE_get_integer_keyed_str(interp, exception, CONST_STRING(interp, "type"));
+
+    if (!PMC_IS_NULL(handled_types)) {
+        if (handled_types->vtable->base_type == enum_class_Key) {
+            PMC *key;
+            for (key = handled_types; key; key = Parrot_key_next(interp, key)) {
+                const INTVAL handled_type = Parrot_key_integer(interp, key);
+                if (handled_type == type || handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                    return 1;
+            }
+        }
+        else {
+            const INTVAL elems = VTABLE_elements(interp, handled_types);
+            INTVAL i;
+
+            for (i = 0; i < elems; ++i) {
+                const INTVAL handled_type =
+                    VTABLE_get_integer_keyed_int(interp, handled_types, i);
+                if (handled_type == type || handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                    return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    {
+        const INTVAL elems = VTABLE_elements(interp, handled_types_except);
+        INTVAL i;
+
+        for (i = 0; i < elems; ++i) {
+            const INTVAL handled_type =
+                VTABLE_get_integer_keyed_int(interp, handled_types_except, i);
+            if (handled_type == type || handled_type == (type | EXCEPTION_TYPE_ALL_MASK))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
 =item C<PMC * Parrot_ex_get_current_handler(PARROT_INTERP, PMC *expmc)>
 
 Get the current exception handler from expmc.
@@ -719,7 +868,7 @@ Parrot_print_backtrace(void)
 
 /*
 
-=item C<static void Parrot_ex_update_for_rethrow(PARROT_INTERP, PMC * ex)>
+=item C<void Parrot_ex_update_for_rethrow(PARROT_INTERP, PMC * ex)>
 
 Update an exception PMC so that it can be rethrown.
 
@@ -727,7 +876,8 @@ Update an exception PMC so that it can be rethrown.
 
 */
 
-static void
+PARROT_EXPORT
+void
 Parrot_ex_update_for_rethrow(PARROT_INTERP, ARGMOD(PMC * ex))
 {
     ASSERT_ARGS(Parrot_ex_update_for_rethrow)
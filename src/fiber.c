@@ -0,0 +1,611 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/fiber.c - The C stacks Tasks run on
+
+=head1 DESCRIPTION
+
+A fiber is a C stack of its own, together with the part of the interpreter
+state that belongs to whatever runs on it: the current context, the bytecode
+segment and the runloop jump points. Every Task but the main one runs on a
+fiber, so it can be suspended anywhere, even deep in a nested runloop of a
+vtable override or an NCI callback, and later continue right there.
+
+The scheduler runs on the stack of the thread. It resumes the fiber of the
+task it picked, and the fiber suspends itself to get back to the scheduler.
+Fibers never switch to one another directly.
+
+Each fiber gets a stack as large as the threads get by default, the stack
+limit of the process, unless C<PARROT_FIBER_STACK_SIZE> in the environment
+gives the size in bytes. The stacks are mapped with an inaccessible page
+below them, so a task recursing too deep crashes right away, as it would on
+the stack of the thread, instead of writing over whatever lies below.
+
+Switching saves the registers with C<swapcontext>, so fibers are available
+wherever F<ucontext.h> is. Without it, C<Parrot_fiber_new> returns C<NULL>
+and tasks run on the stack of the thread, as before.
+
+The GC traces the used part of every stack, and the saved registers, see
+F<src/gc/system.c>.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/events.h"
+#include "parrot/fiber.h"
+#include "fiber.str"
+
+#if defined(PARROT_HAS_HEADER_SYSRESOURCE)
+#  include <sys/resource.h>
+#endif
+
+/* HEADERIZER HFILE: include/parrot/fiber.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void fiber_main(unsigned int hi, unsigned int lo);
+static int fiber_setup_regs(ARGMOD(Parrot_fiber *fiber))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*fiber);
+
+PARROT_CAN_RETURN_NULL
+static char * fiber_stack_alloc(ARGIN(const Parrot_fiber_set *set))
+        __attribute__nonnull__(1);
+
+static void fiber_stack_free(
+    ARGIN(const Parrot_fiber_set *set),
+    ARGFREE(char *stack))
+        __attribute__nonnull__(1);
+
+static size_t fiber_stack_size(PARROT_INTERP, size_t page_size)
+        __attribute__nonnull__(1);
+
+static void fiber_switch(PARROT_INTERP,
+    ARGMOD(Parrot_fiber *from),
+    ARGMOD(Parrot_fiber *to))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*from)
+        FUNC_MODIFIES(*to);
+
+#define ASSERT_ARGS_fiber_main __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_fiber_setup_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(fiber))
+#define ASSERT_ARGS_fiber_stack_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(set))
+#define ASSERT_ARGS_fiber_stack_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(set))
+#define ASSERT_ARGS_fiber_stack_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_fiber_switch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(from) \
+    , PARROT_ASSERT_ARG(to))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<Parrot_fiber * Parrot_fiber_new(PARROT_INTERP, PMC *code, PMC *data)>
+
+Makes a fiber that calls C<code> with C<data> once it's resumed the first
+time. Returns C<NULL> if this platform has no fibers, or if the fiber could
+not be set up; the caller runs C<code> on its own stack then.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parrot_fiber *
+Parrot_fiber_new(PARROT_INTERP, ARGIN(PMC *code), ARGIN(PMC *data))
+{
+    ASSERT_ARGS(Parrot_fiber_new)
+#ifdef PARROT_HAS_FIBERS
+    Parrot_fiber_set *set = interp->fibers;
+    Parrot_fiber     *fiber;
+
+    if (!set) {
+        set                = mem_internal_allocate_zeroed_typed(Parrot_fiber_set);
+        set->thread.interp = interp;
+        set->thread.state  = PARROT_FIBER_RUNNING;
+#  ifdef PARROT_HAS_HEADER_SYSMMAN
+        set->guard_size    = (size_t)sysconf(_SC_PAGESIZE);
+#  endif
+        set->stack_size    = fiber_stack_size(interp, set->guard_size);
+        interp->fibers     = set;
+    }
+
+    if (set->spare) {
+        fiber      = set->spare;
+        set->spare = fiber->next;
+        --set->num_spare;
+    }
+    else {
+        char * const stack = fiber_stack_alloc(set);
+
+        if (!stack)
+            return NULL;
+
+        fiber             = mem_internal_allocate_zeroed_typed(Parrot_fiber);
+        fiber->interp     = interp;
+        fiber->stack      = stack;
+        fiber->stack_size = set->stack_size;
+    }
+
+    if (!fiber_setup_regs(fiber)) {
+        fiber_stack_free(set, fiber->stack);
+        mem_internal_free(fiber);
+        return NULL;
+    }
+
+    fiber->code      = code;
+    fiber->data      = data;
+    fiber->exception = NULL;
+    fiber->state     = PARROT_FIBER_NEW;
+    fiber->stack_ptr = NULL;
+
+    fiber->prev = NULL;
+    fiber->next = set->live;
+    if (set->live)
+        set->live->prev = fiber;
+    set->live = fiber;
+
+    return fiber;
+#else
+    UNUSED(interp);
+    UNUSED(code);
+    UNUSED(data);
+    return NULL;
+#endif
+}
+
+/*
+
+=item C<static size_t fiber_stack_size(PARROT_INTERP, size_t page_size)>
+
+Returns how large the stacks of the fibers of this interpreter are, rounded
+up to whole pages of C<page_size> bytes, if that's not 0.
+
+=cut
+
+*/
+
+static size_t
+fiber_stack_size(PARROT_INTERP, size_t page_size)
+{
+    ASSERT_ARGS(fiber_stack_size)
+    STRING * const env  = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_FIBER_STACK_SIZE"));
+    size_t         size = PARROT_FIBER_STACK_SIZE;
+
+    if (!STRING_IS_NULL(env)) {
+        const INTVAL bytes = Parrot_str_to_int(interp, env);
+        if (bytes > 0)
+            size = (size_t)bytes;
+    }
+    else {
+#if defined(PARROT_HAS_HEADER_SYSRESOURCE)
+        /* what pthread_create gives a thread when asked for nothing else */
+        struct rlimit limit;
+        if (getrlimit(RLIMIT_STACK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+            size = (size_t)limit.rlim_cur;
+#endif
+    }
+
+    if (size < PARROT_FIBER_MIN_STACK_SIZE)
+        size = PARROT_FIBER_MIN_STACK_SIZE;
+    if (page_size)
+        size = (size + page_size - 1) / page_size * page_size;
+
+    return size;
+}
+
+/*
+
+=item C<static char * fiber_stack_alloc(const Parrot_fiber_set *set)>
+
+Maps a stack for a fiber of C<set>, with the guard pages below it. Returns
+C<NULL> if there's no room for it.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static char *
+fiber_stack_alloc(ARGIN(const Parrot_fiber_set *set))
+{
+    ASSERT_ARGS(fiber_stack_alloc)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    int   flags = MAP_PRIVATE | MAP_ANON;
+    char *map;
+
+#  ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#  endif
+#  ifdef MAP_STACK
+    flags |= MAP_STACK;
+#  endif
+
+    map = (char *)mmap(NULL, set->guard_size + set->stack_size,
+            PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (map == (char *)MAP_FAILED)
+        return NULL;
+
+    /* the stacks grow down, into the guard */
+    if (mprotect(map, set->guard_size, PROT_NONE)) {
+        munmap(map, set->guard_size + set->stack_size);
+        return NULL;
+    }
+
+    return map + set->guard_size;
+#else
+    return (char *)mem_internal_allocate(set->stack_size);
+#endif
+}
+
+/*
+
+=item C<static void fiber_stack_free(const Parrot_fiber_set *set, char *stack)>
+
+Unmaps a stack from C<fiber_stack_alloc>, guard pages and all.
+
+=cut
+
+*/
+
+static void
+fiber_stack_free(ARGIN(const Parrot_fiber_set *set), ARGFREE(char *stack))
+{
+    ASSERT_ARGS(fiber_stack_free)
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    munmap(stack - set->guard_size, set->guard_size + set->stack_size);
+#else
+    UNUSED(set);
+    mem_internal_free(stack);
+#endif
+}
+
+/*
+
+=item C<static int fiber_setup_regs(Parrot_fiber *fiber)>
+
+Sets up the registers of C<fiber> to start C<fiber_main> on its stack.
+Returns 0 on failure.
+
+=cut
+
+*/
+
+static int
+fiber_setup_regs(ARGMOD(Parrot_fiber *fiber))
+{
+    ASSERT_ARGS(fiber_setup_regs)
+#ifdef PARROT_HAS_FIBERS
+    const ptrcast_t addr = (ptrcast_t)fiber;
+
+    if (getcontext(&fiber->regs))
+        return 0;
+
+    fiber->regs.uc_stack.ss_sp   = fiber->stack;
+    fiber->regs.uc_stack.ss_size = fiber->stack_size;
+    fiber->regs.uc_link          = NULL;
+
+    /* makecontext only passes ints, so the pointer goes in two halves */
+    makecontext(&fiber->regs, (void (*)(void))fiber_main, 2,
+            (unsigned int)((addr >> 16) >> 16), (unsigned int)(addr & 0xffffffffUL));
+    return 1;
+#else
+    UNUSED(fiber);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<static void fiber_main(unsigned int hi, unsigned int lo)>
+
+Where a fiber starts. It runs the code of the fiber and switches back to the
+thread for good.
+
+The code runs in a context of the fiber's own, with a C handler that catches
+whatever the code leaves unhandled. The handlers further out belong to the
+stack of the thread: their runloops and C frames aren't on this stack, so
+they must not be reached from here. The exception caught is kept in the
+fiber, for the thread to rethrow once it is back on its own stack.
+
+=cut
+
+*/
+
+static void
+fiber_main(unsigned int hi, unsigned int lo)
+{
+    ASSERT_ARGS(fiber_main)
+    Parrot_fiber * const fiber =
+        (Parrot_fiber *)((((ptrcast_t)hi << 16) << 16) | (ptrcast_t)lo);
+    Interp * const interp = fiber->interp;
+    UINTVAL        regs_used[] = { 0, 0, 0, 0 };
+    PMC * const    ctx = Parrot_push_context(interp, regs_used);
+    Parrot_runloop jump_point;
+
+    switch (setjmp(jump_point.resume)) {
+      case 0:
+        Parrot_ex_add_c_handler(interp, &jump_point);
+        Parrot_ext_call(interp, fiber->code, "P->", fiber->data);
+        break;
+      default:
+        fiber->exception = jump_point.exception;
+        Parrot_pcc_set_context(interp, ctx);
+
+        /* the runloops the exception left */
+        while (interp->current_runloop)
+            Parrot_runloop_free_jump_point(interp);
+        break;
+    }
+
+    Parrot_cx_delete_handler_local(interp);
+    Parrot_pop_context(interp);
+
+    fiber->state = PARROT_FIBER_DONE;
+    fiber_switch(interp, fiber, &interp->fibers->thread);
+
+    /* nobody resumes a finished fiber */
+    PARROT_ASSERT(0);
+}
+
+/*
+
+=item C<static void fiber_switch(PARROT_INTERP, Parrot_fiber *from, Parrot_fiber
+*to)>
+
+Leaves the fiber C<from>, which we run on, for C<to>. Returns once some
+fiber switches back to C<from>.
+
+=cut
+
+*/
+
+static void
+fiber_switch(PARROT_INTERP, ARGMOD(Parrot_fiber *from), ARGMOD(Parrot_fiber *to))
+{
+    ASSERT_ARGS(fiber_switch)
+    Parrot_fiber_set * const set = interp->fibers;
+
+    /* Everything below this frame is in the registers saved by the switch */
+    from->stack_ptr     = (void *)&from;
+    from->ctx           = CURRENT_CONTEXT(interp);
+    from->code_seg      = interp->code;
+    from->runloop       = interp->current_runloop;
+    from->runloop_level = interp->current_runloop_level;
+    from->runloop_id    = interp->current_runloop_id;
+    if (from->state == PARROT_FIBER_RUNNING)
+        from->state = PARROT_FIBER_SUSPENDED;
+
+    CURRENT_CONTEXT(interp)       = to->ctx;
+    interp->code                  = to->code_seg;
+    interp->current_runloop       = to->runloop;
+    interp->current_runloop_level = to->runloop_level;
+    interp->current_runloop_id    = to->runloop_id;
+    to->state                     = PARROT_FIBER_RUNNING;
+    set->current                  = to->stack ? to : NULL;
+
+#ifdef PARROT_HAS_FIBERS
+    swapcontext(&from->regs, &to->regs);
+#endif
+}
+
+/*
+
+=item C<void Parrot_fiber_resume(PARROT_INTERP, Parrot_fiber *fiber)>
+
+Runs C<fiber> until it suspends itself or its code returns. Only the thread
+itself resumes fibers, never another fiber.
+
+A new fiber starts out in the context of its caller, but with no runloops:
+the runloops on the stack of the thread can't be jumped to from the fiber.
+
+=cut
+
+*/
+
+void
+Parrot_fiber_resume(PARROT_INTERP, ARGMOD(Parrot_fiber *fiber))
+{
+    ASSERT_ARGS(Parrot_fiber_resume)
+    Parrot_fiber_set * const set = interp->fibers;
+
+    PARROT_ASSERT(set && !set->current);
+    PARROT_ASSERT(fiber->state == PARROT_FIBER_NEW
+               || fiber->state == PARROT_FIBER_SUSPENDED);
+
+    if (fiber->state == PARROT_FIBER_NEW) {
+        fiber->ctx           = CURRENT_CONTEXT(interp);
+        fiber->code_seg      = interp->code;
+        fiber->runloop       = NULL;
+        fiber->runloop_level = interp->current_runloop_level;
+        fiber->runloop_id    = interp->current_runloop_id;
+    }
+
+    fiber_switch(interp, &set->thread, fiber);
+}
+
+/*
+
+=item C<void Parrot_fiber_suspend(PARROT_INTERP)>
+
+Switches from the fiber we run on back to the thread. Returns when the fiber
+is resumed.
+
+=cut
+
+*/
+
+void
+Parrot_fiber_suspend(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_fiber_suspend)
+    Parrot_fiber_set * const set = interp->fibers;
+
+    PARROT_ASSERT(set && set->current);
+    fiber_switch(interp, set->current, &set->thread);
+}
+
+/*
+
+=item C<void Parrot_fiber_free(PARROT_INTERP, Parrot_fiber *fiber)>
+
+Gets rid of a fiber that isn't running. Its stack is kept for the next
+fiber, up to C<PARROT_FIBER_MAX_SPARE> of them.
+
+A fiber dropped while suspended never finishes what it was doing. Its
+runloop jump points go back to the free list; whatever else its C frames
+held is lost.
+
+=cut
+
+*/
+
+void
+Parrot_fiber_free(PARROT_INTERP, ARGFREE(Parrot_fiber *fiber))
+{
+    ASSERT_ARGS(Parrot_fiber_free)
+    Parrot_fiber_set * const set = interp->fibers;
+
+    PARROT_ASSERT(fiber != set->current);
+
+    if (fiber->state == PARROT_FIBER_SUSPENDED)
+        while (fiber->runloop) {
+            Parrot_runloop * const jump_point = fiber->runloop;
+            fiber->runloop                    = jump_point->prev;
+            jump_point->prev                  = interp->runloop_jmp_free_list;
+            interp->runloop_jmp_free_list     = jump_point;
+        }
+
+    if (fiber->prev)
+        fiber->prev->next = fiber->next;
+    else
+        set->live = fiber->next;
+    if (fiber->next)
+        fiber->next->prev = fiber->prev;
+
+    if (set->num_spare < PARROT_FIBER_MAX_SPARE) {
+        fiber->code      = NULL;
+        fiber->data      = NULL;
+        fiber->exception = NULL;
+        fiber->ctx       = NULL;
+        fiber->stack_ptr = NULL;
+        fiber->prev      = NULL;
+        fiber->next      = set->spare;
+        set->spare       = fiber;
+        ++set->num_spare;
+    }
+    else {
+        fiber_stack_free(set, fiber->stack);
+        mem_internal_free(fiber);
+    }
+}
+
+/*
+
+=item C<INTVAL Parrot_fiber_is_done(const Parrot_fiber *fiber)>
+
+Returns 1 if the code of C<fiber> returned.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_fiber_is_done(ARGIN(const Parrot_fiber *fiber))
+{
+    ASSERT_ARGS(Parrot_fiber_is_done)
+    return fiber->state == PARROT_FIBER_DONE;
+}
+
+/*
+
+=item C<PMC * Parrot_fiber_exception(const Parrot_fiber *fiber)>
+
+Returns the exception that the code of the finished C<fiber> left unhandled,
+or C<NULL> if it returned normally.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_fiber_exception(ARGIN(const Parrot_fiber *fiber))
+{
+    ASSERT_ARGS(Parrot_fiber_exception)
+    return fiber->exception;
+}
+
+/*
+
+=item C<void Parrot_fiber_finish(PARROT_INTERP)>
+
+Frees all the fibers of a dying interpreter. The tasks are gone by now, but
+the spare fibers are left.
+
+=cut
+
+*/
+
+void
+Parrot_fiber_finish(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_fiber_finish)
+    Parrot_fiber_set * const set = interp->fibers;
+    Parrot_fiber     *fiber;
+
+    if (!set)
+        return;
+
+    while ((fiber = set->live) != NULL)
+        Parrot_fiber_free(interp, fiber);
+
+    while ((fiber = set->spare) != NULL) {
+        set->spare = fiber->next;
+        fiber_stack_free(set, fiber->stack);
+        mem_internal_free(fiber);
+    }
+
+    mem_internal_free(set);
+    interp->fibers = NULL;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/scheduler.c>, F<src/pmc/task.pmc>, F<src/gc/system.c>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -64,6 +64,11 @@ gc_inf.c implements an "infinite" allocator which never frees any memory.
 The infinite allocator is not recommended except for debugging.
 The default is currently F<gc_gms.c>, it was F<gc_ms2.c> until RELEASE_3_3_0.
 
+=item F<src/gc/telemetry.c>
+
+This file records the GC event stream, the phase timing histograms and the
+sampled allocation sites. The gms and ms2 cores report to it.
+
 =item F<src/gc/mark_sweep.c>
 
 This file implements some generic utility functions that are commonly needed by
@@ -196,6 +201,7 @@ Parrot_gc_initialize(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
     interp->lo_var_ptr = args->stacktop;
 
     interp->gc_sys->sys_type = PARROT_GC_DEFAULT_TYPE;
+    Parrot_gc_telemetry_init(interp);
 
     if (args->system != NULL) {
         if (STREQ(args->system, "gms"))
@@ -296,6 +302,7 @@ Parrot_gc_finalize(PARROT_INTERP)
     if (interp->gc_sys->finalize_gc_system)
         interp->gc_sys->finalize_gc_system(interp);
 
+    Parrot_gc_telemetry_destroy(interp);
     mem_internal_free(interp->gc_sys);
     interp->gc_sys = NULL;
 }
@@ -334,6 +341,10 @@ Parrot_gc_new_pmc_header(PARROT_INTERP, UINTVAL flags)
     pmc->orig_interp    = interp;
 #endif
 
+    if (UNLIKELY(interp->gc_sys->alloc_sample_countdown)
+    &&  --interp->gc_sys->alloc_sample_countdown == 0)
+        Parrot_gc_telemetry_sample(interp, pmc);
+
     return pmc;
 }
 
@@ -1178,6 +1189,113 @@ Parrot_gc_pmc_needs_early_collection(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 /*
 
+=item C<UINTVAL Parrot_gc_event_count(PARROT_INTERP)>
+
+Returns the number of collections recorded by the GC telemetry so far. Only the
+gms and ms2 cores record them.
+
+=item C<const Parrot_GC_event * Parrot_gc_get_event(PARROT_INTERP, UINTVAL
+cycle)>
+
+Returns the record of collection number C<cycle>, counting from 0, or NULL when
+it is not one of the last C<GC_EVENT_RING_SIZE> collections.
+
+=item C<PMC * Parrot_gc_events(PARROT_INTERP, UINTVAL since)>
+
+Returns an array with a Hash for every collection still recorded, starting at
+collection number C<since>. The keys are C<cycle>, C<generation> (the oldest
+generation collected), C<start> and C<end> (in seconds), the time spent in
+C<mark>, C<sweep> and C<compact>, the bytes C<promoted> into an older
+generation, C<memory_used> after the collection and C<survivors>, an array with
+the number of live headers found in each collected generation.
+
+=item C<const UINTVAL * Parrot_gc_phase_histogram(PARROT_INTERP, Parrot_gc_phase
+phase)>
+
+Returns the C<PARROT_GC_HISTOGRAM_BUCKETS> counters of the durations of
+C<phase>. Bucket N counts the phases that took less than 2^N microseconds but
+not less than 2^(N-1).
+
+=item C<void Parrot_gc_sample_allocations(PARROT_INTERP, UINTVAL rate)>
+
+Remembers where one in every C<rate> PMCs is allocated, so that the sites whose
+objects survive collections can be found with C<Parrot_gc_allocation_sites>. A
+rate of 0 turns sampling off and drops all samples. Does nothing with GC cores
+that don't feed the telemetry.
+
+=item C<PMC * Parrot_gc_allocation_sites(PARROT_INTERP)>
+
+Returns an array with a Hash for each site that allocated sampled objects which
+are still alive, the site with most of them first. The keys are C<sub>, the Sub
+doing the allocation, C<pc>, the offset of the last call that Sub made, or -1,
+C<objects>, the number of live sampled objects, C<survived>, the number of
+collections they lived through together, and C<generations>, an array with the
+number of these objects in each generation.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+UINTVAL
+Parrot_gc_event_count(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_event_count)
+    return interp->gc_sys->telemetry->cycles;
+}
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const Parrot_GC_event *
+Parrot_gc_get_event(PARROT_INTERP, UINTVAL cycle)
+{
+    ASSERT_ARGS(Parrot_gc_get_event)
+    return Parrot_gc_telemetry_event(interp, cycle);
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_gc_events(PARROT_INTERP, UINTVAL since)
+{
+    ASSERT_ARGS(Parrot_gc_events)
+    return Parrot_gc_telemetry_events(interp, since);
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const UINTVAL *
+Parrot_gc_phase_histogram(PARROT_INTERP, Parrot_gc_phase phase)
+{
+    ASSERT_ARGS(Parrot_gc_phase_histogram)
+    PARROT_ASSERT(phase < PARROT_GC_PHASES);
+    return interp->gc_sys->telemetry->histogram[phase];
+}
+
+PARROT_EXPORT
+void
+Parrot_gc_sample_allocations(PARROT_INTERP, UINTVAL rate)
+{
+    ASSERT_ARGS(Parrot_gc_sample_allocations)
+    if (interp->gc_sys->sys_type == GMS || interp->gc_sys->sys_type == MS2)
+        Parrot_gc_telemetry_sample_rate(interp, rate);
+}
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_gc_allocation_sites(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_allocation_sites)
+    return Parrot_gc_telemetry_sites(interp);
+}
+
+/*
+
 =item C<STRING * Parrot_gc_sys_name(PARROT_INTERP)>
 
 Retrieve the name of the currently active GC system.
@@ -150,12 +150,6 @@ typedef struct string_alloc_struct {
 #define STR2PAC(p) ((string_alloc_struct *)((char*)(p) - sizeof (void *)))
 
 
-/* Get generation from PObj->flags */
-#define POBJ2GEN(pobj)                                                  \
-        ((size_t)(((pobj)->flags & PObj_GC_generation_0_FLAG) ? 1 : 0)  \
-         + (((pobj)->flags & PObj_GC_generation_1_FLAG) ? 2 : 0)        \
-         + (((pobj)->flags & PObj_GC_generation_2_FLAG) ? 4 : 0))
-
 /* Get flags for generation number */
 #define GEN2FLAGS(gen)                                  \
         (((gen) & 1 ? PObj_GC_generation_0_FLAG : 0)    \
@@ -831,6 +825,7 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     will be collected. Remember K in C<self->gen_to_collect>.
     */
     self->gen_to_collect = gen = gc_gms_select_generation_to_collect(interp);
+    Parrot_gc_telemetry_cycle_begin(interp, gen);
 
     /*
     3. Move all objects from collections younger K from dirty_list
@@ -877,6 +872,8 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     gc_gms_print_stats(interp, "After work_list");
     gc_gms_check_sanity(interp);
 #endif
+    Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_MARK);
+    Parrot_gc_telemetry_sweep_samples(interp, gen);
 
     /*
     7. Sweep generations starting from K:
@@ -888,6 +885,7 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 #ifdef MEMORY_DEBUG
     gc_gms_check_sanity(interp);
 #endif
+    Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_SWEEP);
 
     /* Update some stats */
     interp->gc_sys->stats.header_allocs_since_last_collect  = 0;
@@ -899,8 +897,10 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     self->num_early_gc_PMCs                      = 0;
 
     /* Don't compact after nursery collection */
-    if (gen)
+    if (gen) {
         gc_gms_compact_memory_pool(interp);
+        Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_COMPACT);
+    }
 
 #ifdef MEMORY_DEBUG
     gc_gms_check_sanity(interp);
@@ -911,6 +911,7 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         Parrot_pa_destroy(interp, self->work_list);
     self->work_list = NULL;
 
+    Parrot_gc_telemetry_cycle_end(interp);
     gc_gms_validate_objects(interp);
 
 DONE:
@@ -1132,7 +1133,9 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
     for (i = self->gen_to_collect; i >= 0; i--) {
         /* Don't move to generation beyond last */
-        const int move_to_old = i != GC_MAX_GENERATIONS;
+        const int move_to_old = i != GC_MAX_GENERATIONS - 1;
+        size_t    survivors   = 0;
+        size_t    promoted    = 0;
 
         POINTER_ARRAY_ITER(self->objects[i],
             pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
@@ -1144,8 +1147,10 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
             /* Paint live objects white */
             if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
                 PObj_live_CLEAR(pmc);
+                ++survivors;
 
                 if (move_to_old) {
+                    promoted += sizeof (PMC) + pmc->vtable->attr_size;
                     SET_GEN_FLAGS(pmc, i + 1);
 
                     Parrot_pa_remove(interp, self->objects[i], item->ptr);
@@ -1192,7 +1197,9 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
             /* Paint live objects white */
             if (PObj_live_TEST(str) || PObj_constant_TEST(str)) {
                 PObj_live_CLEAR(str);
+                ++survivors;
                 if (move_to_old) {
+                    promoted += sizeof (STRING) + Buffer_buflen(str);
                     Parrot_pa_remove(interp, self->strings[i], item->ptr);
                     item->ptr = Parrot_pa_insert(self->strings[i + 1], item);
                     SET_GEN_FLAGS(str, i + 1);
@@ -1211,6 +1218,8 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
                 Parrot_gc_pool_free(interp, self->string_allocator, ptr);
             });
+
+        Parrot_gc_telemetry_survivors(interp, i, survivors, promoted);
     }
 
 }
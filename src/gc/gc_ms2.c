@@ -1138,7 +1138,10 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         goto DONE;
 
     ++self->gc_mark_block_level;
+    Parrot_gc_telemetry_cycle_begin(interp, 0);
     gc_ms2_mark_live_objects(interp, self, flags);
+    Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_MARK);
+    Parrot_gc_telemetry_sweep_samples(interp, 0);
 
     /* At this point of time new_objects contains only live PMCs */
     /* objects contains "dead" or "constant" PMCs */
@@ -1164,10 +1167,12 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         self->objects = self->new_objects;
         Parrot_pa_destroy(interp, tmp);
     } while (0);
+    Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_SWEEP);
 
     /* We swept all dead objects */
     gc_ms2_print_stats(interp, "Compact memory pool");
     gc_ms2_compact_memory_pool(interp);
+    Parrot_gc_telemetry_phase_end(interp, PARROT_GC_PHASE_COMPACT);
 
     stats = &gc_sys->stats;
     stats->mem_used_last_collect = stats->memory_used;
@@ -1183,6 +1188,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     self->gc_threshold = stats->mem_used_last_collect + threshold;
 
+    Parrot_gc_telemetry_cycle_end(interp);
+
     self->gc_mark_block_level--;
     self->num_early_gc_PMCs = 0;
 DONE:
@@ -1233,13 +1240,16 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_ms2_sweep_pmc_pool)
     struct GC_Subsystem * const gc_sys = interp->gc_sys;
+    size_t                      survivors = 0;
 
     POINTER_ARRAY_ITER(list,
         PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
 
         /* Paint live objects white */
-        if (PObj_live_TEST(pmc))
+        if (PObj_live_TEST(pmc)) {
             PObj_live_CLEAR(pmc);
+            ++survivors;
+        }
 
         else if (!PObj_constant_TEST(pmc)) {
             GC_DEBUG_DETAIL_FLAGS("GC destroy pmc ", pmc);
@@ -1260,6 +1270,8 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
 
             Parrot_gc_pool_free(interp, pool, ptr);
         });
+
+    Parrot_gc_telemetry_survivors(interp, 0, survivors, 0);
 }
 
 
@@ -1312,6 +1324,7 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     GC_Statistics  stats = interp->gc_sys->stats;
+    size_t         survivors = 0;
 
     gc_ms2_print_stats(interp, "Sweep string pool");
     POINTER_ARRAY_ITER(list,
@@ -1320,8 +1333,10 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
         PARROT_ASSERT(!PObj_on_free_list_TEST(obj));
 
         /* Paint live objects white */
-        if (PObj_live_TEST(obj))
+        if (PObj_live_TEST(obj)) {
             PObj_live_CLEAR(obj);
+            ++survivors;
+        }
 
         else if (!PObj_constant_TEST(obj)) {
             GC_DEBUG_DETAIL_STR("GC remove str ", obj);
@@ -1335,6 +1350,8 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 
             Parrot_gc_pool_free(interp, pool, ptr);
         });
+
+    Parrot_gc_telemetry_survivors(interp, 0, survivors, 0);
 }
 
 
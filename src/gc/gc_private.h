@@ -160,6 +160,12 @@ typedef struct GC_MS_PObj_Wrapper {
     struct GC_MS_PObj_Wrapper * next_ptr;
 } GC_MS_PObj_Wrapper;
 
+/* Get generation from PObj->flags. Always 0 unless the GC is generational */
+#define POBJ2GEN(pobj)                                                  \
+        ((size_t)(((pobj)->flags & PObj_GC_generation_0_FLAG) ? 1 : 0)  \
+         + (((pobj)->flags & PObj_GC_generation_1_FLAG) ? 2 : 0)        \
+         + (((pobj)->flags & PObj_GC_generation_2_FLAG) ? 4 : 0))
+
 /* how often to skip a full GC when this pool has nothing free */
 typedef enum _gc_skip_type_enum {
     GC_NO_SKIP = 0,
@@ -202,6 +208,38 @@ typedef struct GC_Statistics {
 
 } GC_Statistics;
 
+/* Number of collections kept by the telemetry */
+#define GC_EVENT_RING_SIZE      256
+
+/* Most sampled allocations followed at the same time */
+#define GC_MAX_ALLOC_SAMPLES    4096
+
+/* An allocation picked by the sampler, kept until the object dies */
+typedef struct GC_Alloc_Sample {
+    PMC     *pmc;       /* the sampled object, not marked by the telemetry */
+    PMC     *sub;       /* Sub running when it was allocated */
+    INTVAL   pc;        /* op offset of the last call made by that Sub, or -1 */
+    UINTVAL  survived;  /* collections the object lived through */
+} GC_Alloc_Sample;
+
+/** GC event stream, phase timings and allocation sites **/
+typedef struct GC_Telemetry {
+    Parrot_GC_event  events[GC_EVENT_RING_SIZE];
+    UINTVAL          cycles;         /* completed collections */
+
+    /* the collection in progress and when its current phase started */
+    Parrot_GC_event  current;
+    UHUGEINTVAL      phase_start;
+    FLOATVAL         tick;           /* seconds per high resolution tick */
+
+    UINTVAL          histogram[PARROT_GC_PHASES][PARROT_GC_HISTOGRAM_BUCKETS];
+
+    /* one in sample_rate PMC allocations is sampled, 0 disables sampling */
+    UINTVAL          sample_rate;
+    GC_Alloc_Sample *samples;
+    UINTVAL          num_samples;
+} GC_Telemetry;
+
 /* Callback for live string. Use Parrot_Buffer for now... */
 typedef void (*string_iterator_callback)(PARROT_INTERP, Parrot_Buffer *str, void *data);
 
@@ -288,6 +326,12 @@ typedef struct GC_Subsystem {
     /* Statistic for GC */
     struct GC_Statistics stats;
 
+    /* Event stream and allocation sampling, see src/gc/telemetry.c */
+    struct GC_Telemetry *telemetry;
+
+    /* PMC allocations until the next sample, 0 when sampling is off */
+    UINTVAL alloc_sample_countdown;
+
     /* Holds system-specific data structures */
     void * gc_private;
 } GC_Subsystem;
@@ -771,6 +815,92 @@ int pobj2gen(ARGIN(PObj *pmc))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/gc_gms.c */
 
+/* HEADERIZER BEGIN: src/gc/telemetry.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_telemetry_cycle_begin(PARROT_INTERP, INTVAL generation)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_cycle_end(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_destroy(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const Parrot_GC_event * Parrot_gc_telemetry_event(PARROT_INTERP,
+    UINTVAL cycle)
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_gc_telemetry_events(PARROT_INTERP, UINTVAL since)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_mark(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_phase_end(PARROT_INTERP, Parrot_gc_phase phase)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_sample(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_gc_telemetry_sample_rate(PARROT_INTERP, UINTVAL rate)
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_gc_telemetry_sites(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_survivors(PARROT_INTERP,
+    size_t generation,
+    size_t count,
+    size_t promoted)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_telemetry_sweep_samples(PARROT_INTERP, size_t generation)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_gc_telemetry_cycle_begin \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_cycle_end __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_event __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_events __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_mark __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_phase_end __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_gc_telemetry_sample_rate \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_survivors __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_telemetry_sweep_samples \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/telemetry.c */
+
 /* HEADERIZER BEGIN: src/gc/string_gc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
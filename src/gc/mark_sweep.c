@@ -255,6 +255,9 @@ mark_interp(PARROT_INTERP)
     /* Walk the iodata */
     Parrot_io_mark(interp, interp->piodata);
 
+    /* Mark the Subs of sampled allocation sites */
+    Parrot_gc_telemetry_mark(interp);
+
     if (!PMC_IS_NULL(interp->final_exception))
         Parrot_gc_mark_PMC_alive(interp, interp->final_exception);
 
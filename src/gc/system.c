@@ -26,6 +26,7 @@ TT #273: This file needs to be cleaned up significantly.
 */
 
 #include "parrot/parrot.h"
+#include "parrot/fiber.h"
 #include "gc_private.h"
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
@@ -57,6 +58,11 @@ static size_t get_min_pmc_address(PARROT_INTERP,
     ARGIN_NULLOK(const Memory_Pools *mem_pools))
         __attribute__nonnull__(1);
 
+static void trace_fiber_stacks(PARROT_INTERP,
+    ARGIN_NULLOK(const Memory_Pools *mem_pools),
+    size_t stack_top)
+        __attribute__nonnull__(1);
+
 PARROT_NO_ADDRESS_SAFETY_ANALYSIS
 static void trace_mem_block(PARROT_INTERP,
     ARGIN_NULLOK(const Memory_Pools *mem_pools),
@@ -79,6 +85,8 @@ static void trace_system_stack(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_get_min_pmc_address __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_trace_fiber_stacks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_trace_mem_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_trace_system_stack __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -236,8 +244,61 @@ trace_system_stack(PARROT_INTERP, ARGIN_NULLOK(const Memory_Pools *mem_pools))
     const size_t lo_var_ptr = (size_t)interp->lo_var_ptr;
     PARROT_ASSERT(lo_var_ptr);
 
-    trace_mem_block(interp, mem_pools, (size_t)lo_var_ptr,
-            (size_t)&lo_var_ptr);
+    if (interp->fibers)
+        trace_fiber_stacks(interp, mem_pools, (size_t)&lo_var_ptr);
+    else
+        trace_mem_block(interp, mem_pools, (size_t)lo_var_ptr,
+                (size_t)&lo_var_ptr);
+}
+
+/*
+
+=item C<static void trace_fiber_stacks(PARROT_INTERP, const Memory_Pools
+*mem_pools, size_t stack_top)>
+
+Traces the stacks of an interpreter running tasks on fibers, see
+F<src/fiber.c>. C<stack_top> is the top of the stack we run on, which is
+either the stack of the thread or that of the current fiber. Of all the
+other stacks, only the part in use when they were switched out is traced,
+along with the registers saved then.
+
+=cut
+
+*/
+
+static void
+trace_fiber_stacks(PARROT_INTERP, ARGIN_NULLOK(const Memory_Pools *mem_pools),
+        size_t stack_top)
+{
+    ASSERT_ARGS(trace_fiber_stacks)
+    const Parrot_fiber_set * const set        = interp->fibers;
+    const size_t                   lo_var_ptr = (size_t)interp->lo_var_ptr;
+    const Parrot_fiber            *current    = set->current;
+    const Parrot_fiber            *fiber;
+
+    if (current
+    &&  stack_top >= (size_t)current->stack
+    &&  stack_top <  (size_t)current->stack + current->stack_size) {
+        trace_mem_block(interp, mem_pools, stack_top,
+                (size_t)current->stack + current->stack_size);
+        trace_mem_block(interp, mem_pools, lo_var_ptr,
+                (size_t)set->thread.stack_ptr);
+    }
+    else {
+        /* On the stack of the thread, maybe after a longjmp out of a fiber */
+        trace_mem_block(interp, mem_pools, lo_var_ptr, stack_top);
+        current = NULL;
+    }
+
+    trace_mem_block(interp, mem_pools, (size_t)&set->thread,
+            (size_t)(&set->thread + 1));
+
+    for (fiber = set->live; fiber; fiber = fiber->next) {
+        trace_mem_block(interp, mem_pools, (size_t)fiber, (size_t)(fiber + 1));
+        if (fiber != current && fiber->stack_ptr)
+            trace_mem_block(interp, mem_pools, (size_t)fiber->stack_ptr,
+                    (size_t)fiber->stack + fiber->stack_size);
+    }
 }
 
 /*
@@ -0,0 +1,505 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/telemetry.c - GC event stream and allocation site sampling
+
+=head1 DESCRIPTION
+
+The GC cores report every collection here: when it started and ended, which
+generation was collected, how long the mark, sweep and compact phases took,
+how many headers survived in each generation and how many bytes were promoted
+into an older one. The last C<GC_EVENT_RING_SIZE> collections are kept as
+C<Parrot_GC_event> records and every phase duration is also counted in a
+histogram with power of two buckets.
+
+Allocation site sampling is off by default. When enabled, one in every N PMC
+allocations is remembered together with the Sub that was running and the
+offset of the last call that Sub made (the fast runcores don't record the op
+being executed). Samples are dropped as soon as their object is collected, so
+what is left are the sites whose objects stay alive and move into the old
+generations.
+
+Only the gms and ms2 cores feed the telemetry.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "gc_private.h"
+#include "telemetry.str"
+#include "pmc/pmc_sub.h"
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/* Surviving samples with the same Sub and pc, see Parrot_gc_telemetry_sites */
+typedef struct alloc_site {
+    PMC     *sub;
+    INTVAL   pc;
+    UINTVAL  objects;
+    UINTVAL  survived;
+    UINTVAL  generations[PARROT_GC_EVENT_GENERATIONS];
+} alloc_site;
+
+/*
+
+=item C<void Parrot_gc_telemetry_init(PARROT_INTERP)>
+
+Allocates the telemetry of the interpreter's GC.
+
+=item C<void Parrot_gc_telemetry_destroy(PARROT_INTERP)>
+
+Frees the telemetry and any allocation samples.
+
+=cut
+
+*/
+
+void
+Parrot_gc_telemetry_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_init)
+    GC_Telemetry * const tel = mem_internal_allocate_zeroed_typed(GC_Telemetry);
+
+    tel->tick                              = Parrot_hires_get_tick_duration() * 1e-9;
+    interp->gc_sys->telemetry              = tel;
+    interp->gc_sys->alloc_sample_countdown = 0;
+}
+
+void
+Parrot_gc_telemetry_destroy(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_destroy)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    if (tel) {
+        if (tel->samples)
+            mem_internal_free(tel->samples);
+        mem_internal_free(tel);
+        interp->gc_sys->telemetry = NULL;
+    }
+}
+
+/*
+
+=item C<void Parrot_gc_telemetry_cycle_begin(PARROT_INTERP, INTVAL generation)>
+
+Starts recording a collection of all generations up to C<generation>. The
+mark phase starts now.
+
+=item C<void Parrot_gc_telemetry_phase_end(PARROT_INTERP, Parrot_gc_phase
+phase)>
+
+Ends C<phase> of the current collection and starts timing the next one.
+
+=item C<void Parrot_gc_telemetry_survivors(PARROT_INTERP, size_t generation,
+size_t count, size_t promoted)>
+
+Records that C<count> headers of C<generation> survived the current
+collection, C<promoted> bytes of which moved into an older generation.
+
+=item C<void Parrot_gc_telemetry_cycle_end(PARROT_INTERP)>
+
+Ends the current collection and adds it to the event stream.
+
+=cut
+
+*/
+
+void
+Parrot_gc_telemetry_cycle_begin(PARROT_INTERP, INTVAL generation)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_cycle_begin)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    memset(&tel->current, 0, sizeof (Parrot_GC_event));
+    tel->phase_start        = Parrot_hires_get_time();
+    tel->current.cycle      = tel->cycles;
+    tel->current.generation = generation;
+    tel->current.start      = tel->phase_start * tel->tick;
+}
+
+void
+Parrot_gc_telemetry_phase_end(PARROT_INTERP, Parrot_gc_phase phase)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_phase_end)
+    GC_Telemetry * const tel  = interp->gc_sys->telemetry;
+    const UHUGEINTVAL    now  = Parrot_hires_get_time();
+    const FLOATVAL       took = (now - tel->phase_start) * tel->tick;
+    FLOATVAL             usec = took * 1e6;
+    int                  bucket;
+
+    tel->current.phase[phase] += took;
+    tel->phase_start           = now;
+
+    for (bucket = 0; usec >= 1.0 && bucket < PARROT_GC_HISTOGRAM_BUCKETS - 1; ++bucket)
+        usec /= 2;
+    ++tel->histogram[phase][bucket];
+}
+
+void
+Parrot_gc_telemetry_survivors(PARROT_INTERP, size_t generation, size_t count,
+        size_t promoted)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_survivors)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    PARROT_ASSERT(generation < PARROT_GC_EVENT_GENERATIONS);
+    tel->current.survivors[generation] += count;
+    tel->current.promoted              += promoted;
+}
+
+void
+Parrot_gc_telemetry_cycle_end(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_cycle_end)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    tel->current.end         = Parrot_hires_get_time() * tel->tick;
+    tel->current.memory_used = interp->gc_sys->stats.memory_used;
+
+    tel->events[tel->cycles % GC_EVENT_RING_SIZE] = tel->current;
+    ++tel->cycles;
+}
+
+/*
+
+=item C<const Parrot_GC_event * Parrot_gc_telemetry_event(PARROT_INTERP, UINTVAL
+cycle)>
+
+Returns the record of collection number C<cycle>, or NULL if it hasn't happened
+yet or was already dropped from the event ring.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+const Parrot_GC_event *
+Parrot_gc_telemetry_event(PARROT_INTERP, UINTVAL cycle)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_event)
+    const GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    if (cycle >= tel->cycles || tel->cycles - cycle > GC_EVENT_RING_SIZE)
+        return NULL;
+
+    return &tel->events[cycle % GC_EVENT_RING_SIZE];
+}
+
+/*
+
+=item C<void Parrot_gc_telemetry_sample_rate(PARROT_INTERP, UINTVAL rate)>
+
+Samples one in every C<rate> PMC allocations from now on. A rate of 0 stops
+sampling and forgets all samples.
+
+=item C<void Parrot_gc_telemetry_sample(PARROT_INTERP, PMC *pmc)>
+
+Called by C<Parrot_gc_new_pmc_header> when the sampling countdown runs out.
+Remembers where C<pmc> was allocated, unless it is a constant or enough
+samples are already followed.
+
+=cut
+
+*/
+
+void
+Parrot_gc_telemetry_sample_rate(PARROT_INTERP, UINTVAL rate)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_sample_rate)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+
+    if (rate && !tel->samples)
+        tel->samples = mem_internal_allocate_n_zeroed_typed(GC_MAX_ALLOC_SAMPLES,
+                            GC_Alloc_Sample);
+    else if (!rate && tel->samples) {
+        mem_internal_free(tel->samples);
+        tel->samples     = NULL;
+        tel->num_samples = 0;
+    }
+
+    tel->sample_rate                       = rate;
+    interp->gc_sys->alloc_sample_countdown = rate;
+}
+
+void
+Parrot_gc_telemetry_sample(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_sample)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+    PMC          * const ctx = CURRENT_CONTEXT(interp);
+    GC_Alloc_Sample     *sample;
+
+    /* Constants are never collected, try the next allocation instead */
+    if (PObj_constant_TEST(pmc) || PMC_IS_NULL(ctx)) {
+        interp->gc_sys->alloc_sample_countdown = 1;
+        return;
+    }
+
+    interp->gc_sys->alloc_sample_countdown = tel->sample_rate;
+
+    if (tel->num_samples == GC_MAX_ALLOC_SAMPLES)
+        return;
+
+    sample           = &tel->samples[tel->num_samples++];
+    sample->pmc      = pmc;
+    sample->sub      = Parrot_pcc_get_sub(interp, ctx);
+    sample->pc       = -1;
+    sample->survived = 0;
+
+    if (!PMC_IS_NULL(sample->sub)
+    &&  VTABLE_isa(interp, sample->sub, CONST_STRING(interp, "Sub"))) {
+        opcode_t * const       pc = Parrot_pcc_get_pc(interp, ctx);
+        Parrot_Sub_attributes *subattrs;
+
+        PMC_get_sub(interp, sample->sub, subattrs);
+        if (pc && subattrs->seg
+        &&  pc >= subattrs->seg->base.data
+        &&  pc <  subattrs->seg->base.data + subattrs->seg->base.size)
+            sample->pc = pc - subattrs->seg->base.data;
+    }
+}
+
+/*
+
+=item C<void Parrot_gc_telemetry_sweep_samples(PARROT_INTERP, size_t
+generation)>
+
+Called after marking and before sweeping. Samples whose object is in a
+collected generation (up to C<generation>) and wasn't marked are dropped,
+the others count one more collection survived.
+
+=item C<void Parrot_gc_telemetry_mark(PARROT_INTERP)>
+
+Marks the Subs of the allocation samples. The sampled objects themselves are
+not kept alive.
+
+=cut
+
+*/
+
+void
+Parrot_gc_telemetry_sweep_samples(PARROT_INTERP, size_t generation)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_sweep_samples)
+    GC_Telemetry * const tel = interp->gc_sys->telemetry;
+    UINTVAL              i, kept = 0;
+
+    for (i = 0; i < tel->num_samples; ++i) {
+        GC_Alloc_Sample * const sample = &tel->samples[i];
+        PMC             * const pmc    = sample->pmc;
+
+        if (POBJ2GEN(pmc) <= generation) {
+            if (!PObj_live_TEST(pmc) && !PObj_constant_TEST(pmc))
+                continue;
+            ++sample->survived;
+        }
+
+        tel->samples[kept++] = *sample;
+    }
+
+    tel->num_samples = kept;
+}
+
+void
+Parrot_gc_telemetry_mark(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_mark)
+    const GC_Telemetry * const tel = interp->gc_sys->telemetry;
+    UINTVAL                    i;
+
+    if (!tel)
+        return;
+
+    for (i = 0; i < tel->num_samples; ++i)
+        Parrot_gc_mark_PMC_alive(interp, tel->samples[i].sub);
+}
+
+/*
+
+=item C<PMC * Parrot_gc_telemetry_events(PARROT_INTERP, UINTVAL since)>
+
+Returns an array with a Hash for each recorded collection numbered C<since> or
+later. See C<Parrot_gc_events> for the keys.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_gc_telemetry_events(PARROT_INTERP, UINTVAL since)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_events)
+    const GC_Telemetry * const tel    = interp->gc_sys->telemetry;
+    PMC                * const result = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    STRING             * const s_survivors = CONST_STRING(interp, "survivors");
+    UINTVAL                    cycle;
+
+    /* No collection may be added to the ring while we copy it */
+    Parrot_block_GC_mark(interp);
+
+    if (tel->cycles > GC_EVENT_RING_SIZE && since < tel->cycles - GC_EVENT_RING_SIZE)
+        since = tel->cycles - GC_EVENT_RING_SIZE;
+
+    for (cycle = since; cycle < tel->cycles; ++cycle) {
+        const Parrot_GC_event * const ev = &tel->events[cycle % GC_EVENT_RING_SIZE];
+        PMC * const event     = Parrot_pmc_new(interp, enum_class_Hash);
+        PMC * const survivors = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+        int         gen;
+
+        VTABLE_set_integer_keyed_str(interp, event, CONST_STRING(interp, "cycle"),
+                ev->cycle);
+        VTABLE_set_integer_keyed_str(interp, event, CONST_STRING(interp, "generation"),
+                ev->generation);
+        VTABLE_set_number_keyed_str(interp, event, CONST_STRING(interp, "start"),
+                ev->start);
+        VTABLE_set_number_keyed_str(interp, event, CONST_STRING(interp, "end"),
+                ev->end);
+        VTABLE_set_number_keyed_str(interp, event, CONST_STRING(interp, "mark"),
+                ev->phase[PARROT_GC_PHASE_MARK]);
+        VTABLE_set_number_keyed_str(interp, event, CONST_STRING(interp, "sweep"),
+                ev->phase[PARROT_GC_PHASE_SWEEP]);
+        VTABLE_set_number_keyed_str(interp, event, CONST_STRING(interp, "compact"),
+                ev->phase[PARROT_GC_PHASE_COMPACT]);
+        VTABLE_set_integer_keyed_str(interp, event, CONST_STRING(interp, "promoted"),
+                ev->promoted);
+        VTABLE_set_integer_keyed_str(interp, event, CONST_STRING(interp, "memory_used"),
+                ev->memory_used);
+
+        for (gen = 0; gen <= ev->generation && gen < PARROT_GC_EVENT_GENERATIONS; ++gen)
+            VTABLE_push_integer(interp, survivors, ev->survivors[gen]);
+        VTABLE_set_pmc_keyed_str(interp, event, s_survivors, survivors);
+
+        VTABLE_push_pmc(interp, result, event);
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+
+/*
+
+=item C<PMC * Parrot_gc_telemetry_sites(PARROT_INTERP)>
+
+Groups the samples that survived at least one collection by Sub and pc and
+returns an array with a Hash for each site, the site with most live objects
+first. See C<Parrot_gc_allocation_sites> for the keys.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_gc_telemetry_sites(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_telemetry_sites)
+    const GC_Telemetry * const tel    = interp->gc_sys->telemetry;
+    PMC                * const result = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    STRING             * const s_sub  = CONST_STRING(interp, "sub");
+    STRING             * const s_gens = CONST_STRING(interp, "generations");
+    alloc_site               *sites;
+    UINTVAL                   i, j, num_sites = 0;
+
+    if (!tel->num_samples)
+        return result;
+
+    /* No collection may drop samples while we look at them */
+    Parrot_block_GC_mark(interp);
+
+    sites = mem_internal_allocate_n_zeroed_typed(tel->num_samples, alloc_site);
+
+    for (i = 0; i < tel->num_samples; ++i) {
+        const GC_Alloc_Sample * const sample = &tel->samples[i];
+        alloc_site                   *site;
+
+        if (!sample->survived)
+            continue;
+
+        for (j = 0; j < num_sites; ++j)
+            if (sites[j].sub == sample->sub && sites[j].pc == sample->pc)
+                break;
+
+        site = &sites[j];
+        if (j == num_sites) {
+            site->sub = sample->sub;
+            site->pc  = sample->pc;
+            ++num_sites;
+        }
+
+        ++site->objects;
+        site->survived += sample->survived;
+        ++site->generations[POBJ2GEN(sample->pmc)];
+    }
+
+    /* most live objects first; there are rarely more than a few sites */
+    for (i = 1; i < num_sites; ++i) {
+        const alloc_site tmp = sites[i];
+
+        for (j = i; j > 0 && sites[j - 1].objects < tmp.objects; --j)
+            sites[j] = sites[j - 1];
+        sites[j] = tmp;
+    }
+
+    for (i = 0; i < num_sites; ++i) {
+        PMC * const site = Parrot_pmc_new(interp, enum_class_Hash);
+        PMC * const gens = Parrot_pmc_new(interp, enum_class_ResizableIntegerArray);
+        int         gen  = PARROT_GC_EVENT_GENERATIONS;
+
+        VTABLE_set_pmc_keyed_str(interp, site, s_sub, sites[i].sub);
+        VTABLE_set_integer_keyed_str(interp, site, CONST_STRING(interp, "pc"),
+                sites[i].pc);
+        VTABLE_set_integer_keyed_str(interp, site, CONST_STRING(interp, "objects"),
+                sites[i].objects);
+        VTABLE_set_integer_keyed_str(interp, site, CONST_STRING(interp, "survived"),
+                sites[i].survived);
+
+        /* only up to the oldest generation holding any of them */
+        while (gen > 1 && !sites[i].generations[gen - 1])
+            --gen;
+        for (j = 0; j < (UINTVAL)gen; ++j)
+            VTABLE_push_integer(interp, gens, sites[i].generations[j]);
+        VTABLE_set_pmc_keyed_str(interp, site, s_gens, gens);
+
+        VTABLE_push_pmc(interp, result, site);
+    }
+
+    mem_internal_free(sites);
+    Parrot_unblock_GC_mark(interp);
+
+    return result;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/api.c>, F<src/gc/gc_gms.c>, F<src/gc/gc_ms2.c>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -27,6 +27,8 @@ Functions related to managing the Parrot interpreter
 #include "parrot/has_header.h"
 #include "imcc/embed.h"
 #include "parrot/thread.h"
+#include "parrot/alarm.h"
+#include "parrot/fiber.h"
 
 #ifdef PARROT_HAS_HEADER_SYSUTSNAME
 #  include <sys/utsname.h>
@@ -44,9 +46,14 @@ static int Parrot_interp_is_env_var_set(PARROT_INTERP, ARGIN(STRING* var))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void write_run_stats(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_Parrot_interp_is_env_var_set __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(var))
+#define ASSERT_ARGS_write_run_stats __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -544,6 +551,58 @@ Parrot_interp_destroy(PARROT_INTERP)
 
 /*
 
+=item C<static void write_run_stats(PARROT_INTERP)>
+
+If the C<PARROT_STATS_FILE> environment variable names a file, writes the
+runcore and GC used by this run, the GC counters and the peak resident set
+size to it as a single JSON object, for benchmark drivers like
+F<tools/dev/bench.pl>. Called once the program is done.
+
+=cut
+
+*/
+
+static void
+write_run_stats(PARROT_INTERP)
+{
+    ASSERT_ARGS(write_run_stats)
+
+    STRING * const filename = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_STATS_FILE"));
+    char          *cstr;
+    FILE          *out;
+
+    if (STRING_IS_NULL(filename) || STRING_IS_EMPTY(filename))
+        return;
+
+    /* the IO subsystem is already gone, use stdio */
+    cstr = Parrot_str_to_cstring(interp, filename);
+    out  = fopen(cstr, "w");
+    Parrot_str_free_cstring(cstr);
+    if (!out)
+        return;
+
+    cstr = Parrot_str_to_cstring(interp, interp->run_core->name);
+    fprintf(out, "{\"runcore\": \"%s\", ", cstr);
+    Parrot_str_free_cstring(cstr);
+
+    cstr = Parrot_str_to_cstring(interp, Parrot_gc_sys_name(interp));
+    fprintf(out, "\"gc\": \"%s\", ", cstr);
+    Parrot_str_free_cstring(cstr);
+
+    fprintf(out, "\"gc_mark_runs\": %lu, \"gc_lazy_mark_runs\": %lu, "
+            "\"gc_collect_runs\": %lu, \"total_mem_alloc\": %lu, "
+            "\"max_rss\": %lu}\n",
+            (unsigned long)Parrot_gc_count_mark_runs(interp),
+            (unsigned long)Parrot_gc_count_lazy_mark_runs(interp),
+            (unsigned long)Parrot_gc_count_collect_runs(interp),
+            (unsigned long)Parrot_gc_total_memory_allocated(interp),
+            (unsigned long)Parrot_sysmem_max_rss(interp));
+
+    fclose(out);
+}
+
+/*
+
 =item C<void Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, void
 *arg)>
 
@@ -567,6 +626,9 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
        Parrot_interp_clear_emergency_interpreter();
     }
 
+    /* the alarm thread must not wake us up any more */
+    Parrot_alarm_clear(interp);
+
     /* if something needs destruction (e.g. closing PIOs)
      * we must destroy it now:
      *
@@ -596,8 +658,10 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
     Parrot_io_finish(interp);
 
     /* deinit runcores and dynamic op_libs */
-    if (!interp->parent_interpreter)
+    if (!interp->parent_interpreter) {
+        write_run_stats(interp);
         Parrot_runcore_destroy(interp);
+    }
 
     /*
      * now all objects that need timely destruction should be finalized
@@ -623,6 +687,16 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
 
     Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
 
+    /* register frames kept by dead contexts */
+    Parrot_pcc_destroy_frame_pool(interp);
+
+    /* global lookup caches */
+    Parrot_ns_destroy_caches(interp, NULL);
+
+    /* stacks of the tasks, after the tasks gave back the jump points of
+       their suspended fibers */
+    Parrot_fiber_finish(interp);
+
     destroy_runloop_jump_points(interp);
 
     /* cache structure */
@@ -1046,14 +1120,17 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
     switch (what) {
       case CURRENT_CTX:
         result = CURRENT_CONTEXT(interp);
+        Parrot_pcc_capture_context(interp, result);
         break;
       case CURRENT_SUB:
         result = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_CONT:
+        Parrot_pcc_capture_context(interp, CURRENT_CONTEXT(interp));
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_LEXPAD:
+        Parrot_pcc_capture_context(interp, CURRENT_CONTEXT(interp));
         result = Parrot_pcc_get_lex_pad(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_TASK:
@@ -1450,6 +1527,9 @@ Parrot_interp_set_run_core(PARROT_INTERP, Parrot_Run_core_t core)
       case PARROT_SUBPROF_OPS_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "subprof_ops"));
         break;
+      case PARROT_SAMPLING_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "sampling"));
+        break;
       default:
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
             "Invalid runcore %d requested", (int)core);
@@ -0,0 +1,269 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/mailbox.c - The message queue of a Task
+
+=head1 DESCRIPTION
+
+Every Task has a mailbox holding the messages sent to it and not received
+yet. Any number of tasks, in any number of threads, may send to a Task, but
+only the Task itself receives from it.
+
+Senders push a node onto the C<inbox>, a stack linked through the nodes,
+with a single compare-and-swap and without taking any lock. The receiver
+takes the whole stack at once by swapping in C<NULL>, reverses it into the
+C<batch> array and then receives message after message from the array, again
+without a lock. Neither side ever removes a single node from the stack, so
+the stack doesn't suffer from the ABA problem.
+
+A sender learns whether it made the inbox non-empty. Only that sender has
+to check whether the receiver is blocked and wake it up. To not miss a
+wakeup, the receiver decides to block while holding C<lock>, after looking
+at the inbox once more, and the waking sender looks at the receiver while
+holding it as well.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/mailbox.h"
+
+/* HEADERIZER HFILE: include/parrot/mailbox.h */
+
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<Parrot_mailbox * Parrot_mailbox_new(void)>
+
+Creates an empty mailbox. It's allocated outside of the memory of any
+interpreter, since senders from other threads use it too.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_mailbox *
+Parrot_mailbox_new(void)
+{
+    ASSERT_ARGS(Parrot_mailbox_new)
+    Parrot_mailbox * const mailbox = mem_internal_allocate_zeroed_typed(Parrot_mailbox);
+
+    PARROT_ATOMIC_PTR_INIT(mailbox->inbox);
+    PARROT_ATOMIC_PTR_SET(mailbox->inbox, NULL);
+    MUTEX_INIT(mailbox->lock);
+    return mailbox;
+}
+
+/*
+
+=item C<void Parrot_mailbox_destroy(Parrot_mailbox *mailbox)>
+
+Frees the mailbox. Messages that were never received are left to the GC.
+
+=cut
+
+*/
+
+void
+Parrot_mailbox_destroy(ARGFREE(Parrot_mailbox *mailbox))
+{
+    ASSERT_ARGS(Parrot_mailbox_destroy)
+    Parrot_mailbox_node *node;
+    void                *head;
+
+    PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+    node = (Parrot_mailbox_node *)head;
+    while (node) {
+        Parrot_mailbox_node * const next = node->next;
+        mem_internal_free(node);
+        node = next;
+    }
+
+    if (mailbox->batch)
+        mem_internal_free(mailbox->batch);
+
+    PARROT_ATOMIC_PTR_DESTROY(mailbox->inbox);
+    MUTEX_DESTROY(mailbox->lock);
+    mem_internal_free(mailbox);
+}
+
+/*
+
+=item C<int Parrot_mailbox_push(Parrot_mailbox *mailbox, PMC *message)>
+
+Adds C<message> to the mailbox. Returns 1 if the inbox was empty before,
+in which case the caller is responsible for waking up the receiver.
+
+=cut
+
+*/
+
+int
+Parrot_mailbox_push(ARGMOD(Parrot_mailbox *mailbox), ARGIN(PMC *message))
+{
+    ASSERT_ARGS(Parrot_mailbox_push)
+    Parrot_mailbox_node * const node = mem_internal_allocate_typed(Parrot_mailbox_node);
+    int done = 0;
+
+    node->message = message;
+
+    do {
+        void *head;
+        PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+        node->next = (Parrot_mailbox_node *)head;
+        PARROT_ATOMIC_PTR_CAS(done, mailbox->inbox, head, node);
+    } while (!done);
+
+    return node->next == NULL;
+}
+
+/*
+
+=item C<PMC * Parrot_mailbox_shift(Parrot_mailbox *mailbox)>
+
+Takes the oldest message out of the mailbox, or returns C<NULL> if there is
+none. Only the receiver of the mailbox may call this.
+
+Once the current batch is used up, all the messages in the inbox are moved
+into the batch in one go, under C<lock>.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_mailbox_shift(ARGMOD(Parrot_mailbox *mailbox))
+{
+    ASSERT_ARGS(Parrot_mailbox_shift)
+    Parrot_mailbox_node *node;
+    void                *head;
+    UINTVAL              count = 0;
+    int                  done  = 0;
+
+    if (mailbox->batch_read < mailbox->batch_size)
+        return mailbox->batch[mailbox->batch_read++];
+
+    PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+    if (!head)
+        return NULL;
+
+    LOCK(mailbox->lock);
+
+    /* Detach the whole stack. Senders only ever push, so no other thread
+     * takes it from under us. */
+    do {
+        PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+        PARROT_ATOMIC_PTR_CAS(done, mailbox->inbox, head, NULL);
+    } while (!done);
+
+    for (node = (Parrot_mailbox_node *)head; node; node = node->next)
+        ++count;
+
+    if (count > mailbox->batch_alloc) {
+        mem_internal_realloc_n_typed(mailbox->batch, count, PMC *);
+        mailbox->batch_alloc = count;
+    }
+
+    /* The stack has the newest message first, the batch the oldest */
+    mailbox->batch_read = 0;
+    mailbox->batch_size = count;
+    node = (Parrot_mailbox_node *)head;
+    while (node) {
+        Parrot_mailbox_node * const next = node->next;
+        mailbox->batch[--count] = node->message;
+        mem_internal_free(node);
+        node = next;
+    }
+
+    UNLOCK(mailbox->lock);
+
+    return mailbox->batch[mailbox->batch_read++];
+}
+
+/*
+
+=item C<int Parrot_mailbox_is_empty(Parrot_mailbox *mailbox)>
+
+Returns 1 if there is no message in the mailbox. Unless the caller holds
+C<lock> and is the receiver, the answer may be outdated by the time it
+arrives.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+int
+Parrot_mailbox_is_empty(ARGMOD(Parrot_mailbox *mailbox))
+{
+    ASSERT_ARGS(Parrot_mailbox_is_empty)
+    void *head;
+
+    if (mailbox->batch_read < mailbox->batch_size)
+        return 0;
+
+    PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+    return head == NULL;
+}
+
+/*
+
+=item C<void Parrot_mailbox_mark(PARROT_INTERP, Parrot_mailbox *mailbox)>
+
+Marks the messages waiting in the mailbox as live. The lock keeps the
+receiver from freeing the nodes of the inbox while we walk them.
+
+=cut
+
+*/
+
+void
+Parrot_mailbox_mark(PARROT_INTERP, ARGMOD(Parrot_mailbox *mailbox))
+{
+    ASSERT_ARGS(Parrot_mailbox_mark)
+    Parrot_mailbox_node *node;
+    void                *head;
+    UINTVAL              i;
+
+    LOCK(mailbox->lock);
+
+    PARROT_ATOMIC_PTR_GET(head, mailbox->inbox);
+    for (node = (Parrot_mailbox_node *)head; node; node = node->next)
+        Parrot_gc_mark_PMC_alive(interp, node->message);
+
+    for (i = mailbox->batch_read; i < mailbox->batch_size; ++i)
+        Parrot_gc_mark_PMC_alive(interp, mailbox->batch[i]);
+
+    UNLOCK(mailbox->lock);
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/pmc/task.pmc>, F<src/ops/experimental.ops>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
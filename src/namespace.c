@@ -17,11 +17,19 @@ Common routines for storing and finding elements in namespaces
 #include "namespace.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_namespace.h"
 
 /* HEADERIZER HFILE: include/parrot/namespace.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_ns_cache_table * get_cache_table(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *seg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC * get_namespace_pmc(PARROT_INTERP, ARGIN(PMC *sub_pmc))
@@ -68,6 +76,20 @@ static PMC * internal_ns_maybe_create(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_ns_cache_table * new_cache_table(PARROT_INTERP,
+    ARGIN(const PackFile_ByteCode *seg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int ns_path_is_tracked(PARROT_INTERP,
+    ARGIN(PMC *ns),
+    ARGIN_NULLOK(PMC *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void store_sub_in_multi(PARROT_INTERP,
     ARGIN(PMC *sub_pmc),
     ARGIN(PMC *ns))
@@ -75,6 +97,9 @@ static void store_sub_in_multi(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_get_cache_table __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(seg))
 #define ASSERT_ARGS_get_namespace_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -94,6 +119,12 @@ static void store_sub_in_multi(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ns) \
     , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_new_cache_table __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(seg))
+#define ASSERT_ARGS_ns_path_is_tracked __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ns))
 #define ASSERT_ARGS_store_sub_in_multi __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc) \
@@ -269,6 +300,50 @@ internal_ns_maybe_create(PARROT_INTERP, ARGIN(PMC *ns), ARGIN(STRING *key), int
 
 /*
 
+=item C<static int ns_path_is_tracked(PARROT_INTERP, PMC *ns, PMC *key)>
+
+Returns true if C<ns> and all the namespaces on the way along C<key> are
+plain C<NameSpace> PMCs, which are stored in the namespace they have as
+parent. A modification of any of them then changes the stamp of C<ns>.
+C<key> is either PMCNULL or a C<Key>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ns_path_is_tracked(PARROT_INTERP, ARGIN(PMC *ns), ARGIN_NULLOK(PMC *key))
+{
+    ASSERT_ARGS(ns_path_is_tracked)
+
+    if (ns->vtable->base_type != enum_class_NameSpace)
+        return 0;
+
+    if (PMC_IS_NULL(key))
+        return 1;
+
+    if (!PMC_IS_TYPE(key, Key))
+        return 0;
+
+    while (key) {
+        STRING * const part   = VTABLE_get_string(interp, key);
+        PMC    * const sub_ns = VTABLE_get_pmc_keyed_str(interp, ns, part);
+
+        if (PMC_IS_NULL(sub_ns)
+        ||  sub_ns->vtable->base_type != enum_class_NameSpace
+        ||  PARROT_NAMESPACE(sub_ns)->parent != ns)
+            return 0;
+
+        ns  = sub_ns;
+        key = VTABLE_shift_pmc(interp, key);
+    }
+
+    return 1;
+}
+
+/*
+
 =item C<static PMC * get_namespace_pmc(PARROT_INTERP, PMC *sub_pmc)>
 
 Return the namespace PMC associated with the PMC C<sub>. If there is no
@@ -662,6 +737,204 @@ Parrot_ns_find_global_from_op(PARROT_INTERP, ARGIN(PMC *ns),
     }
 }
 
+/*
+
+=item C<PMC * Parrot_ns_find_global_cached(PARROT_INTERP, PMC *ns, PMC *key,
+STRING *globalname, INTVAL slot)>
+
+Like C<Parrot_ns_find_global_from_op>, but looks in the namespace C<key>
+relative to C<ns>, if C<key> isn't PMCNULL. The global found is remembered
+in the lookup cache C<slot> of the current bytecode segment and returned
+from there, until C<ns> is modified. Used by the C<get_*global_ic> ops.
+
+The caches belong to the interpreter, not to the segment: threads share the
+segments, but each of them has its own namespaces.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_ns_find_global_cached(PARROT_INTERP, ARGIN_NULLOK(PMC *ns),
+        ARGIN_NULLOK(PMC *key), ARGIN_NULLOK(STRING *globalname), INTVAL slot)
+{
+    ASSERT_ARGS(Parrot_ns_find_global_cached)
+    Parrot_ns_cache_table * const table = get_cache_table(interp, interp->code);
+    PMC *target, *res;
+
+    if (PMC_IS_NULL(ns))
+        return PMCNULL;
+
+    if (table && (size_t)slot < table->n_entries) {
+        const Parrot_ns_cache_entry * const entry = &table->entries[slot];
+
+        if (entry->ns == ns && entry->key == key && entry->name == globalname
+        &&  ns->vtable->base_type == enum_class_NameSpace
+        &&  entry->stamp == PARROT_NAMESPACE(ns)->stamp)
+            return entry->value;
+    }
+
+    target = PMC_IS_NULL(key) ? ns : Parrot_ns_get_namespace_keyed(interp, ns, key);
+
+    if (PMC_IS_NULL(target))
+        return PMCNULL;
+
+    res = Parrot_ns_find_global_from_op(interp, target, globalname, NULL);
+
+    if (!PMC_IS_NULL(res) && slot >= 0 && ns_path_is_tracked(interp, ns, key)) {
+        Parrot_ns_cache_table * const t = table ? table : new_cache_table(interp, interp->code);
+        Parrot_ns_cache_entry *entry;
+
+        if ((size_t)slot >= t->n_entries) {
+            const size_t n = (size_t)slot + 1 > t->n_entries * 2
+                           ? (size_t)slot + 1 : t->n_entries * 2;
+
+            t->entries   = mem_gc_realloc_n_typed_zeroed(interp, t->entries,
+                                n, t->n_entries, Parrot_ns_cache_entry);
+            t->n_entries = n;
+        }
+
+        /* a thawed namespace didn't get a stamp yet */
+        if (!PARROT_NAMESPACE(ns)->stamp)
+            Parrot_ns_modified(interp, ns);
+
+        entry        = &t->entries[slot];
+        entry->ns    = ns;
+        entry->key   = key;
+        entry->name  = globalname;
+        entry->stamp = PARROT_NAMESPACE(ns)->stamp;
+        entry->value = res;
+    }
+
+    return res;
+}
+
+/*
+
+=item C<static Parrot_ns_cache_table * get_cache_table(PARROT_INTERP, const
+PackFile_ByteCode *seg)>
+
+Returns the global lookup caches of the code segment C<seg> in this
+interpreter, or NULL if it has none yet. The table found is moved to the
+front, where the next lookup from the same segment finds it first.
+
+=item C<static Parrot_ns_cache_table * new_cache_table(PARROT_INTERP, const
+PackFile_ByteCode *seg)>
+
+Adds an empty table of global lookup caches for the code segment C<seg> in
+front of the tables of this interpreter.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Parrot_ns_cache_table *
+get_cache_table(PARROT_INTERP, ARGIN(const PackFile_ByteCode *seg))
+{
+    ASSERT_ARGS(get_cache_table)
+    Parrot_ns_cache_table *table = interp->ns_caches;
+    Parrot_ns_cache_table *prev;
+
+    if (!table || table->seg == seg)
+        return table;
+
+    for (prev = table, table = table->next; table; prev = table, table = table->next) {
+        if (table->seg == seg) {
+            prev->next        = table->next;
+            table->next       = interp->ns_caches;
+            interp->ns_caches = table;
+            break;
+        }
+    }
+
+    return table;
+}
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_ns_cache_table *
+new_cache_table(PARROT_INTERP, ARGIN(const PackFile_ByteCode *seg))
+{
+    ASSERT_ARGS(new_cache_table)
+    Parrot_ns_cache_table * const table = mem_gc_allocate_zeroed_typed(interp,
+                                                Parrot_ns_cache_table);
+
+    table->seg        = seg;
+    table->next       = interp->ns_caches;
+    interp->ns_caches = table;
+
+    return table;
+}
+
+/*
+
+=item C<void Parrot_ns_destroy_caches(PARROT_INTERP, const PackFile_ByteCode
+*seg)>
+
+Frees the global lookup caches this interpreter keeps for the code segment
+C<seg>, or all of them if C<seg> is NULL.
+
+=cut
+
+*/
+
+void
+Parrot_ns_destroy_caches(PARROT_INTERP, ARGIN_NULLOK(const PackFile_ByteCode *seg))
+{
+    ASSERT_ARGS(Parrot_ns_destroy_caches)
+    Parrot_ns_cache_table **link = &interp->ns_caches;
+
+    while (*link) {
+        Parrot_ns_cache_table * const table = *link;
+
+        if (!seg || table->seg == seg) {
+            *link = table->next;
+
+            if (table->entries)
+                mem_gc_free(interp, table->entries);
+
+            mem_gc_free(interp, table);
+        }
+        else
+            link = &table->next;
+    }
+}
+
+/*
+
+=item C<void Parrot_ns_modified(PARROT_INTERP, PMC *ns)>
+
+Gives the namespace C<ns> and its parents a new modification stamp. This
+invalidates the global lookups cached for them. Called by the C<NameSpace>
+PMC whenever it changes.
+
+=cut
+
+*/
+
+void
+Parrot_ns_modified(PARROT_INTERP, ARGIN(PMC *ns))
+{
+    ASSERT_ARGS(Parrot_ns_modified)
+    const UINTVAL stamp = ++interp->ns_stamp;
+
+    while (!PMC_IS_NULL(ns) && ns->vtable->base_type == enum_class_NameSpace) {
+        Parrot_NameSpace_attributes * const nsinfo = PARROT_NAMESPACE(ns);
+
+        /* the parents may form a cycle */
+        if (nsinfo->stamp == stamp)
+            break;
+
+        nsinfo->stamp = stamp;
+        ns            = nsinfo->parent;
+    }
+}
+
 
 /*
 
@@ -20,6 +20,11 @@ conversion from the ffi signature back to INPS.
 Of course this needs to be optimized into one single call to bear the
 conversion overhead only on certain arg types.
 
+The signatures are parsed once, when the thunk is built: the NCI argument
+types and the NUL-terminated PCC signatures are kept in the thunk, and calls
+with few arguments marshal through scratch space on the C stack, so a call
+does no signature parsing and no heap allocation.
+
 =head2 Functions
 
 =over 4
@@ -83,8 +88,19 @@ typedef struct ffi_thunk_t {
 
     ffi_cif    pcc_ret_cif;
     ffi_type **pcc_ret_types;
+
+    /* marshalling plan, computed once from the signature in build_ffi_thunk */
+    INTVAL            arity;          /* number of NCI arguments */
+    PARROT_DATA_TYPE  ret_type;       /* NCI return type */
+    PARROT_DATA_TYPE *nci_types;      /* NCI argument types, including the ref flag */
+    char             *pcc_params_sig; /* NUL-terminated PCC parameter signature */
+    char             *pcc_ret_sig;    /* NUL-terminated PCC return signature */
 } ffi_thunk_t;
 
+/* Calls with at most this many arguments marshal through scratch space on the
+   C stack; wider signatures fall back to heap allocation. */
+#define NCI_FFI_STATIC_ARGS 5
+
 typedef union parrot_var_t {
     INTVAL    i;
     FLOATVAL  n;
@@ -244,6 +260,31 @@ build_ffi_thunk(PARROT_INTERP, SHIM(PMC *user_data), ARGIN(PMC *sig))
     STRING *pcc_ret_sig, *pcc_params_sig;
     Parrot_nci_sig_to_pcc(interp, sig, &pcc_params_sig, &pcc_ret_sig);
 
+    /* precompute the marshalling plan so call_ffi_thunk never parses signatures */
+    {
+        INTVAL i;
+
+        thunk_data->arity          = VTABLE_elements(interp, sig) - 1;
+        thunk_data->ret_type       = (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, sig, 0);
+        thunk_data->nci_types      = mem_gc_allocate_n_zeroed_typed(interp,
+                                        thunk_data->arity + 1, PARROT_DATA_TYPE);
+        thunk_data->pcc_params_sig = Parrot_str_to_cstring(interp, pcc_params_sig);
+        thunk_data->pcc_ret_sig    = Parrot_str_to_cstring(interp, pcc_ret_sig);
+
+        for (i = 0; i < thunk_data->arity; i++) {
+            const char c = thunk_data->pcc_params_sig[i];
+            if (c == 'v')
+                Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_JIT_ERROR,
+                      "Invalid pcc signature code: 'v'. Leave it empty");
+            else if (c != 'I' && c != 'N' && c != 'S' && c != 'P')
+                Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_JIT_ERROR,
+                      "Invalid pcc signature code: '%c'", c);
+
+            thunk_data->nci_types[i] = (PARROT_DATA_TYPE)
+                                        VTABLE_get_integer_keyed_int(interp, sig, i + 1);
+        }
+    }
+
     /* generate Parrot_pcc_fill_params_from_c_args dynamic call infrastructure */
     {
         INTVAL     argc  = Parrot_str_length(interp, pcc_params_sig) + 3;
@@ -519,13 +560,26 @@ call_ffi_thunk(PARROT_INTERP, ARGMOD(PMC *nci_pmc), ARGMOD(PMC *self))
 
     PMC *call_object = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
-    parrot_var_t  *pcc_arg;     /* values of pcc arguments */
+    /* scratch space for common arities */
+    parrot_var_t  pcc_arg_buf[NCI_FFI_STATIC_ARGS + 1];
+    nci_var_t     nci_val_buf[NCI_FFI_STATIC_ARGS];
+    void         *nci_arg_buf[NCI_FFI_STATIC_ARGS];
+    void         *nci_arg_ptr_buf[NCI_FFI_STATIC_ARGS];
+    void         *call_arg_buf[NCI_FFI_STATIC_ARGS + 4];
+
+    parrot_var_t  *pcc_arg;     /* values of pcc arguments, later of pcc returns */
     nci_var_t     *nci_val;     /* values of nci arguments */
     void         **nci_arg;     /* pointers for pass-by-ref arguments */
-    void         **nci_arg_ptr = NULL; /* pointers to arguments for libffi */
+    void         **nci_arg_ptr; /* pointers to arguments for libffi */
+    void         **call_arg;    /* arguments of the dynamic pcc calls */
 
-    void *return_data; /* Holds return data from FFI call */
-    int i;
+    union {
+        nci_var_t v;
+        ffi_arg   a;
+    } return_data; /* Holds return data from FFI call */
+
+    INTVAL arity;
+    int    i;
 
     {
         void *v;
@@ -533,246 +587,212 @@ call_ffi_thunk(PARROT_INTERP, ARGMOD(PMC *nci_pmc), ARGMOD(PMC *self))
         thunk = (ffi_thunk_t *)v;
     }
 
+    arity = thunk->arity;
+
+    if (arity <= NCI_FFI_STATIC_ARGS) {
+        pcc_arg     = pcc_arg_buf;
+        nci_val     = nci_val_buf;
+        nci_arg     = nci_arg_buf;
+        nci_arg_ptr = nci_arg_ptr_buf;
+        call_arg    = call_arg_buf;
+    }
+    else {
+        pcc_arg     = mem_gc_allocate_n_zeroed_typed(interp, arity + 1, parrot_var_t);
+        nci_val     = mem_gc_allocate_n_zeroed_typed(interp, arity, nci_var_t);
+        nci_arg     = mem_gc_allocate_n_zeroed_typed(interp, arity, void *);
+        nci_arg_ptr = mem_gc_allocate_n_zeroed_typed(interp, arity, void *);
+        call_arg    = mem_gc_allocate_n_zeroed_typed(interp, arity + 4, void *);
+    }
+
     /* dynamic call to Parrot_pcc_fill_params_from_c_args */
     {
-        INTVAL  pcc_argc = Parrot_str_length(interp, nci->pcc_params_signature);
-        char   *pcc_sig  = Parrot_str_to_cstring(interp, nci->pcc_params_signature);
-
-        void **pcc_arg_ptr, **call_arg;
         ffi_arg ffi_ret_dummy;
 
-        pcc_arg     = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, parrot_var_t);
-        pcc_arg_ptr = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, void *);
-        call_arg    = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc + 3, void*);
-
         /* setup Parrot_pcc_fill_params_from_c_args required arguments */
         call_arg[0] = &interp;
         call_arg[1] = &call_object;
-        call_arg[2] = &pcc_sig;
-
-        /* TODO: eliminate PCC signature parsing somehow */
-        for (i = 0; i < pcc_argc; i++) {
-            switch (pcc_sig[i]) {
-                case 'I':
-                    pcc_arg_ptr[i] = &pcc_arg[i].i;
-                    break;
-                case 'N':
-                    pcc_arg_ptr[i] = &pcc_arg[i].n;
-                    break;
-                case 'S':
-                    pcc_arg_ptr[i] = &pcc_arg[i].s;
-                    break;
-                case 'P':
-                    pcc_arg_ptr[i] = &pcc_arg[i].p;
-                    break;
-                case 'v':
-                    Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_JIT_ERROR,
-                          "Invalid pcc signature code: 'v'. Leave it empty");
-                    break;
-                default:
-                    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_JIT_ERROR,
-                          "Invalid pcc signature code: '%c'", pcc_sig[i]);
-                    break;
-            }
-            call_arg[i + 3] = &pcc_arg_ptr[i];
+        call_arg[2] = &thunk->pcc_params_sig;
+
+        /* every member of parrot_var_t lives at the start of the union, so the
+           slot pointers don't depend on the (already validated) signature.
+           nci_arg_ptr is free until the native arguments are marshalled. */
+        for (i = 0; i < arity; i++) {
+            nci_arg_ptr[i]  = &pcc_arg[i];
+            call_arg[i + 3] = &nci_arg_ptr[i];
         }
 
         ffi_call(&thunk->pcc_arg_cif, FFI_FN(Parrot_pcc_fill_params_from_c_args),
                 &ffi_ret_dummy, call_arg);
-
-        mem_gc_free(interp, call_arg);
-        mem_gc_free(interp, pcc_arg_ptr);
-        Parrot_str_free_cstring(pcc_sig);
     }
 
-    if (nci->arity) {
-        nci_val     = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, nci_var_t);
-        nci_arg     = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, void *);
-        nci_arg_ptr = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, void *);
-
-        for (i = 0; i < nci->arity; i++) {
-            unsigned int slack = 0;
-            PARROT_DATA_TYPE t = (PARROT_DATA_TYPE)
-                                    VTABLE_get_integer_keyed_int(interp, nci->signature, i + 1);
-            switch (t & ~enum_type_ref_flag) {
-              case enum_type_char:
-                nci_val[i].c   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].c;
-                break;
-              case enum_type_short:
-                nci_val[i].s   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].s;
-                break;
-              case enum_type_int:
-                nci_val[i].i   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i;
-                break;
-              case enum_type_long:
-                nci_val[i].l   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].l;
-                break;
+    for (i = 0; i < arity; i++) {
+        unsigned int slack = 0;
+        const PARROT_DATA_TYPE t = thunk->nci_types[i];
+        switch (t & ~enum_type_ref_flag) {
+          case enum_type_char:
+            nci_val[i].c   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].c;
+            break;
+          case enum_type_short:
+            nci_val[i].s   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].s;
+            break;
+          case enum_type_int:
+            nci_val[i].i   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i;
+            break;
+          case enum_type_long:
+            nci_val[i].l   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].l;
+            break;
 #if PARROT_HAS_LONGLONG
-              case enum_type_longlong:
-                nci_val[i].ll  = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].ll;
-                break;
+          case enum_type_longlong:
+            nci_val[i].ll  = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].ll;
+            break;
 #endif
-              case enum_type_int8:
-                nci_val[i].i8  = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i8;
-                break;
-              case enum_type_int16:
-                nci_val[i].i16 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i16;
-                break;
-              case enum_type_int32:
-                nci_val[i].i32 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i32;
-                break;
+          case enum_type_int8:
+            nci_val[i].i8  = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i8;
+            break;
+          case enum_type_int16:
+            nci_val[i].i16 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i16;
+            break;
+          case enum_type_int32:
+            nci_val[i].i32 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i32;
+            break;
 #if PARROT_HAS_INT64
-              case enum_type_int64:
-                nci_val[i].i64 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i64;
-                break;
+          case enum_type_int64:
+            nci_val[i].i64 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i64;
+            break;
 #endif
-              case enum_type_INTVAL:
-                nci_val[i].I   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].I;
-                break;
-
-              case enum_type_float:
-                nci_val[i].f   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].f;
-                break;
-              case enum_type_double:
-                nci_val[i].d   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].d;
-                break;
-              case enum_type_longdouble:
-                nci_val[i].ld  = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].ld;
-                break;
-              case enum_type_FLOATVAL:
-                nci_val[i].N   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].N;
-                break;
-
-              case enum_type_STRING:
-                nci_val[i].S   = pcc_arg[i].s;
-                nci_arg_ptr[i] = &nci_val[i].S;
-                break;
-              case enum_type_plong:
-                slack = sizeof (INTVAL) - sizeof (long) + 1;
-              case enum_type_pint:
-                slack = slack ? slack : sizeof (INTVAL) - sizeof (int) + 1;
-              case enum_type_pshort:
-                slack = slack ? slack : sizeof (INTVAL) - sizeof (short) + 1;
-                nci_val[i].t = (char*)&(((Parrot_Integer_attributes *)PMC_data(pcc_arg[i].p))->iv);
-                /* on little-endian set the remainder to 0,
-                   the callback only manipulates the head, on big-endian the tail. */
-                --slack;
-                if (slack) {
+          case enum_type_INTVAL:
+            nci_val[i].I   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].I;
+            break;
+
+          case enum_type_float:
+            nci_val[i].f   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].f;
+            break;
+          case enum_type_double:
+            nci_val[i].d   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].d;
+            break;
+          case enum_type_longdouble:
+            nci_val[i].ld  = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].ld;
+            break;
+          case enum_type_FLOATVAL:
+            nci_val[i].N   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].N;
+            break;
+
+          case enum_type_STRING:
+            nci_val[i].S   = pcc_arg[i].s;
+            nci_arg_ptr[i] = &nci_val[i].S;
+            break;
+          case enum_type_plong:
+            slack = sizeof (INTVAL) - sizeof (long) + 1;
+          case enum_type_pint:
+            slack = slack ? slack : sizeof (INTVAL) - sizeof (int) + 1;
+          case enum_type_pshort:
+            slack = slack ? slack : sizeof (INTVAL) - sizeof (short) + 1;
+            nci_val[i].t = (char*)&(((Parrot_Integer_attributes *)PMC_data(pcc_arg[i].p))->iv);
+            /* on little-endian set the remainder to 0,
+               the callback only manipulates the head, on big-endian the tail. */
+            --slack;
+            if (slack) {
 #if !PARROT_BIGENDIAN
-                    memset(&nci_val[i].t[sizeof (INTVAL) - slack], 0, slack);
+                memset(&nci_val[i].t[sizeof (INTVAL) - slack], 0, slack);
 #else
-                    /* on BE forward the ptr and mask the head. */
-                    memset(&nci_val[i].t[0], 0, slack);
-                    nci_val[i].t += slack;
+                /* on BE forward the ptr and mask the head. */
+                memset(&nci_val[i].t[0], 0, slack);
+                nci_val[i].t += slack;
 #endif
-                }
-                nci_arg_ptr[i] = &nci_val[i].t;
-                break;
-
-              case enum_type_PMC:
-                nci_val[i].P   = pcc_arg[i].p;
-                nci_arg_ptr[i] = &nci_val[i].P;
-                break;
-              case enum_type_ptr:
-                nci_val[i].p   = PMC_IS_NULL(pcc_arg[i].p) ?
-                                    NULL :
-                                    VTABLE_get_pointer(interp, pcc_arg[i].p);
-                nci_arg_ptr[i] = &nci_val[i].p;
-                break;
-              case enum_type_cstr:
-                nci_val[i].t   = STRING_IS_NULL(pcc_arg[i].s) ?
-                                    (char *)NULL :
-                                    Parrot_str_to_cstring(interp, pcc_arg[i].s);
-                nci_arg_ptr[i] = &nci_val[i].t;
+            }
+            nci_arg_ptr[i] = &nci_val[i].t;
+            break;
+
+          case enum_type_PMC:
+            nci_val[i].P   = pcc_arg[i].p;
+            nci_arg_ptr[i] = &nci_val[i].P;
+            break;
+          case enum_type_ptr:
+            nci_val[i].p   = PMC_IS_NULL(pcc_arg[i].p) ?
+                                NULL :
+                                VTABLE_get_pointer(interp, pcc_arg[i].p);
+            nci_arg_ptr[i] = &nci_val[i].p;
+            break;
+          case enum_type_cstr:
+            nci_val[i].t   = STRING_IS_NULL(pcc_arg[i].s) ?
+                                (char *)NULL :
+                                Parrot_str_to_cstring(interp, pcc_arg[i].s);
+            nci_arg_ptr[i] = &nci_val[i].t;
 #if 0
-                translation_pointers[i] = STRING_IS_NULL(pcc_arg[j].s) ?
-                    (char *)NULL :
-                    Parrot_str_to_cstring(interp, pcc_arg[j].s);
-                j++;
-                values[i] = &translation_pointers[i];
+            translation_pointers[i] = STRING_IS_NULL(pcc_arg[j].s) ?
+                (char *)NULL :
+                Parrot_str_to_cstring(interp, pcc_arg[j].s);
+            j++;
+            values[i] = &translation_pointers[i];
 #endif
-                break;
+            break;
 
-              default:
-                PARROT_ASSERT("Unhandled NCI signature");
-                break;
-            }
+          default:
+            PARROT_ASSERT("Unhandled NCI signature");
+            break;
+        }
 
-            if (t & enum_type_ref_flag) {
-                nci_arg[i]     = nci_arg_ptr[i];
-                nci_arg_ptr[i] = &nci_arg[i];
-            }
+        if (t & enum_type_ref_flag) {
+            nci_arg[i]     = nci_arg_ptr[i];
+            nci_arg_ptr[i] = &nci_arg[i];
         }
     }
 
-    mem_gc_free(interp, pcc_arg);
-
-    return_data = mem_sys_allocate(thunk->cif.rtype->size);
-
-    ffi_call(&thunk->cif, FFI_FN(nci->orig_func), return_data, nci_arg_ptr);
+    ffi_call(&thunk->cif, FFI_FN(nci->orig_func), &return_data, nci_arg_ptr);
 
     /* dynamic call to Parrot_pcc_build_call_from_c_args */
     if (thunk->pcc_ret_cif.nargs > 3) {
-        PMC           *ffi_ret_unused;
-        INTVAL         pcc_retc    = Parrot_str_length(interp, nci->pcc_return_signature);
-        char          *pcc_ret_sig = Parrot_str_to_cstring(interp, nci->pcc_return_signature);
-        void         **call_arg    = mem_gc_allocate_n_zeroed_typed(interp, pcc_retc + 3, void *);
-        parrot_var_t  *pcc_retv    = mem_gc_allocate_n_zeroed_typed(interp, pcc_retc, parrot_var_t);
-
-        PARROT_DATA_TYPE arg_t;
-        int              j;
+        PMC          *ffi_ret_unused;
+        const INTVAL  pcc_retc = thunk->pcc_ret_cif.nargs - 3;
+        int           j;
         i = 0;
 
         call_arg[0] = &interp;
         call_arg[1] = &call_object;
-        call_arg[2] = &pcc_ret_sig;
+        call_arg[2] = &thunk->pcc_ret_sig;
 
         /* populate return slot (non-existent if void) */
-        if (enum_type_void !=
-            (arg_t = (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, nci->signature, 0))) {
-            prep_pcc_ret_arg(interp, arg_t, &pcc_retv[i], &call_arg[i + 3], return_data);
+        if (thunk->ret_type != enum_type_void) {
+            prep_pcc_ret_arg(interp, thunk->ret_type, &pcc_arg[i], &call_arg[i + 3],
+                             &return_data);
             i++;
         }
 
         /* also return call-by-reference arguments (if any) */
-        for (j = 1; i < pcc_retc; j++) {
-            arg_t = (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, nci->signature, j);
+        for (j = 0; i < pcc_retc; j++) {
+            const PARROT_DATA_TYPE arg_t = thunk->nci_types[j];
             if (arg_t & enum_type_ref_flag) {
                 prep_pcc_ret_arg(interp, (PARROT_DATA_TYPE)(arg_t & ~enum_type_ref_flag),
-                                 &pcc_retv[i], &call_arg[i + 3], nci_arg[j - 1]);
+                                 &pcc_arg[i], &call_arg[i + 3], nci_arg[j]);
                 i++;
             }
         }
 
         ffi_call(&thunk->pcc_ret_cif, FFI_FN(Parrot_pcc_build_call_from_c_args),
                 &ffi_ret_unused, call_arg);
-
-        Parrot_str_free_cstring(pcc_ret_sig);
-        mem_gc_free(interp, call_arg);
-        mem_gc_free(interp, pcc_retv);
     }
 
-    if (nci->arity) {
+    if (pcc_arg != pcc_arg_buf) {
+        mem_gc_free(interp, pcc_arg);
         mem_gc_free(interp, nci_val);
         mem_gc_free(interp, nci_arg);
         mem_gc_free(interp, nci_arg_ptr);
+        mem_gc_free(interp, call_arg);
     }
-
-    mem_gc_free(interp, return_data);
 }
 
 
@@ -811,6 +831,24 @@ clone_ffi_thunk(PARROT_INTERP, SHIM(PMC *thunk), ARGIN(void *_thunk_data))
     mem_copy_n_typed(clone_data->arg_types, thunk_data->arg_types,
                         thunk_data->cif.nargs, ffi_type *);
 
+    clone_data->pcc_ret_types = mem_gc_allocate_n_zeroed_typed(interp,
+                                    thunk_data->pcc_ret_cif.nargs, ffi_type *);
+    mem_copy_n_typed(clone_data->pcc_ret_types, thunk_data->pcc_ret_types,
+                        thunk_data->pcc_ret_cif.nargs, ffi_type *);
+
+    /* the copied cifs must not point into the original thunk's arrays */
+    clone_data->pcc_arg_cif.arg_types = clone_data->pcc_arg_types;
+    clone_data->cif.arg_types         = clone_data->arg_types;
+    clone_data->pcc_ret_cif.arg_types = clone_data->pcc_ret_types;
+
+    clone_data->nci_types     = mem_gc_allocate_n_zeroed_typed(interp,
+                                    thunk_data->arity + 1, PARROT_DATA_TYPE);
+    mem_copy_n_typed(clone_data->nci_types, thunk_data->nci_types,
+                        thunk_data->arity + 1, PARROT_DATA_TYPE);
+
+    clone_data->pcc_params_sig = mem_sys_strdup(thunk_data->pcc_params_sig);
+    clone_data->pcc_ret_sig    = mem_sys_strdup(thunk_data->pcc_ret_sig);
+
     return clone;
 }
 
@@ -838,6 +876,18 @@ free_ffi_thunk(PARROT_INTERP, SHIM(void *thunk_func), ARGFREE(void *thunk_data))
     if (thunk->pcc_arg_types)
         mem_gc_free(interp, thunk->pcc_arg_types);
 
+    if (thunk->pcc_ret_types)
+        mem_gc_free(interp, thunk->pcc_ret_types);
+
+    if (thunk->nci_types)
+        mem_gc_free(interp, thunk->nci_types);
+
+    if (thunk->pcc_params_sig)
+        Parrot_str_free_cstring(thunk->pcc_params_sig);
+
+    if (thunk->pcc_ret_sig)
+        Parrot_str_free_cstring(thunk->pcc_ret_sig);
+
     mem_gc_free(interp, thunk);
 }
 
@@ -80,6 +80,7 @@ PARROT_DYNEXT_EXPORT float  nci_fff(float, float);
 PARROT_DYNEXT_EXPORT int    nci_i(void);
 PARROT_DYNEXT_EXPORT int    nci_ib(int *);
 PARROT_DYNEXT_EXPORT int    nci_iiii(int, int, int);
+PARROT_DYNEXT_EXPORT int    nci_iiiiiii(int, int, int, int, int, int);
 PARROT_DYNEXT_EXPORT int    nci_ii2(int, short *);
 PARROT_DYNEXT_EXPORT int    nci_ii3(int, int *);
 PARROT_DYNEXT_EXPORT int    nci_ip(void *);
@@ -420,6 +421,25 @@ nci_iiii(int i1, int i2, int i3)
 
 /*
 
+=item C<PARROT_DYNEXT_EXPORT int nci_iiiiiii(int i1, int i2, int i3, int i4, int
+i5, int i6)>
+
+Returns the six integers weighted by their position, C<i1 + 2 * i2 + ... + 6 * i6>,
+so that wide signatures can check argument order.
+
+=cut
+
+*/
+
+PARROT_DYNEXT_EXPORT
+int
+nci_iiiiiii(int i1, int i2, int i3, int i4, int i5, int i6)
+{
+    return i1 + 2 * i2 + 3 * i3 + 4 * i4 + 5 * i5 + 6 * i6;
+}
+
+/*
+
 =item C<PARROT_DYNEXT_EXPORT int nci_ii2(int a, short *bp)>
 
 Multiplies C<a> and C<*bp> together and returns the result. Updates C<*bp>
@@ -76,16 +76,17 @@ extern op_lib_t core_op_lib;
 
 #include "parrot/scheduler_private.h"
 #include "pmc/pmc_task.h"
+#include "parrot/mailbox.h"
 
 
 
-INTVAL core_numops = 1132;
+INTVAL core_numops = 1158;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1132] = {
+static op_func_t core_op_func_table[1158] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -763,460 +764,486 @@ static op_func_t core_op_func_table[1132] = {
   Parrot_freeze_s_p,                                 /*    674 */
   Parrot_thaw_p_s,                                   /*    675 */
   Parrot_thaw_p_sc,                                  /*    676 */
-  Parrot_add_multi_s_s_p,                            /*    677 */
-  Parrot_add_multi_sc_s_p,                           /*    678 */
-  Parrot_add_multi_s_sc_p,                           /*    679 */
-  Parrot_add_multi_sc_sc_p,                          /*    680 */
-  Parrot_find_multi_p_s_s,                           /*    681 */
-  Parrot_find_multi_p_sc_s,                          /*    682 */
-  Parrot_find_multi_p_s_sc,                          /*    683 */
-  Parrot_find_multi_p_sc_sc,                         /*    684 */
-  Parrot_register_p,                                 /*    685 */
-  Parrot_unregister_p,                               /*    686 */
-  Parrot_box_p_i,                                    /*    687 */
-  Parrot_box_p_ic,                                   /*    688 */
-  Parrot_box_p_n,                                    /*    689 */
-  Parrot_box_p_nc,                                   /*    690 */
-  Parrot_box_p_s,                                    /*    691 */
-  Parrot_box_p_sc,                                   /*    692 */
-  Parrot_iter_p_p,                                   /*    693 */
-  Parrot_morph_p_p,                                  /*    694 */
-  Parrot_morph_p_pc,                                 /*    695 */
-  Parrot_clone_s_s,                                  /*    696 */
-  Parrot_clone_s_sc,                                 /*    697 */
-  Parrot_set_i_i,                                    /*    698 */
-  Parrot_set_i_ic,                                   /*    699 */
-  Parrot_set_i_n,                                    /*    700 */
-  Parrot_set_i_nc,                                   /*    701 */
-  Parrot_set_i_s,                                    /*    702 */
-  Parrot_set_i_sc,                                   /*    703 */
-  Parrot_set_n_n,                                    /*    704 */
-  Parrot_set_n_nc,                                   /*    705 */
-  Parrot_set_n_i,                                    /*    706 */
-  Parrot_set_n_ic,                                   /*    707 */
-  Parrot_set_n_s,                                    /*    708 */
-  Parrot_set_n_sc,                                   /*    709 */
-  Parrot_set_n_p,                                    /*    710 */
-  Parrot_set_s_p,                                    /*    711 */
-  Parrot_set_s_s,                                    /*    712 */
-  Parrot_set_s_sc,                                   /*    713 */
-  Parrot_set_s_i,                                    /*    714 */
-  Parrot_set_s_ic,                                   /*    715 */
-  Parrot_set_s_n,                                    /*    716 */
-  Parrot_set_s_nc,                                   /*    717 */
-  Parrot_set_p_pc,                                   /*    718 */
-  Parrot_set_p_p,                                    /*    719 */
-  Parrot_set_p_i,                                    /*    720 */
-  Parrot_set_p_ic,                                   /*    721 */
-  Parrot_set_p_n,                                    /*    722 */
-  Parrot_set_p_nc,                                   /*    723 */
-  Parrot_set_p_s,                                    /*    724 */
-  Parrot_set_p_sc,                                   /*    725 */
-  Parrot_set_i_p,                                    /*    726 */
-  Parrot_assign_p_p,                                 /*    727 */
-  Parrot_assign_p_i,                                 /*    728 */
-  Parrot_assign_p_ic,                                /*    729 */
-  Parrot_assign_p_n,                                 /*    730 */
-  Parrot_assign_p_nc,                                /*    731 */
-  Parrot_assign_p_s,                                 /*    732 */
-  Parrot_assign_p_sc,                                /*    733 */
-  Parrot_assign_s_s,                                 /*    734 */
-  Parrot_assign_s_sc,                                /*    735 */
-  Parrot_setref_p_p,                                 /*    736 */
-  Parrot_deref_p_p,                                  /*    737 */
-  Parrot_set_p_ki_i,                                 /*    738 */
-  Parrot_set_p_kic_i,                                /*    739 */
-  Parrot_set_p_ki_ic,                                /*    740 */
-  Parrot_set_p_kic_ic,                               /*    741 */
-  Parrot_set_p_ki_n,                                 /*    742 */
-  Parrot_set_p_kic_n,                                /*    743 */
-  Parrot_set_p_ki_nc,                                /*    744 */
-  Parrot_set_p_kic_nc,                               /*    745 */
-  Parrot_set_p_ki_s,                                 /*    746 */
-  Parrot_set_p_kic_s,                                /*    747 */
-  Parrot_set_p_ki_sc,                                /*    748 */
-  Parrot_set_p_kic_sc,                               /*    749 */
-  Parrot_set_p_ki_p,                                 /*    750 */
-  Parrot_set_p_kic_p,                                /*    751 */
-  Parrot_set_i_p_ki,                                 /*    752 */
-  Parrot_set_i_p_kic,                                /*    753 */
-  Parrot_set_n_p_ki,                                 /*    754 */
-  Parrot_set_n_p_kic,                                /*    755 */
-  Parrot_set_s_p_ki,                                 /*    756 */
-  Parrot_set_s_p_kic,                                /*    757 */
-  Parrot_set_p_p_ki,                                 /*    758 */
-  Parrot_set_p_p_kic,                                /*    759 */
-  Parrot_set_p_k_i,                                  /*    760 */
-  Parrot_set_p_kc_i,                                 /*    761 */
-  Parrot_set_p_k_ic,                                 /*    762 */
-  Parrot_set_p_kc_ic,                                /*    763 */
-  Parrot_set_p_k_n,                                  /*    764 */
-  Parrot_set_p_kc_n,                                 /*    765 */
-  Parrot_set_p_k_nc,                                 /*    766 */
-  Parrot_set_p_kc_nc,                                /*    767 */
-  Parrot_set_p_k_s,                                  /*    768 */
-  Parrot_set_p_kc_s,                                 /*    769 */
-  Parrot_set_p_k_sc,                                 /*    770 */
-  Parrot_set_p_kc_sc,                                /*    771 */
-  Parrot_set_p_k_p,                                  /*    772 */
-  Parrot_set_p_kc_p,                                 /*    773 */
-  Parrot_set_i_p_k,                                  /*    774 */
-  Parrot_set_i_p_kc,                                 /*    775 */
-  Parrot_set_n_p_k,                                  /*    776 */
-  Parrot_set_n_p_kc,                                 /*    777 */
-  Parrot_set_s_p_k,                                  /*    778 */
-  Parrot_set_s_p_kc,                                 /*    779 */
-  Parrot_set_p_p_k,                                  /*    780 */
-  Parrot_set_p_p_kc,                                 /*    781 */
-  Parrot_clone_p_p,                                  /*    782 */
-  Parrot_clone_p_p_p,                                /*    783 */
-  Parrot_clone_p_p_pc,                               /*    784 */
-  Parrot_copy_p_p,                                   /*    785 */
-  Parrot_null_s,                                     /*    786 */
-  Parrot_null_i,                                     /*    787 */
-  Parrot_null_p,                                     /*    788 */
-  Parrot_null_n,                                     /*    789 */
-  Parrot_ord_i_s,                                    /*    790 */
-  Parrot_ord_i_sc,                                   /*    791 */
-  Parrot_ord_i_s_i,                                  /*    792 */
-  Parrot_ord_i_sc_i,                                 /*    793 */
-  Parrot_ord_i_s_ic,                                 /*    794 */
-  Parrot_ord_i_sc_ic,                                /*    795 */
-  Parrot_chr_s_i,                                    /*    796 */
-  Parrot_chr_s_ic,                                   /*    797 */
-  Parrot_chopn_s_s_i,                                /*    798 */
-  Parrot_chopn_s_sc_i,                               /*    799 */
-  Parrot_chopn_s_s_ic,                               /*    800 */
-  Parrot_chopn_s_sc_ic,                              /*    801 */
-  Parrot_concat_p_p,                                 /*    802 */
-  Parrot_concat_p_s,                                 /*    803 */
-  Parrot_concat_p_sc,                                /*    804 */
-  Parrot_concat_s_s_s,                               /*    805 */
-  Parrot_concat_s_sc_s,                              /*    806 */
-  Parrot_concat_s_s_sc,                              /*    807 */
-  Parrot_concat_p_p_s,                               /*    808 */
-  Parrot_concat_p_p_sc,                              /*    809 */
-  Parrot_concat_p_p_p,                               /*    810 */
-  Parrot_repeat_s_s_i,                               /*    811 */
-  Parrot_repeat_s_sc_i,                              /*    812 */
-  Parrot_repeat_s_s_ic,                              /*    813 */
-  Parrot_repeat_s_sc_ic,                             /*    814 */
-  Parrot_repeat_p_p_i,                               /*    815 */
-  Parrot_repeat_p_p_ic,                              /*    816 */
-  Parrot_repeat_p_p_p,                               /*    817 */
-  Parrot_repeat_p_i,                                 /*    818 */
-  Parrot_repeat_p_ic,                                /*    819 */
-  Parrot_repeat_p_p,                                 /*    820 */
-  Parrot_length_i_s,                                 /*    821 */
-  Parrot_length_i_sc,                                /*    822 */
-  Parrot_bytelength_i_s,                             /*    823 */
-  Parrot_bytelength_i_sc,                            /*    824 */
-  Parrot_pin_s,                                      /*    825 */
-  Parrot_unpin_s,                                    /*    826 */
-  Parrot_substr_s_s_i,                               /*    827 */
-  Parrot_substr_s_sc_i,                              /*    828 */
-  Parrot_substr_s_s_ic,                              /*    829 */
-  Parrot_substr_s_sc_ic,                             /*    830 */
-  Parrot_substr_s_s_i_i,                             /*    831 */
-  Parrot_substr_s_sc_i_i,                            /*    832 */
-  Parrot_substr_s_s_ic_i,                            /*    833 */
-  Parrot_substr_s_sc_ic_i,                           /*    834 */
-  Parrot_substr_s_s_i_ic,                            /*    835 */
-  Parrot_substr_s_sc_i_ic,                           /*    836 */
-  Parrot_substr_s_s_ic_ic,                           /*    837 */
-  Parrot_substr_s_sc_ic_ic,                          /*    838 */
-  Parrot_substr_s_p_i_i,                             /*    839 */
-  Parrot_substr_s_p_ic_i,                            /*    840 */
-  Parrot_substr_s_p_i_ic,                            /*    841 */
-  Parrot_substr_s_p_ic_ic,                           /*    842 */
-  Parrot_replace_s_s_i_i_s,                          /*    843 */
-  Parrot_replace_s_sc_i_i_s,                         /*    844 */
-  Parrot_replace_s_s_ic_i_s,                         /*    845 */
-  Parrot_replace_s_sc_ic_i_s,                        /*    846 */
-  Parrot_replace_s_s_i_ic_s,                         /*    847 */
-  Parrot_replace_s_sc_i_ic_s,                        /*    848 */
-  Parrot_replace_s_s_ic_ic_s,                        /*    849 */
-  Parrot_replace_s_sc_ic_ic_s,                       /*    850 */
-  Parrot_replace_s_s_i_i_sc,                         /*    851 */
-  Parrot_replace_s_sc_i_i_sc,                        /*    852 */
-  Parrot_replace_s_s_ic_i_sc,                        /*    853 */
-  Parrot_replace_s_sc_ic_i_sc,                       /*    854 */
-  Parrot_replace_s_s_i_ic_sc,                        /*    855 */
-  Parrot_replace_s_sc_i_ic_sc,                       /*    856 */
-  Parrot_replace_s_s_ic_ic_sc,                       /*    857 */
-  Parrot_replace_s_sc_ic_ic_sc,                      /*    858 */
-  Parrot_index_i_s_s,                                /*    859 */
-  Parrot_index_i_sc_s,                               /*    860 */
-  Parrot_index_i_s_sc,                               /*    861 */
-  Parrot_index_i_sc_sc,                              /*    862 */
-  Parrot_index_i_s_s_i,                              /*    863 */
-  Parrot_index_i_sc_s_i,                             /*    864 */
-  Parrot_index_i_s_sc_i,                             /*    865 */
-  Parrot_index_i_sc_sc_i,                            /*    866 */
-  Parrot_index_i_s_s_ic,                             /*    867 */
-  Parrot_index_i_sc_s_ic,                            /*    868 */
-  Parrot_index_i_s_sc_ic,                            /*    869 */
-  Parrot_index_i_sc_sc_ic,                           /*    870 */
-  Parrot_rindex_i_s_s,                               /*    871 */
-  Parrot_rindex_i_sc_s,                              /*    872 */
-  Parrot_rindex_i_s_sc,                              /*    873 */
-  Parrot_rindex_i_sc_sc,                             /*    874 */
-  Parrot_rindex_i_s_s_i,                             /*    875 */
-  Parrot_rindex_i_sc_s_i,                            /*    876 */
-  Parrot_rindex_i_s_sc_i,                            /*    877 */
-  Parrot_rindex_i_sc_sc_i,                           /*    878 */
-  Parrot_rindex_i_s_s_ic,                            /*    879 */
-  Parrot_rindex_i_sc_s_ic,                           /*    880 */
-  Parrot_rindex_i_s_sc_ic,                           /*    881 */
-  Parrot_rindex_i_sc_sc_ic,                          /*    882 */
-  Parrot_sprintf_s_s_p,                              /*    883 */
-  Parrot_sprintf_s_sc_p,                             /*    884 */
-  Parrot_sprintf_p_p_p,                              /*    885 */
-  Parrot_new_s,                                      /*    886 */
-  Parrot_stringinfo_i_s_i,                           /*    887 */
-  Parrot_stringinfo_i_sc_i,                          /*    888 */
-  Parrot_stringinfo_i_s_ic,                          /*    889 */
-  Parrot_stringinfo_i_sc_ic,                         /*    890 */
-  Parrot_upcase_s_s,                                 /*    891 */
-  Parrot_upcase_s_sc,                                /*    892 */
-  Parrot_downcase_s_s,                               /*    893 */
-  Parrot_downcase_s_sc,                              /*    894 */
-  Parrot_titlecase_s_s,                              /*    895 */
-  Parrot_titlecase_s_sc,                             /*    896 */
-  Parrot_foldcase_s_s,                               /*    897 */
-  Parrot_foldcase_s_sc,                              /*    898 */
-  Parrot_join_s_s_p,                                 /*    899 */
-  Parrot_join_s_sc_p,                                /*    900 */
-  Parrot_split_p_s_s,                                /*    901 */
-  Parrot_split_p_sc_s,                               /*    902 */
-  Parrot_split_p_s_sc,                               /*    903 */
-  Parrot_split_p_sc_sc,                              /*    904 */
-  Parrot_encoding_i_s,                               /*    905 */
-  Parrot_encoding_i_sc,                              /*    906 */
-  Parrot_encodingname_s_i,                           /*    907 */
-  Parrot_encodingname_s_ic,                          /*    908 */
-  Parrot_find_encoding_i_s,                          /*    909 */
-  Parrot_find_encoding_i_sc,                         /*    910 */
-  Parrot_trans_encoding_s_s_i,                       /*    911 */
-  Parrot_trans_encoding_s_sc_i,                      /*    912 */
-  Parrot_trans_encoding_s_s_ic,                      /*    913 */
-  Parrot_trans_encoding_s_sc_ic,                     /*    914 */
-  Parrot_is_cclass_i_i_s_i,                          /*    915 */
-  Parrot_is_cclass_i_ic_s_i,                         /*    916 */
-  Parrot_is_cclass_i_i_sc_i,                         /*    917 */
-  Parrot_is_cclass_i_ic_sc_i,                        /*    918 */
-  Parrot_is_cclass_i_i_s_ic,                         /*    919 */
-  Parrot_is_cclass_i_ic_s_ic,                        /*    920 */
-  Parrot_is_cclass_i_i_sc_ic,                        /*    921 */
-  Parrot_is_cclass_i_ic_sc_ic,                       /*    922 */
-  Parrot_find_cclass_i_i_s_i_i,                      /*    923 */
-  Parrot_find_cclass_i_ic_s_i_i,                     /*    924 */
-  Parrot_find_cclass_i_i_sc_i_i,                     /*    925 */
-  Parrot_find_cclass_i_ic_sc_i_i,                    /*    926 */
-  Parrot_find_cclass_i_i_s_ic_i,                     /*    927 */
-  Parrot_find_cclass_i_ic_s_ic_i,                    /*    928 */
-  Parrot_find_cclass_i_i_sc_ic_i,                    /*    929 */
-  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    930 */
-  Parrot_find_cclass_i_i_s_i_ic,                     /*    931 */
-  Parrot_find_cclass_i_ic_s_i_ic,                    /*    932 */
-  Parrot_find_cclass_i_i_sc_i_ic,                    /*    933 */
-  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    934 */
-  Parrot_find_cclass_i_i_s_ic_ic,                    /*    935 */
-  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    936 */
-  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    937 */
-  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    938 */
-  Parrot_find_not_cclass_i_i_s_i_i,                  /*    939 */
-  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    940 */
-  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    941 */
-  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    942 */
-  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    943 */
-  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    944 */
-  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    945 */
-  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    946 */
-  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    947 */
-  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    948 */
-  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    949 */
-  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    950 */
-  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    951 */
-  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    952 */
-  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    953 */
-  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    954 */
-  Parrot_escape_s_s,                                 /*    955 */
-  Parrot_compose_s_s,                                /*    956 */
-  Parrot_compose_s_sc,                               /*    957 */
-  Parrot_find_codepoint_i_s,                         /*    958 */
-  Parrot_find_codepoint_i_sc,                        /*    959 */
-  Parrot_spawnw_i_s,                                 /*    960 */
-  Parrot_spawnw_i_sc,                                /*    961 */
-  Parrot_spawnw_i_p,                                 /*    962 */
-  Parrot_err_i,                                      /*    963 */
-  Parrot_err_s,                                      /*    964 */
-  Parrot_err_s_i,                                    /*    965 */
-  Parrot_err_s_ic,                                   /*    966 */
-  Parrot_time_i,                                     /*    967 */
-  Parrot_time_n,                                     /*    968 */
-  Parrot_sleep_i,                                    /*    969 */
-  Parrot_sleep_ic,                                   /*    970 */
-  Parrot_sleep_n,                                    /*    971 */
-  Parrot_sleep_nc,                                   /*    972 */
-  Parrot_store_lex_s_p,                              /*    973 */
-  Parrot_store_lex_sc_p,                             /*    974 */
-  Parrot_store_lex_s_s,                              /*    975 */
-  Parrot_store_lex_sc_s,                             /*    976 */
-  Parrot_store_lex_s_sc,                             /*    977 */
-  Parrot_store_lex_sc_sc,                            /*    978 */
-  Parrot_store_lex_s_i,                              /*    979 */
-  Parrot_store_lex_sc_i,                             /*    980 */
-  Parrot_store_lex_s_ic,                             /*    981 */
-  Parrot_store_lex_sc_ic,                            /*    982 */
-  Parrot_store_lex_s_n,                              /*    983 */
-  Parrot_store_lex_sc_n,                             /*    984 */
-  Parrot_store_lex_s_nc,                             /*    985 */
-  Parrot_store_lex_sc_nc,                            /*    986 */
-  Parrot_store_dynamic_lex_s_p,                      /*    987 */
-  Parrot_store_dynamic_lex_sc_p,                     /*    988 */
-  Parrot_find_lex_p_s,                               /*    989 */
-  Parrot_find_lex_p_sc,                              /*    990 */
-  Parrot_find_lex_s_s,                               /*    991 */
-  Parrot_find_lex_s_sc,                              /*    992 */
-  Parrot_find_lex_i_s,                               /*    993 */
-  Parrot_find_lex_i_sc,                              /*    994 */
-  Parrot_find_lex_n_s,                               /*    995 */
-  Parrot_find_lex_n_sc,                              /*    996 */
-  Parrot_find_dynamic_lex_p_s,                       /*    997 */
-  Parrot_find_dynamic_lex_p_sc,                      /*    998 */
-  Parrot_find_caller_lex_p_s,                        /*    999 */
-  Parrot_find_caller_lex_p_sc,                       /*   1000 */
-  Parrot_get_namespace_p,                            /*   1001 */
-  Parrot_get_namespace_p_p,                          /*   1002 */
-  Parrot_get_namespace_p_pc,                         /*   1003 */
-  Parrot_get_hll_namespace_p,                        /*   1004 */
-  Parrot_get_hll_namespace_p_p,                      /*   1005 */
-  Parrot_get_hll_namespace_p_pc,                     /*   1006 */
-  Parrot_get_root_namespace_p,                       /*   1007 */
-  Parrot_get_root_namespace_p_p,                     /*   1008 */
-  Parrot_get_root_namespace_p_pc,                    /*   1009 */
-  Parrot_get_global_p_s,                             /*   1010 */
-  Parrot_get_global_p_sc,                            /*   1011 */
-  Parrot_get_global_p_p_s,                           /*   1012 */
-  Parrot_get_global_p_pc_s,                          /*   1013 */
-  Parrot_get_global_p_p_sc,                          /*   1014 */
-  Parrot_get_global_p_pc_sc,                         /*   1015 */
-  Parrot_get_hll_global_p_s,                         /*   1016 */
-  Parrot_get_hll_global_p_sc,                        /*   1017 */
-  Parrot_get_hll_global_p_p_s,                       /*   1018 */
-  Parrot_get_hll_global_p_pc_s,                      /*   1019 */
-  Parrot_get_hll_global_p_p_sc,                      /*   1020 */
-  Parrot_get_hll_global_p_pc_sc,                     /*   1021 */
-  Parrot_get_root_global_p_s,                        /*   1022 */
-  Parrot_get_root_global_p_sc,                       /*   1023 */
-  Parrot_get_root_global_p_p_s,                      /*   1024 */
-  Parrot_get_root_global_p_pc_s,                     /*   1025 */
-  Parrot_get_root_global_p_p_sc,                     /*   1026 */
-  Parrot_get_root_global_p_pc_sc,                    /*   1027 */
-  Parrot_set_global_s_p,                             /*   1028 */
-  Parrot_set_global_sc_p,                            /*   1029 */
-  Parrot_set_global_p_s_p,                           /*   1030 */
-  Parrot_set_global_pc_s_p,                          /*   1031 */
-  Parrot_set_global_p_sc_p,                          /*   1032 */
-  Parrot_set_global_pc_sc_p,                         /*   1033 */
-  Parrot_set_hll_global_s_p,                         /*   1034 */
-  Parrot_set_hll_global_sc_p,                        /*   1035 */
-  Parrot_set_hll_global_p_s_p,                       /*   1036 */
-  Parrot_set_hll_global_pc_s_p,                      /*   1037 */
-  Parrot_set_hll_global_p_sc_p,                      /*   1038 */
-  Parrot_set_hll_global_pc_sc_p,                     /*   1039 */
-  Parrot_set_root_global_s_p,                        /*   1040 */
-  Parrot_set_root_global_sc_p,                       /*   1041 */
-  Parrot_set_root_global_p_s_p,                      /*   1042 */
-  Parrot_set_root_global_pc_s_p,                     /*   1043 */
-  Parrot_set_root_global_p_sc_p,                     /*   1044 */
-  Parrot_set_root_global_pc_sc_p,                    /*   1045 */
-  Parrot_find_name_p_s,                              /*   1046 */
-  Parrot_find_name_p_sc,                             /*   1047 */
-  Parrot_find_sub_not_null_p_s,                      /*   1048 */
-  Parrot_find_sub_not_null_p_sc,                     /*   1049 */
-  Parrot_trap,                                       /*   1050 */
-  Parrot_set_label_p_ic,                             /*   1051 */
-  Parrot_get_label_i_p,                              /*   1052 */
-  Parrot_get_id_i_p,                                 /*   1053 */
-  Parrot_get_id_i_pc,                                /*   1054 */
-  Parrot_fetch_p_p_p_p,                              /*   1055 */
-  Parrot_fetch_p_pc_p_p,                             /*   1056 */
-  Parrot_fetch_p_p_pc_p,                             /*   1057 */
-  Parrot_fetch_p_pc_pc_p,                            /*   1058 */
-  Parrot_fetch_p_p_p_pc,                             /*   1059 */
-  Parrot_fetch_p_pc_p_pc,                            /*   1060 */
-  Parrot_fetch_p_p_pc_pc,                            /*   1061 */
-  Parrot_fetch_p_pc_pc_pc,                           /*   1062 */
-  Parrot_fetch_p_p_i_p,                              /*   1063 */
-  Parrot_fetch_p_pc_i_p,                             /*   1064 */
-  Parrot_fetch_p_p_ic_p,                             /*   1065 */
-  Parrot_fetch_p_pc_ic_p,                            /*   1066 */
-  Parrot_fetch_p_p_i_pc,                             /*   1067 */
-  Parrot_fetch_p_pc_i_pc,                            /*   1068 */
-  Parrot_fetch_p_p_ic_pc,                            /*   1069 */
-  Parrot_fetch_p_pc_ic_pc,                           /*   1070 */
-  Parrot_fetch_p_p_s_p,                              /*   1071 */
-  Parrot_fetch_p_pc_s_p,                             /*   1072 */
-  Parrot_fetch_p_p_sc_p,                             /*   1073 */
-  Parrot_fetch_p_pc_sc_p,                            /*   1074 */
-  Parrot_fetch_p_p_s_pc,                             /*   1075 */
-  Parrot_fetch_p_pc_s_pc,                            /*   1076 */
-  Parrot_fetch_p_p_sc_pc,                            /*   1077 */
-  Parrot_fetch_p_pc_sc_pc,                           /*   1078 */
-  Parrot_vivify_p_p_p_p,                             /*   1079 */
-  Parrot_vivify_p_pc_p_p,                            /*   1080 */
-  Parrot_vivify_p_p_pc_p,                            /*   1081 */
-  Parrot_vivify_p_pc_pc_p,                           /*   1082 */
-  Parrot_vivify_p_p_p_pc,                            /*   1083 */
-  Parrot_vivify_p_pc_p_pc,                           /*   1084 */
-  Parrot_vivify_p_p_pc_pc,                           /*   1085 */
-  Parrot_vivify_p_pc_pc_pc,                          /*   1086 */
-  Parrot_vivify_p_p_i_p,                             /*   1087 */
-  Parrot_vivify_p_pc_i_p,                            /*   1088 */
-  Parrot_vivify_p_p_ic_p,                            /*   1089 */
-  Parrot_vivify_p_pc_ic_p,                           /*   1090 */
-  Parrot_vivify_p_p_i_pc,                            /*   1091 */
-  Parrot_vivify_p_pc_i_pc,                           /*   1092 */
-  Parrot_vivify_p_p_ic_pc,                           /*   1093 */
-  Parrot_vivify_p_pc_ic_pc,                          /*   1094 */
-  Parrot_vivify_p_p_s_p,                             /*   1095 */
-  Parrot_vivify_p_pc_s_p,                            /*   1096 */
-  Parrot_vivify_p_p_sc_p,                            /*   1097 */
-  Parrot_vivify_p_pc_sc_p,                           /*   1098 */
-  Parrot_vivify_p_p_s_pc,                            /*   1099 */
-  Parrot_vivify_p_pc_s_pc,                           /*   1100 */
-  Parrot_vivify_p_p_sc_pc,                           /*   1101 */
-  Parrot_vivify_p_pc_sc_pc,                          /*   1102 */
-  Parrot_new_p_s_i,                                  /*   1103 */
-  Parrot_new_p_sc_i,                                 /*   1104 */
-  Parrot_new_p_s_ic,                                 /*   1105 */
-  Parrot_new_p_sc_ic,                                /*   1106 */
-  Parrot_new_p_p_i,                                  /*   1107 */
-  Parrot_new_p_pc_i,                                 /*   1108 */
-  Parrot_new_p_p_ic,                                 /*   1109 */
-  Parrot_new_p_pc_ic,                                /*   1110 */
-  Parrot_root_new_p_p_i,                             /*   1111 */
-  Parrot_root_new_p_pc_i,                            /*   1112 */
-  Parrot_root_new_p_p_ic,                            /*   1113 */
-  Parrot_root_new_p_pc_ic,                           /*   1114 */
-  Parrot_get_context_p,                              /*   1115 */
-  Parrot_new_call_context_p,                         /*   1116 */
-  Parrot_invokecc_p_p,                               /*   1117 */
-  Parrot_flatten_array_into_p_p_i,                   /*   1118 */
-  Parrot_flatten_array_into_p_p_ic,                  /*   1119 */
-  Parrot_flatten_hash_into_p_p_i,                    /*   1120 */
-  Parrot_flatten_hash_into_p_p_ic,                   /*   1121 */
-  Parrot_slurp_array_from_p_p_i,                     /*   1122 */
-  Parrot_slurp_array_from_p_p_ic,                    /*   1123 */
-  Parrot_receive_p,                                  /*   1124 */
-  Parrot_wait_p,                                     /*   1125 */
-  Parrot_wait_pc,                                    /*   1126 */
-  Parrot_pass,                                       /*   1127 */
-  Parrot_disable_preemption,                         /*   1128 */
-  Parrot_enable_preemption,                          /*   1129 */
-  Parrot_terminate,                                  /*   1130 */
+  Parrot_freeze_p_p,                                 /*    677 */
+  Parrot_thaw_p_p,                                   /*    678 */
+  Parrot_add_multi_s_s_p,                            /*    679 */
+  Parrot_add_multi_sc_s_p,                           /*    680 */
+  Parrot_add_multi_s_sc_p,                           /*    681 */
+  Parrot_add_multi_sc_sc_p,                          /*    682 */
+  Parrot_find_multi_p_s_s,                           /*    683 */
+  Parrot_find_multi_p_sc_s,                          /*    684 */
+  Parrot_find_multi_p_s_sc,                          /*    685 */
+  Parrot_find_multi_p_sc_sc,                         /*    686 */
+  Parrot_register_p,                                 /*    687 */
+  Parrot_unregister_p,                               /*    688 */
+  Parrot_box_p_i,                                    /*    689 */
+  Parrot_box_p_ic,                                   /*    690 */
+  Parrot_box_p_n,                                    /*    691 */
+  Parrot_box_p_nc,                                   /*    692 */
+  Parrot_box_p_s,                                    /*    693 */
+  Parrot_box_p_sc,                                   /*    694 */
+  Parrot_iter_p_p,                                   /*    695 */
+  Parrot_morph_p_p,                                  /*    696 */
+  Parrot_morph_p_pc,                                 /*    697 */
+  Parrot_clone_s_s,                                  /*    698 */
+  Parrot_clone_s_sc,                                 /*    699 */
+  Parrot_set_i_i,                                    /*    700 */
+  Parrot_set_i_ic,                                   /*    701 */
+  Parrot_set_i_n,                                    /*    702 */
+  Parrot_set_i_nc,                                   /*    703 */
+  Parrot_set_i_s,                                    /*    704 */
+  Parrot_set_i_sc,                                   /*    705 */
+  Parrot_set_n_n,                                    /*    706 */
+  Parrot_set_n_nc,                                   /*    707 */
+  Parrot_set_n_i,                                    /*    708 */
+  Parrot_set_n_ic,                                   /*    709 */
+  Parrot_set_n_s,                                    /*    710 */
+  Parrot_set_n_sc,                                   /*    711 */
+  Parrot_set_n_p,                                    /*    712 */
+  Parrot_set_s_p,                                    /*    713 */
+  Parrot_set_s_s,                                    /*    714 */
+  Parrot_set_s_sc,                                   /*    715 */
+  Parrot_set_s_i,                                    /*    716 */
+  Parrot_set_s_ic,                                   /*    717 */
+  Parrot_set_s_n,                                    /*    718 */
+  Parrot_set_s_nc,                                   /*    719 */
+  Parrot_set_p_pc,                                   /*    720 */
+  Parrot_set_p_p,                                    /*    721 */
+  Parrot_set_p_i,                                    /*    722 */
+  Parrot_set_p_ic,                                   /*    723 */
+  Parrot_set_p_n,                                    /*    724 */
+  Parrot_set_p_nc,                                   /*    725 */
+  Parrot_set_p_s,                                    /*    726 */
+  Parrot_set_p_sc,                                   /*    727 */
+  Parrot_set_i_p,                                    /*    728 */
+  Parrot_assign_p_p,                                 /*    729 */
+  Parrot_assign_p_i,                                 /*    730 */
+  Parrot_assign_p_ic,                                /*    731 */
+  Parrot_assign_p_n,                                 /*    732 */
+  Parrot_assign_p_nc,                                /*    733 */
+  Parrot_assign_p_s,                                 /*    734 */
+  Parrot_assign_p_sc,                                /*    735 */
+  Parrot_assign_s_s,                                 /*    736 */
+  Parrot_assign_s_sc,                                /*    737 */
+  Parrot_setref_p_p,                                 /*    738 */
+  Parrot_deref_p_p,                                  /*    739 */
+  Parrot_set_p_ki_i,                                 /*    740 */
+  Parrot_set_p_kic_i,                                /*    741 */
+  Parrot_set_p_ki_ic,                                /*    742 */
+  Parrot_set_p_kic_ic,                               /*    743 */
+  Parrot_set_p_ki_n,                                 /*    744 */
+  Parrot_set_p_kic_n,                                /*    745 */
+  Parrot_set_p_ki_nc,                                /*    746 */
+  Parrot_set_p_kic_nc,                               /*    747 */
+  Parrot_set_p_ki_s,                                 /*    748 */
+  Parrot_set_p_kic_s,                                /*    749 */
+  Parrot_set_p_ki_sc,                                /*    750 */
+  Parrot_set_p_kic_sc,                               /*    751 */
+  Parrot_set_p_ki_p,                                 /*    752 */
+  Parrot_set_p_kic_p,                                /*    753 */
+  Parrot_set_i_p_ki,                                 /*    754 */
+  Parrot_set_i_p_kic,                                /*    755 */
+  Parrot_set_n_p_ki,                                 /*    756 */
+  Parrot_set_n_p_kic,                                /*    757 */
+  Parrot_set_s_p_ki,                                 /*    758 */
+  Parrot_set_s_p_kic,                                /*    759 */
+  Parrot_set_p_p_ki,                                 /*    760 */
+  Parrot_set_p_p_kic,                                /*    761 */
+  Parrot_set_p_k_i,                                  /*    762 */
+  Parrot_set_p_kc_i,                                 /*    763 */
+  Parrot_set_p_k_ic,                                 /*    764 */
+  Parrot_set_p_kc_ic,                                /*    765 */
+  Parrot_set_p_k_n,                                  /*    766 */
+  Parrot_set_p_kc_n,                                 /*    767 */
+  Parrot_set_p_k_nc,                                 /*    768 */
+  Parrot_set_p_kc_nc,                                /*    769 */
+  Parrot_set_p_k_s,                                  /*    770 */
+  Parrot_set_p_kc_s,                                 /*    771 */
+  Parrot_set_p_k_sc,                                 /*    772 */
+  Parrot_set_p_kc_sc,                                /*    773 */
+  Parrot_set_p_k_p,                                  /*    774 */
+  Parrot_set_p_kc_p,                                 /*    775 */
+  Parrot_set_i_p_k,                                  /*    776 */
+  Parrot_set_i_p_kc,                                 /*    777 */
+  Parrot_set_n_p_k,                                  /*    778 */
+  Parrot_set_n_p_kc,                                 /*    779 */
+  Parrot_set_s_p_k,                                  /*    780 */
+  Parrot_set_s_p_kc,                                 /*    781 */
+  Parrot_set_p_p_k,                                  /*    782 */
+  Parrot_set_p_p_kc,                                 /*    783 */
+  Parrot_clone_p_p,                                  /*    784 */
+  Parrot_clone_p_p_p,                                /*    785 */
+  Parrot_clone_p_p_pc,                               /*    786 */
+  Parrot_copy_p_p,                                   /*    787 */
+  Parrot_null_s,                                     /*    788 */
+  Parrot_null_i,                                     /*    789 */
+  Parrot_null_p,                                     /*    790 */
+  Parrot_null_n,                                     /*    791 */
+  Parrot_ord_i_s,                                    /*    792 */
+  Parrot_ord_i_sc,                                   /*    793 */
+  Parrot_ord_i_s_i,                                  /*    794 */
+  Parrot_ord_i_sc_i,                                 /*    795 */
+  Parrot_ord_i_s_ic,                                 /*    796 */
+  Parrot_ord_i_sc_ic,                                /*    797 */
+  Parrot_chr_s_i,                                    /*    798 */
+  Parrot_chr_s_ic,                                   /*    799 */
+  Parrot_chopn_s_s_i,                                /*    800 */
+  Parrot_chopn_s_sc_i,                               /*    801 */
+  Parrot_chopn_s_s_ic,                               /*    802 */
+  Parrot_chopn_s_sc_ic,                              /*    803 */
+  Parrot_concat_p_p,                                 /*    804 */
+  Parrot_concat_p_s,                                 /*    805 */
+  Parrot_concat_p_sc,                                /*    806 */
+  Parrot_concat_s_s_s,                               /*    807 */
+  Parrot_concat_s_sc_s,                              /*    808 */
+  Parrot_concat_s_s_sc,                              /*    809 */
+  Parrot_concat_p_p_s,                               /*    810 */
+  Parrot_concat_p_p_sc,                              /*    811 */
+  Parrot_concat_p_p_p,                               /*    812 */
+  Parrot_repeat_s_s_i,                               /*    813 */
+  Parrot_repeat_s_sc_i,                              /*    814 */
+  Parrot_repeat_s_s_ic,                              /*    815 */
+  Parrot_repeat_s_sc_ic,                             /*    816 */
+  Parrot_repeat_p_p_i,                               /*    817 */
+  Parrot_repeat_p_p_ic,                              /*    818 */
+  Parrot_repeat_p_p_p,                               /*    819 */
+  Parrot_repeat_p_i,                                 /*    820 */
+  Parrot_repeat_p_ic,                                /*    821 */
+  Parrot_repeat_p_p,                                 /*    822 */
+  Parrot_length_i_s,                                 /*    823 */
+  Parrot_length_i_sc,                                /*    824 */
+  Parrot_bytelength_i_s,                             /*    825 */
+  Parrot_bytelength_i_sc,                            /*    826 */
+  Parrot_pin_s,                                      /*    827 */
+  Parrot_unpin_s,                                    /*    828 */
+  Parrot_substr_s_s_i,                               /*    829 */
+  Parrot_substr_s_sc_i,                              /*    830 */
+  Parrot_substr_s_s_ic,                              /*    831 */
+  Parrot_substr_s_sc_ic,                             /*    832 */
+  Parrot_substr_s_s_i_i,                             /*    833 */
+  Parrot_substr_s_sc_i_i,                            /*    834 */
+  Parrot_substr_s_s_ic_i,                            /*    835 */
+  Parrot_substr_s_sc_ic_i,                           /*    836 */
+  Parrot_substr_s_s_i_ic,                            /*    837 */
+  Parrot_substr_s_sc_i_ic,                           /*    838 */
+  Parrot_substr_s_s_ic_ic,                           /*    839 */
+  Parrot_substr_s_sc_ic_ic,                          /*    840 */
+  Parrot_substr_s_p_i_i,                             /*    841 */
+  Parrot_substr_s_p_ic_i,                            /*    842 */
+  Parrot_substr_s_p_i_ic,                            /*    843 */
+  Parrot_substr_s_p_ic_ic,                           /*    844 */
+  Parrot_replace_s_s_i_i_s,                          /*    845 */
+  Parrot_replace_s_sc_i_i_s,                         /*    846 */
+  Parrot_replace_s_s_ic_i_s,                         /*    847 */
+  Parrot_replace_s_sc_ic_i_s,                        /*    848 */
+  Parrot_replace_s_s_i_ic_s,                         /*    849 */
+  Parrot_replace_s_sc_i_ic_s,                        /*    850 */
+  Parrot_replace_s_s_ic_ic_s,                        /*    851 */
+  Parrot_replace_s_sc_ic_ic_s,                       /*    852 */
+  Parrot_replace_s_s_i_i_sc,                         /*    853 */
+  Parrot_replace_s_sc_i_i_sc,                        /*    854 */
+  Parrot_replace_s_s_ic_i_sc,                        /*    855 */
+  Parrot_replace_s_sc_ic_i_sc,                       /*    856 */
+  Parrot_replace_s_s_i_ic_sc,                        /*    857 */
+  Parrot_replace_s_sc_i_ic_sc,                       /*    858 */
+  Parrot_replace_s_s_ic_ic_sc,                       /*    859 */
+  Parrot_replace_s_sc_ic_ic_sc,                      /*    860 */
+  Parrot_index_i_s_s,                                /*    861 */
+  Parrot_index_i_sc_s,                               /*    862 */
+  Parrot_index_i_s_sc,                               /*    863 */
+  Parrot_index_i_sc_sc,                              /*    864 */
+  Parrot_index_i_s_s_i,                              /*    865 */
+  Parrot_index_i_sc_s_i,                             /*    866 */
+  Parrot_index_i_s_sc_i,                             /*    867 */
+  Parrot_index_i_sc_sc_i,                            /*    868 */
+  Parrot_index_i_s_s_ic,                             /*    869 */
+  Parrot_index_i_sc_s_ic,                            /*    870 */
+  Parrot_index_i_s_sc_ic,                            /*    871 */
+  Parrot_index_i_sc_sc_ic,                           /*    872 */
+  Parrot_rindex_i_s_s,                               /*    873 */
+  Parrot_rindex_i_sc_s,                              /*    874 */
+  Parrot_rindex_i_s_sc,                              /*    875 */
+  Parrot_rindex_i_sc_sc,                             /*    876 */
+  Parrot_rindex_i_s_s_i,                             /*    877 */
+  Parrot_rindex_i_sc_s_i,                            /*    878 */
+  Parrot_rindex_i_s_sc_i,                            /*    879 */
+  Parrot_rindex_i_sc_sc_i,                           /*    880 */
+  Parrot_rindex_i_s_s_ic,                            /*    881 */
+  Parrot_rindex_i_sc_s_ic,                           /*    882 */
+  Parrot_rindex_i_s_sc_ic,                           /*    883 */
+  Parrot_rindex_i_sc_sc_ic,                          /*    884 */
+  Parrot_sprintf_s_s_p,                              /*    885 */
+  Parrot_sprintf_s_sc_p,                             /*    886 */
+  Parrot_sprintf_p_p_p,                              /*    887 */
+  Parrot_new_s,                                      /*    888 */
+  Parrot_stringinfo_i_s_i,                           /*    889 */
+  Parrot_stringinfo_i_sc_i,                          /*    890 */
+  Parrot_stringinfo_i_s_ic,                          /*    891 */
+  Parrot_stringinfo_i_sc_ic,                         /*    892 */
+  Parrot_upcase_s_s,                                 /*    893 */
+  Parrot_upcase_s_sc,                                /*    894 */
+  Parrot_downcase_s_s,                               /*    895 */
+  Parrot_downcase_s_sc,                              /*    896 */
+  Parrot_titlecase_s_s,                              /*    897 */
+  Parrot_titlecase_s_sc,                             /*    898 */
+  Parrot_foldcase_s_s,                               /*    899 */
+  Parrot_foldcase_s_sc,                              /*    900 */
+  Parrot_join_s_s_p,                                 /*    901 */
+  Parrot_join_s_sc_p,                                /*    902 */
+  Parrot_split_p_s_s,                                /*    903 */
+  Parrot_split_p_sc_s,                               /*    904 */
+  Parrot_split_p_s_sc,                               /*    905 */
+  Parrot_split_p_sc_sc,                              /*    906 */
+  Parrot_encoding_i_s,                               /*    907 */
+  Parrot_encoding_i_sc,                              /*    908 */
+  Parrot_encodingname_s_i,                           /*    909 */
+  Parrot_encodingname_s_ic,                          /*    910 */
+  Parrot_find_encoding_i_s,                          /*    911 */
+  Parrot_find_encoding_i_sc,                         /*    912 */
+  Parrot_trans_encoding_s_s_i,                       /*    913 */
+  Parrot_trans_encoding_s_sc_i,                      /*    914 */
+  Parrot_trans_encoding_s_s_ic,                      /*    915 */
+  Parrot_trans_encoding_s_sc_ic,                     /*    916 */
+  Parrot_is_cclass_i_i_s_i,                          /*    917 */
+  Parrot_is_cclass_i_ic_s_i,                         /*    918 */
+  Parrot_is_cclass_i_i_sc_i,                         /*    919 */
+  Parrot_is_cclass_i_ic_sc_i,                        /*    920 */
+  Parrot_is_cclass_i_i_s_ic,                         /*    921 */
+  Parrot_is_cclass_i_ic_s_ic,                        /*    922 */
+  Parrot_is_cclass_i_i_sc_ic,                        /*    923 */
+  Parrot_is_cclass_i_ic_sc_ic,                       /*    924 */
+  Parrot_find_cclass_i_i_s_i_i,                      /*    925 */
+  Parrot_find_cclass_i_ic_s_i_i,                     /*    926 */
+  Parrot_find_cclass_i_i_sc_i_i,                     /*    927 */
+  Parrot_find_cclass_i_ic_sc_i_i,                    /*    928 */
+  Parrot_find_cclass_i_i_s_ic_i,                     /*    929 */
+  Parrot_find_cclass_i_ic_s_ic_i,                    /*    930 */
+  Parrot_find_cclass_i_i_sc_ic_i,                    /*    931 */
+  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    932 */
+  Parrot_find_cclass_i_i_s_i_ic,                     /*    933 */
+  Parrot_find_cclass_i_ic_s_i_ic,                    /*    934 */
+  Parrot_find_cclass_i_i_sc_i_ic,                    /*    935 */
+  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    936 */
+  Parrot_find_cclass_i_i_s_ic_ic,                    /*    937 */
+  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    938 */
+  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    939 */
+  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    940 */
+  Parrot_find_not_cclass_i_i_s_i_i,                  /*    941 */
+  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    942 */
+  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    943 */
+  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    944 */
+  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    945 */
+  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    946 */
+  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    947 */
+  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    948 */
+  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    949 */
+  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    950 */
+  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    951 */
+  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    952 */
+  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    953 */
+  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    954 */
+  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    955 */
+  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    956 */
+  Parrot_escape_s_s,                                 /*    957 */
+  Parrot_compose_s_s,                                /*    958 */
+  Parrot_compose_s_sc,                               /*    959 */
+  Parrot_find_codepoint_i_s,                         /*    960 */
+  Parrot_find_codepoint_i_sc,                        /*    961 */
+  Parrot_spawnw_i_s,                                 /*    962 */
+  Parrot_spawnw_i_sc,                                /*    963 */
+  Parrot_spawnw_i_p,                                 /*    964 */
+  Parrot_err_i,                                      /*    965 */
+  Parrot_err_s,                                      /*    966 */
+  Parrot_err_s_i,                                    /*    967 */
+  Parrot_err_s_ic,                                   /*    968 */
+  Parrot_time_i,                                     /*    969 */
+  Parrot_time_n,                                     /*    970 */
+  Parrot_sleep_i,                                    /*    971 */
+  Parrot_sleep_ic,                                   /*    972 */
+  Parrot_sleep_n,                                    /*    973 */
+  Parrot_sleep_nc,                                   /*    974 */
+  Parrot_store_lex_s_p,                              /*    975 */
+  Parrot_store_lex_sc_p,                             /*    976 */
+  Parrot_store_lex_s_s,                              /*    977 */
+  Parrot_store_lex_sc_s,                             /*    978 */
+  Parrot_store_lex_s_sc,                             /*    979 */
+  Parrot_store_lex_sc_sc,                            /*    980 */
+  Parrot_store_lex_s_i,                              /*    981 */
+  Parrot_store_lex_sc_i,                             /*    982 */
+  Parrot_store_lex_s_ic,                             /*    983 */
+  Parrot_store_lex_sc_ic,                            /*    984 */
+  Parrot_store_lex_s_n,                              /*    985 */
+  Parrot_store_lex_sc_n,                             /*    986 */
+  Parrot_store_lex_s_nc,                             /*    987 */
+  Parrot_store_lex_sc_nc,                            /*    988 */
+  Parrot_store_dynamic_lex_s_p,                      /*    989 */
+  Parrot_store_dynamic_lex_sc_p,                     /*    990 */
+  Parrot_find_lex_p_s,                               /*    991 */
+  Parrot_find_lex_p_sc,                              /*    992 */
+  Parrot_find_lex_s_s,                               /*    993 */
+  Parrot_find_lex_s_sc,                              /*    994 */
+  Parrot_find_lex_i_s,                               /*    995 */
+  Parrot_find_lex_i_sc,                              /*    996 */
+  Parrot_find_lex_n_s,                               /*    997 */
+  Parrot_find_lex_n_sc,                              /*    998 */
+  Parrot_find_lex_idx_p_sc_pc_ic_ic,                 /*    999 */
+  Parrot_find_lex_idx_s_sc_pc_ic_ic,                 /*   1000 */
+  Parrot_find_lex_idx_i_sc_pc_ic_ic,                 /*   1001 */
+  Parrot_find_lex_idx_n_sc_pc_ic_ic,                 /*   1002 */
+  Parrot_store_lex_idx_sc_p_pc_ic_ic,                /*   1003 */
+  Parrot_store_lex_idx_sc_s_pc_ic_ic,                /*   1004 */
+  Parrot_store_lex_idx_sc_sc_pc_ic_ic,               /*   1005 */
+  Parrot_store_lex_idx_sc_i_pc_ic_ic,                /*   1006 */
+  Parrot_store_lex_idx_sc_ic_pc_ic_ic,               /*   1007 */
+  Parrot_store_lex_idx_sc_n_pc_ic_ic,                /*   1008 */
+  Parrot_store_lex_idx_sc_nc_pc_ic_ic,               /*   1009 */
+  Parrot_find_dynamic_lex_p_s,                       /*   1010 */
+  Parrot_find_dynamic_lex_p_sc,                      /*   1011 */
+  Parrot_find_caller_lex_p_s,                        /*   1012 */
+  Parrot_find_caller_lex_p_sc,                       /*   1013 */
+  Parrot_get_namespace_p,                            /*   1014 */
+  Parrot_get_namespace_p_p,                          /*   1015 */
+  Parrot_get_namespace_p_pc,                         /*   1016 */
+  Parrot_get_hll_namespace_p,                        /*   1017 */
+  Parrot_get_hll_namespace_p_p,                      /*   1018 */
+  Parrot_get_hll_namespace_p_pc,                     /*   1019 */
+  Parrot_get_root_namespace_p,                       /*   1020 */
+  Parrot_get_root_namespace_p_p,                     /*   1021 */
+  Parrot_get_root_namespace_p_pc,                    /*   1022 */
+  Parrot_get_global_p_s,                             /*   1023 */
+  Parrot_get_global_p_sc,                            /*   1024 */
+  Parrot_get_global_p_p_s,                           /*   1025 */
+  Parrot_get_global_p_pc_s,                          /*   1026 */
+  Parrot_get_global_p_p_sc,                          /*   1027 */
+  Parrot_get_global_p_pc_sc,                         /*   1028 */
+  Parrot_get_hll_global_p_s,                         /*   1029 */
+  Parrot_get_hll_global_p_sc,                        /*   1030 */
+  Parrot_get_hll_global_p_p_s,                       /*   1031 */
+  Parrot_get_hll_global_p_pc_s,                      /*   1032 */
+  Parrot_get_hll_global_p_p_sc,                      /*   1033 */
+  Parrot_get_hll_global_p_pc_sc,                     /*   1034 */
+  Parrot_get_root_global_p_s,                        /*   1035 */
+  Parrot_get_root_global_p_sc,                       /*   1036 */
+  Parrot_get_root_global_p_p_s,                      /*   1037 */
+  Parrot_get_root_global_p_pc_s,                     /*   1038 */
+  Parrot_get_root_global_p_p_sc,                     /*   1039 */
+  Parrot_get_root_global_p_pc_sc,                    /*   1040 */
+  Parrot_get_global_ic_p_sc_ic,                      /*   1041 */
+  Parrot_get_global_ic_p_pc_sc_ic,                   /*   1042 */
+  Parrot_get_hll_global_ic_p_sc_ic,                  /*   1043 */
+  Parrot_get_hll_global_ic_p_pc_sc_ic,               /*   1044 */
+  Parrot_get_root_global_ic_p_sc_ic,                 /*   1045 */
+  Parrot_get_root_global_ic_p_pc_sc_ic,              /*   1046 */
+  Parrot_set_global_s_p,                             /*   1047 */
+  Parrot_set_global_sc_p,                            /*   1048 */
+  Parrot_set_global_p_s_p,                           /*   1049 */
+  Parrot_set_global_pc_s_p,                          /*   1050 */
+  Parrot_set_global_p_sc_p,                          /*   1051 */
+  Parrot_set_global_pc_sc_p,                         /*   1052 */
+  Parrot_set_hll_global_s_p,                         /*   1053 */
+  Parrot_set_hll_global_sc_p,                        /*   1054 */
+  Parrot_set_hll_global_p_s_p,                       /*   1055 */
+  Parrot_set_hll_global_pc_s_p,                      /*   1056 */
+  Parrot_set_hll_global_p_sc_p,                      /*   1057 */
+  Parrot_set_hll_global_pc_sc_p,                     /*   1058 */
+  Parrot_set_root_global_s_p,                        /*   1059 */
+  Parrot_set_root_global_sc_p,                       /*   1060 */
+  Parrot_set_root_global_p_s_p,                      /*   1061 */
+  Parrot_set_root_global_pc_s_p,                     /*   1062 */
+  Parrot_set_root_global_p_sc_p,                     /*   1063 */
+  Parrot_set_root_global_pc_sc_p,                    /*   1064 */
+  Parrot_find_name_p_s,                              /*   1065 */
+  Parrot_find_name_p_sc,                             /*   1066 */
+  Parrot_find_sub_not_null_p_s,                      /*   1067 */
+  Parrot_find_sub_not_null_p_sc,                     /*   1068 */
+  Parrot_trap,                                       /*   1069 */
+  Parrot_set_label_p_ic,                             /*   1070 */
+  Parrot_get_label_i_p,                              /*   1071 */
+  Parrot_get_id_i_p,                                 /*   1072 */
+  Parrot_get_id_i_pc,                                /*   1073 */
+  Parrot_fetch_p_p_p_p,                              /*   1074 */
+  Parrot_fetch_p_pc_p_p,                             /*   1075 */
+  Parrot_fetch_p_p_pc_p,                             /*   1076 */
+  Parrot_fetch_p_pc_pc_p,                            /*   1077 */
+  Parrot_fetch_p_p_p_pc,                             /*   1078 */
+  Parrot_fetch_p_pc_p_pc,                            /*   1079 */
+  Parrot_fetch_p_p_pc_pc,                            /*   1080 */
+  Parrot_fetch_p_pc_pc_pc,                           /*   1081 */
+  Parrot_fetch_p_p_i_p,                              /*   1082 */
+  Parrot_fetch_p_pc_i_p,                             /*   1083 */
+  Parrot_fetch_p_p_ic_p,                             /*   1084 */
+  Parrot_fetch_p_pc_ic_p,                            /*   1085 */
+  Parrot_fetch_p_p_i_pc,                             /*   1086 */
+  Parrot_fetch_p_pc_i_pc,                            /*   1087 */
+  Parrot_fetch_p_p_ic_pc,                            /*   1088 */
+  Parrot_fetch_p_pc_ic_pc,                           /*   1089 */
+  Parrot_fetch_p_p_s_p,                              /*   1090 */
+  Parrot_fetch_p_pc_s_p,                             /*   1091 */
+  Parrot_fetch_p_p_sc_p,                             /*   1092 */
+  Parrot_fetch_p_pc_sc_p,                            /*   1093 */
+  Parrot_fetch_p_p_s_pc,                             /*   1094 */
+  Parrot_fetch_p_pc_s_pc,                            /*   1095 */
+  Parrot_fetch_p_p_sc_pc,                            /*   1096 */
+  Parrot_fetch_p_pc_sc_pc,                           /*   1097 */
+  Parrot_vivify_p_p_p_p,                             /*   1098 */
+  Parrot_vivify_p_pc_p_p,                            /*   1099 */
+  Parrot_vivify_p_p_pc_p,                            /*   1100 */
+  Parrot_vivify_p_pc_pc_p,                           /*   1101 */
+  Parrot_vivify_p_p_p_pc,                            /*   1102 */
+  Parrot_vivify_p_pc_p_pc,                           /*   1103 */
+  Parrot_vivify_p_p_pc_pc,                           /*   1104 */
+  Parrot_vivify_p_pc_pc_pc,                          /*   1105 */
+  Parrot_vivify_p_p_i_p,                             /*   1106 */
+  Parrot_vivify_p_pc_i_p,                            /*   1107 */
+  Parrot_vivify_p_p_ic_p,                            /*   1108 */
+  Parrot_vivify_p_pc_ic_p,                           /*   1109 */
+  Parrot_vivify_p_p_i_pc,                            /*   1110 */
+  Parrot_vivify_p_pc_i_pc,                           /*   1111 */
+  Parrot_vivify_p_p_ic_pc,                           /*   1112 */
+  Parrot_vivify_p_pc_ic_pc,                          /*   1113 */
+  Parrot_vivify_p_p_s_p,                             /*   1114 */
+  Parrot_vivify_p_pc_s_p,                            /*   1115 */
+  Parrot_vivify_p_p_sc_p,                            /*   1116 */
+  Parrot_vivify_p_pc_sc_p,                           /*   1117 */
+  Parrot_vivify_p_p_s_pc,                            /*   1118 */
+  Parrot_vivify_p_pc_s_pc,                           /*   1119 */
+  Parrot_vivify_p_p_sc_pc,                           /*   1120 */
+  Parrot_vivify_p_pc_sc_pc,                          /*   1121 */
+  Parrot_new_p_s_i,                                  /*   1122 */
+  Parrot_new_p_sc_i,                                 /*   1123 */
+  Parrot_new_p_s_ic,                                 /*   1124 */
+  Parrot_new_p_sc_ic,                                /*   1125 */
+  Parrot_new_p_p_i,                                  /*   1126 */
+  Parrot_new_p_pc_i,                                 /*   1127 */
+  Parrot_new_p_p_ic,                                 /*   1128 */
+  Parrot_new_p_pc_ic,                                /*   1129 */
+  Parrot_root_new_p_p_i,                             /*   1130 */
+  Parrot_root_new_p_pc_i,                            /*   1131 */
+  Parrot_root_new_p_p_ic,                            /*   1132 */
+  Parrot_root_new_p_pc_ic,                           /*   1133 */
+  Parrot_get_context_p,                              /*   1134 */
+  Parrot_new_call_context_p,                         /*   1135 */
+  Parrot_invokecc_p_p,                               /*   1136 */
+  Parrot_flatten_array_into_p_p_i,                   /*   1137 */
+  Parrot_flatten_array_into_p_p_ic,                  /*   1138 */
+  Parrot_flatten_hash_into_p_p_i,                    /*   1139 */
+  Parrot_flatten_hash_into_p_p_ic,                   /*   1140 */
+  Parrot_slurp_array_from_p_p_i,                     /*   1141 */
+  Parrot_slurp_array_from_p_p_ic,                    /*   1142 */
+  Parrot_receive_p,                                  /*   1143 */
+  Parrot_wait_p,                                     /*   1144 */
+  Parrot_wait_pc,                                    /*   1145 */
+  Parrot_pass,                                       /*   1146 */
+  Parrot_disable_preemption,                         /*   1147 */
+  Parrot_enable_preemption,                          /*   1148 */
+  Parrot_terminate,                                  /*   1149 */
+  Parrot_throw_control_i,                            /*   1150 */
+  Parrot_throw_control_ic,                           /*   1151 */
+  Parrot_throw_control_i_p,                          /*   1152 */
+  Parrot_throw_control_ic_p,                         /*   1153 */
+  Parrot_resume_p_p,                                 /*   1154 */
+  Parrot_yield_p,                                    /*   1155 */
+  Parrot_share_ro_p_p,                               /*   1156 */
 
   NULL /* NULL function pointer */
 };
@@ -1227,7 +1254,7 @@ static op_func_t core_op_func_table[1132] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1132] = {
+static op_info_t core_op_info_table[1158] = {
   { /* 0 */
     "end",
     "end",
@@ -8676,6 +8703,28 @@ static op_info_t core_op_info_table[1132] = {
     &core_op_lib
   },
   { /* 677 */
+    "freeze",
+    "freeze_p_p",
+    "Parrot_freeze_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 678 */
+    "thaw",
+    "thaw_p_p",
+    "Parrot_thaw_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 679 */
     "add_multi",
     "add_multi_s_s_p",
     "Parrot_add_multi_s_s_p",
@@ -8686,7 +8735,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 678 */
+  { /* 680 */
     "add_multi",
     "add_multi_sc_s_p",
     "Parrot_add_multi_sc_s_p",
@@ -8697,7 +8746,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 679 */
+  { /* 681 */
     "add_multi",
     "add_multi_s_sc_p",
     "Parrot_add_multi_s_sc_p",
@@ -8708,7 +8757,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 680 */
+  { /* 682 */
     "add_multi",
     "add_multi_sc_sc_p",
     "Parrot_add_multi_sc_sc_p",
@@ -8719,7 +8768,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 681 */
+  { /* 683 */
     "find_multi",
     "find_multi_p_s_s",
     "Parrot_find_multi_p_s_s",
@@ -8730,7 +8779,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 682 */
+  { /* 684 */
     "find_multi",
     "find_multi_p_sc_s",
     "Parrot_find_multi_p_sc_s",
@@ -8741,7 +8790,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 683 */
+  { /* 685 */
     "find_multi",
     "find_multi_p_s_sc",
     "Parrot_find_multi_p_s_sc",
@@ -8752,7 +8801,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 684 */
+  { /* 686 */
     "find_multi",
     "find_multi_p_sc_sc",
     "Parrot_find_multi_p_sc_sc",
@@ -8763,7 +8812,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 685 */
+  { /* 687 */
     "register",
     "register_p",
     "Parrot_register_p",
@@ -8774,7 +8823,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 686 */
+  { /* 688 */
     "unregister",
     "unregister_p",
     "Parrot_unregister_p",
@@ -8785,7 +8834,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 687 */
+  { /* 689 */
     "box",
     "box_p_i",
     "Parrot_box_p_i",
@@ -8796,7 +8845,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 688 */
+  { /* 690 */
     "box",
     "box_p_ic",
     "Parrot_box_p_ic",
@@ -8807,7 +8856,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 689 */
+  { /* 691 */
     "box",
     "box_p_n",
     "Parrot_box_p_n",
@@ -8818,7 +8867,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 690 */
+  { /* 692 */
     "box",
     "box_p_nc",
     "Parrot_box_p_nc",
@@ -8829,7 +8878,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 691 */
+  { /* 693 */
     "box",
     "box_p_s",
     "Parrot_box_p_s",
@@ -8840,7 +8889,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 692 */
+  { /* 694 */
     "box",
     "box_p_sc",
     "Parrot_box_p_sc",
@@ -8851,7 +8900,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 693 */
+  { /* 695 */
     "iter",
     "iter_p_p",
     "Parrot_iter_p_p",
@@ -8862,7 +8911,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 694 */
+  { /* 696 */
     "morph",
     "morph_p_p",
     "Parrot_morph_p_p",
@@ -8873,7 +8922,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 695 */
+  { /* 697 */
     "morph",
     "morph_p_pc",
     "Parrot_morph_p_pc",
@@ -8884,7 +8933,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 696 */
+  { /* 698 */
     "clone",
     "clone_s_s",
     "Parrot_clone_s_s",
@@ -8895,7 +8944,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 697 */
+  { /* 699 */
     "clone",
     "clone_s_sc",
     "Parrot_clone_s_sc",
@@ -8906,7 +8955,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 698 */
+  { /* 700 */
     "set",
     "set_i_i",
     "Parrot_set_i_i",
@@ -8917,7 +8966,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 699 */
+  { /* 701 */
     "set",
     "set_i_ic",
     "Parrot_set_i_ic",
@@ -8928,7 +8977,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 700 */
+  { /* 702 */
     "set",
     "set_i_n",
     "Parrot_set_i_n",
@@ -8939,7 +8988,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 701 */
+  { /* 703 */
     "set",
     "set_i_nc",
     "Parrot_set_i_nc",
@@ -8950,7 +8999,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 702 */
+  { /* 704 */
     "set",
     "set_i_s",
     "Parrot_set_i_s",
@@ -8961,7 +9010,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 703 */
+  { /* 705 */
     "set",
     "set_i_sc",
     "Parrot_set_i_sc",
@@ -8972,7 +9021,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 704 */
+  { /* 706 */
     "set",
     "set_n_n",
     "Parrot_set_n_n",
@@ -8983,7 +9032,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 705 */
+  { /* 707 */
     "set",
     "set_n_nc",
     "Parrot_set_n_nc",
@@ -8994,7 +9043,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 706 */
+  { /* 708 */
     "set",
     "set_n_i",
     "Parrot_set_n_i",
@@ -9005,7 +9054,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 707 */
+  { /* 709 */
     "set",
     "set_n_ic",
     "Parrot_set_n_ic",
@@ -9016,7 +9065,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 708 */
+  { /* 710 */
     "set",
     "set_n_s",
     "Parrot_set_n_s",
@@ -9027,7 +9076,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 709 */
+  { /* 711 */
     "set",
     "set_n_sc",
     "Parrot_set_n_sc",
@@ -9038,7 +9087,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 710 */
+  { /* 712 */
     "set",
     "set_n_p",
     "Parrot_set_n_p",
@@ -9049,7 +9098,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 711 */
+  { /* 713 */
     "set",
     "set_s_p",
     "Parrot_set_s_p",
@@ -9060,7 +9109,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 712 */
+  { /* 714 */
     "set",
     "set_s_s",
     "Parrot_set_s_s",
@@ -9071,7 +9120,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 713 */
+  { /* 715 */
     "set",
     "set_s_sc",
     "Parrot_set_s_sc",
@@ -9082,7 +9131,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 714 */
+  { /* 716 */
     "set",
     "set_s_i",
     "Parrot_set_s_i",
@@ -9093,7 +9142,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 715 */
+  { /* 717 */
     "set",
     "set_s_ic",
     "Parrot_set_s_ic",
@@ -9104,7 +9153,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 716 */
+  { /* 718 */
     "set",
     "set_s_n",
     "Parrot_set_s_n",
@@ -9115,7 +9164,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 717 */
+  { /* 719 */
     "set",
     "set_s_nc",
     "Parrot_set_s_nc",
@@ -9126,7 +9175,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 718 */
+  { /* 720 */
     "set",
     "set_p_pc",
     "Parrot_set_p_pc",
@@ -9137,7 +9186,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 719 */
+  { /* 721 */
     "set",
     "set_p_p",
     "Parrot_set_p_p",
@@ -9148,7 +9197,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 720 */
+  { /* 722 */
     "set",
     "set_p_i",
     "Parrot_set_p_i",
@@ -9159,7 +9208,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 721 */
+  { /* 723 */
     "set",
     "set_p_ic",
     "Parrot_set_p_ic",
@@ -9170,7 +9219,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 722 */
+  { /* 724 */
     "set",
     "set_p_n",
     "Parrot_set_p_n",
@@ -9181,7 +9230,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 723 */
+  { /* 725 */
     "set",
     "set_p_nc",
     "Parrot_set_p_nc",
@@ -9192,7 +9241,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 724 */
+  { /* 726 */
     "set",
     "set_p_s",
     "Parrot_set_p_s",
@@ -9203,7 +9252,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 725 */
+  { /* 727 */
     "set",
     "set_p_sc",
     "Parrot_set_p_sc",
@@ -9214,7 +9263,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 726 */
+  { /* 728 */
     "set",
     "set_i_p",
     "Parrot_set_i_p",
@@ -9225,7 +9274,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 727 */
+  { /* 729 */
     "assign",
     "assign_p_p",
     "Parrot_assign_p_p",
@@ -9236,7 +9285,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 728 */
+  { /* 730 */
     "assign",
     "assign_p_i",
     "Parrot_assign_p_i",
@@ -9247,7 +9296,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 729 */
+  { /* 731 */
     "assign",
     "assign_p_ic",
     "Parrot_assign_p_ic",
@@ -9258,7 +9307,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 730 */
+  { /* 732 */
     "assign",
     "assign_p_n",
     "Parrot_assign_p_n",
@@ -9269,7 +9318,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 731 */
+  { /* 733 */
     "assign",
     "assign_p_nc",
     "Parrot_assign_p_nc",
@@ -9280,7 +9329,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 732 */
+  { /* 734 */
     "assign",
     "assign_p_s",
     "Parrot_assign_p_s",
@@ -9291,7 +9340,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 733 */
+  { /* 735 */
     "assign",
     "assign_p_sc",
     "Parrot_assign_p_sc",
@@ -9302,7 +9351,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 734 */
+  { /* 736 */
     "assign",
     "assign_s_s",
     "Parrot_assign_s_s",
@@ -9313,7 +9362,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 735 */
+  { /* 737 */
     "assign",
     "assign_s_sc",
     "Parrot_assign_s_sc",
@@ -9324,7 +9373,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 736 */
+  { /* 738 */
     "setref",
     "setref_p_p",
     "Parrot_setref_p_p",
@@ -9335,7 +9384,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 737 */
+  { /* 739 */
     "deref",
     "deref_p_p",
     "Parrot_deref_p_p",
@@ -9346,7 +9395,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 738 */
+  { /* 740 */
     "set",
     "set_p_ki_i",
     "Parrot_set_p_ki_i",
@@ -9357,7 +9406,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 739 */
+  { /* 741 */
     "set",
     "set_p_kic_i",
     "Parrot_set_p_kic_i",
@@ -9368,7 +9417,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 740 */
+  { /* 742 */
     "set",
     "set_p_ki_ic",
     "Parrot_set_p_ki_ic",
@@ -9379,7 +9428,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 741 */
+  { /* 743 */
     "set",
     "set_p_kic_ic",
     "Parrot_set_p_kic_ic",
@@ -9390,7 +9439,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 742 */
+  { /* 744 */
     "set",
     "set_p_ki_n",
     "Parrot_set_p_ki_n",
@@ -9401,7 +9450,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 743 */
+  { /* 745 */
     "set",
     "set_p_kic_n",
     "Parrot_set_p_kic_n",
@@ -9412,7 +9461,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 744 */
+  { /* 746 */
     "set",
     "set_p_ki_nc",
     "Parrot_set_p_ki_nc",
@@ -9423,7 +9472,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 745 */
+  { /* 747 */
     "set",
     "set_p_kic_nc",
     "Parrot_set_p_kic_nc",
@@ -9434,7 +9483,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 746 */
+  { /* 748 */
     "set",
     "set_p_ki_s",
     "Parrot_set_p_ki_s",
@@ -9445,7 +9494,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 747 */
+  { /* 749 */
     "set",
     "set_p_kic_s",
     "Parrot_set_p_kic_s",
@@ -9456,7 +9505,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 748 */
+  { /* 750 */
     "set",
     "set_p_ki_sc",
     "Parrot_set_p_ki_sc",
@@ -9467,7 +9516,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 749 */
+  { /* 751 */
     "set",
     "set_p_kic_sc",
     "Parrot_set_p_kic_sc",
@@ -9478,7 +9527,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 750 */
+  { /* 752 */
     "set",
     "set_p_ki_p",
     "Parrot_set_p_ki_p",
@@ -9489,7 +9538,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 751 */
+  { /* 753 */
     "set",
     "set_p_kic_p",
     "Parrot_set_p_kic_p",
@@ -9500,7 +9549,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 752 */
+  { /* 754 */
     "set",
     "set_i_p_ki",
     "Parrot_set_i_p_ki",
@@ -9511,7 +9560,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 753 */
+  { /* 755 */
     "set",
     "set_i_p_kic",
     "Parrot_set_i_p_kic",
@@ -9522,7 +9571,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 754 */
+  { /* 756 */
     "set",
     "set_n_p_ki",
     "Parrot_set_n_p_ki",
@@ -9533,7 +9582,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 755 */
+  { /* 757 */
     "set",
     "set_n_p_kic",
     "Parrot_set_n_p_kic",
@@ -9544,7 +9593,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 756 */
+  { /* 758 */
     "set",
     "set_s_p_ki",
     "Parrot_set_s_p_ki",
@@ -9555,7 +9604,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 757 */
+  { /* 759 */
     "set",
     "set_s_p_kic",
     "Parrot_set_s_p_kic",
@@ -9566,7 +9615,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 758 */
+  { /* 760 */
     "set",
     "set_p_p_ki",
     "Parrot_set_p_p_ki",
@@ -9577,7 +9626,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 759 */
+  { /* 761 */
     "set",
     "set_p_p_kic",
     "Parrot_set_p_p_kic",
@@ -9588,7 +9637,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 760 */
+  { /* 762 */
     "set",
     "set_p_k_i",
     "Parrot_set_p_k_i",
@@ -9599,7 +9648,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 761 */
+  { /* 763 */
     "set",
     "set_p_kc_i",
     "Parrot_set_p_kc_i",
@@ -9610,7 +9659,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 762 */
+  { /* 764 */
     "set",
     "set_p_k_ic",
     "Parrot_set_p_k_ic",
@@ -9621,7 +9670,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 763 */
+  { /* 765 */
     "set",
     "set_p_kc_ic",
     "Parrot_set_p_kc_ic",
@@ -9632,7 +9681,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 764 */
+  { /* 766 */
     "set",
     "set_p_k_n",
     "Parrot_set_p_k_n",
@@ -9643,7 +9692,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 765 */
+  { /* 767 */
     "set",
     "set_p_kc_n",
     "Parrot_set_p_kc_n",
@@ -9654,7 +9703,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 766 */
+  { /* 768 */
     "set",
     "set_p_k_nc",
     "Parrot_set_p_k_nc",
@@ -9665,7 +9714,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 767 */
+  { /* 769 */
     "set",
     "set_p_kc_nc",
     "Parrot_set_p_kc_nc",
@@ -9676,7 +9725,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 768 */
+  { /* 770 */
     "set",
     "set_p_k_s",
     "Parrot_set_p_k_s",
@@ -9687,7 +9736,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 769 */
+  { /* 771 */
     "set",
     "set_p_kc_s",
     "Parrot_set_p_kc_s",
@@ -9698,7 +9747,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 770 */
+  { /* 772 */
     "set",
     "set_p_k_sc",
     "Parrot_set_p_k_sc",
@@ -9709,7 +9758,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 771 */
+  { /* 773 */
     "set",
     "set_p_kc_sc",
     "Parrot_set_p_kc_sc",
@@ -9720,7 +9769,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 772 */
+  { /* 774 */
     "set",
     "set_p_k_p",
     "Parrot_set_p_k_p",
@@ -9731,7 +9780,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 773 */
+  { /* 775 */
     "set",
     "set_p_kc_p",
     "Parrot_set_p_kc_p",
@@ -9742,7 +9791,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 774 */
+  { /* 776 */
     "set",
     "set_i_p_k",
     "Parrot_set_i_p_k",
@@ -9753,7 +9802,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 775 */
+  { /* 777 */
     "set",
     "set_i_p_kc",
     "Parrot_set_i_p_kc",
@@ -9764,7 +9813,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 776 */
+  { /* 778 */
     "set",
     "set_n_p_k",
     "Parrot_set_n_p_k",
@@ -9775,7 +9824,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 777 */
+  { /* 779 */
     "set",
     "set_n_p_kc",
     "Parrot_set_n_p_kc",
@@ -9786,7 +9835,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 778 */
+  { /* 780 */
     "set",
     "set_s_p_k",
     "Parrot_set_s_p_k",
@@ -9797,7 +9846,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 779 */
+  { /* 781 */
     "set",
     "set_s_p_kc",
     "Parrot_set_s_p_kc",
@@ -9808,7 +9857,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 780 */
+  { /* 782 */
     "set",
     "set_p_p_k",
     "Parrot_set_p_p_k",
@@ -9819,7 +9868,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 781 */
+  { /* 783 */
     "set",
     "set_p_p_kc",
     "Parrot_set_p_p_kc",
@@ -9830,7 +9879,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 782 */
+  { /* 784 */
     "clone",
     "clone_p_p",
     "Parrot_clone_p_p",
@@ -9841,7 +9890,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 783 */
+  { /* 785 */
     "clone",
     "clone_p_p_p",
     "Parrot_clone_p_p_p",
@@ -9852,7 +9901,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 784 */
+  { /* 786 */
     "clone",
     "clone_p_p_pc",
     "Parrot_clone_p_p_pc",
@@ -9863,7 +9912,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 785 */
+  { /* 787 */
     "copy",
     "copy_p_p",
     "Parrot_copy_p_p",
@@ -9874,7 +9923,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 786 */
+  { /* 788 */
     "null",
     "null_s",
     "Parrot_null_s",
@@ -9885,7 +9934,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 787 */
+  { /* 789 */
     "null",
     "null_i",
     "Parrot_null_i",
@@ -9896,7 +9945,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 788 */
+  { /* 790 */
     "null",
     "null_p",
     "Parrot_null_p",
@@ -9907,7 +9956,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 789 */
+  { /* 791 */
     "null",
     "null_n",
     "Parrot_null_n",
@@ -9918,7 +9967,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 790 */
+  { /* 792 */
     "ord",
     "ord_i_s",
     "Parrot_ord_i_s",
@@ -9929,7 +9978,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 791 */
+  { /* 793 */
     "ord",
     "ord_i_sc",
     "Parrot_ord_i_sc",
@@ -9940,7 +9989,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 792 */
+  { /* 794 */
     "ord",
     "ord_i_s_i",
     "Parrot_ord_i_s_i",
@@ -9951,7 +10000,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 793 */
+  { /* 795 */
     "ord",
     "ord_i_sc_i",
     "Parrot_ord_i_sc_i",
@@ -9962,7 +10011,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 794 */
+  { /* 796 */
     "ord",
     "ord_i_s_ic",
     "Parrot_ord_i_s_ic",
@@ -9973,7 +10022,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 795 */
+  { /* 797 */
     "ord",
     "ord_i_sc_ic",
     "Parrot_ord_i_sc_ic",
@@ -9984,7 +10033,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 796 */
+  { /* 798 */
     "chr",
     "chr_s_i",
     "Parrot_chr_s_i",
@@ -9995,7 +10044,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 797 */
+  { /* 799 */
     "chr",
     "chr_s_ic",
     "Parrot_chr_s_ic",
@@ -10006,7 +10055,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 798 */
+  { /* 800 */
     "chopn",
     "chopn_s_s_i",
     "Parrot_chopn_s_s_i",
@@ -10017,7 +10066,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 799 */
+  { /* 801 */
     "chopn",
     "chopn_s_sc_i",
     "Parrot_chopn_s_sc_i",
@@ -10028,7 +10077,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 800 */
+  { /* 802 */
     "chopn",
     "chopn_s_s_ic",
     "Parrot_chopn_s_s_ic",
@@ -10039,7 +10088,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 801 */
+  { /* 803 */
     "chopn",
     "chopn_s_sc_ic",
     "Parrot_chopn_s_sc_ic",
@@ -10050,7 +10099,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 802 */
+  { /* 804 */
     "concat",
     "concat_p_p",
     "Parrot_concat_p_p",
@@ -10061,7 +10110,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 803 */
+  { /* 805 */
     "concat",
     "concat_p_s",
     "Parrot_concat_p_s",
@@ -10072,7 +10121,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 804 */
+  { /* 806 */
     "concat",
     "concat_p_sc",
     "Parrot_concat_p_sc",
@@ -10083,7 +10132,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 805 */
+  { /* 807 */
     "concat",
     "concat_s_s_s",
     "Parrot_concat_s_s_s",
@@ -10094,7 +10143,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 806 */
+  { /* 808 */
     "concat",
     "concat_s_sc_s",
     "Parrot_concat_s_sc_s",
@@ -10105,7 +10154,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 807 */
+  { /* 809 */
     "concat",
     "concat_s_s_sc",
     "Parrot_concat_s_s_sc",
@@ -10116,7 +10165,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 808 */
+  { /* 810 */
     "concat",
     "concat_p_p_s",
     "Parrot_concat_p_p_s",
@@ -10127,7 +10176,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 809 */
+  { /* 811 */
     "concat",
     "concat_p_p_sc",
     "Parrot_concat_p_p_sc",
@@ -10138,7 +10187,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 810 */
+  { /* 812 */
     "concat",
     "concat_p_p_p",
     "Parrot_concat_p_p_p",
@@ -10149,7 +10198,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 811 */
+  { /* 813 */
     "repeat",
     "repeat_s_s_i",
     "Parrot_repeat_s_s_i",
@@ -10160,7 +10209,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 812 */
+  { /* 814 */
     "repeat",
     "repeat_s_sc_i",
     "Parrot_repeat_s_sc_i",
@@ -10171,7 +10220,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 813 */
+  { /* 815 */
     "repeat",
     "repeat_s_s_ic",
     "Parrot_repeat_s_s_ic",
@@ -10182,7 +10231,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 814 */
+  { /* 816 */
     "repeat",
     "repeat_s_sc_ic",
     "Parrot_repeat_s_sc_ic",
@@ -10193,7 +10242,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 815 */
+  { /* 817 */
     "repeat",
     "repeat_p_p_i",
     "Parrot_repeat_p_p_i",
@@ -10204,7 +10253,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 816 */
+  { /* 818 */
     "repeat",
     "repeat_p_p_ic",
     "Parrot_repeat_p_p_ic",
@@ -10215,7 +10264,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 817 */
+  { /* 819 */
     "repeat",
     "repeat_p_p_p",
     "Parrot_repeat_p_p_p",
@@ -10226,7 +10275,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 818 */
+  { /* 820 */
     "repeat",
     "repeat_p_i",
     "Parrot_repeat_p_i",
@@ -10237,7 +10286,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 819 */
+  { /* 821 */
     "repeat",
     "repeat_p_ic",
     "Parrot_repeat_p_ic",
@@ -10248,7 +10297,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 820 */
+  { /* 822 */
     "repeat",
     "repeat_p_p",
     "Parrot_repeat_p_p",
@@ -10259,7 +10308,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 821 */
+  { /* 823 */
     "length",
     "length_i_s",
     "Parrot_length_i_s",
@@ -10270,7 +10319,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 822 */
+  { /* 824 */
     "length",
     "length_i_sc",
     "Parrot_length_i_sc",
@@ -10281,7 +10330,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 823 */
+  { /* 825 */
     "bytelength",
     "bytelength_i_s",
     "Parrot_bytelength_i_s",
@@ -10292,7 +10341,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 824 */
+  { /* 826 */
     "bytelength",
     "bytelength_i_sc",
     "Parrot_bytelength_i_sc",
@@ -10303,7 +10352,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 825 */
+  { /* 827 */
     "pin",
     "pin_s",
     "Parrot_pin_s",
@@ -10314,7 +10363,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 826 */
+  { /* 828 */
     "unpin",
     "unpin_s",
     "Parrot_unpin_s",
@@ -10325,7 +10374,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 827 */
+  { /* 829 */
     "substr",
     "substr_s_s_i",
     "Parrot_substr_s_s_i",
@@ -10336,7 +10385,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 828 */
+  { /* 830 */
     "substr",
     "substr_s_sc_i",
     "Parrot_substr_s_sc_i",
@@ -10347,7 +10396,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 829 */
+  { /* 831 */
     "substr",
     "substr_s_s_ic",
     "Parrot_substr_s_s_ic",
@@ -10358,7 +10407,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 830 */
+  { /* 832 */
     "substr",
     "substr_s_sc_ic",
     "Parrot_substr_s_sc_ic",
@@ -10369,7 +10418,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 831 */
+  { /* 833 */
     "substr",
     "substr_s_s_i_i",
     "Parrot_substr_s_s_i_i",
@@ -10380,7 +10429,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 832 */
+  { /* 834 */
     "substr",
     "substr_s_sc_i_i",
     "Parrot_substr_s_sc_i_i",
@@ -10391,7 +10440,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 833 */
+  { /* 835 */
     "substr",
     "substr_s_s_ic_i",
     "Parrot_substr_s_s_ic_i",
@@ -10402,7 +10451,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 834 */
+  { /* 836 */
     "substr",
     "substr_s_sc_ic_i",
     "Parrot_substr_s_sc_ic_i",
@@ -10413,7 +10462,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 835 */
+  { /* 837 */
     "substr",
     "substr_s_s_i_ic",
     "Parrot_substr_s_s_i_ic",
@@ -10424,7 +10473,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 836 */
+  { /* 838 */
     "substr",
     "substr_s_sc_i_ic",
     "Parrot_substr_s_sc_i_ic",
@@ -10435,7 +10484,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 837 */
+  { /* 839 */
     "substr",
     "substr_s_s_ic_ic",
     "Parrot_substr_s_s_ic_ic",
@@ -10446,7 +10495,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 838 */
+  { /* 840 */
     "substr",
     "substr_s_sc_ic_ic",
     "Parrot_substr_s_sc_ic_ic",
@@ -10457,7 +10506,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 839 */
+  { /* 841 */
     "substr",
     "substr_s_p_i_i",
     "Parrot_substr_s_p_i_i",
@@ -10468,7 +10517,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 840 */
+  { /* 842 */
     "substr",
     "substr_s_p_ic_i",
     "Parrot_substr_s_p_ic_i",
@@ -10479,7 +10528,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 841 */
+  { /* 843 */
     "substr",
     "substr_s_p_i_ic",
     "Parrot_substr_s_p_i_ic",
@@ -10490,7 +10539,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 842 */
+  { /* 844 */
     "substr",
     "substr_s_p_ic_ic",
     "Parrot_substr_s_p_ic_ic",
@@ -10501,7 +10550,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 843 */
+  { /* 845 */
     "replace",
     "replace_s_s_i_i_s",
     "Parrot_replace_s_s_i_i_s",
@@ -10512,7 +10561,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 844 */
+  { /* 846 */
     "replace",
     "replace_s_sc_i_i_s",
     "Parrot_replace_s_sc_i_i_s",
@@ -10523,7 +10572,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 845 */
+  { /* 847 */
     "replace",
     "replace_s_s_ic_i_s",
     "Parrot_replace_s_s_ic_i_s",
@@ -10534,7 +10583,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 846 */
+  { /* 848 */
     "replace",
     "replace_s_sc_ic_i_s",
     "Parrot_replace_s_sc_ic_i_s",
@@ -10545,7 +10594,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 847 */
+  { /* 849 */
     "replace",
     "replace_s_s_i_ic_s",
     "Parrot_replace_s_s_i_ic_s",
@@ -10556,7 +10605,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 848 */
+  { /* 850 */
     "replace",
     "replace_s_sc_i_ic_s",
     "Parrot_replace_s_sc_i_ic_s",
@@ -10567,7 +10616,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 849 */
+  { /* 851 */
     "replace",
     "replace_s_s_ic_ic_s",
     "Parrot_replace_s_s_ic_ic_s",
@@ -10578,7 +10627,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 850 */
+  { /* 852 */
     "replace",
     "replace_s_sc_ic_ic_s",
     "Parrot_replace_s_sc_ic_ic_s",
@@ -10589,7 +10638,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 851 */
+  { /* 853 */
     "replace",
     "replace_s_s_i_i_sc",
     "Parrot_replace_s_s_i_i_sc",
@@ -10600,7 +10649,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 852 */
+  { /* 854 */
     "replace",
     "replace_s_sc_i_i_sc",
     "Parrot_replace_s_sc_i_i_sc",
@@ -10611,7 +10660,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 853 */
+  { /* 855 */
     "replace",
     "replace_s_s_ic_i_sc",
     "Parrot_replace_s_s_ic_i_sc",
@@ -10622,7 +10671,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 854 */
+  { /* 856 */
     "replace",
     "replace_s_sc_ic_i_sc",
     "Parrot_replace_s_sc_ic_i_sc",
@@ -10633,7 +10682,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 855 */
+  { /* 857 */
     "replace",
     "replace_s_s_i_ic_sc",
     "Parrot_replace_s_s_i_ic_sc",
@@ -10644,7 +10693,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 856 */
+  { /* 858 */
     "replace",
     "replace_s_sc_i_ic_sc",
     "Parrot_replace_s_sc_i_ic_sc",
@@ -10655,7 +10704,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 857 */
+  { /* 859 */
     "replace",
     "replace_s_s_ic_ic_sc",
     "Parrot_replace_s_s_ic_ic_sc",
@@ -10666,7 +10715,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 858 */
+  { /* 860 */
     "replace",
     "replace_s_sc_ic_ic_sc",
     "Parrot_replace_s_sc_ic_ic_sc",
@@ -10677,7 +10726,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 859 */
+  { /* 861 */
     "index",
     "index_i_s_s",
     "Parrot_index_i_s_s",
@@ -10688,7 +10737,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 860 */
+  { /* 862 */
     "index",
     "index_i_sc_s",
     "Parrot_index_i_sc_s",
@@ -10699,7 +10748,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 861 */
+  { /* 863 */
     "index",
     "index_i_s_sc",
     "Parrot_index_i_s_sc",
@@ -10710,7 +10759,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 862 */
+  { /* 864 */
     "index",
     "index_i_sc_sc",
     "Parrot_index_i_sc_sc",
@@ -10721,7 +10770,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 863 */
+  { /* 865 */
     "index",
     "index_i_s_s_i",
     "Parrot_index_i_s_s_i",
@@ -10732,7 +10781,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 864 */
+  { /* 866 */
     "index",
     "index_i_sc_s_i",
     "Parrot_index_i_sc_s_i",
@@ -10743,7 +10792,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 865 */
+  { /* 867 */
     "index",
     "index_i_s_sc_i",
     "Parrot_index_i_s_sc_i",
@@ -10754,7 +10803,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 866 */
+  { /* 868 */
     "index",
     "index_i_sc_sc_i",
     "Parrot_index_i_sc_sc_i",
@@ -10765,7 +10814,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 867 */
+  { /* 869 */
     "index",
     "index_i_s_s_ic",
     "Parrot_index_i_s_s_ic",
@@ -10776,7 +10825,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 868 */
+  { /* 870 */
     "index",
     "index_i_sc_s_ic",
     "Parrot_index_i_sc_s_ic",
@@ -10787,7 +10836,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 869 */
+  { /* 871 */
     "index",
     "index_i_s_sc_ic",
     "Parrot_index_i_s_sc_ic",
@@ -10798,7 +10847,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 870 */
+  { /* 872 */
     "index",
     "index_i_sc_sc_ic",
     "Parrot_index_i_sc_sc_ic",
@@ -10809,7 +10858,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 871 */
+  { /* 873 */
     "rindex",
     "rindex_i_s_s",
     "Parrot_rindex_i_s_s",
@@ -10820,7 +10869,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 872 */
+  { /* 874 */
     "rindex",
     "rindex_i_sc_s",
     "Parrot_rindex_i_sc_s",
@@ -10831,7 +10880,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 873 */
+  { /* 875 */
     "rindex",
     "rindex_i_s_sc",
     "Parrot_rindex_i_s_sc",
@@ -10842,7 +10891,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 874 */
+  { /* 876 */
     "rindex",
     "rindex_i_sc_sc",
     "Parrot_rindex_i_sc_sc",
@@ -10853,7 +10902,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 875 */
+  { /* 877 */
     "rindex",
     "rindex_i_s_s_i",
     "Parrot_rindex_i_s_s_i",
@@ -10864,7 +10913,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 876 */
+  { /* 878 */
     "rindex",
     "rindex_i_sc_s_i",
     "Parrot_rindex_i_sc_s_i",
@@ -10875,7 +10924,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 877 */
+  { /* 879 */
     "rindex",
     "rindex_i_s_sc_i",
     "Parrot_rindex_i_s_sc_i",
@@ -10886,7 +10935,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 878 */
+  { /* 880 */
     "rindex",
     "rindex_i_sc_sc_i",
     "Parrot_rindex_i_sc_sc_i",
@@ -10897,7 +10946,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 879 */
+  { /* 881 */
     "rindex",
     "rindex_i_s_s_ic",
     "Parrot_rindex_i_s_s_ic",
@@ -10908,7 +10957,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 880 */
+  { /* 882 */
     "rindex",
     "rindex_i_sc_s_ic",
     "Parrot_rindex_i_sc_s_ic",
@@ -10919,7 +10968,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 881 */
+  { /* 883 */
     "rindex",
     "rindex_i_s_sc_ic",
     "Parrot_rindex_i_s_sc_ic",
@@ -10930,7 +10979,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 882 */
+  { /* 884 */
     "rindex",
     "rindex_i_sc_sc_ic",
     "Parrot_rindex_i_sc_sc_ic",
@@ -10941,7 +10990,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 883 */
+  { /* 885 */
     "sprintf",
     "sprintf_s_s_p",
     "Parrot_sprintf_s_s_p",
@@ -10952,7 +11001,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 884 */
+  { /* 886 */
     "sprintf",
     "sprintf_s_sc_p",
     "Parrot_sprintf_s_sc_p",
@@ -10963,7 +11012,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 885 */
+  { /* 887 */
     "sprintf",
     "sprintf_p_p_p",
     "Parrot_sprintf_p_p_p",
@@ -10974,7 +11023,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 886 */
+  { /* 888 */
     "new",
     "new_s",
     "Parrot_new_s",
@@ -10985,7 +11034,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 887 */
+  { /* 889 */
     "stringinfo",
     "stringinfo_i_s_i",
     "Parrot_stringinfo_i_s_i",
@@ -10996,7 +11045,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 888 */
+  { /* 890 */
     "stringinfo",
     "stringinfo_i_sc_i",
     "Parrot_stringinfo_i_sc_i",
@@ -11007,7 +11056,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 889 */
+  { /* 891 */
     "stringinfo",
     "stringinfo_i_s_ic",
     "Parrot_stringinfo_i_s_ic",
@@ -11018,7 +11067,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 890 */
+  { /* 892 */
     "stringinfo",
     "stringinfo_i_sc_ic",
     "Parrot_stringinfo_i_sc_ic",
@@ -11029,7 +11078,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 891 */
+  { /* 893 */
     "upcase",
     "upcase_s_s",
     "Parrot_upcase_s_s",
@@ -11040,7 +11089,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 892 */
+  { /* 894 */
     "upcase",
     "upcase_s_sc",
     "Parrot_upcase_s_sc",
@@ -11051,7 +11100,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 893 */
+  { /* 895 */
     "downcase",
     "downcase_s_s",
     "Parrot_downcase_s_s",
@@ -11062,7 +11111,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 894 */
+  { /* 896 */
     "downcase",
     "downcase_s_sc",
     "Parrot_downcase_s_sc",
@@ -11073,7 +11122,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 895 */
+  { /* 897 */
     "titlecase",
     "titlecase_s_s",
     "Parrot_titlecase_s_s",
@@ -11084,7 +11133,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 896 */
+  { /* 898 */
     "titlecase",
     "titlecase_s_sc",
     "Parrot_titlecase_s_sc",
@@ -11095,7 +11144,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 897 */
+  { /* 899 */
     "foldcase",
     "foldcase_s_s",
     "Parrot_foldcase_s_s",
@@ -11106,7 +11155,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 898 */
+  { /* 900 */
     "foldcase",
     "foldcase_s_sc",
     "Parrot_foldcase_s_sc",
@@ -11117,7 +11166,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 899 */
+  { /* 901 */
     "join",
     "join_s_s_p",
     "Parrot_join_s_s_p",
@@ -11128,7 +11177,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 900 */
+  { /* 902 */
     "join",
     "join_s_sc_p",
     "Parrot_join_s_sc_p",
@@ -11139,7 +11188,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 901 */
+  { /* 903 */
     "split",
     "split_p_s_s",
     "Parrot_split_p_s_s",
@@ -11150,7 +11199,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 902 */
+  { /* 904 */
     "split",
     "split_p_sc_s",
     "Parrot_split_p_sc_s",
@@ -11161,7 +11210,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 903 */
+  { /* 905 */
     "split",
     "split_p_s_sc",
     "Parrot_split_p_s_sc",
@@ -11172,7 +11221,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 904 */
+  { /* 906 */
     "split",
     "split_p_sc_sc",
     "Parrot_split_p_sc_sc",
@@ -11183,7 +11232,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 905 */
+  { /* 907 */
     "encoding",
     "encoding_i_s",
     "Parrot_encoding_i_s",
@@ -11194,7 +11243,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 906 */
+  { /* 908 */
     "encoding",
     "encoding_i_sc",
     "Parrot_encoding_i_sc",
@@ -11205,7 +11254,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 907 */
+  { /* 909 */
     "encodingname",
     "encodingname_s_i",
     "Parrot_encodingname_s_i",
@@ -11216,7 +11265,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 908 */
+  { /* 910 */
     "encodingname",
     "encodingname_s_ic",
     "Parrot_encodingname_s_ic",
@@ -11227,7 +11276,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 909 */
+  { /* 911 */
     "find_encoding",
     "find_encoding_i_s",
     "Parrot_find_encoding_i_s",
@@ -11238,7 +11287,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 910 */
+  { /* 912 */
     "find_encoding",
     "find_encoding_i_sc",
     "Parrot_find_encoding_i_sc",
@@ -11249,7 +11298,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 911 */
+  { /* 913 */
     "trans_encoding",
     "trans_encoding_s_s_i",
     "Parrot_trans_encoding_s_s_i",
@@ -11260,7 +11309,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 912 */
+  { /* 914 */
     "trans_encoding",
     "trans_encoding_s_sc_i",
     "Parrot_trans_encoding_s_sc_i",
@@ -11271,7 +11320,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 913 */
+  { /* 915 */
     "trans_encoding",
     "trans_encoding_s_s_ic",
     "Parrot_trans_encoding_s_s_ic",
@@ -11282,7 +11331,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 914 */
+  { /* 916 */
     "trans_encoding",
     "trans_encoding_s_sc_ic",
     "Parrot_trans_encoding_s_sc_ic",
@@ -11293,7 +11342,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 915 */
+  { /* 917 */
     "is_cclass",
     "is_cclass_i_i_s_i",
     "Parrot_is_cclass_i_i_s_i",
@@ -11304,7 +11353,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 916 */
+  { /* 918 */
     "is_cclass",
     "is_cclass_i_ic_s_i",
     "Parrot_is_cclass_i_ic_s_i",
@@ -11315,7 +11364,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 917 */
+  { /* 919 */
     "is_cclass",
     "is_cclass_i_i_sc_i",
     "Parrot_is_cclass_i_i_sc_i",
@@ -11326,7 +11375,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 918 */
+  { /* 920 */
     "is_cclass",
     "is_cclass_i_ic_sc_i",
     "Parrot_is_cclass_i_ic_sc_i",
@@ -11337,7 +11386,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 919 */
+  { /* 921 */
     "is_cclass",
     "is_cclass_i_i_s_ic",
     "Parrot_is_cclass_i_i_s_ic",
@@ -11348,7 +11397,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 920 */
+  { /* 922 */
     "is_cclass",
     "is_cclass_i_ic_s_ic",
     "Parrot_is_cclass_i_ic_s_ic",
@@ -11359,7 +11408,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 921 */
+  { /* 923 */
     "is_cclass",
     "is_cclass_i_i_sc_ic",
     "Parrot_is_cclass_i_i_sc_ic",
@@ -11370,7 +11419,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 922 */
+  { /* 924 */
     "is_cclass",
     "is_cclass_i_ic_sc_ic",
     "Parrot_is_cclass_i_ic_sc_ic",
@@ -11381,7 +11430,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 923 */
+  { /* 925 */
     "find_cclass",
     "find_cclass_i_i_s_i_i",
     "Parrot_find_cclass_i_i_s_i_i",
@@ -11392,7 +11441,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 924 */
+  { /* 926 */
     "find_cclass",
     "find_cclass_i_ic_s_i_i",
     "Parrot_find_cclass_i_ic_s_i_i",
@@ -11403,7 +11452,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 925 */
+  { /* 927 */
     "find_cclass",
     "find_cclass_i_i_sc_i_i",
     "Parrot_find_cclass_i_i_sc_i_i",
@@ -11414,7 +11463,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 926 */
+  { /* 928 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_i",
     "Parrot_find_cclass_i_ic_sc_i_i",
@@ -11425,7 +11474,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 927 */
+  { /* 929 */
     "find_cclass",
     "find_cclass_i_i_s_ic_i",
     "Parrot_find_cclass_i_i_s_ic_i",
@@ -11436,7 +11485,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 928 */
+  { /* 930 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_i",
     "Parrot_find_cclass_i_ic_s_ic_i",
@@ -11447,7 +11496,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 929 */
+  { /* 931 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_i",
     "Parrot_find_cclass_i_i_sc_ic_i",
@@ -11458,7 +11507,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 930 */
+  { /* 932 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_i",
     "Parrot_find_cclass_i_ic_sc_ic_i",
@@ -11469,7 +11518,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 931 */
+  { /* 933 */
     "find_cclass",
     "find_cclass_i_i_s_i_ic",
     "Parrot_find_cclass_i_i_s_i_ic",
@@ -11480,7 +11529,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 932 */
+  { /* 934 */
     "find_cclass",
     "find_cclass_i_ic_s_i_ic",
     "Parrot_find_cclass_i_ic_s_i_ic",
@@ -11491,7 +11540,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 933 */
+  { /* 935 */
     "find_cclass",
     "find_cclass_i_i_sc_i_ic",
     "Parrot_find_cclass_i_i_sc_i_ic",
@@ -11502,7 +11551,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 934 */
+  { /* 936 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_ic",
     "Parrot_find_cclass_i_ic_sc_i_ic",
@@ -11513,7 +11562,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 935 */
+  { /* 937 */
     "find_cclass",
     "find_cclass_i_i_s_ic_ic",
     "Parrot_find_cclass_i_i_s_ic_ic",
@@ -11524,7 +11573,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 936 */
+  { /* 938 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_ic",
     "Parrot_find_cclass_i_ic_s_ic_ic",
@@ -11535,7 +11584,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 937 */
+  { /* 939 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_ic",
     "Parrot_find_cclass_i_i_sc_ic_ic",
@@ -11546,7 +11595,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 938 */
+  { /* 940 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_ic",
     "Parrot_find_cclass_i_ic_sc_ic_ic",
@@ -11557,7 +11606,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 939 */
+  { /* 941 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_i",
     "Parrot_find_not_cclass_i_i_s_i_i",
@@ -11568,7 +11617,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 940 */
+  { /* 942 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_i",
     "Parrot_find_not_cclass_i_ic_s_i_i",
@@ -11579,7 +11628,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 941 */
+  { /* 943 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_i",
     "Parrot_find_not_cclass_i_i_sc_i_i",
@@ -11590,7 +11639,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 942 */
+  { /* 944 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_i",
     "Parrot_find_not_cclass_i_ic_sc_i_i",
@@ -11601,7 +11650,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 943 */
+  { /* 945 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_i",
     "Parrot_find_not_cclass_i_i_s_ic_i",
@@ -11612,7 +11661,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 944 */
+  { /* 946 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_i",
     "Parrot_find_not_cclass_i_ic_s_ic_i",
@@ -11623,7 +11672,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 945 */
+  { /* 947 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_i",
     "Parrot_find_not_cclass_i_i_sc_ic_i",
@@ -11634,7 +11683,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 946 */
+  { /* 948 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_i",
     "Parrot_find_not_cclass_i_ic_sc_ic_i",
@@ -11645,7 +11694,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 947 */
+  { /* 949 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_ic",
     "Parrot_find_not_cclass_i_i_s_i_ic",
@@ -11656,7 +11705,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 948 */
+  { /* 950 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_ic",
     "Parrot_find_not_cclass_i_ic_s_i_ic",
@@ -11667,7 +11716,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 949 */
+  { /* 951 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_ic",
     "Parrot_find_not_cclass_i_i_sc_i_ic",
@@ -11678,7 +11727,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 950 */
+  { /* 952 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_ic",
     "Parrot_find_not_cclass_i_ic_sc_i_ic",
@@ -11689,7 +11738,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 951 */
+  { /* 953 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_ic",
     "Parrot_find_not_cclass_i_i_s_ic_ic",
@@ -11700,7 +11749,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 952 */
+  { /* 954 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_ic",
     "Parrot_find_not_cclass_i_ic_s_ic_ic",
@@ -11711,7 +11760,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 953 */
+  { /* 955 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_ic",
     "Parrot_find_not_cclass_i_i_sc_ic_ic",
@@ -11722,7 +11771,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 954 */
+  { /* 956 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_ic",
     "Parrot_find_not_cclass_i_ic_sc_ic_ic",
@@ -11733,7 +11782,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 955 */
+  { /* 957 */
     "escape",
     "escape_s_s",
     "Parrot_escape_s_s",
@@ -11744,7 +11793,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 956 */
+  { /* 958 */
     "compose",
     "compose_s_s",
     "Parrot_compose_s_s",
@@ -11755,7 +11804,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 957 */
+  { /* 959 */
     "compose",
     "compose_s_sc",
     "Parrot_compose_s_sc",
@@ -11766,7 +11815,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 958 */
+  { /* 960 */
     "find_codepoint",
     "find_codepoint_i_s",
     "Parrot_find_codepoint_i_s",
@@ -11777,7 +11826,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 959 */
+  { /* 961 */
     "find_codepoint",
     "find_codepoint_i_sc",
     "Parrot_find_codepoint_i_sc",
@@ -11788,7 +11837,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 960 */
+  { /* 962 */
     "spawnw",
     "spawnw_i_s",
     "Parrot_spawnw_i_s",
@@ -11799,7 +11848,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 961 */
+  { /* 963 */
     "spawnw",
     "spawnw_i_sc",
     "Parrot_spawnw_i_sc",
@@ -11810,7 +11859,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 962 */
+  { /* 964 */
     "spawnw",
     "spawnw_i_p",
     "Parrot_spawnw_i_p",
@@ -11821,7 +11870,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 963 */
+  { /* 965 */
     "err",
     "err_i",
     "Parrot_err_i",
@@ -11832,7 +11881,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 964 */
+  { /* 966 */
     "err",
     "err_s",
     "Parrot_err_s",
@@ -11843,7 +11892,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 965 */
+  { /* 967 */
     "err",
     "err_s_i",
     "Parrot_err_s_i",
@@ -11854,7 +11903,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 966 */
+  { /* 968 */
     "err",
     "err_s_ic",
     "Parrot_err_s_ic",
@@ -11865,7 +11914,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 967 */
+  { /* 969 */
     "time",
     "time_i",
     "Parrot_time_i",
@@ -11876,7 +11925,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 968 */
+  { /* 970 */
     "time",
     "time_n",
     "Parrot_time_n",
@@ -11887,7 +11936,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 969 */
+  { /* 971 */
     "sleep",
     "sleep_i",
     "Parrot_sleep_i",
@@ -11898,7 +11947,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 970 */
+  { /* 972 */
     "sleep",
     "sleep_ic",
     "Parrot_sleep_ic",
@@ -11909,7 +11958,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 971 */
+  { /* 973 */
     "sleep",
     "sleep_n",
     "Parrot_sleep_n",
@@ -11920,7 +11969,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 972 */
+  { /* 974 */
     "sleep",
     "sleep_nc",
     "Parrot_sleep_nc",
@@ -11931,7 +11980,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 973 */
+  { /* 975 */
     "store_lex",
     "store_lex_s_p",
     "Parrot_store_lex_s_p",
@@ -11942,7 +11991,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 974 */
+  { /* 976 */
     "store_lex",
     "store_lex_sc_p",
     "Parrot_store_lex_sc_p",
@@ -11953,7 +12002,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 975 */
+  { /* 977 */
     "store_lex",
     "store_lex_s_s",
     "Parrot_store_lex_s_s",
@@ -11964,7 +12013,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 976 */
+  { /* 978 */
     "store_lex",
     "store_lex_sc_s",
     "Parrot_store_lex_sc_s",
@@ -11975,7 +12024,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 977 */
+  { /* 979 */
     "store_lex",
     "store_lex_s_sc",
     "Parrot_store_lex_s_sc",
@@ -11986,7 +12035,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 978 */
+  { /* 980 */
     "store_lex",
     "store_lex_sc_sc",
     "Parrot_store_lex_sc_sc",
@@ -11997,7 +12046,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 979 */
+  { /* 981 */
     "store_lex",
     "store_lex_s_i",
     "Parrot_store_lex_s_i",
@@ -12008,7 +12057,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 980 */
+  { /* 982 */
     "store_lex",
     "store_lex_sc_i",
     "Parrot_store_lex_sc_i",
@@ -12019,7 +12068,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 981 */
+  { /* 983 */
     "store_lex",
     "store_lex_s_ic",
     "Parrot_store_lex_s_ic",
@@ -12030,7 +12079,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 982 */
+  { /* 984 */
     "store_lex",
     "store_lex_sc_ic",
     "Parrot_store_lex_sc_ic",
@@ -12041,7 +12090,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 983 */
+  { /* 985 */
     "store_lex",
     "store_lex_s_n",
     "Parrot_store_lex_s_n",
@@ -12052,7 +12101,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 984 */
+  { /* 986 */
     "store_lex",
     "store_lex_sc_n",
     "Parrot_store_lex_sc_n",
@@ -12063,7 +12112,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 985 */
+  { /* 987 */
     "store_lex",
     "store_lex_s_nc",
     "Parrot_store_lex_s_nc",
@@ -12074,7 +12123,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 986 */
+  { /* 988 */
     "store_lex",
     "store_lex_sc_nc",
     "Parrot_store_lex_sc_nc",
@@ -12085,7 +12134,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 987 */
+  { /* 989 */
     "store_dynamic_lex",
     "store_dynamic_lex_s_p",
     "Parrot_store_dynamic_lex_s_p",
@@ -12096,7 +12145,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 988 */
+  { /* 990 */
     "store_dynamic_lex",
     "store_dynamic_lex_sc_p",
     "Parrot_store_dynamic_lex_sc_p",
@@ -12107,7 +12156,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 989 */
+  { /* 991 */
     "find_lex",
     "find_lex_p_s",
     "Parrot_find_lex_p_s",
@@ -12118,7 +12167,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 990 */
+  { /* 992 */
     "find_lex",
     "find_lex_p_sc",
     "Parrot_find_lex_p_sc",
@@ -12129,7 +12178,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 991 */
+  { /* 993 */
     "find_lex",
     "find_lex_s_s",
     "Parrot_find_lex_s_s",
@@ -12140,7 +12189,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 992 */
+  { /* 994 */
     "find_lex",
     "find_lex_s_sc",
     "Parrot_find_lex_s_sc",
@@ -12151,7 +12200,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 993 */
+  { /* 995 */
     "find_lex",
     "find_lex_i_s",
     "Parrot_find_lex_i_s",
@@ -12162,7 +12211,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 994 */
+  { /* 996 */
     "find_lex",
     "find_lex_i_sc",
     "Parrot_find_lex_i_sc",
@@ -12173,7 +12222,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 995 */
+  { /* 997 */
     "find_lex",
     "find_lex_n_s",
     "Parrot_find_lex_n_s",
@@ -12184,7 +12233,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 996 */
+  { /* 998 */
     "find_lex",
     "find_lex_n_sc",
     "Parrot_find_lex_n_sc",
@@ -12195,7 +12244,128 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 997 */
+  { /* 999 */
+    "find_lex_idx",
+    "find_lex_idx_p_sc_pc_ic_ic",
+    "Parrot_find_lex_idx_p_sc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1000 */
+    "find_lex_idx",
+    "find_lex_idx_s_sc_pc_ic_ic",
+    "Parrot_find_lex_idx_s_sc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1001 */
+    "find_lex_idx",
+    "find_lex_idx_i_sc_pc_ic_ic",
+    "Parrot_find_lex_idx_i_sc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_I, PARROT_ARG_SC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1002 */
+    "find_lex_idx",
+    "find_lex_idx_n_sc_pc_ic_ic",
+    "Parrot_find_lex_idx_n_sc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_N, PARROT_ARG_SC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1003 */
+    "store_lex_idx",
+    "store_lex_idx_sc_p_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_p_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_P, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1004 */
+    "store_lex_idx",
+    "store_lex_idx_sc_s_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_s_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_S, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1005 */
+    "store_lex_idx",
+    "store_lex_idx_sc_sc_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_sc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_SC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1006 */
+    "store_lex_idx",
+    "store_lex_idx_sc_i_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_i_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_I, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1007 */
+    "store_lex_idx",
+    "store_lex_idx_sc_ic_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_ic_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1008 */
+    "store_lex_idx",
+    "store_lex_idx_sc_n_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_n_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_N, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1009 */
+    "store_lex_idx",
+    "store_lex_idx_sc_nc_pc_ic_ic",
+    "Parrot_store_lex_idx_sc_nc_pc_ic_ic",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_NC, PARROT_ARG_PC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1010 */
     "find_dynamic_lex",
     "find_dynamic_lex_p_s",
     "Parrot_find_dynamic_lex_p_s",
@@ -12206,7 +12376,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 998 */
+  { /* 1011 */
     "find_dynamic_lex",
     "find_dynamic_lex_p_sc",
     "Parrot_find_dynamic_lex_p_sc",
@@ -12217,7 +12387,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 999 */
+  { /* 1012 */
     "find_caller_lex",
     "find_caller_lex_p_s",
     "Parrot_find_caller_lex_p_s",
@@ -12228,7 +12398,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1000 */
+  { /* 1013 */
     "find_caller_lex",
     "find_caller_lex_p_sc",
     "Parrot_find_caller_lex_p_sc",
@@ -12239,7 +12409,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1001 */
+  { /* 1014 */
     "get_namespace",
     "get_namespace_p",
     "Parrot_get_namespace_p",
@@ -12250,7 +12420,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1002 */
+  { /* 1015 */
     "get_namespace",
     "get_namespace_p_p",
     "Parrot_get_namespace_p_p",
@@ -12261,7 +12431,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1003 */
+  { /* 1016 */
     "get_namespace",
     "get_namespace_p_pc",
     "Parrot_get_namespace_p_pc",
@@ -12272,7 +12442,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1004 */
+  { /* 1017 */
     "get_hll_namespace",
     "get_hll_namespace_p",
     "Parrot_get_hll_namespace_p",
@@ -12283,7 +12453,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1005 */
+  { /* 1018 */
     "get_hll_namespace",
     "get_hll_namespace_p_p",
     "Parrot_get_hll_namespace_p_p",
@@ -12294,7 +12464,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1006 */
+  { /* 1019 */
     "get_hll_namespace",
     "get_hll_namespace_p_pc",
     "Parrot_get_hll_namespace_p_pc",
@@ -12305,7 +12475,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1007 */
+  { /* 1020 */
     "get_root_namespace",
     "get_root_namespace_p",
     "Parrot_get_root_namespace_p",
@@ -12316,7 +12486,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1008 */
+  { /* 1021 */
     "get_root_namespace",
     "get_root_namespace_p_p",
     "Parrot_get_root_namespace_p_p",
@@ -12327,7 +12497,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1009 */
+  { /* 1022 */
     "get_root_namespace",
     "get_root_namespace_p_pc",
     "Parrot_get_root_namespace_p_pc",
@@ -12338,7 +12508,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1010 */
+  { /* 1023 */
     "get_global",
     "get_global_p_s",
     "Parrot_get_global_p_s",
@@ -12349,7 +12519,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1011 */
+  { /* 1024 */
     "get_global",
     "get_global_p_sc",
     "Parrot_get_global_p_sc",
@@ -12360,7 +12530,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1012 */
+  { /* 1025 */
     "get_global",
     "get_global_p_p_s",
     "Parrot_get_global_p_p_s",
@@ -12371,7 +12541,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1013 */
+  { /* 1026 */
     "get_global",
     "get_global_p_pc_s",
     "Parrot_get_global_p_pc_s",
@@ -12382,7 +12552,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1014 */
+  { /* 1027 */
     "get_global",
     "get_global_p_p_sc",
     "Parrot_get_global_p_p_sc",
@@ -12393,7 +12563,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1015 */
+  { /* 1028 */
     "get_global",
     "get_global_p_pc_sc",
     "Parrot_get_global_p_pc_sc",
@@ -12404,7 +12574,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1016 */
+  { /* 1029 */
     "get_hll_global",
     "get_hll_global_p_s",
     "Parrot_get_hll_global_p_s",
@@ -12415,7 +12585,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1017 */
+  { /* 1030 */
     "get_hll_global",
     "get_hll_global_p_sc",
     "Parrot_get_hll_global_p_sc",
@@ -12426,7 +12596,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1018 */
+  { /* 1031 */
     "get_hll_global",
     "get_hll_global_p_p_s",
     "Parrot_get_hll_global_p_p_s",
@@ -12437,7 +12607,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1019 */
+  { /* 1032 */
     "get_hll_global",
     "get_hll_global_p_pc_s",
     "Parrot_get_hll_global_p_pc_s",
@@ -12448,7 +12618,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1020 */
+  { /* 1033 */
     "get_hll_global",
     "get_hll_global_p_p_sc",
     "Parrot_get_hll_global_p_p_sc",
@@ -12459,7 +12629,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1021 */
+  { /* 1034 */
     "get_hll_global",
     "get_hll_global_p_pc_sc",
     "Parrot_get_hll_global_p_pc_sc",
@@ -12470,7 +12640,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1022 */
+  { /* 1035 */
     "get_root_global",
     "get_root_global_p_s",
     "Parrot_get_root_global_p_s",
@@ -12481,7 +12651,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1023 */
+  { /* 1036 */
     "get_root_global",
     "get_root_global_p_sc",
     "Parrot_get_root_global_p_sc",
@@ -12492,7 +12662,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1024 */
+  { /* 1037 */
     "get_root_global",
     "get_root_global_p_p_s",
     "Parrot_get_root_global_p_p_s",
@@ -12503,7 +12673,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1025 */
+  { /* 1038 */
     "get_root_global",
     "get_root_global_p_pc_s",
     "Parrot_get_root_global_p_pc_s",
@@ -12514,7 +12684,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1026 */
+  { /* 1039 */
     "get_root_global",
     "get_root_global_p_p_sc",
     "Parrot_get_root_global_p_p_sc",
@@ -12525,7 +12695,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1027 */
+  { /* 1040 */
     "get_root_global",
     "get_root_global_p_pc_sc",
     "Parrot_get_root_global_p_pc_sc",
@@ -12536,7 +12706,73 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1028 */
+  { /* 1041 */
+    "get_global_ic",
+    "get_global_ic_p_sc_ic",
+    "Parrot_get_global_ic_p_sc_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1042 */
+    "get_global_ic",
+    "get_global_ic_p_pc_sc_ic",
+    "Parrot_get_global_ic_p_pc_sc_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_PC, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1043 */
+    "get_hll_global_ic",
+    "get_hll_global_ic_p_sc_ic",
+    "Parrot_get_hll_global_ic_p_sc_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1044 */
+    "get_hll_global_ic",
+    "get_hll_global_ic_p_pc_sc_ic",
+    "Parrot_get_hll_global_ic_p_pc_sc_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_PC, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1045 */
+    "get_root_global_ic",
+    "get_root_global_ic_p_sc_ic",
+    "Parrot_get_root_global_ic_p_sc_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1046 */
+    "get_root_global_ic",
+    "get_root_global_ic_p_pc_sc_ic",
+    "Parrot_get_root_global_ic_p_pc_sc_ic",
+    0,
+    5,
+    { PARROT_ARG_P, PARROT_ARG_PC, PARROT_ARG_SC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1047 */
     "set_global",
     "set_global_s_p",
     "Parrot_set_global_s_p",
@@ -12547,7 +12783,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1029 */
+  { /* 1048 */
     "set_global",
     "set_global_sc_p",
     "Parrot_set_global_sc_p",
@@ -12558,7 +12794,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1030 */
+  { /* 1049 */
     "set_global",
     "set_global_p_s_p",
     "Parrot_set_global_p_s_p",
@@ -12569,7 +12805,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1031 */
+  { /* 1050 */
     "set_global",
     "set_global_pc_s_p",
     "Parrot_set_global_pc_s_p",
@@ -12580,7 +12816,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1032 */
+  { /* 1051 */
     "set_global",
     "set_global_p_sc_p",
     "Parrot_set_global_p_sc_p",
@@ -12591,7 +12827,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1033 */
+  { /* 1052 */
     "set_global",
     "set_global_pc_sc_p",
     "Parrot_set_global_pc_sc_p",
@@ -12602,7 +12838,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1034 */
+  { /* 1053 */
     "set_hll_global",
     "set_hll_global_s_p",
     "Parrot_set_hll_global_s_p",
@@ -12613,7 +12849,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1035 */
+  { /* 1054 */
     "set_hll_global",
     "set_hll_global_sc_p",
     "Parrot_set_hll_global_sc_p",
@@ -12624,7 +12860,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1036 */
+  { /* 1055 */
     "set_hll_global",
     "set_hll_global_p_s_p",
     "Parrot_set_hll_global_p_s_p",
@@ -12635,7 +12871,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1037 */
+  { /* 1056 */
     "set_hll_global",
     "set_hll_global_pc_s_p",
     "Parrot_set_hll_global_pc_s_p",
@@ -12646,7 +12882,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1038 */
+  { /* 1057 */
     "set_hll_global",
     "set_hll_global_p_sc_p",
     "Parrot_set_hll_global_p_sc_p",
@@ -12657,7 +12893,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1039 */
+  { /* 1058 */
     "set_hll_global",
     "set_hll_global_pc_sc_p",
     "Parrot_set_hll_global_pc_sc_p",
@@ -12668,7 +12904,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1040 */
+  { /* 1059 */
     "set_root_global",
     "set_root_global_s_p",
     "Parrot_set_root_global_s_p",
@@ -12679,7 +12915,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1041 */
+  { /* 1060 */
     "set_root_global",
     "set_root_global_sc_p",
     "Parrot_set_root_global_sc_p",
@@ -12690,7 +12926,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1042 */
+  { /* 1061 */
     "set_root_global",
     "set_root_global_p_s_p",
     "Parrot_set_root_global_p_s_p",
@@ -12701,7 +12937,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1043 */
+  { /* 1062 */
     "set_root_global",
     "set_root_global_pc_s_p",
     "Parrot_set_root_global_pc_s_p",
@@ -12712,7 +12948,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1044 */
+  { /* 1063 */
     "set_root_global",
     "set_root_global_p_sc_p",
     "Parrot_set_root_global_p_sc_p",
@@ -12723,7 +12959,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1045 */
+  { /* 1064 */
     "set_root_global",
     "set_root_global_pc_sc_p",
     "Parrot_set_root_global_pc_sc_p",
@@ -12734,7 +12970,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1046 */
+  { /* 1065 */
     "find_name",
     "find_name_p_s",
     "Parrot_find_name_p_s",
@@ -12745,7 +12981,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1047 */
+  { /* 1066 */
     "find_name",
     "find_name_p_sc",
     "Parrot_find_name_p_sc",
@@ -12756,7 +12992,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1048 */
+  { /* 1067 */
     "find_sub_not_null",
     "find_sub_not_null_p_s",
     "Parrot_find_sub_not_null_p_s",
@@ -12767,7 +13003,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1049 */
+  { /* 1068 */
     "find_sub_not_null",
     "find_sub_not_null_p_sc",
     "Parrot_find_sub_not_null_p_sc",
@@ -12778,7 +13014,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1050 */
+  { /* 1069 */
     "trap",
     "trap",
     "Parrot_trap",
@@ -12789,7 +13025,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1051 */
+  { /* 1070 */
     "set_label",
     "set_label_p_ic",
     "Parrot_set_label_p_ic",
@@ -12800,7 +13036,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 1 },
     &core_op_lib
   },
-  { /* 1052 */
+  { /* 1071 */
     "get_label",
     "get_label_i_p",
     "Parrot_get_label_i_p",
@@ -12811,7 +13047,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1053 */
+  { /* 1072 */
     "get_id",
     "get_id_i_p",
     "Parrot_get_id_i_p",
@@ -12822,7 +13058,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1054 */
+  { /* 1073 */
     "get_id",
     "get_id_i_pc",
     "Parrot_get_id_i_pc",
@@ -12833,7 +13069,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1055 */
+  { /* 1074 */
     "fetch",
     "fetch_p_p_p_p",
     "Parrot_fetch_p_p_p_p",
@@ -12844,7 +13080,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1056 */
+  { /* 1075 */
     "fetch",
     "fetch_p_pc_p_p",
     "Parrot_fetch_p_pc_p_p",
@@ -12855,7 +13091,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1057 */
+  { /* 1076 */
     "fetch",
     "fetch_p_p_pc_p",
     "Parrot_fetch_p_p_pc_p",
@@ -12866,7 +13102,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1058 */
+  { /* 1077 */
     "fetch",
     "fetch_p_pc_pc_p",
     "Parrot_fetch_p_pc_pc_p",
@@ -12877,7 +13113,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1059 */
+  { /* 1078 */
     "fetch",
     "fetch_p_p_p_pc",
     "Parrot_fetch_p_p_p_pc",
@@ -12888,7 +13124,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1060 */
+  { /* 1079 */
     "fetch",
     "fetch_p_pc_p_pc",
     "Parrot_fetch_p_pc_p_pc",
@@ -12899,7 +13135,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1061 */
+  { /* 1080 */
     "fetch",
     "fetch_p_p_pc_pc",
     "Parrot_fetch_p_p_pc_pc",
@@ -12910,7 +13146,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1062 */
+  { /* 1081 */
     "fetch",
     "fetch_p_pc_pc_pc",
     "Parrot_fetch_p_pc_pc_pc",
@@ -12921,7 +13157,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1063 */
+  { /* 1082 */
     "fetch",
     "fetch_p_p_i_p",
     "Parrot_fetch_p_p_i_p",
@@ -12932,7 +13168,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1064 */
+  { /* 1083 */
     "fetch",
     "fetch_p_pc_i_p",
     "Parrot_fetch_p_pc_i_p",
@@ -12943,7 +13179,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1065 */
+  { /* 1084 */
     "fetch",
     "fetch_p_p_ic_p",
     "Parrot_fetch_p_p_ic_p",
@@ -12954,7 +13190,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1066 */
+  { /* 1085 */
     "fetch",
     "fetch_p_pc_ic_p",
     "Parrot_fetch_p_pc_ic_p",
@@ -12965,7 +13201,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1067 */
+  { /* 1086 */
     "fetch",
     "fetch_p_p_i_pc",
     "Parrot_fetch_p_p_i_pc",
@@ -12976,7 +13212,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1068 */
+  { /* 1087 */
     "fetch",
     "fetch_p_pc_i_pc",
     "Parrot_fetch_p_pc_i_pc",
@@ -12987,7 +13223,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1069 */
+  { /* 1088 */
     "fetch",
     "fetch_p_p_ic_pc",
     "Parrot_fetch_p_p_ic_pc",
@@ -12998,7 +13234,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1070 */
+  { /* 1089 */
     "fetch",
     "fetch_p_pc_ic_pc",
     "Parrot_fetch_p_pc_ic_pc",
@@ -13009,7 +13245,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1071 */
+  { /* 1090 */
     "fetch",
     "fetch_p_p_s_p",
     "Parrot_fetch_p_p_s_p",
@@ -13020,7 +13256,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1072 */
+  { /* 1091 */
     "fetch",
     "fetch_p_pc_s_p",
     "Parrot_fetch_p_pc_s_p",
@@ -13031,7 +13267,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1073 */
+  { /* 1092 */
     "fetch",
     "fetch_p_p_sc_p",
     "Parrot_fetch_p_p_sc_p",
@@ -13042,7 +13278,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1074 */
+  { /* 1093 */
     "fetch",
     "fetch_p_pc_sc_p",
     "Parrot_fetch_p_pc_sc_p",
@@ -13053,7 +13289,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1075 */
+  { /* 1094 */
     "fetch",
     "fetch_p_p_s_pc",
     "Parrot_fetch_p_p_s_pc",
@@ -13064,7 +13300,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1076 */
+  { /* 1095 */
     "fetch",
     "fetch_p_pc_s_pc",
     "Parrot_fetch_p_pc_s_pc",
@@ -13075,7 +13311,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1077 */
+  { /* 1096 */
     "fetch",
     "fetch_p_p_sc_pc",
     "Parrot_fetch_p_p_sc_pc",
@@ -13086,7 +13322,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1078 */
+  { /* 1097 */
     "fetch",
     "fetch_p_pc_sc_pc",
     "Parrot_fetch_p_pc_sc_pc",
@@ -13097,7 +13333,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1079 */
+  { /* 1098 */
     "vivify",
     "vivify_p_p_p_p",
     "Parrot_vivify_p_p_p_p",
@@ -13108,7 +13344,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1080 */
+  { /* 1099 */
     "vivify",
     "vivify_p_pc_p_p",
     "Parrot_vivify_p_pc_p_p",
@@ -13119,7 +13355,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1081 */
+  { /* 1100 */
     "vivify",
     "vivify_p_p_pc_p",
     "Parrot_vivify_p_p_pc_p",
@@ -13130,7 +13366,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1082 */
+  { /* 1101 */
     "vivify",
     "vivify_p_pc_pc_p",
     "Parrot_vivify_p_pc_pc_p",
@@ -13141,7 +13377,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1083 */
+  { /* 1102 */
     "vivify",
     "vivify_p_p_p_pc",
     "Parrot_vivify_p_p_p_pc",
@@ -13152,7 +13388,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1084 */
+  { /* 1103 */
     "vivify",
     "vivify_p_pc_p_pc",
     "Parrot_vivify_p_pc_p_pc",
@@ -13163,7 +13399,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1085 */
+  { /* 1104 */
     "vivify",
     "vivify_p_p_pc_pc",
     "Parrot_vivify_p_p_pc_pc",
@@ -13174,7 +13410,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1086 */
+  { /* 1105 */
     "vivify",
     "vivify_p_pc_pc_pc",
     "Parrot_vivify_p_pc_pc_pc",
@@ -13185,7 +13421,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1087 */
+  { /* 1106 */
     "vivify",
     "vivify_p_p_i_p",
     "Parrot_vivify_p_p_i_p",
@@ -13196,7 +13432,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1088 */
+  { /* 1107 */
     "vivify",
     "vivify_p_pc_i_p",
     "Parrot_vivify_p_pc_i_p",
@@ -13207,7 +13443,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1089 */
+  { /* 1108 */
     "vivify",
     "vivify_p_p_ic_p",
     "Parrot_vivify_p_p_ic_p",
@@ -13218,7 +13454,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1090 */
+  { /* 1109 */
     "vivify",
     "vivify_p_pc_ic_p",
     "Parrot_vivify_p_pc_ic_p",
@@ -13229,7 +13465,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1091 */
+  { /* 1110 */
     "vivify",
     "vivify_p_p_i_pc",
     "Parrot_vivify_p_p_i_pc",
@@ -13240,7 +13476,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1092 */
+  { /* 1111 */
     "vivify",
     "vivify_p_pc_i_pc",
     "Parrot_vivify_p_pc_i_pc",
@@ -13251,7 +13487,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1093 */
+  { /* 1112 */
     "vivify",
     "vivify_p_p_ic_pc",
     "Parrot_vivify_p_p_ic_pc",
@@ -13262,7 +13498,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1094 */
+  { /* 1113 */
     "vivify",
     "vivify_p_pc_ic_pc",
     "Parrot_vivify_p_pc_ic_pc",
@@ -13273,7 +13509,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1095 */
+  { /* 1114 */
     "vivify",
     "vivify_p_p_s_p",
     "Parrot_vivify_p_p_s_p",
@@ -13284,7 +13520,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1096 */
+  { /* 1115 */
     "vivify",
     "vivify_p_pc_s_p",
     "Parrot_vivify_p_pc_s_p",
@@ -13295,7 +13531,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1097 */
+  { /* 1116 */
     "vivify",
     "vivify_p_p_sc_p",
     "Parrot_vivify_p_p_sc_p",
@@ -13306,7 +13542,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1098 */
+  { /* 1117 */
     "vivify",
     "vivify_p_pc_sc_p",
     "Parrot_vivify_p_pc_sc_p",
@@ -13317,7 +13553,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1099 */
+  { /* 1118 */
     "vivify",
     "vivify_p_p_s_pc",
     "Parrot_vivify_p_p_s_pc",
@@ -13328,7 +13564,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1100 */
+  { /* 1119 */
     "vivify",
     "vivify_p_pc_s_pc",
     "Parrot_vivify_p_pc_s_pc",
@@ -13339,7 +13575,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1101 */
+  { /* 1120 */
     "vivify",
     "vivify_p_p_sc_pc",
     "Parrot_vivify_p_p_sc_pc",
@@ -13350,7 +13586,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1102 */
+  { /* 1121 */
     "vivify",
     "vivify_p_pc_sc_pc",
     "Parrot_vivify_p_pc_sc_pc",
@@ -13361,7 +13597,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1103 */
+  { /* 1122 */
     "new",
     "new_p_s_i",
     "Parrot_new_p_s_i",
@@ -13372,7 +13608,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1104 */
+  { /* 1123 */
     "new",
     "new_p_sc_i",
     "Parrot_new_p_sc_i",
@@ -13383,7 +13619,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1105 */
+  { /* 1124 */
     "new",
     "new_p_s_ic",
     "Parrot_new_p_s_ic",
@@ -13394,7 +13630,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1106 */
+  { /* 1125 */
     "new",
     "new_p_sc_ic",
     "Parrot_new_p_sc_ic",
@@ -13405,7 +13641,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1107 */
+  { /* 1126 */
     "new",
     "new_p_p_i",
     "Parrot_new_p_p_i",
@@ -13416,7 +13652,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1108 */
+  { /* 1127 */
     "new",
     "new_p_pc_i",
     "Parrot_new_p_pc_i",
@@ -13427,7 +13663,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1109 */
+  { /* 1128 */
     "new",
     "new_p_p_ic",
     "Parrot_new_p_p_ic",
@@ -13438,7 +13674,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1110 */
+  { /* 1129 */
     "new",
     "new_p_pc_ic",
     "Parrot_new_p_pc_ic",
@@ -13449,7 +13685,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1111 */
+  { /* 1130 */
     "root_new",
     "root_new_p_p_i",
     "Parrot_root_new_p_p_i",
@@ -13460,7 +13696,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1112 */
+  { /* 1131 */
     "root_new",
     "root_new_p_pc_i",
     "Parrot_root_new_p_pc_i",
@@ -13471,7 +13707,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1113 */
+  { /* 1132 */
     "root_new",
     "root_new_p_p_ic",
     "Parrot_root_new_p_p_ic",
@@ -13482,7 +13718,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1114 */
+  { /* 1133 */
     "root_new",
     "root_new_p_pc_ic",
     "Parrot_root_new_p_pc_ic",
@@ -13493,7 +13729,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1115 */
+  { /* 1134 */
     "get_context",
     "get_context_p",
     "Parrot_get_context_p",
@@ -13504,7 +13740,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1116 */
+  { /* 1135 */
     "new_call_context",
     "new_call_context_p",
     "Parrot_new_call_context_p",
@@ -13515,7 +13751,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1117 */
+  { /* 1136 */
     "invokecc",
     "invokecc_p_p",
     "Parrot_invokecc_p_p",
@@ -13526,7 +13762,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1118 */
+  { /* 1137 */
     "flatten_array_into",
     "flatten_array_into_p_p_i",
     "Parrot_flatten_array_into_p_p_i",
@@ -13537,7 +13773,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1119 */
+  { /* 1138 */
     "flatten_array_into",
     "flatten_array_into_p_p_ic",
     "Parrot_flatten_array_into_p_p_ic",
@@ -13548,7 +13784,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1120 */
+  { /* 1139 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_i",
     "Parrot_flatten_hash_into_p_p_i",
@@ -13559,7 +13795,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1121 */
+  { /* 1140 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_ic",
     "Parrot_flatten_hash_into_p_p_ic",
@@ -13570,7 +13806,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1122 */
+  { /* 1141 */
     "slurp_array_from",
     "slurp_array_from_p_p_i",
     "Parrot_slurp_array_from_p_p_i",
@@ -13581,7 +13817,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1123 */
+  { /* 1142 */
     "slurp_array_from",
     "slurp_array_from_p_p_ic",
     "Parrot_slurp_array_from_p_p_ic",
@@ -13592,7 +13828,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1124 */
+  { /* 1143 */
     "receive",
     "receive_p",
     "Parrot_receive_p",
@@ -13603,7 +13839,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1125 */
+  { /* 1144 */
     "wait",
     "wait_p",
     "Parrot_wait_p",
@@ -13614,7 +13850,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1126 */
+  { /* 1145 */
     "wait",
     "wait_pc",
     "Parrot_wait_pc",
@@ -13625,7 +13861,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1127 */
+  { /* 1146 */
     "pass",
     "pass",
     "Parrot_pass",
@@ -13636,7 +13872,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1128 */
+  { /* 1147 */
     "disable_preemption",
     "disable_preemption",
     "Parrot_disable_preemption",
@@ -13647,7 +13883,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1129 */
+  { /* 1148 */
     "enable_preemption",
     "enable_preemption",
     "Parrot_enable_preemption",
@@ -13658,7 +13894,7 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1130 */
+  { /* 1149 */
     "terminate",
     "terminate",
     "Parrot_terminate",
@@ -13669,6 +13905,83 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1150 */
+    "throw_control",
+    "throw_control_i",
+    "Parrot_throw_control_i",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1151 */
+    "throw_control",
+    "throw_control_ic",
+    "Parrot_throw_control_ic",
+    0,
+    2,
+    { PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1152 */
+    "throw_control",
+    "throw_control_i_p",
+    "Parrot_throw_control_i_p",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1153 */
+    "throw_control",
+    "throw_control_ic_p",
+    "Parrot_throw_control_ic_p",
+    0,
+    3,
+    { PARROT_ARG_IC, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1154 */
+    "resume",
+    "resume_p_p",
+    "Parrot_resume_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1155 */
+    "yield",
+    "yield_p",
+    "Parrot_yield_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1156 */
+    "share_ro",
+    "share_ro_p_p",
+    "Parrot_share_ro_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
 
 };
 
@@ -13949,10 +14262,20 @@ Parrot_tailcall_p(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t    * dest =  cur_opcode + 2;
     PMC  * const  ctx = CURRENT_CONTEXT(interp);
     PMC  * const  parent_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
-    PMC  * const  this_call_sig = Parrot_pcc_get_signature(interp, ctx);
     PMC  * const  parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
+    PMC  *        this_call_sig = Parrot_pcc_get_signature(interp, ctx);
 
     interp->current_cont = Parrot_pcc_get_continuation(interp, ctx);
+    if (this_call_sig == ctx) {
+        if (p->vtable->base_type == enum_class_Sub) {
+            dest = VTABLE_invoke(interp, p, dest);
+            return (opcode_t *)dest;
+        }
+
+        this_call_sig = VTABLE_clone(interp, ctx);
+        Parrot_pcc_set_signature(interp, ctx, this_call_sig);
+    }
+
     Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
     SUB_FLAG_TAILCALL_SET(interp->current_cont);
     dest = VTABLE_invoke(interp, p, dest);
@@ -13984,7 +14307,7 @@ opcode_t *
 Parrot_set_args_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  raw_args = CUR_OPCODE;
     PMC  * const  signature = PCONST(1);
-    PMC  * const  call_sig = Parrot_pcc_build_sig_object_from_op(interp, PMCNULL, signature, raw_args);
+    PMC  * const  call_sig = Parrot_pcc_build_call_from_op(interp, signature, raw_args);
     INTVAL   argc;
 
     GETATTR_FixedIntegerArray_size(interp, signature, argc);
@@ -14002,7 +14325,7 @@ Parrot_get_params_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  call_object = Parrot_pcc_get_signature(interp, caller_ctx);
     INTVAL   argc;
 
-    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_PARAM_COUNT_FLAG);
+    Parrot_pcc_fill_sub_params_from_op(interp, Parrot_pcc_get_sub(interp, ctx), call_object, signature, raw_params);
     if (PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
         (PObj_get_FLAGS(ccont) &= (~SUB_FLAG_TAILCALL));
         Parrot_pcc_dec_recursion_depth(interp, ctx);
@@ -14119,10 +14442,7 @@ Parrot_addhandler_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_push_eh_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
-
-    VTABLE_set_pointer(interp, eh, (CUR_OPCODE + ICONST(1)));
-    Parrot_cx_add_handler_local(interp, eh);
+    Parrot_cx_record_handler_local(interp, (CUR_OPCODE + ICONST(1)), 0);
     return cur_opcode + 2;
 }
 
@@ -20389,8 +20709,21 @@ Parrot_thaw_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_thaw(interp, SCONST(2));
+Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_freeze_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_freeze_to_handle(interp, PREG(2), PREG(1));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_thaw_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw_from_handle(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
@@ -22937,6 +23270,229 @@ Parrot_find_lex_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 3;
 }
 
+opcode_t *
+Parrot_find_lex_idx_p_sc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PREG(1) = CTX_REG_PMC(interp, ctx, ICONST(5));
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(2), CURRENT_CONTEXT(interp));
+
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, SCONST(2));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_lex_idx_s_sc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        SREG(1) = CTX_REG_STR(interp, ctx, ICONST(5));
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(2), CURRENT_CONTEXT(interp));
+
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, SCONST(2));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_lex_idx_i_sc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        IREG(1) = CTX_REG_INT(interp, ctx, ICONST(5));
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(2), CURRENT_CONTEXT(interp));
+
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, SCONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_lex_idx_n_sc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        NREG(1) = CTX_REG_NUM(interp, ctx, ICONST(5));
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(2), CURRENT_CONTEXT(interp));
+
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, SCONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_p_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_PMC(interp, ctx, ICONST(5)) = PREG(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, SCONST(1), PREG(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_s_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_STR(interp, ctx, ICONST(5)) = SREG(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, SCONST(1), SREG(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_sc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_STR(interp, ctx, ICONST(5)) = SCONST(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, SCONST(1), SCONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_i_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_INT(interp, ctx, ICONST(5)) = IREG(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, SCONST(1), IREG(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_ic_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_INT(interp, ctx, ICONST(5)) = ICONST(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, SCONST(1), ICONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_n_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_NUM(interp, ctx, ICONST(5)) = NREG(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, SCONST(1), NREG(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_store_lex_idx_sc_nc_pc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_lex_ctx(interp, CURRENT_CONTEXT(interp), PCONST(3), ICONST(4));
+
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_NUM(interp, ctx, ICONST(5)) = NCONST(2);
+    }
+    else {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, SCONST(1), CURRENT_CONTEXT(interp));
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", SCONST(1));
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, SCONST(1), NCONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
 opcode_t *
 Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     STRING   * const  lex_name = SREG(2);
@@ -23460,6 +24016,56 @@ Parrot_get_root_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 4;
 }
 
+opcode_t *
+Parrot_get_global_ic_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_cached(interp, cur_ns, PMCNULL, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_get_global_ic_p_pc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_cached(interp, cur_ns, PCONST(2), SCONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_get_hll_global_ic_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_cached(interp, hll_ns, PMCNULL, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_get_hll_global_ic_p_pc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_cached(interp, hll_ns, PCONST(2), SCONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_get_root_global_ic_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_ns_find_global_cached(interp, interp->root_namespace, PMCNULL, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_get_root_global_ic_p_pc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_ns_find_global_cached(interp, interp->root_namespace, PCONST(2), SCONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
 opcode_t *
 Parrot_set_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
@@ -24669,6 +25275,7 @@ Parrot_root_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 opcode_t *
 Parrot_get_context_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PREG(1) = CURRENT_CONTEXT(interp);
+    Parrot_pcc_capture_context(interp, PREG(1));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 2;
 }
@@ -24788,69 +25395,34 @@ Parrot_receive_p(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  *const  dest =  cur_opcode + 2;
     PMC  * cur_task = Parrot_cx_current_task(interp);
     Parrot_Task_attributes  * tdata = PARROT_TASK(cur_task);
-    int   msg_count;
-
-    if (tdata->partner) {
-        Parrot_Task_attributes  * const  pdata = PARROT_TASK(tdata->partner);
-
-        LOCK(pdata->mailbox_lock);
-        Parrot_block_GC_mark(interp);
-        if (PMC_IS_NULL(pdata->mailbox)) {
-            msg_count = 0;
-        }
-        else {
-            msg_count = VTABLE_elements(interp, pdata->mailbox);
-        }
-
-        if (msg_count > 0) {
-            PREG(1) = VTABLE_shift_pmc(pdata->interp, pdata->mailbox);
-            Parrot_unblock_GC_mark(interp);
-            UNLOCK(pdata->mailbox_lock);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)dest;
-            }
-
-        }
-        else {
-            Parrot_unblock_GC_mark(interp);
-            TASK_recv_block_SET(cur_task);
-            (void)Parrot_cx_stop_task(interp, cur_opcode);
-            UNLOCK(pdata->mailbox_lock);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
-            }
+    Parrot_mailbox  * const  mailbox = tdata->partner ? PARROT_TASK(tdata->partner)->mailbox : tdata->mailbox;
+    PMC  * const  message = Parrot_mailbox_shift(mailbox);
 
+    if (message) {
+        PREG(1) = message;
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
         }
 
     }
-    else {
-        if (PMC_IS_NULL(tdata->mailbox)) {
-            msg_count = 0;
-        }
-        else {
-            msg_count = VTABLE_elements(interp, tdata->mailbox);
-        }
-
-        if (msg_count > 0) {
-            PREG(1) = VTABLE_shift_pmc(interp, tdata->mailbox);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)dest;
-            }
 
+    LOCK(mailbox->lock);
+    if (Parrot_mailbox_is_empty(mailbox)) {
+        TASK_recv_block_SET(cur_task);
+        (void)Parrot_cx_stop_task(interp, cur_opcode);
+        UNLOCK(mailbox->lock);
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)Parrot_cx_leave_task(interp, cur_opcode);
         }
-        else {
-            TASK_recv_block_SET(cur_task);
-            (void)Parrot_cx_stop_task(interp, cur_opcode);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
-            }
 
-        }
+    }
 
+    UNLOCK(mailbox->lock);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)cur_opcode;
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
@@ -24883,7 +25455,7 @@ Parrot_wait_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
     VTABLE_push_pmc(interp, tdata->waiters, cur_task);
     UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
+    return (opcode_t *)Parrot_cx_leave_task(interp, next);
     return cur_opcode + 2;
 }
 
@@ -24913,7 +25485,7 @@ Parrot_wait_pc(opcode_t *cur_opcode, PARROT_INTERP) {
 
     VTABLE_push_pmc(interp, tdata->waiters, cur_task);
     UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
+    return (opcode_t *)Parrot_cx_leave_task(interp, next);
     return cur_opcode + 2;
 }
 
@@ -24946,6 +25518,65 @@ Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_throw_control_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest = Parrot_ex_throw_control_from_op(interp, IREG(1), PMCNULL,  cur_opcode + 2);
+
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_throw_control_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest = Parrot_ex_throw_control_from_op(interp, ICONST(1), PMCNULL,  cur_opcode + 2);
+
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_throw_control_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest = Parrot_ex_throw_control_from_op(interp, IREG(1), PREG(2),  cur_opcode + 3);
+
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_throw_control_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest = Parrot_ex_throw_control_from_op(interp, ICONST(1), PREG(2),  cur_opcode + 3);
+
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_resume_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * value = PMCNULL;
+    opcode_t  * const  dest = Parrot_sub_resume_coroutine(interp, PREG(2), (&value), CUR_OPCODE, next);
+
+    if (dest == next) {
+        PREG(1) = value;
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
+
+}
+
+opcode_t *
+Parrot_yield_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest = Parrot_sub_yield_coroutine(interp, PREG(1),  cur_opcode + 2);
+
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_share_ro_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thread_share_ro(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
 
 /*
 ** op lib descriptor:
@@ -24959,7 +25590,7 @@ op_lib_t core_op_lib = {
   0,                                /* flags */
   PARROT_PBC_MAJOR,
   PARROT_PBC_MINOR,
-  1131,             /* op_count */
+  1157,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
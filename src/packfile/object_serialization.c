@@ -22,6 +22,7 @@ individual action vtable (freeze/thaw) is then called for all todo-PMCs.
 */
 
 #include "parrot/parrot.h"
+#include "parrot/events.h"
 #include "pmc/pmc_callcontext.h"
 #include "object_serialization.str"
 
@@ -59,6 +60,28 @@ Parrot_freeze(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<void Parrot_freeze_to_handle(PARROT_INTERP, PMC *pmc, PMC *handle)>
+
+Freezes C<pmc> and writes the image to the IO C<handle> as it is produced,
+in chunks of at most C<FREEZE_STREAM_CHUNK> bytes, instead of building it
+in memory first. The image is read back with C<Parrot_thaw_from_handle>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_freeze_to_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_freeze_to_handle)
+    PMC * const image = Parrot_pmc_new_init(interp, enum_class_ImageIOFreeze, handle);
+    VTABLE_set_pmc(interp, image, pmc);
+}
+
+
 /*
 
 =item C<opcode_t * Parrot_freeze_pbc(PARROT_INTERP, PMC *pmc, const
@@ -242,6 +265,60 @@ Parrot_thaw(PARROT_INTERP, ARGIN(STRING *image))
 }
 
 
+/*
+
+=item C<PMC * Parrot_thaw_from_handle(PARROT_INTERP, PMC *handle)>
+
+Thaws a PMC from an image written to C<handle> by C<Parrot_freeze_to_handle>,
+reading it one chunk at a time. Called from the C<thaw> opcode.
+
+GC is blocked while thawing. An exception thrown by the thaw, say for an
+image cut short, unblocks it on the way out.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_thaw_from_handle(PARROT_INTERP, ARGMOD(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_thaw_from_handle)
+
+    PMC           *result;
+    PMC * const    info = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+    PMC * const    ctx  = CURRENT_CONTEXT(interp);
+    Parrot_runloop jmp;
+
+    /* see Parrot_thaw */
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    if (setjmp(jmp.resume)) {
+        /* A short or broken image is up to the caller, but GC has to run
+         * again whatever it does about it */
+        PMC * const exception = jmp.exception;
+        Parrot_pcc_set_context(interp, ctx);
+        Parrot_cx_delete_handler_local(interp);
+        Parrot_unblock_GC_mark(interp);
+        Parrot_unblock_GC_sweep(interp);
+        Parrot_ex_rethrow_from_c(interp, exception);
+    }
+
+    Parrot_ex_add_c_handler(interp, &jmp);
+    VTABLE_set_pmc(interp, info, handle);
+    result = VTABLE_get_pmc(interp, info);
+    Parrot_cx_delete_handler_local(interp);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+
+    return result;
+}
+
+
 /*
 
 =item C<PMC* Parrot_thaw_pbc(PARROT_INTERP, PackFile_ConstTable *ct, const
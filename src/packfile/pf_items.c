@@ -350,6 +350,13 @@ static opcode_t fetch_op_le_8(ARGIN(const unsigned char *b))
  */
 #define ROUND_UP(val, size) (((val) + ((size) - 1))/(size))
 
+/*
+ * map signed integers to unsigned ones with small magnitudes first
+ * (0, -1, 1, -2, ...) for the variable length integer encoding
+ */
+#define ZIGZAG_ENCODE(i) ((i) < 0 ? ~((UINTVAL)(i) << 1) : (UINTVAL)(i) << 1)
+#define ZIGZAG_DECODE(u) ((INTVAL)((u) >> 1) ^ -(INTVAL)((u) & 1))
+
 /*
  * offset not in ptr diff, but in byte
  */
@@ -1304,6 +1311,118 @@ PF_size_number(void)
 
 /*
 
+=item C<void PF_fetch_varints(PackFile *pf, const opcode_t **stream, INTVAL
+*values, size_t count)>
+
+Fetches C<count> integers written by C<PF_store_varints> into C<values>.
+The encoding is a byte stream, so no byteorder conversion is needed; the
+stream pointer is advanced past the padding to the next packfile word.
+
+=cut
+
+*/
+
+void
+PF_fetch_varints(ARGIN_NULLOK(PackFile *pf), ARGMOD(const opcode_t **stream),
+        ARGOUT(INTVAL *values), size_t count)
+{
+    ASSERT_ARGS(PF_fetch_varints)
+    const int            wordsize = pf ? pf->header->wordsize : sizeof (opcode_t);
+    const unsigned char *start    = (const unsigned char *)*stream;
+    const unsigned char *b        = start;
+    size_t               i;
+
+    for (i = 0; i < count; ++i) {
+        UINTVAL u     = 0;
+        int     shift = 0;
+
+        do {
+            if (shift < (int)(8 * sizeof (UINTVAL)))
+                u |= (UINTVAL)(*b & 0x7f) << shift;
+            shift += 7;
+        } while (*b++ & 0x80);
+
+        values[i] = ZIGZAG_DECODE(u);
+    }
+
+    *((const unsigned char **)(stream)) = start + ROUND_UP_B(b - start, wordsize);
+}
+
+/*
+
+=item C<opcode_t* PF_store_varints(opcode_t *cursor, const INTVAL *values,
+size_t count)>
+
+Writes C<count> integers as zigzag LEB128 bytes: seven bits per byte with
+the high bit set on all but the last byte of each value, so small values
+of either sign take a single byte.  The block is zero-padded to a whole
+C<opcode_t>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+opcode_t*
+PF_store_varints(ARGOUT(opcode_t *cursor), ARGIN(const INTVAL *values), size_t count)
+{
+    ASSERT_ARGS(PF_store_varints)
+    unsigned char * const start = (unsigned char *)cursor;
+    unsigned char        *b     = start;
+    size_t                i;
+
+    for (i = 0; i < count; ++i) {
+        UINTVAL u = ZIGZAG_ENCODE(values[i]);
+
+        while (u > 0x7f) {
+            *b++ = (unsigned char)(u & 0x7f) | 0x80;
+            u  >>= 7;
+        }
+
+        *b++ = (unsigned char)u;
+    }
+
+    /* Pad up to wordsize boundary. */
+    while ((b - start) % sizeof (opcode_t))
+        *b++ = 0;
+
+    return (opcode_t *)b;
+}
+
+/*
+
+=item C<size_t PF_size_varints(const INTVAL *values, size_t count)>
+
+Returns the stored size of C<count> integers written by
+C<PF_store_varints> in C<opcode_t> units.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+size_t
+PF_size_varints(ARGIN(const INTVAL *values), size_t count)
+{
+    ASSERT_ARGS(PF_size_varints)
+    size_t bytes = 0;
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        UINTVAL u = ZIGZAG_ENCODE(values[i]);
+
+        do {
+            ++bytes;
+            u >>= 7;
+        } while (u);
+    }
+
+    return ROUND_UP(bytes, sizeof (opcode_t));
+}
+
+/*
+
 =item C<STRING * PF_fetch_buf(PARROT_INTERP, PackFile *pf, const opcode_t
 **cursor)>
 
@@ -2140,6 +2140,8 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     if (byte_code->libdeps)
         mem_gc_free(interp, byte_code->libdeps);
 
+    Parrot_ns_destroy_caches(interp, byte_code);
+
     if (byte_code->annotations)
         annotations_destroy(interp, (PackFile_Segment *)byte_code->annotations);
 
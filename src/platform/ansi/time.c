@@ -61,6 +61,23 @@ Parrot_floatval_time(void)
     return (FLOATVAL)Parrot_intval_time();
 }
 
+/*
+
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Note:  ANSI-C has no monotonic clock, so this is the same as
+C<Parrot_floatval_time()>.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+    return Parrot_floatval_time();
+}
+
 
 /*
 
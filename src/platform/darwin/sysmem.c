@@ -107,6 +107,33 @@ Parrot_sysmem_amount(PARROT_INTERP)
 
 /*
 
+=item C<size_t Parrot_sysmem_max_rss(PARROT_INTERP)>
+
+Returns the peak resident set size of the process in bytes, or 0 if it is
+not known.
+
+=cut
+
+*/
+
+size_t
+Parrot_sysmem_max_rss(PARROT_INTERP)
+{
+    UNUSED(interp);
+#if defined(PARROT_HAS_HEADER_SYSRESOURCE)
+    {
+        struct rusage usage;
+
+        /* unlike elsewhere, Darwin counts in bytes */
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+            return (size_t)usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+/*
+
 =back
 
 =cut
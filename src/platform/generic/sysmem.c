@@ -166,6 +166,33 @@ Parrot_sysmem_amount(PARROT_INTERP)
 
 /*
 
+=item C<size_t Parrot_sysmem_max_rss(PARROT_INTERP)>
+
+Returns the peak resident set size of the process in bytes, or 0 if it is
+not known.
+
+=cut
+
+*/
+
+size_t
+Parrot_sysmem_max_rss(PARROT_INTERP)
+{
+    UNUSED(interp);
+#if defined(PARROT_HAS_HEADER_SYSRESOURCE)
+    {
+        struct rusage usage;
+
+        /* Linux and the BSDs count in kilobytes */
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+            return (size_t)usage.ru_maxrss * 1024;
+    }
+#endif
+    return 0;
+}
+
+/*
+
 =back
 
 =cut
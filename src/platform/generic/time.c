@@ -65,6 +65,29 @@ Parrot_floatval_time(void)
 
 /*
 
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Returns the seconds elapsed since some unspecified point in the past, from a
+clock that is not affected by changes to the system time. Only differences
+between two results are meaningful.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+#if defined(_POSIX_TIMERS) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return (FLOATVAL)ts.tv_sec + ((FLOATVAL)ts.tv_nsec / 1000000000.0);
+#endif
+    return Parrot_floatval_time();
+}
+
+/*
+
 =item C<void Parrot_sleep(unsigned int seconds)>
 
 Parrot wrapper around standard library C<sleep()> function.
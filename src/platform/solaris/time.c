@@ -65,6 +65,24 @@ Parrot_floatval_time(void)
 
 /*
 
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Returns the seconds elapsed since some unspecified point in the past, from a
+clock that is not affected by changes to the system time, using
+C<gethrtime()>. Only differences between two results are meaningful.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+    return (FLOATVAL)gethrtime() / 1000000000.0;
+}
+
+/*
+
 =item C<void Parrot_sleep(unsigned int seconds)>
 
 Parrot wrapper around standard library C<sleep()> function.
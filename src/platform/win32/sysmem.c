@@ -57,6 +57,25 @@ Parrot_sysmem_amount(PARROT_INTERP)
 
 /*
 
+=item C<size_t Parrot_sysmem_max_rss(PARROT_INTERP)>
+
+Returns the peak resident set size of the process in bytes, or 0 if it is
+not known.
+
+=cut
+
+*/
+
+size_t
+Parrot_sysmem_max_rss(PARROT_INTERP)
+{
+    /* GetProcessMemoryInfo() would need psapi, which we don't link */
+    UNUSED(interp);
+    return 0;
+}
+
+/*
+
 =back
 
 =cut
@@ -0,0 +1,363 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/counters.c - Hardware performance counters for runcores
+
+=head1 DESCRIPTION
+
+This file implements a small layer over the Linux C<perf_event_open>
+interface that any runcore can attach to. It opens a group of counters for
+the calling thread, counting in user mode only, and reads all of them with
+a single system call, so a runcore can take the difference of two reads
+exactly like it does with tick counts.
+
+The counters are selected by a comma separated list of names:
+
+  cycles          CPU cycles
+  instructions    retired instructions
+  cache-misses    last level cache misses
+  branch-misses   mispredicted branches
+  task-clock      CPU time in nanoseconds
+  page-faults     page faults
+
+C<1> or C<all> select the first four, which gives the instructions per
+cycle and the cache and branch behaviour of the code being run.
+
+Counters the CPU or the kernel do not provide are silently left out, and
+on systems without C<perf_event_open> no counter is ever opened. Callers
+then fall back to whatever they measured before.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/runcore_counters.h"
+
+#ifdef PARROT_HAS_HEADER_LINUXPERF_EVENT
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+/* HEADERIZER HFILE: include/parrot/runcore_counters.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static int open_counter(Parrot_runcore_counter counter, int leader);
+static INTVAL parse_counters(PARROT_INTERP,
+    ARGIN(STRING *spec),
+    ARGOUT(Parrot_runcore_counter *wanted))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*wanted);
+
+#define ASSERT_ARGS_open_counter __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_parse_counters __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(spec) \
+    , PARROT_ASSERT_ARG(wanted))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+static const char * const counter_names[PARROT_MAX_COUNTERS] = {
+    "cycles",
+    "instructions",
+    "cache-misses",
+    "branch-misses",
+    "task-clock",
+    "page-faults"
+};
+
+/* what C<1> and C<all> select */
+#define DEFAULT_COUNTERS 4
+
+/*
+
+=item C<static INTVAL parse_counters(PARROT_INTERP, STRING *spec,
+Parrot_runcore_counter *wanted)>
+
+Fills C<wanted> with the counters named in C<spec> and returns how many
+there are. Throws an exception on an unknown name.
+
+=cut
+
+*/
+
+static INTVAL
+parse_counters(PARROT_INTERP, ARGIN(STRING *spec),
+        ARGOUT(Parrot_runcore_counter *wanted))
+{
+    ASSERT_ARGS(parse_counters)
+
+    char * const  cspec = Parrot_str_to_cstring(interp, spec);
+    const char   *name  = cspec;
+    INTVAL        num   = 0;
+
+    if (STREQ(cspec, "1") || STREQ(cspec, "all")) {
+        Parrot_str_free_cstring(cspec);
+        for (num = 0; num < DEFAULT_COUNTERS; ++num)
+            wanted[num] = (Parrot_runcore_counter)num;
+        return num;
+    }
+
+    while (*name) {
+        const char * const end = strchr(name, ',');
+        const size_t       len = end ? (size_t)(end - name) : strlen(name);
+
+        if (len) {
+            INTVAL i, seen;
+
+            for (i = 0; i < PARROT_MAX_COUNTERS; ++i)
+                if (strlen(counter_names[i]) == len
+                &&  strncmp(counter_names[i], name, len) == 0)
+                    break;
+
+            if (i == PARROT_MAX_COUNTERS) {
+                STRING * const bad = Parrot_str_new(interp, name, len);
+                Parrot_str_free_cstring(cspec);
+                Parrot_ex_throw_from_c_args(interp, NULL,
+                    EXCEPTION_INVALID_OPERATION,
+                    "unknown performance counter '%Ss'", bad);
+            }
+
+            for (seen = 0; seen < num; ++seen)
+                if (wanted[seen] == (Parrot_runcore_counter)i)
+                    break;
+
+            if (seen == num)
+                wanted[num++] = (Parrot_runcore_counter)i;
+        }
+
+        name += len;
+        if (*name == ',')
+            ++name;
+    }
+
+    Parrot_str_free_cstring(cspec);
+    return num;
+}
+
+/*
+
+=item C<static int open_counter(Parrot_runcore_counter counter, int leader)>
+
+Opens and starts a single counter for the calling thread as a member of the
+group of C<leader>, or as a new group leader if C<leader> is -1. Returns the
+file descriptor, or -1 if the counter is not available.
+
+=cut
+
+*/
+
+static int
+open_counter(Parrot_runcore_counter counter, int leader)
+{
+    ASSERT_ARGS(open_counter)
+
+#ifdef PARROT_HAS_HEADER_LINUXPERF_EVENT
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof (attr));
+    attr.size           = sizeof (attr);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_GROUP;
+
+    switch (counter) {
+      case PARROT_COUNTER_CYCLES:
+        attr.type   = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case PARROT_COUNTER_INSTRUCTIONS:
+        attr.type   = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case PARROT_COUNTER_CACHE_MISSES:
+        attr.type   = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case PARROT_COUNTER_BRANCH_MISSES:
+        attr.type   = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case PARROT_COUNTER_TASK_CLOCK:
+        attr.type   = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_TASK_CLOCK;
+        break;
+      case PARROT_COUNTER_PAGE_FAULTS:
+        attr.type   = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+        break;
+      default:
+        return -1;
+    }
+
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+#else
+    UNUSED(counter);
+    UNUSED(leader);
+    return -1;
+#endif
+}
+
+/*
+
+=item C<Parrot_runcore_counters * Parrot_runcore_counters_open(PARROT_INTERP,
+STRING *spec)>
+
+Opens the counters named in C<spec> for the calling thread and starts them.
+Returns NULL if none of them could be opened. Throws an exception if
+C<spec> names an unknown counter.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+Parrot_runcore_counters *
+Parrot_runcore_counters_open(PARROT_INTERP, ARGIN(STRING *spec))
+{
+    ASSERT_ARGS(Parrot_runcore_counters_open)
+
+    Parrot_runcore_counter          wanted[PARROT_MAX_COUNTERS];
+    const INTVAL                    num = parse_counters(interp, spec, wanted);
+    Parrot_runcore_counters * const c   =
+        mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_counters);
+    INTVAL                          i;
+
+    c->leader = -1;
+
+    for (i = 0; i < num; ++i) {
+        const int fd = open_counter(wanted[i], c->leader);
+
+        if (fd < 0)
+            continue;
+
+        if (c->leader == -1)
+            c->leader = fd;
+
+        c->fd[c->num]      = fd;
+        c->counter[c->num] = wanted[i];
+        c->num++;
+    }
+
+    if (!c->num) {
+        mem_gc_free(interp, c);
+        return NULL;
+    }
+
+    return c;
+}
+
+/*
+
+=item C<unsigned int Parrot_runcore_counters_read(Parrot_runcore_counters *c,
+UHUGEINTVAL *values)>
+
+Stores the current value of every open counter of C<c> in C<values>, in the
+order given by C<c-E<gt>counter>, and returns how many there are. The values
+only ever grow; runcores are expected to work on differences.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+unsigned int
+Parrot_runcore_counters_read(ARGMOD(Parrot_runcore_counters *c),
+        ARGOUT(UHUGEINTVAL *values))
+{
+    ASSERT_ARGS(Parrot_runcore_counters_read)
+
+#ifdef PARROT_HAS_HEADER_LINUXPERF_EVENT
+    /* the group read format: the number of values, then the values */
+    __u64         buf[1 + PARROT_MAX_COUNTERS];
+    unsigned int  i;
+
+    if (read(c->leader, buf, sizeof (buf)) > 0)
+        for (i = 0; i < c->num && i < buf[0]; ++i)
+            c->last[i] = buf[1 + i];
+#endif
+
+    memcpy(values, c->last, c->num * sizeof (UHUGEINTVAL));
+    return c->num;
+}
+
+/*
+
+=item C<const char * Parrot_runcore_counter_name(Parrot_runcore_counter
+counter)>
+
+Returns the name of C<counter>, as used when selecting it.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CONST_FUNCTION
+PARROT_CANNOT_RETURN_NULL
+const char *
+Parrot_runcore_counter_name(Parrot_runcore_counter counter)
+{
+    ASSERT_ARGS(Parrot_runcore_counter_name)
+
+    return counter_names[counter];
+}
+
+/*
+
+=item C<void Parrot_runcore_counters_close(PARROT_INTERP,
+Parrot_runcore_counters *c)>
+
+Stops and closes all the counters of C<c> and frees it.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_counters_close(PARROT_INTERP, ARGFREE(Parrot_runcore_counters *c))
+{
+    ASSERT_ARGS(Parrot_runcore_counters_close)
+
+#ifdef PARROT_HAS_HEADER_LINUXPERF_EVENT
+    unsigned int i;
+
+    /* members first, the leader is fd[0] */
+    for (i = c->num; i > 0; --i)
+        close(c->fd[i - 1]);
+#endif
+
+    mem_gc_free(interp, c);
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/runcore/subprof.c>, L<perf_event_open(2)>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
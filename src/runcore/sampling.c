@@ -0,0 +1,656 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/sampling.c - Parrot's sampling profiler
+
+=head1 DESCRIPTION
+
+This compilation unit implements the C<sampling> runcore, a statistical
+profiler cheap enough to leave switched on in production runs.
+
+Instead of accounting for every op or every sub transition like the
+C<profiling> and C<subprof> cores, it runs ops exactly like the C<fast>
+core and only looks at the alarm serial (see F<src/alarm.c>) every
+C<SAMPLING_CHECK_OPS> ops. When the sampling alarm has fired, the current
+call chain is walked and recorded as the interned Sub and pc position of
+every frame in a ring of sample records.
+
+The ring is only written and drained by the sampled interpreter itself; the
+alarm thread never touches it, so taking a sample never waits on a lock.
+Whenever the ring fills up, its records are folded into a table counting
+the samples of each distinct call chain. Only when the interpreter is
+destroyed are the chains resolved into sub names and source positions and
+written out in the folded stack format read by flame graph tools:
+
+  main (foo.pir:12);outer (foo.pir:30);inner (foo.pir:41) 1234
+
+Source positions come from the C<file> and C<line> annotations of the
+bytecode when present, which is what HLL compilers emit, and from the PIR
+debug segment otherwise.
+
+The following environment variables are honoured:
+
+=over 4
+
+=item C<PARROT_SAMPLING_FILENAME>
+
+The file the folded stacks are written to. C<stdout> and C<stderr> name the
+standard streams. Defaults to F<parrot.folded.PID>.
+
+=item C<PARROT_SAMPLING_INTERVAL>
+
+The time between two samples in microseconds, 1000 by default.
+
+=back
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+#include "parrot/runcore_sampling.h"
+#include "parrot/alarm.h"
+
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
+
+#include "sampling.str"
+
+#include "pmc/pmc_sub.h"
+
+#define SAMPLING_RING_MASK (SAMPLING_RING_SIZE - 1)
+
+/* HEADERIZER HFILE: include/parrot/runcore_sampling.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void drain_samples(PARROT_INTERP,
+    ARGMOD(Parrot_sampling_runcore_t *core))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*core);
+
+PARROT_CANNOT_RETURN_NULL
+static STRING * frame_name(PARROT_INTERP,
+    ARGIN(Parrot_sampling_runcore_t *core),
+    UINTVAL idx,
+    opcode_t pos)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void init_sampling(PARROT_INTERP,
+    ARGMOD(Parrot_sampling_runcore_t *core))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*core);
+
+static UINTVAL intern_sub(PARROT_INTERP,
+    ARGMOD(Parrot_sampling_runcore_t *core),
+    ARGIN(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*core);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_sampling_core(PARROT_INTERP,
+    ARGIN(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void runops_sampling_destroy(PARROT_INTERP,
+    ARGIN(Parrot_runcore_t *runcore))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_NOINLINE
+static void sample_if_due(PARROT_INTERP,
+    ARGMOD(Parrot_sampling_runcore_t *core),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*core);
+
+static void take_sample(PARROT_INTERP,
+    ARGMOD(Parrot_sampling_runcore_t *core),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*core);
+
+static void write_folded_stacks(PARROT_INTERP,
+    ARGIN(Parrot_sampling_runcore_t *core))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_drain_samples __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core))
+#define ASSERT_ARGS_frame_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core))
+#define ASSERT_ARGS_init_sampling __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core))
+#define ASSERT_ARGS_intern_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_runops_sampling_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_runops_sampling_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_sample_if_due __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_take_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_write_folded_stacks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(core))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_runcore_sampling_init(PARROT_INTERP)>
+
+Registers the sampling runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_sampling_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_sampling_init)
+
+    Parrot_sampling_runcore_t * const coredata
+                          = mem_gc_allocate_zeroed_typed(interp, Parrot_sampling_runcore_t);
+    coredata->name        = CONST_STRING(interp, "sampling");
+    coredata->id          = PARROT_SAMPLING_CORE;
+    coredata->opinit      = PARROT_CORE_OPLIB_INIT;
+    coredata->runops      = runops_sampling_core;
+    coredata->prepare_run = NULL;
+    coredata->destroy     = runops_sampling_destroy;
+    coredata->flags       = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, (Parrot_runcore_t *)coredata);
+}
+
+/*
+
+=item C<static void init_sampling(PARROT_INTERP, Parrot_sampling_runcore_t
+*core)>
+
+Sets up the sample ring, the tables and the output file on the first run,
+and arms the first sampling alarm.
+
+=cut
+
+*/
+
+static void
+init_sampling(PARROT_INTERP, ARGMOD(Parrot_sampling_runcore_t *core))
+{
+    ASSERT_ARGS(init_sampling)
+
+    STRING * const filename = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SAMPLING_FILENAME"));
+    STRING * const interval = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SAMPLING_INTERVAL"));
+    char          *filename_cstr;
+
+    if (STRING_IS_NULL(filename))
+        filename_cstr = Parrot_str_to_cstring(interp,
+                Parrot_sprintf_c(interp, "parrot.folded.%d", getpid()));
+    else
+        filename_cstr = Parrot_str_to_cstring(interp, filename);
+
+    if (STREQ(filename_cstr, "stdout"))
+        core->out = stdout;
+    else if (STREQ(filename_cstr, "stderr"))
+        core->out = stderr;
+    else
+        core->out = fopen(filename_cstr, "w");
+
+    if (!core->out) {
+        fprintf(stderr, "unable to open %s for writing", filename_cstr);
+        Parrot_str_free_cstring(filename_cstr);
+        Parrot_x_jump_out(interp, 1);
+    }
+
+    Parrot_str_free_cstring(filename_cstr);
+
+    core->interval = SAMPLING_DEFAULT_INTERVAL;
+    if (!STRING_IS_NULL(interval)) {
+        const INTVAL usec = Parrot_str_to_int(interp, interval);
+        if (usec > 0)
+            core->interval = usec / 1000000.0;
+    }
+
+    core->interp     = interp;
+    core->ring       = mem_gc_allocate_n_typed(interp, SAMPLING_RING_SIZE, UINTVAL);
+    core->chain      = mem_gc_allocate_n_typed(interp, 2 * SAMPLING_MAX_DEPTH, UINTVAL);
+    core->sub_index  = Parrot_hash_new_pointer_hash(interp);
+    core->subs       = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    core->stacks     = Parrot_pmc_new(interp, enum_class_Hash);
+    Parrot_pmc_gc_register(interp, core->subs);
+    Parrot_pmc_gc_register(interp, core->stacks);
+
+    Parrot_alarm_check(interp, &core->last_alarm);
+    core->next_sample = Parrot_floatval_time() + core->interval;
+    Parrot_alarm_set(interp, core->next_sample);
+}
+
+/*
+
+=item C<static UINTVAL intern_sub(PARROT_INTERP, Parrot_sampling_runcore_t
+*core, PMC *sub)>
+
+Returns the index of C<sub> in the table of sampled Subs, adding it first if
+needed. The table keeps the Sub alive until the profile is written.
+
+=cut
+
+*/
+
+static UINTVAL
+intern_sub(PARROT_INTERP, ARGMOD(Parrot_sampling_runcore_t *core), ARGIN(PMC *sub))
+{
+    ASSERT_ARGS(intern_sub)
+
+    UINTVAL idx = (UINTVAL)Parrot_hash_get(interp, core->sub_index, sub);
+
+    if (!idx) {
+        VTABLE_push_pmc(interp, core->subs, sub);
+        idx = VTABLE_elements(interp, core->subs);
+        Parrot_hash_put(interp, core->sub_index, sub, (void *)idx);
+    }
+
+    return idx - 1;
+}
+
+/*
+
+=item C<static void take_sample(PARROT_INTERP, Parrot_sampling_runcore_t *core,
+opcode_t *pc)>
+
+Records the call chain of the op at C<pc> in the sample ring, innermost
+frame first. Every frame is recorded at a position just past the start of
+its current op, which is the return address for callers; this is also how
+bytecode annotations are looked up.
+
+=cut
+
+*/
+
+static void
+take_sample(PARROT_INTERP, ARGMOD(Parrot_sampling_runcore_t *core), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(take_sample)
+
+    PMC     *ctx   = CURRENT_CONTEXT(interp);
+    UINTVAL  depth = 0;
+    UINTVAL  start;
+
+    if (SAMPLING_RING_SIZE - (core->head - core->tail) < 1 + 2 * SAMPLING_MAX_DEPTH)
+        drain_samples(interp, core);
+
+    Parrot_pcc_set_pc(interp, ctx, pc);
+    start = core->head++;
+
+    for (; !PMC_IS_NULL(ctx) && depth < SAMPLING_MAX_DEPTH;
+           ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC      * const sub = Parrot_pcc_get_sub(interp, ctx);
+        opcode_t * const cur = Parrot_pcc_get_pc(interp, ctx);
+        Parrot_Sub_attributes *subattrs;
+        opcode_t  pos;
+
+        if (PMC_IS_NULL(sub) || !cur)
+            continue;
+
+        PMC_get_sub(interp, sub, subattrs);
+        if (!subattrs->seg
+        ||  cur < subattrs->seg->base.data
+        ||  cur > subattrs->seg->base.data + subattrs->seg->base.size)
+            continue;
+
+        /* callers are at their return address, just past the invoking op */
+        pos = cur - subattrs->seg->base.data;
+        if (ctx == CURRENT_CONTEXT(interp))
+            ++pos;
+
+        core->ring[core->head++ & SAMPLING_RING_MASK] = intern_sub(interp, core, sub);
+        core->ring[core->head++ & SAMPLING_RING_MASK] = pos;
+        ++depth;
+    }
+
+    core->ring[start & SAMPLING_RING_MASK] = depth;
+    ++core->samples;
+}
+
+/*
+
+=item C<static void drain_samples(PARROT_INTERP, Parrot_sampling_runcore_t
+*core)>
+
+Empties the sample ring, counting each recorded call chain in the table of
+folded stacks.
+
+=cut
+
+*/
+
+static void
+drain_samples(PARROT_INTERP, ARGMOD(Parrot_sampling_runcore_t *core))
+{
+    ASSERT_ARGS(drain_samples)
+
+    while (core->tail != core->head) {
+        const UINTVAL depth = core->ring[core->tail++ & SAMPLING_RING_MASK];
+        UINTVAL       i;
+        STRING       *key;
+
+        if (!depth)
+            continue;
+
+        for (i = 0; i < 2 * depth; ++i)
+            core->chain[i] = core->ring[core->tail++ & SAMPLING_RING_MASK];
+
+        key = Parrot_str_new_init(interp, (const char *)core->chain,
+                2 * depth * sizeof (UINTVAL), Parrot_binary_encoding_ptr, 0);
+        VTABLE_set_integer_keyed_str(interp, core->stacks, key,
+                VTABLE_get_integer_keyed_str(interp, core->stacks, key) + 1);
+    }
+}
+
+/*
+
+=item C<static STRING * frame_name(PARROT_INTERP, Parrot_sampling_runcore_t
+*core, UINTVAL idx, opcode_t pos)>
+
+Returns the name and source position of a single frame, the Sub with index
+C<idx> at position C<pos>. Namespaces below the HLL root are joined with
+C<::>, as a C<;> would start a new frame in the folded format.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+frame_name(PARROT_INTERP, ARGIN(Parrot_sampling_runcore_t *core), UINTVAL idx, opcode_t pos)
+{
+    ASSERT_ARGS(frame_name)
+
+    PMC * const            sub  = VTABLE_get_pmc_keyed_int(interp, core->subs, idx);
+    STRING                *name;
+    STRING                *file = STRINGNULL;
+    INTVAL                 line = -1;
+    Parrot_Sub_attributes *subattrs;
+
+    PMC_get_sub(interp, sub, subattrs);
+    name = subattrs->name;
+
+    if (!PMC_IS_NULL(subattrs->namespace_stash)) {
+        PMC * const ns = Parrot_ns_get_name(interp, subattrs->namespace_stash);
+
+        if (!PMC_IS_NULL(ns) && VTABLE_elements(interp, ns) > 1) {
+            VTABLE_shift_string(interp, ns);
+            VTABLE_push_string(interp, ns, name);
+            name = Parrot_str_join(interp, CONST_STRING(interp, "::"), ns);
+        }
+    }
+
+    if (subattrs->seg->annotations) {
+        PackFile_Annotations * const ann    = subattrs->seg->annotations;
+        STRING               * const s_line = CONST_STRING(interp, "line");
+        STRING               * const s_file = CONST_STRING(interp, "file");
+        PMC                  * const line_pmc
+                = Parrot_pf_annotations_lookup(interp, ann, pos, s_line);
+
+        if (!PMC_IS_NULL(line_pmc)) {
+            PMC * const file_pmc = Parrot_pf_annotations_lookup(interp, ann, pos, s_file);
+            line = VTABLE_get_integer(interp, line_pmc);
+            if (!PMC_IS_NULL(file_pmc))
+                file = VTABLE_get_string(interp, file_pmc);
+        }
+    }
+
+    if (line < 0 && subattrs->seg->debugs) {
+        PackFile_ByteCode * const seg   = subattrs->seg;
+        PackFile_Debug    * const debug = seg->debugs;
+        opcode_t                 *op    = seg->base.data;
+        opcode_t                  n     = 0;
+        size_t                    i;
+
+        /* find the op starting before pos; the debug segment has a line per op */
+        for (i = 0; i < debug->base.size && n < (opcode_t)seg->base.size; ++i) {
+            op_info_t * const op_info  = seg->op_info_table[*op];
+            opcode_t          var_args = 0;
+
+            ADD_OP_VAR_PART(interp, seg, op, var_args);
+            if (pos <= n + op_info->op_count + var_args) {
+                line = debug->base.data[i];
+                break;
+            }
+            n  += op_info->op_count + var_args;
+            op += op_info->op_count + var_args;
+        }
+
+        file = Parrot_pf_debug_pc_to_filename(interp, debug, pos - 1);
+    }
+
+    if (line < 0)
+        return name;
+
+    if (STRING_IS_NULL(file))
+        file = CONST_STRING(interp, "(unknown file)");
+
+    return Parrot_sprintf_c(interp, "%Ss (%Ss:%vd)", name, file, line);
+}
+
+/*
+
+=item C<static void write_folded_stacks(PARROT_INTERP, Parrot_sampling_runcore_t
+*core)>
+
+Writes every sampled call chain, outermost frame first, followed by the
+number of samples that hit it. Chains differing only in positions that
+resolve to the same lines are merged.
+
+=cut
+
+*/
+
+static void
+write_folded_stacks(PARROT_INTERP, ARGIN(Parrot_sampling_runcore_t *core))
+{
+    ASSERT_ARGS(write_folded_stacks)
+
+    STRING * const semicolon = CONST_STRING(interp, ";");
+    Hash   * const stacks    = (Hash *)VTABLE_get_pointer(interp, core->stacks);
+    PMC    * const folded    = Parrot_pmc_new(interp, enum_class_Hash);
+    Hash          *lines;
+
+    Parrot_pmc_gc_register(interp, folded);
+
+    parrot_hash_iterate(stacks,
+        STRING * const key   = (STRING *)_bucket->key;
+        const INTVAL   count = VTABLE_get_integer_keyed_str(interp, core->stacks, key);
+        const UINTVAL  depth = Parrot_str_byte_length(interp, key) / (2 * sizeof (UINTVAL));
+        STRING        *line  = STRINGNULL;
+        UINTVAL        i;
+
+        memcpy(core->chain, key->strstart, 2 * depth * sizeof (UINTVAL));
+
+        for (i = depth; i > 0; --i) {
+            STRING * const frame = frame_name(interp, core,
+                    core->chain[2 * i - 2], (opcode_t)core->chain[2 * i - 1]);
+            line = STRING_IS_NULL(line)
+                 ? frame
+                 : Parrot_str_concat(interp,
+                        Parrot_str_concat(interp, line, semicolon), frame);
+        }
+
+        VTABLE_set_integer_keyed_str(interp, folded, line,
+                VTABLE_get_integer_keyed_str(interp, folded, line) + count););
+
+    lines = (Hash *)VTABLE_get_pointer(interp, folded);
+
+    parrot_hash_iterate(lines,
+        STRING * const line  = (STRING *)_bucket->key;
+        char   * const cstr  = Parrot_str_to_cstring(interp, line);
+
+        fprintf(core->out, "%s %ld\n", cstr,
+                (long)VTABLE_get_integer_keyed_str(interp, folded, line));
+        Parrot_str_free_cstring(cstr););
+
+    Parrot_pmc_gc_unregister(interp, folded);
+}
+
+/*
+
+=item C<static void runops_sampling_destroy(PARROT_INTERP, Parrot_runcore_t
+*runcore)>
+
+Destroy callback. Writes the folded stacks and frees the profile.
+
+=cut
+
+*/
+
+static void
+runops_sampling_destroy(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore))
+{
+    ASSERT_ARGS(runops_sampling_destroy)
+
+    Parrot_sampling_runcore_t * const core = (Parrot_sampling_runcore_t *)runcore;
+
+    if (!core->interp)
+        return;
+
+    drain_samples(interp, core);
+    write_folded_stacks(interp, core);
+
+    if (core->out == stdout || core->out == stderr)
+        fflush(core->out);
+    else
+        fclose(core->out);
+
+    Parrot_pmc_gc_unregister(interp, core->subs);
+    Parrot_pmc_gc_unregister(interp, core->stacks);
+    Parrot_hash_destroy(interp, core->sub_index);
+    mem_gc_free(interp, core->ring);
+    mem_gc_free(interp, core->chain);
+    core->interp = NULL;
+}
+
+/*
+
+=item C<static void sample_if_due(PARROT_INTERP, Parrot_sampling_runcore_t
+*core, opcode_t *pc)>
+
+Called by the runloop when some alarm has fired. Takes a sample if the
+sampling interval has passed and re-arms the sampling alarm, which may have
+been pre-empted by an earlier one. Kept out of line so the runloop stays as
+tight as the C<fast> core's.
+
+=cut
+
+*/
+
+PARROT_NOINLINE
+static void
+sample_if_due(PARROT_INTERP, ARGMOD(Parrot_sampling_runcore_t *core), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(sample_if_due)
+
+    const FLOATVAL now = Parrot_floatval_time();
+
+    if (now >= core->next_sample) {
+        take_sample(interp, core, pc);
+        core->next_sample = now + core->interval;
+    }
+
+    Parrot_alarm_set(interp, core->next_sample);
+}
+
+/*
+
+=item C<static opcode_t * runops_sampling_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, taking a sample whenever the sampling interval has passed.
+
+The alarm serial is only looked at every C<SAMPLING_CHECK_OPS> ops, and the
+time only when the serial has changed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_sampling_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_sampling_core)
+
+    Parrot_sampling_runcore_t * const core = (Parrot_sampling_runcore_t *)runcore;
+    int countdown = SAMPLING_CHECK_OPS;
+
+    if (!core->interp)
+        init_sampling(interp, core);
+    else if (core->interp != interp)
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+                "illegal interpreter change while profiling");
+
+    while (pc) {
+        if (UNLIKELY(--countdown == 0)) {
+            countdown = SAMPLING_CHECK_OPS;
+            if (Parrot_alarm_check(interp, &core->last_alarm))
+                sample_if_due(interp, core, pc);
+        }
+
+        DO_OP(pc, interp);
+    }
+
+    return pc;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
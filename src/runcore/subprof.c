@@ -9,6 +9,19 @@ src/runcore/subprof.c - Parrot's subroutine-level profiler
 
 This compilation unit implements Parrot's subroutine-level profiler.
 
+The profile is written to stderr in the callgrind format when the
+interpreter is destroyed. Every line and call is charged with the number of
+ops run and the CPU ticks spent in it. If the C<PARROT_SUBPROF_COUNTERS>
+environment variable names hardware performance counters, for example
+
+  PARROT_SUBPROF_COUNTERS=cycles,instructions parrot -R subprof_hll foo.pir
+
+they are read together with the ticks and reported as additional events, so
+the instructions per cycle or the cache misses of every sub and line show up
+next to its time. C<1> selects cycles, instructions, cache and branch misses.
+See F<src/runcore/counters.c> for the available counters; those the system
+does not provide are left out of the profile.
+
 =head2 Functions
 
 =over 4
@@ -29,11 +42,27 @@ This compilation unit implements Parrot's subroutine-level profiler.
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
 
+#ifdef HAS_LONGLONG
+#  define UHUGEINTVAL_FMT "%llu"
+#else
+#  define UHUGEINTVAL_FMT "%lu"
+#endif
+
 /* HEADERIZER HFILE: include/parrot/runcore_subprof.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_INLINE
+static void addevents(
+    ARGIN(const subprofiledata *spdata),
+    ARGMOD(UHUGEINTVAL *to),
+    ARGIN(const UHUGEINTVAL *from))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*to);
+
 static void buildcallchain(PARROT_INTERP,
     ARGIN(subprofiledata *spdata),
     ARGIN_NULLOK(PMC *ctx),
@@ -65,6 +94,11 @@ static opcode_t * findlineannotations(PARROT_INTERP,
 static void finishcallchain(PARROT_INTERP, ARGIN(subprofiledata *spdata))
         __attribute__nonnull__(2);
 
+PARROT_INLINE
+static void finishevents(ARGMOD(subprofiledata *spdata))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*spdata);
+
 static void free_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -95,12 +129,28 @@ static void Parrot_runcore_subprof_sub_init(PARROT_INTERP)
 static void popcallchain(PARROT_INTERP, ARGIN(subprofiledata *spdata))
         __attribute__nonnull__(2);
 
+static void printevents(
+    ARGIN(const subprofiledata *spdata),
+    UINTVAL ops,
+    ARGIN(const UHUGEINTVAL *events))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
 static void printspname(PARROT_INTERP,
     const subprofiledata *spdata,
     ARGIN(const subprofile *sp))
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+PARROT_INLINE
+static void readevents(
+    ARGMOD(subprofiledata *spdata),
+    ARGOUT(UHUGEINTVAL *events))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*spdata)
+        FUNC_MODIFIES(*events);
+
 static void runops_subprof_destroy(PARROT_INTERP,
     ARGIN(Parrot_runcore_t *runcore))
         __attribute__nonnull__(1)
@@ -170,6 +220,10 @@ static lineinfo * sync_hll_linechange(PARROT_INTERP,
     ARGIN_NULLOK(opcode_t *pc_op))
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_addevents __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(spdata) \
+    , PARROT_ASSERT_ARG(to) \
+    , PARROT_ASSERT_ARG(from))
 #define ASSERT_ARGS_buildcallchain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(spdata))
@@ -186,6 +240,8 @@ static lineinfo * sync_hll_linechange(PARROT_INTERP,
     , PARROT_ASSERT_ARG(cntp))
 #define ASSERT_ARGS_finishcallchain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(spdata))
+#define ASSERT_ARGS_finishevents __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(spdata))
 #define ASSERT_ARGS_free_profile_data __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(spdata))
@@ -206,9 +262,15 @@ static lineinfo * sync_hll_linechange(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_popcallchain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(spdata))
+#define ASSERT_ARGS_printevents __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(spdata) \
+    , PARROT_ASSERT_ARG(events))
 #define ASSERT_ARGS_printspname __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sp))
+#define ASSERT_ARGS_readevents __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(spdata) \
+    , PARROT_ASSERT_ARG(events))
 #define ASSERT_ARGS_runops_subprof_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(runcore))
@@ -577,19 +639,19 @@ popcallchain(SHIM_INTERP, ARGIN(subprofiledata *spdata))
 
     if (sp->callerci) {
         sp->callerci->ops   += sp->callerops;
-        sp->callerci->ticks += sp->callerticks;
+        addevents(spdata, sp->callerci->events, sp->callerevents);
     }
 
     if (csp) {
         csp->callerops      += sp->callerops;
-        csp->callerticks    += sp->callerticks;
+        addevents(spdata, csp->callerevents, sp->callerevents);
     }
 
     sp->caller      = NULL;
     sp->callerci    = NULL;
     sp->ctx         = NULL;
     sp->callerops   = 0;
-    sp->callerticks = 0;
+    memset(sp->callerevents, 0, sizeof (sp->callerevents));
 
     spdata->cursubpmc       = csp ? csp->subpmc : NULL;
     spdata->curctx          = csp ? csp->ctx    : NULL;
@@ -620,19 +682,19 @@ finishcallchain(SHIM_INTERP, ARGIN(subprofiledata *spdata))
 
         if (sp->callerci) {
             sp->callerci->ops   += sp->callerops;
-            sp->callerci->ticks += sp->callerticks;
+            addevents(spdata, sp->callerci->events, sp->callerevents);
         }
 
         if (csp) {
             csp->callerops      += sp->callerops;
-            csp->callerticks    += sp->callerticks;
+            addevents(spdata, csp->callerevents, sp->callerevents);
         }
 
         sp->caller      = NULL;
         sp->callerci    = NULL;
         sp->ctx         = NULL;
         sp->callerops   = 0;
-        sp->callerticks = 0;
+        memset(sp->callerevents, 0, sizeof (sp->callerevents));
     }
 
     spdata->cursp       = NULL;
@@ -823,19 +885,15 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
 {
     ASSERT_ARGS(dump_profile_data)
 
-    unsigned int totalops   = 0;
-    UHUGEINTVAL  totalticks = 0;
-
-#ifdef HAS_LONGLONG
-#  define UHUGEINTVAL_FMT "%llu"
-#else
-#  define UHUGEINTVAL_FMT "%lu"
-#endif
+    unsigned int totalops = 0;
+    UHUGEINTVAL  totalevents[SUBPROF_MAX_EVENTS];
+    unsigned int e;
 
     if (!spdata->profile_type)
         return;
 
     finishcallchain(interp, spdata);    /* just in case */
+    memset(totalevents, 0, sizeof (totalevents));
 
     if (!spdata->sphash)
         spdata->sphash = Parrot_hash_create(interp, enum_type_ptr, Hash_key_type_PMC_ptr);
@@ -848,12 +906,17 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
             int j;
             for (j = 0; j < sp->nlines; j++) {
                 totalops += sp->lines[j].ops;
-                totalticks += sp->lines[j].ticks;
+                addevents(spdata, totalevents, sp->lines[j].events);
             }
         });
 
-    fprintf(stderr, "events: ops ticks\n");
-    fprintf(stderr, "summary: %d "UHUGEINTVAL_FMT"\n", totalops, totalticks);
+    fprintf(stderr, "events: ops ticks");
+    for (e = 1; e < spdata->nevents; e++)
+        fprintf(stderr, " %s",
+            Parrot_runcore_counter_name(spdata->counters->counter[e - 1]));
+    fprintf(stderr, "\n");
+    fprintf(stderr, "summary:");
+    printevents(spdata, totalops, totalevents);
 
     parrot_hash_iterate(spdata->sphash,
         subprofile *hsp = (subprofile*)_bucket->value;
@@ -880,7 +943,7 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
                 lineinfo *li = sp->lines + i;
                 callinfo *ci;
                 INTVAL srcline = -1;
-                if (!li->ops && !li->ticks && !li->calls)
+                if (!li->ops && !li->events[SUBPROF_EVENT_TICKS] && !li->calls)
                     continue;
                 if (i == 0) {
                     /* easy for the first annotation */
@@ -901,12 +964,10 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
                     }
                 }
 
-                if (li->ops || li->ticks)
-                    fprintf(stderr,
-                            "%d %u "UHUGEINTVAL_FMT"\n",
-                            (int) srcline,
-                            (unsigned int) li->ops,
-                            li->ticks);
+                if (li->ops || li->events[SUBPROF_EVENT_TICKS]) {
+                    fprintf(stderr, "%d", (int) srcline);
+                    printevents(spdata, li->ops, li->events);
+                }
 
                 for (ci = li->calls; ci && ci->callee; ci++) {
                     subprofile *csp = ci->callee;
@@ -915,11 +976,8 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
                     printspname(interp, spdata, csp);
                     fprintf(stderr, "\n");
                     fprintf(stderr, "calls=%u %d\n", (unsigned int) ci->count, (int) csp->srcline);
-                    fprintf(stderr,
-                            "%d %u "UHUGEINTVAL_FMT"\n",
-                            (int) srcline,
-                            (unsigned int) ci->ops,
-                            ci->ticks);
+                    fprintf(stderr, "%d", (int) srcline);
+                    printevents(spdata, ci->ops, ci->events);
                 }
             }
         });
@@ -943,15 +1001,13 @@ dump_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
             printspname(interp, spdata, csp);
             fprintf(stderr, "\n");
             fprintf(stderr, "calls=%u %d\n", (unsigned int) ci->count, (int) csp->srcline);
-            fprintf(stderr,
-                    "%d %u "UHUGEINTVAL_FMT"\n",
-                    0,
-                    (unsigned int) ci->ops,
-                    ci->ticks);
+            fprintf(stderr, "%d", 0);
+            printevents(spdata, ci->ops, ci->events);
         }
     }
 
-    fprintf(stderr, "\ntotals: %d "UHUGEINTVAL_FMT"\n", totalops, totalticks);
+    fprintf(stderr, "\ntotals:");
+    printevents(spdata, totalops, totalevents);
 }
 
 
@@ -1027,6 +1083,8 @@ free_profile_data(PARROT_INTERP, ARGIN(subprofiledata *spdata))
             mem_sys_free(xdebug););
         Parrot_hash_destroy(interp, spdata->seg2debug);
     }
+    if (spdata->counters)
+        Parrot_runcore_counters_close(interp, spdata->counters);
     mem_sys_free(spdata);
 }
 
@@ -1069,6 +1127,108 @@ getticks(void) {
 
 /*
 
+=item C<static void readevents(subprofiledata *spdata, UHUGEINTVAL *events)>
+
+Stores the current tick count and the values of the hardware counters in
+C<events>.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+readevents(ARGMOD(subprofiledata *spdata), ARGOUT(UHUGEINTVAL *events))
+{
+    ASSERT_ARGS(readevents)
+
+    events[SUBPROF_EVENT_TICKS] = getticks();
+    if (spdata->counters)
+        Parrot_runcore_counters_read(spdata->counters, events + 1);
+}
+
+/*
+
+=item C<static void finishevents(subprofiledata *spdata)>
+
+Adds the events since the last read to the line and the caller being
+charged, and starts counting anew.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+finishevents(ARGMOD(subprofiledata *spdata))
+{
+    ASSERT_ARGS(finishevents)
+
+    UHUGEINTVAL now[SUBPROF_MAX_EVENTS];
+    unsigned int i;
+
+    readevents(spdata, now);
+    if (spdata->eventadd) {
+        for (i = 0; i < spdata->nevents; i++) {
+            const UHUGEINTVAL diff = now[i] - spdata->startevents[i];
+            spdata->eventadd[i]  += diff;
+            spdata->eventadd2[i] += diff;
+        }
+    }
+    memcpy(spdata->startevents, now, spdata->nevents * sizeof (UHUGEINTVAL));
+}
+
+/*
+
+=item C<static void addevents(const subprofiledata *spdata, UHUGEINTVAL *to,
+const UHUGEINTVAL *from)>
+
+Adds the events in C<from> to the ones in C<to>.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+addevents(ARGIN(const subprofiledata *spdata), ARGMOD(UHUGEINTVAL *to),
+        ARGIN(const UHUGEINTVAL *from))
+{
+    ASSERT_ARGS(addevents)
+
+    unsigned int i;
+
+    for (i = 0; i < spdata->nevents; i++)
+        to[i] += from[i];
+}
+
+/*
+
+=item C<static void printevents(const subprofiledata *spdata, UINTVAL ops, const
+UHUGEINTVAL *events)>
+
+Finishes a cost line of the profile with the op count and the events.
+
+=cut
+
+*/
+
+static void
+printevents(ARGIN(const subprofiledata *spdata), UINTVAL ops,
+        ARGIN(const UHUGEINTVAL *events))
+{
+    ASSERT_ARGS(printevents)
+
+    unsigned int i;
+
+    fprintf(stderr, " %u", (unsigned int) ops);
+    for (i = 0; i < spdata->nevents; i++)
+        fprintf(stderr, " "UHUGEINTVAL_FMT, events[i]);
+    fprintf(stderr, "\n");
+}
+
+/*
+
 =item C<static void sync_callchainchange(PARROT_INTERP, subprofiledata *spdata,
 PMC *ctx, PMC *subpmc)>
 
@@ -1181,6 +1341,7 @@ get_subprofiledata(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), int type)
 
     Parrot_subprof_runcore_t *core   = (Parrot_subprof_runcore_t *) runcore;
     subprofiledata           *spdata = core->spdata;
+    STRING                   *counters;
 
     if (!spdata) {
         spdata               = (subprofiledata *) mem_sys_allocate_zeroed(sizeof (subprofiledata));
@@ -1188,7 +1349,15 @@ get_subprofiledata(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), int type)
         spdata->interp       = interp;
         spdata->markpmcs     = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
         Parrot_pmc_gc_register(interp, spdata->markpmcs);
+        spdata->nevents      = 1;
         core->spdata         = spdata;
+
+        counters = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SUBPROF_COUNTERS"));
+        if (!STRING_IS_NULL(counters)) {
+            spdata->counters = Parrot_runcore_counters_open(interp, counters);
+            if (spdata->counters)
+                spdata->nevents += spdata->counters->num;
+        }
     }
 
     if (spdata->profile_type != type)
@@ -1272,13 +1441,8 @@ runops_subprof_sub_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
             if (subpmc != spdata->cursubpmc || ctx != spdata->curctx) {
                 /* context changed! either called new sub or returned from sub */
 
-                /* finish old ticks */
-                UHUGEINTVAL tick = getticks();
-                if (spdata->tickadd) {
-                    UHUGEINTVAL tickdiff = tick - spdata->starttick;
-                    *spdata->tickadd         += tickdiff;
-                    *spdata->tickadd2        += tickdiff;
-                }
+                /* finish old events */
+                finishevents(spdata);
                 sync_callchainchange(interp, spdata, ctx, subpmc);
                 sp = spdata->cursp;
                 if (pc == sp->code_ops + sp->subattrs->start_offs) {
@@ -1286,9 +1450,9 @@ runops_subprof_sub_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
                     if (sp->callerci)
                         sp->callerci->count++;
                 }
-                spdata->tickadd   = &sp->lines->ticks;
-                spdata->tickadd2  = &sp->callerticks;
-                spdata->starttick = getticks();
+                spdata->eventadd  = sp->lines->events;
+                spdata->eventadd2 = sp->callerevents;
+                readevents(spdata, spdata->startevents);
             }
 
             sp->lines->ops++;
@@ -1371,13 +1535,8 @@ runops_subprof_hll_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
             if (subpmc != spdata->cursubpmc || ctx != spdata->curctx) {
                 /* context changed! either called new sub or returned from sub */
 
-                /* finish old ticks */
-                UHUGEINTVAL tick = getticks();
-                if (spdata->tickadd) {
-                    UHUGEINTVAL tickdiff = tick - spdata->starttick;
-                    *spdata->tickadd         += tickdiff;
-                    *spdata->tickadd2        += tickdiff;
-                }
+                /* finish old events */
+                finishevents(spdata);
                 sync_callchainchange(interp, spdata, ctx, subpmc);
                 sp = spdata->cursp;
                 if (pc == sp->code_ops + sp->subattrs->start_offs) {
@@ -1386,46 +1545,34 @@ runops_subprof_hll_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
                         sp->callerci->count++;
                 }
                 curline = sync_hll_linechange(interp, spdata, pc);
-                spdata->tickadd   = &curline->ticks;
-                spdata->tickadd2  = &sp->callerticks;
+                spdata->eventadd  = curline->events;
+                spdata->eventadd2 = sp->callerevents;
                 startop = sp->code_ops + curline->op_offs;
                 endop   = sp->code_ops + curline[1].op_offs;
-                spdata->starttick = getticks();
+                readevents(spdata, spdata->startevents);
             }
 
             if (pc >= endop) {
-                /* finish old ticks */
-                UHUGEINTVAL tick = getticks();
-                if (spdata->tickadd) {
-                    const UHUGEINTVAL tickdiff = tick - spdata->starttick;
-                    *spdata->tickadd         += tickdiff;
-                    *spdata->tickadd2        += tickdiff;
-                }
-                spdata->starttick = tick;
+                /* finish old events */
+                finishevents(spdata);
                 /* bring curline in sync with the pc */
                 while (pc >= sp->code_ops + curline[1].op_offs) {
                     curline++;
                 }
                 startop = sp->code_ops + curline->op_offs;
                 endop   = sp->code_ops + curline[1].op_offs;
-                spdata->tickadd = &curline->ticks;
+                spdata->eventadd = curline->events;
             }
             else if (pc < startop) {
-                /* finish old ticks */
-                const UHUGEINTVAL tick = getticks();
-                if (spdata->tickadd) {
-                    UHUGEINTVAL tickdiff = tick - spdata->starttick;
-                    *spdata->tickadd         += tickdiff;
-                    *spdata->tickadd2        += tickdiff;
-                }
-                spdata->starttick = tick;
+                /* finish old events */
+                finishevents(spdata);
                 /* bring curline in sync with the pc */
                 while (pc < sp->code_ops + curline->op_offs) {
                     curline--;
                 }
                 startop = sp->code_ops + curline->op_offs;
                 endop   = sp->code_ops + curline[1].op_offs;
-                spdata->tickadd = &curline->ticks;
+                spdata->eventadd = curline->events;
             }
 
             curline->ops++;
@@ -1503,14 +1650,8 @@ runops_subprof_ops_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
         subpmc = ((Parrot_Context *)PMC_data_typed(ctx, Parrot_Context*))->current_sub;
 
         if (!PMC_IS_NULL(subpmc)) {
-            /* finish old ticks */
-            const UHUGEINTVAL tick = getticks();
-            if (spdata->tickadd) {
-                const UHUGEINTVAL tickdiff = tick - spdata->starttick;
-                *spdata->tickadd         += tickdiff;
-                *spdata->tickadd2        += tickdiff;
-                spdata->starttick = tick;
-            }
+            /* finish old events */
+            finishevents(spdata);
 
             if (subpmc != spdata->cursubpmc || ctx != spdata->curctx) {
                 /* context changed! either called new sub or returned from sub */
@@ -1522,12 +1663,12 @@ runops_subprof_ops_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(o
                         sp->callerci->count++;
                 }
                 startop = sp->code_ops + sp->subattrs->start_offs;
-                spdata->tickadd2  = &sp->callerticks;
-                spdata->starttick = getticks();
+                spdata->eventadd2 = sp->callerevents;
+                readevents(spdata, spdata->startevents);
             }
             sp->lines[(int)(pc - startop)].ops++;
             sp->callerops++;
-            spdata->tickadd = &sp->lines[(int)(pc - startop)].ticks;
+            spdata->eventadd = sp->lines[(int)(pc - startop)].events;
         }
         DO_OP(pc, interp);
     }
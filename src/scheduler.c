@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2007-2015, Parrot Foundation.
+Copyright (C) 2007-2026, Parrot Foundation.
 
 =head1 NAME
 
@@ -22,6 +22,8 @@ exceptions, async I/O, and concurrent tasks (threads).
 #include "parrot/alarm.h"
 #include "parrot/scheduler.h"
 #include "parrot/thread.h"
+#include "parrot/timer_wheel.h"
+#include "parrot/fiber.h"
 
 #include "pmc/pmc_scheduler.h"
 #include "pmc/pmc_task.h"
@@ -103,6 +105,10 @@ Parrot_cx_begin_execution(PARROT_INTERP, ARGIN(PMC *main), ARGIN(PMC *argv))
     tdata->data = argv;
     PARROT_GC_WRITE_BARRIER(interp, main_task);
 
+    /* The main task keeps the stack of the thread, the one we were
+       embedded from. */
+    TASK_fiber_CLEAR(main_task);
+
     SCHEDULER_enable_scheduler_SET(scheduler);
 
     Parrot_cx_schedule_immediate(interp, main_task);
@@ -131,6 +137,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_outer_runloop)
     PMC * const scheduler = interp->scheduler;
+    PMC * const ctx       = CURRENT_CONTEXT(interp);
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
     INTVAL alarm_count, foreign_count, i;
 
@@ -146,6 +153,10 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
             interp->current_runloop_level = 0;
             reset_runloop_id_counter(interp);
 
+            /* a task that stopped halfway leaves its context behind; the
+             * next one must not see the handlers in there */
+            Parrot_pcc_set_context(interp, ctx);
+
             Parrot_cx_next_task(interp, scheduler);
 
             /* add expired alarms to the task queue */
@@ -169,7 +180,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
         /* If we have no scheduled tasks, but we do have an alarm or foreign
            task, we can wait for one of those before we start executing things
            again. */
-        alarm_count = VTABLE_get_integer(interp, sched->alarms);
+        alarm_count = sched->timers->count;
         if (VTABLE_get_integer(interp, scheduler) == 0 && (alarm_count > 0 || foreign_count > 0)) {
             /* Nothing to do except to wait for the next alarm to expire */
             Parrot_thread_wait_for_notification(interp);
@@ -195,7 +206,7 @@ Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
     const FLOATVAL time_now = Parrot_floatval_time();
 
     interp->quantum_done = time_now + PARROT_TASK_SWITCH_QUANTUM;
-    Parrot_alarm_set(interp->quantum_done);
+    Parrot_alarm_set(interp, interp->quantum_done);
 }
 
 /*
@@ -250,7 +261,7 @@ Parrot_cx_check_scheduler(PARROT_INTERP, ARGIN(opcode_t *next))
 
     /* If we have any outstanding alarms, or if we have been requested to
        wake up, run the scheduler. */
-    if (Parrot_alarm_check(&(interp->last_alarm))
+    if (Parrot_alarm_check(interp, &(interp->last_alarm))
         || SCHEDULER_wake_requested_TEST(scheduler)) {
         SCHEDULER_wake_requested_CLEAR(scheduler);
         return Parrot_cx_run_scheduler(interp, scheduler, next);
@@ -284,17 +295,19 @@ Parrot_cx_run_scheduler(PARROT_INTERP, ARGIN(PMC *scheduler), ARGIN(opcode_t *ne
     if (SCHEDULER_resched_requested_TEST(scheduler)) {
         SCHEDULER_resched_requested_CLEAR(scheduler);
 
-        /* A task switch will only work in the outer runloop of a fully
-           booted Parrot. In a Parrot that hasn't called begin_execution,
-           or in a nested runloop, we silently ignore task switches. */
-        if (SCHEDULER_enable_scheduler_TEST(scheduler) && interp->current_runloop_level <= 1)
+        /* A task switch will only work in a fully booted Parrot, in the
+           outer runloop or anywhere in a task running on a fiber. In a Parrot
+           that hasn't called begin_execution, or in a nested runloop of a
+           task on the thread's stack, we silently ignore task switches. */
+        if (SCHEDULER_enable_scheduler_TEST(scheduler)
+        && (interp->current_runloop_level <= 1 || Parrot_fiber_current(interp)))
             return Parrot_cx_preempt_task(interp, scheduler, next);
     }
 
     /* Some alarm seems to have fired, but not the scheduler's.
      * Re-set the scheduler alarm */
     if (Parrot_cx_preemption_enabled(interp))
-        Parrot_alarm_set(interp->quantum_done);
+        Parrot_alarm_set(interp, interp->quantum_done);
 
     return next;
 }
@@ -329,6 +342,9 @@ Parrot_cx_check_quantum(PARROT_INTERP, ARGIN(PMC *scheduler))
 
 Stop the current task and pack it up into a PMC what can be used to resume later.
 
+A task running on a fiber keeps its place on the stack of the fiber instead,
+see C<Parrot_cx_leave_task>.
+
 =cut
 
 */
@@ -340,10 +356,6 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
 {
     ASSERT_ARGS(Parrot_cx_stop_task)
     PMC * const task = Parrot_cx_current_task(interp);
-    Parrot_Task_attributes * const tdata = PARROT_TASK(task);
-    PMC * const cont = Parrot_pmc_new(interp, enum_class_Continuation);
-
-    VTABLE_set_pointer(interp, cont, next);
 
     /* TODO: This check seems expensive. Do we need to have this active at all
        times, or can we make this conditional on NDEBUG? */
@@ -351,8 +363,15 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
             "Attempt to stop invalid interp->current_task");
 
-    tdata->code = cont;
-    PARROT_GC_WRITE_BARRIER(interp, task);
+    if (!Parrot_fiber_current(interp)) {
+        Parrot_Task_attributes * const tdata = PARROT_TASK(task);
+        PMC * const cont = Parrot_pmc_new(interp, enum_class_Continuation);
+
+        VTABLE_set_pointer(interp, cont, next);
+        tdata->code = cont;
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+
     TASK_in_preempt_SET(task);
 
     return task;
@@ -360,11 +379,42 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
 
 /*
 
+=item C<opcode_t* Parrot_cx_leave_task(PARROT_INTERP, opcode_t *next)>
+
+Hands the CPU over to the scheduler, after the current task was stopped
+with C<Parrot_cx_stop_task> and put wherever it waits to be resumed.
+
+A task running on a fiber is suspended right here, however deep in nested
+runloops, and C<next> is returned once it's resumed. Any other task can
+only continue from its continuation, so C<NULL> is returned to end the
+runloop.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+opcode_t*
+Parrot_cx_leave_task(PARROT_INTERP, ARGIN_NULLOK(opcode_t *next))
+{
+    ASSERT_ARGS(Parrot_cx_leave_task)
+
+    if (Parrot_fiber_current(interp)) {
+        Parrot_fiber_suspend(interp);
+        return next;
+    }
+
+    return (opcode_t*)NULL;
+}
+
+/*
+
 =item C<opcode_t* Parrot_cx_preempt_task(PARROT_INTERP, PMC *scheduler, opcode_t
 *next)>
 
 Pre-empt the current task. It goes on the foot of the task queue,
-and then we jump all the way back to the task scheduling loop.
+and then we go back to the task scheduling loop.
 
 =cut
 
@@ -378,7 +428,7 @@ Parrot_cx_preempt_task(PARROT_INTERP, ARGIN(PMC *scheduler), ARGIN(opcode_t *nex
     PMC * const task = Parrot_cx_stop_task(interp, next);
     VTABLE_push_pmc(interp, scheduler, task);
 
-    return (opcode_t*)NULL;
+    return Parrot_cx_leave_task(interp, next);
 }
 
 /*
@@ -440,6 +490,15 @@ Parrot_cx_schedule_task(PARROT_INTERP, ARGIN(PMC *task_or_sub))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
             "Can only schedule Tasks and Subs");
 
+    /* A task suspended on its fiber can only continue in this thread */
+    if (PARROT_TASK(task)->fiber) {
+        PARROT_ASSERT(PARROT_TASK(task)->interp == interp);
+        VTABLE_push_pmc(interp, interp->scheduler, task);
+        if (VTABLE_get_integer(interp, interp->scheduler) == 1)
+            Parrot_cx_enable_preemption(interp);
+        return;
+    }
+
 #ifdef PARROT_HAS_THREADS
     /* Search for a thread that is free. If we have a free thread, schedule
        the task there. Otherwise, find the thread with the fewest tasks in its
@@ -587,7 +646,7 @@ Parrot_cx_send_message(PARROT_INTERP, ARGIN(STRING *messagetype), ARGIN(SHIM(PMC
 
 =item C<void Parrot_cx_schedule_alarm(PARROT_INTERP, PMC *alarm)>
 
-Schedule an alarm.
+Schedule an alarm. If it is already pending, it is rescheduled.
 
 =cut
 
@@ -597,13 +656,35 @@ void
 Parrot_cx_schedule_alarm(PARROT_INTERP, ARGIN(PMC *alarm))
 {
     ASSERT_ARGS(Parrot_cx_schedule_alarm)
-    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
-    FLOATVAL alarm_time = VTABLE_get_number(interp, alarm);
+    PMC * const scheduler = interp->scheduler;
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    const FLOATVAL due = Parrot_timer_wheel_insert(interp, sched->timers, alarm);
+
+    /* the wheel marks the alarms it holds */
+    PARROT_GC_WRITE_BARRIER(interp, scheduler);
+
+    Parrot_alarm_set(interp, due);
+}
+
+/*
 
-    Parrot_alarm_set(alarm_time);
+=item C<INTVAL Parrot_cx_cancel_alarm(PARROT_INTERP, PMC *alarm)>
 
-    /* Insert new alarm at correct (ordered by time) position in array. */
-    Parrot_pmc_list_insert_by_number(interp, sched->alarms, alarm);
+Remove a pending alarm. Returns 1 if it was pending, 0 otherwise.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_cx_cancel_alarm(PARROT_INTERP, ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(Parrot_cx_cancel_alarm)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+
+    /* The wakeup we asked for stays; when it comes early,
+       Parrot_cx_check_alarms simply sets the next one. */
+    return Parrot_timer_wheel_remove(interp, sched->timers, alarm);
 }
 
 /*
@@ -622,29 +703,13 @@ Parrot_cx_check_alarms(PARROT_INTERP, ARGIN(PMC *scheduler))
 {
     ASSERT_ARGS(Parrot_cx_check_alarms)
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL alarm_count = VTABLE_get_integer(interp, sched->alarms);
-    const FLOATVAL now_time = Parrot_floatval_time();
-
-    /* Loop over all alarms, searching for expired ones. Since they are ordered
-       by execution time, as soon as we find one that is not expired we can
-       exit the loop. For each alarm that is expired, add the associated
-       Sub/Task to the queue. */
-    while (alarm_count) {
-        PMC * const alarm = VTABLE_shift_pmc(interp, sched->alarms);
-        const FLOATVAL alarm_time = VTABLE_get_number(interp, alarm);
-
-        if (alarm_time < now_time) {
-            Parrot_Alarm_attributes * const data = PARROT_ALARM(alarm);
-            Parrot_cx_schedule_immediate(interp, data->alarm_task);
-        }
-        else {
-            Parrot_alarm_set(alarm_time);
-            VTABLE_unshift_pmc(interp, sched->alarms, alarm);
-            break;
-        }
 
-        alarm_count--;
-    }
+    Parrot_timer_wheel_expire(interp, sched->timers);
+
+    /* Our wakeup may have been overridden by an earlier one, or was for an
+       alarm that got cancelled. Ask for the one the wheel needs next. */
+    if (sched->timers->count > 0)
+        Parrot_alarm_set(interp, Parrot_timer_wheel_next_time(interp, sched->timers));
 }
 
 /*
@@ -677,7 +742,8 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
     ASSERT_ARGS(Parrot_cx_schedule_sleep)
     const FLOATVAL now_time  = Parrot_floatval_time();
     const FLOATVAL done_time = now_time + time;
-    PMC * const alarm = Parrot_pmc_new(interp, enum_class_Alarm);
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+    PMC * const alarm = Parrot_timer_wheel_get_alarm(interp, sched->timers);
     Parrot_Alarm_attributes * const adata = PARROT_ALARM(alarm);
     PMC * const task = Parrot_cx_stop_task(interp, next);
 
@@ -687,7 +753,7 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
     PARROT_GC_WRITE_BARRIER(interp, alarm);
     (void) VTABLE_invoke(interp, alarm, NULL);
 
-    return (opcode_t*) NULL;
+    return Parrot_cx_leave_task(interp, next);
 }
 
 /*
@@ -0,0 +1,1643 @@
+/*
+Copyright (C) 2001-2015, Parrot Foundation.
+
+=head1 NAME
+
+src/sort.c - Sorting of PMC, STRING and native arrays
+
+=head1 DESCRIPTION
+
+The C<sort> methods of the array PMCs end up here.
+
+Sorts with a comparator use a pattern-defeating quicksort: the pivot is the
+median of three elements (of nine for large ranges), short ranges are
+finished with insertion sort, ranges found already partitioned are checked
+for being sorted, and ranges which keep partitioning badly fall back to
+heapsort, so no input takes more than O(n log n) comparisons. Elements are
+only ever swapped in place, so they stay visible to GC while a comparator
+runs.
+
+With C<PARROT_SORT_STABLE> a merge sort of element indexes is used instead;
+the array is permuted once at the end, again without exposing elements to
+GC in scratch memory.
+
+Without a comparator, integer and float arrays are sorted with an LSD radix
+sort and string arrays with an MSD radix sort on their bytes, as long as
+byte order is codepoint order for all of the strings.
+
+A comparator which is not a total order (e.g. one always returning 1) gives
+some permutation of the input, never a crash: all loops are bounds checked.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "pmc/pmc_fixedpmcarray.h"
+#include "pmc/pmc_nci.h"
+
+/* comparator implemented in C, called with the elements themselves */
+typedef INTVAL (*sort_func_t)(PARROT_INTERP, void *, void *);
+
+typedef struct sort_info_t sort_info_t;
+
+/* compares the elements at a and b, returning <0, 0 or >0 like cmp */
+typedef INTVAL (*sort_cmp_t)(PARROT_INTERP, const void *a, const void *b,
+        const sort_info_t *info);
+
+struct sort_info_t {
+    sort_cmp_t  cmp;    /* element comparison */
+    size_t      width;  /* size of an element in bytes */
+    const char *base;   /* elements, when sorting indexes into them */
+    PMC        *sub;    /* comparator Sub or NCI, if any */
+    const char *sig;    /* PCC signature to call sub with */
+};
+
+/* large enough for any element we sort */
+typedef union sort_elem_t {
+    INTVAL    i;
+    FLOATVAL  n;
+    void     *p;
+} sort_elem_t;
+
+/* ranges this short are finished with insertion sort */
+#define SORT_INSERTION_MAX  24
+
+/* ranges longer than this take the median of nine as pivot */
+#define SORT_NINTHER_MIN    128
+
+/* partial insertion sort gives up after this many moves */
+#define SORT_PARTIAL_MAX    8
+
+/* below this many elements radix sort isn't worth its passes */
+#define SORT_RADIX_MIN      64
+
+/* counters per level of the string radix sort: 257 counts (0 for "string
+ * ended", 1 + byte otherwise) and 257 bucket positions */
+#define SORT_BUCKETS        (2 * 257)
+
+#define ELEM(base, i, w)    ((base) + (i) * (w))
+
+/* HEADERIZER HFILE: include/parrot/misc.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void apply_permutation(PARROT_INTERP,
+    ARGMOD(char *base),
+    ARGIN(const INTVAL *perm),
+    size_t n,
+    size_t width)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*base);
+
+PARROT_PURE_FUNCTION
+static INTVAL cmp_float(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    const sort_info_t *info)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static INTVAL cmp_nci_int(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static INTVAL cmp_nci_ptr(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static INTVAL cmp_pmc(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    const sort_info_t *info)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static INTVAL cmp_string(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    const sort_info_t *info)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static INTVAL cmp_sub_float(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static INTVAL cmp_sub_int(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static INTVAL cmp_sub_ptr(PARROT_INTERP,
+    ARGIN(const void *a),
+    ARGIN(const void *b),
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+PARROT_CONST_FUNCTION
+static UINTVAL float_to_radix(FLOATVAL f);
+
+static void heap_sort(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*base);
+
+static int insertion_sort(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info),
+    size_t limit)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*base);
+
+PARROT_CONST_FUNCTION
+static UINTVAL int_to_radix(INTVAL i);
+
+static void merge_sort_indexes(PARROT_INTERP,
+    ARGMOD(INTVAL *idx),
+    size_t n,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*idx);
+
+static void merge_sort_run(PARROT_INTERP,
+    ARGMOD(INTVAL *idx),
+    ARGMOD(INTVAL *scratch),
+    size_t n,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*idx)
+        FUNC_MODIFIES(*scratch);
+
+static size_t partition_left(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*base);
+
+static size_t partition_right(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info),
+    ARGOUT(int *already_partitioned))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*base)
+        FUNC_MODIFIES(*already_partitioned);
+
+static void pdq_sort(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info),
+    int bad_allowed,
+    int leftmost)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*base);
+
+static void radix_sort(PARROT_INTERP,
+    ARGMOD(UINTVAL *keys),
+    ARGMOD_NULLOK(INTVAL *payload),
+    size_t n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*keys)
+        FUNC_MODIFIES(*payload);
+
+static void radix_sort_strings(
+    ARGMOD(STRING **data),
+    ARGMOD(STRING **aux),
+    ARGMOD(size_t *counts),
+    size_t n,
+    size_t depth)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data)
+        FUNC_MODIFIES(*aux)
+        FUNC_MODIFIES(*counts);
+
+PARROT_CONST_FUNCTION
+static FLOATVAL radix_to_float(UINTVAL u);
+
+PARROT_CONST_FUNCTION
+static INTVAL radix_to_int(UINTVAL u);
+
+static void sift_down(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t root,
+    size_t n,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*base);
+
+static void sort2(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t a,
+    size_t b,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*base);
+
+static void sort3(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t a,
+    size_t b,
+    size_t c,
+    ARGIN(const sort_info_t *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*base);
+
+static void sort_elements(PARROT_INTERP,
+    ARGMOD(char *base),
+    size_t n,
+    ARGIN(const sort_info_t *info),
+    INTVAL flags)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*base);
+
+PARROT_INLINE
+PARROT_PURE_FUNCTION
+static unsigned int string_byte(ARGIN_NULLOK(const STRING *s), size_t depth);
+
+PARROT_PURE_FUNCTION
+static int string_bytes_cmp(
+    ARGIN_NULLOK(const STRING *a),
+    ARGIN_NULLOK(const STRING *b),
+    size_t depth);
+
+PARROT_WARN_UNUSED_RESULT
+static int strings_sort_bytewise(ARGIN(STRING **data), size_t n)
+        __attribute__nonnull__(1);
+
+PARROT_INLINE
+static void swap_elements(ARGMOD(char *a), ARGMOD(char *b), size_t width)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*a)
+        FUNC_MODIFIES(*b);
+
+#define ASSERT_ARGS_apply_permutation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(perm))
+#define ASSERT_ARGS_cmp_float __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_cmp_nci_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_cmp_nci_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_cmp_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_cmp_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_cmp_sub_float __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_cmp_sub_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_cmp_sub_ptr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_float_to_radix __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_heap_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_insertion_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_int_to_radix __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_merge_sort_indexes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(idx) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_merge_sort_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(idx) \
+    , PARROT_ASSERT_ARG(scratch) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_partition_left __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_partition_right __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(already_partitioned))
+#define ASSERT_ARGS_pdq_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_radix_sort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(keys))
+#define ASSERT_ARGS_radix_sort_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data) \
+    , PARROT_ASSERT_ARG(aux) \
+    , PARROT_ASSERT_ARG(counts))
+#define ASSERT_ARGS_radix_to_float __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_radix_to_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_sift_down __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_sort2 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_sort3 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_sort_elements __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(base) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_string_byte __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_string_bytes_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_strings_sort_bytewise __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_swap_elements __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_util_sort_pmcs(PARROT_INTERP, PMC **data, size_t n, PMC
+*cmp, INTVAL flags)>
+
+Sorts the C<n> PMCs at C<data>. C<cmp> is a Sub taking two PMCs and
+returning an integer, or an NCI with a C<sort_func_t> behind it; without
+one the PMCs' C<cmp> vtable is used.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_pmcs(PARROT_INTERP, ARGMOD(PMC **data), size_t n,
+        ARGIN_NULLOK(PMC *cmp), INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_util_sort_pmcs)
+    sort_info_t info;
+
+    info.width = sizeof (PMC *);
+    info.base  = NULL;
+    info.sub   = cmp;
+    info.sig   = "PP->I";
+    if (PMC_IS_NULL(cmp))
+        info.cmp = cmp_pmc;
+    else if (cmp->vtable->base_type == enum_class_NCI)
+        info.cmp = cmp_nci_ptr;
+    else
+        info.cmp = cmp_sub_ptr;
+
+    sort_elements(interp, (char *)data, n, &info, flags);
+}
+
+/*
+
+=item C<void Parrot_util_sort_pmcs_by_key(PARROT_INTERP, PMC **data, size_t n,
+PMC *key)>
+
+Sorts the C<n> PMCs at C<data> by the keys that the Sub C<key> returns for
+them. C<key> is called exactly once per element and the keys are compared
+with their C<cmp> vtable, or by radix sort if they are all Integers or all
+Floats. The sort is stable.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_pmcs_by_key(PARROT_INTERP, ARGMOD(PMC **data), size_t n,
+        ARGIN(PMC *key))
+{
+    ASSERT_ARGS(Parrot_util_sort_pmcs_by_key)
+    PMC    * const keys = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray, n);
+    INTVAL * const perm = mem_gc_allocate_n_typed(interp, n, INTVAL);
+    int     all_int     = 1;
+    int     all_float   = sizeof (FLOATVAL) == sizeof (UINTVAL);
+    size_t  i;
+
+    for (i = 0; i < n; ++i) {
+        PMC *k = PMCNULL;
+
+        Parrot_ext_call(interp, key, "P->P", data[i], &k);
+        VTABLE_set_pmc_keyed_int(interp, keys, i, k);
+        perm[i]   = i;
+        all_int   = all_int   && !PMC_IS_NULL(k) && k->vtable->base_type == enum_class_Integer;
+        all_float = all_float && !PMC_IS_NULL(k) && k->vtable->base_type == enum_class_Float;
+    }
+
+    if (n > 1 && (all_int || all_float)) {
+        UINTVAL * const ukeys = mem_gc_allocate_n_typed(interp, n, UINTVAL);
+
+        for (i = 0; i < n; ++i) {
+            PMC * const k = VTABLE_get_pmc_keyed_int(interp, keys, i);
+            ukeys[i] = all_int
+                     ? int_to_radix(VTABLE_get_integer(interp, k))
+                     : float_to_radix(VTABLE_get_number(interp, k));
+        }
+
+        radix_sort(interp, ukeys, perm, n);
+        mem_gc_free(interp, ukeys);
+    }
+    else if (n > 1) {
+        sort_info_t info;
+
+        info.cmp   = cmp_pmc;
+        info.width = sizeof (PMC *);
+        info.base  = (const char *)PARROT_FIXEDPMCARRAY(keys)->pmc_array;
+        info.sub   = PMCNULL;
+        info.sig   = NULL;
+        merge_sort_indexes(interp, perm, n, &info);
+    }
+
+    apply_permutation(interp, (char *)data, perm, n, sizeof (PMC *));
+    mem_gc_free(interp, perm);
+}
+
+/*
+
+=item C<void Parrot_util_sort_intvals(PARROT_INTERP, INTVAL *data, size_t n, PMC
+*cmp, INTVAL flags)>
+
+Sorts the C<n> integers at C<data>, by radix sort unless a comparator Sub
+C<cmp> taking two integers is given.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_intvals(PARROT_INTERP, ARGMOD(INTVAL *data), size_t n,
+        ARGIN_NULLOK(PMC *cmp), INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_util_sort_intvals)
+
+    if (PMC_IS_NULL(cmp)) {
+        /* equal integers can't be told apart, so this is stable too */
+        UINTVAL * const keys = (UINTVAL *)data;
+        size_t i;
+
+        for (i = 0; i < n; ++i)
+            keys[i] = int_to_radix(data[i]);
+
+        radix_sort(interp, keys, NULL, n);
+
+        for (i = 0; i < n; ++i)
+            data[i] = radix_to_int(keys[i]);
+    }
+    else {
+        sort_info_t info;
+
+        info.width = sizeof (INTVAL);
+        info.base  = NULL;
+        info.sub   = cmp;
+        info.sig   = "II->I";
+        info.cmp   = cmp->vtable->base_type == enum_class_NCI
+                   ? cmp_nci_int : cmp_sub_int;
+        sort_elements(interp, (char *)data, n, &info, flags);
+    }
+}
+
+/*
+
+=item C<void Parrot_util_sort_floatvals(PARROT_INTERP, FLOATVAL *data, size_t n,
+PMC *cmp, INTVAL flags)>
+
+Sorts the C<n> floats at C<data>, by radix sort unless a comparator Sub
+C<cmp> taking two floats and returning an integer is given. Radix sort
+needs FLOATVAL to be the size of an UINTVAL; other builds compare the
+floats directly.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_floatvals(PARROT_INTERP, ARGMOD(FLOATVAL *data), size_t n,
+        ARGIN_NULLOK(PMC *cmp), INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_util_sort_floatvals)
+    sort_info_t info;
+
+    if (PMC_IS_NULL(cmp) && sizeof (FLOATVAL) == sizeof (UINTVAL)) {
+        UINTVAL * const keys = mem_gc_allocate_n_typed(interp, n, UINTVAL);
+        size_t i;
+
+        for (i = 0; i < n; ++i)
+            keys[i] = float_to_radix(data[i]);
+
+        radix_sort(interp, keys, NULL, n);
+
+        for (i = 0; i < n; ++i)
+            data[i] = radix_to_float(keys[i]);
+
+        mem_gc_free(interp, keys);
+        return;
+    }
+
+    info.width = sizeof (FLOATVAL);
+    info.base  = NULL;
+    info.sub   = cmp;
+    info.sig   = "NN->I";
+    info.cmp   = PMC_IS_NULL(cmp) ? cmp_float : cmp_sub_float;
+    sort_elements(interp, (char *)data, n, &info, flags);
+}
+
+/*
+
+=item C<void Parrot_util_sort_strings(PARROT_INTERP, STRING **data, size_t n,
+PMC *cmp, INTVAL flags)>
+
+Sorts the C<n> strings at C<data>. C<cmp> is like for
+C<Parrot_util_sort_pmcs>, but gets two strings. Without a comparator,
+strings which are all ASCII or Latin-1, all ASCII or UTF-8, or all binary
+are sorted by radix sort; others are compared with C<Parrot_str_compare>.
+A NULL string sorts like an empty one.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_strings(PARROT_INTERP, ARGMOD(STRING **data), size_t n,
+        ARGIN_NULLOK(PMC *cmp), INTVAL flags)
+{
+    ASSERT_ARGS(Parrot_util_sort_strings)
+    sort_info_t info;
+
+    if (PMC_IS_NULL(cmp)) {
+        if (!(flags & PARROT_SORT_STABLE) && strings_sort_bytewise(data, n)) {
+            STRING ** const aux    = mem_gc_allocate_n_typed(interp, n, STRING *);
+            size_t           levels = 1;
+            size_t          *counts;
+            size_t           i;
+
+            for (i = n; i > 1; i >>= 1)
+                ++levels;
+
+            counts = mem_gc_allocate_n_typed(interp, levels * SORT_BUCKETS, size_t);
+            radix_sort_strings(data, aux, counts, n, 0);
+            mem_gc_free(interp, counts);
+            mem_gc_free(interp, aux);
+            return;
+        }
+        info.cmp = cmp_string;
+    }
+    else if (cmp->vtable->base_type == enum_class_NCI)
+        info.cmp = cmp_nci_ptr;
+    else
+        info.cmp = cmp_sub_ptr;
+
+    info.width = sizeof (STRING *);
+    info.base  = NULL;
+    info.sub   = cmp;
+    info.sig   = "SS->I";
+    sort_elements(interp, (char *)data, n, &info, flags);
+}
+
+/*
+
+=back
+
+=head2 Comparators
+
+=over 4
+
+=item C<static INTVAL cmp_pmc(PARROT_INTERP, const void *a, const void *b, const
+sort_info_t *info)>
+
+Compares two PMCs with their C<cmp> vtable.
+
+=item C<static INTVAL cmp_string(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+Compares two STRINGs.
+
+=item C<static INTVAL cmp_float(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+Compares two FLOATVALs numerically.
+
+=item C<static INTVAL cmp_nci_ptr(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+=item C<static INTVAL cmp_nci_int(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+Call the C function behind an NCI comparator with two PMCs or STRINGs, or
+two INTVALs passed as pointers.
+
+=item C<static INTVAL cmp_sub_ptr(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+=item C<static INTVAL cmp_sub_int(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+=item C<static INTVAL cmp_sub_float(PARROT_INTERP, const void *a, const void *b,
+const sort_info_t *info)>
+
+Call a comparator Sub with two PMCs or STRINGs, INTVALs or FLOATVALs.
+
+=cut
+
+*/
+
+static INTVAL
+cmp_pmc(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        SHIM(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_pmc)
+    return VTABLE_cmp(interp, *(PMC * const *)a, *(PMC * const *)b);
+}
+
+static INTVAL
+cmp_string(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        SHIM(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_string)
+    return Parrot_str_compare(interp, *(STRING * const *)a, *(STRING * const *)b);
+}
+
+PARROT_PURE_FUNCTION
+static INTVAL
+cmp_float(SHIM_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        SHIM(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_float)
+    const FLOATVAL x = *(const FLOATVAL *)a;
+    const FLOATVAL y = *(const FLOATVAL *)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+static INTVAL
+cmp_nci_ptr(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_nci_ptr)
+    const sort_func_t f = (sort_func_t)D2FPTR(PARROT_NCI(info->sub)->func);
+    return f(interp, *(void * const *)a, *(void * const *)b);
+}
+
+static INTVAL
+cmp_nci_int(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_nci_int)
+    const sort_func_t f = (sort_func_t)D2FPTR(PARROT_NCI(info->sub)->func);
+    return f(interp, INTVAL2PTR(void *, *(const INTVAL *)a),
+                     INTVAL2PTR(void *, *(const INTVAL *)b));
+}
+
+static INTVAL
+cmp_sub_ptr(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_sub_ptr)
+    INTVAL result = 0;
+    Parrot_ext_call(interp, info->sub, info->sig,
+            *(void * const *)a, *(void * const *)b, &result);
+    return result;
+}
+
+static INTVAL
+cmp_sub_int(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_sub_int)
+    INTVAL result = 0;
+    Parrot_ext_call(interp, info->sub, info->sig,
+            *(const INTVAL *)a, *(const INTVAL *)b, &result);
+    return result;
+}
+
+static INTVAL
+cmp_sub_float(PARROT_INTERP, ARGIN(const void *a), ARGIN(const void *b),
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(cmp_sub_float)
+    INTVAL result = 0;
+    Parrot_ext_call(interp, info->sub, info->sig,
+            *(const FLOATVAL *)a, *(const FLOATVAL *)b, &result);
+    return result;
+}
+
+/*
+
+=back
+
+=head2 Comparison sorts
+
+=over 4
+
+=item C<static void sort_elements(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info, INTVAL flags)>
+
+Sorts C<n> elements at C<base> with C<info-E<gt>cmp>: pattern-defeating
+quicksort, or a merge sort of indexes if C<flags> asks for a stable sort.
+
+=cut
+
+*/
+
+static void
+sort_elements(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info), INTVAL flags)
+{
+    ASSERT_ARGS(sort_elements)
+
+    if (n < 2)
+        return;
+
+    if (flags & PARROT_SORT_STABLE) {
+        INTVAL * const perm = mem_gc_allocate_n_typed(interp, n, INTVAL);
+        sort_info_t    by_index = *info;
+        size_t         i;
+
+        for (i = 0; i < n; ++i)
+            perm[i] = i;
+
+        by_index.base = base;
+        merge_sort_indexes(interp, perm, n, &by_index);
+        apply_permutation(interp, base, perm, n, info->width);
+        mem_gc_free(interp, perm);
+    }
+    else {
+        int bad_allowed = 0;
+        size_t i;
+
+        for (i = n; i > 1; i >>= 1)
+            ++bad_allowed;
+
+        pdq_sort(interp, base, n, info, bad_allowed, 1);
+    }
+}
+
+/*
+
+=item C<static void swap_elements(char *a, char *b, size_t width)>
+
+Swaps two elements of C<width> bytes.
+
+=cut
+
+*/
+
+PARROT_INLINE
+static void
+swap_elements(ARGMOD(char *a), ARGMOD(char *b), size_t width)
+{
+    ASSERT_ARGS(swap_elements)
+    sort_elem_t tmp;
+
+    memcpy(&tmp, a, width);
+    memcpy(a, b, width);
+    memcpy(b, &tmp, width);
+}
+
+/*
+
+=item C<static void sort2(PARROT_INTERP, char *base, size_t a, size_t b, const
+sort_info_t *info)>
+
+=item C<static void sort3(PARROT_INTERP, char *base, size_t a, size_t b, size_t
+c, const sort_info_t *info)>
+
+Put two or three elements into order.
+
+=cut
+
+*/
+
+static void
+sort2(PARROT_INTERP, ARGMOD(char *base), size_t a, size_t b,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(sort2)
+    const size_t w = info->width;
+
+    if (info->cmp(interp, ELEM(base, b, w), ELEM(base, a, w), info) < 0)
+        swap_elements(ELEM(base, a, w), ELEM(base, b, w), w);
+}
+
+static void
+sort3(PARROT_INTERP, ARGMOD(char *base), size_t a, size_t b, size_t c,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(sort3)
+    sort2(interp, base, a, b, info);
+    sort2(interp, base, b, c, info);
+    sort2(interp, base, a, b, info);
+}
+
+/*
+
+=item C<static int insertion_sort(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info, size_t limit)>
+
+Sorts C<n> elements by insertion. With a C<limit>, gives up and returns 0
+as soon as more than C<limit> elements had to be moved; returns 1 when the
+range is sorted.
+
+=cut
+
+*/
+
+static int
+insertion_sort(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info), size_t limit)
+{
+    ASSERT_ARGS(insertion_sort)
+    const size_t w     = info->width;
+    size_t       moved = 0;
+    size_t       i;
+
+    for (i = 1; i < n; ++i) {
+        size_t j = i;
+
+        while (j > 0
+        &&     info->cmp(interp, ELEM(base, j, w), ELEM(base, j - 1, w), info) < 0) {
+            swap_elements(ELEM(base, j, w), ELEM(base, j - 1, w), w);
+            --j;
+        }
+
+        moved += i - j;
+        if (limit && moved > limit)
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static void heap_sort(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info)>
+
+Sorts C<n> elements by heapsort; the fallback when quicksort keeps choosing
+bad pivots.
+
+=cut
+
+*/
+
+static void
+heap_sort(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(heap_sort)
+    const size_t w = info->width;
+    size_t       i;
+
+    for (i = n / 2; i > 0; --i)
+        sift_down(interp, base, i - 1, n, info);
+
+    for (i = n - 1; i > 0; --i) {
+        swap_elements(base, ELEM(base, i, w), w);
+        sift_down(interp, base, 0, i, info);
+    }
+}
+
+/*
+
+=item C<static void sift_down(PARROT_INTERP, char *base, size_t root, size_t n,
+const sort_info_t *info)>
+
+Restores the max-heap property below C<root> in a heap of C<n> elements.
+
+=cut
+
+*/
+
+static void
+sift_down(PARROT_INTERP, ARGMOD(char *base), size_t root, size_t n,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(sift_down)
+    const size_t w = info->width;
+
+    while (2 * root + 1 < n) {
+        size_t child = 2 * root + 1;
+
+        if (child + 1 < n
+        &&  info->cmp(interp, ELEM(base, child, w), ELEM(base, child + 1, w), info) < 0)
+            ++child;
+
+        if (!(info->cmp(interp, ELEM(base, root, w), ELEM(base, child, w), info) < 0))
+            return;
+
+        swap_elements(ELEM(base, root, w), ELEM(base, child, w), w);
+        root = child;
+    }
+}
+
+/*
+
+=item C<static size_t partition_right(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info, int *already_partitioned)>
+
+Partitions C<n> elements around the pivot at C<base[0]>: smaller elements
+go to its left, equal and larger ones to its right. Returns the pivot's
+final position and tells whether no element had to be moved.
+
+=cut
+
+*/
+
+static size_t
+partition_right(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info), ARGOUT(int *already_partitioned))
+{
+    ASSERT_ARGS(partition_right)
+    const size_t w = info->width;
+    size_t       i = 1;
+    size_t       j = n;
+
+    /* [1, i) is smaller than the pivot, [j, n) is not */
+    while (i < j && info->cmp(interp, ELEM(base, i, w), base, info) < 0)
+        ++i;
+    while (j > i && !(info->cmp(interp, ELEM(base, j - 1, w), base, info) < 0))
+        --j;
+
+    *already_partitioned = i >= j;
+
+    while (i + 1 < j) {
+        swap_elements(ELEM(base, i, w), ELEM(base, j - 1, w), w);
+        ++i;
+        --j;
+        while (i < j && info->cmp(interp, ELEM(base, i, w), base, info) < 0)
+            ++i;
+        while (j > i && !(info->cmp(interp, ELEM(base, j - 1, w), base, info) < 0))
+            --j;
+    }
+
+    swap_elements(base, ELEM(base, i - 1, w), w);
+    return i - 1;
+}
+
+/*
+
+=item C<static size_t partition_left(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info)>
+
+Like C<partition_right>, but elements equal to the pivot go to its left.
+Used when the pivot equals the element before the range, i.e. the range
+starts with a run of equal elements which need no further sorting.
+
+=cut
+
+*/
+
+static size_t
+partition_left(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(partition_left)
+    const size_t w = info->width;
+    size_t       i = 1;
+    size_t       j = n;
+
+    /* [1, i) is not larger than the pivot, [j, n) is */
+    while (i < j && !(info->cmp(interp, base, ELEM(base, i, w), info) < 0))
+        ++i;
+    while (j > i && info->cmp(interp, base, ELEM(base, j - 1, w), info) < 0)
+        --j;
+
+    while (i + 1 < j) {
+        swap_elements(ELEM(base, i, w), ELEM(base, j - 1, w), w);
+        ++i;
+        --j;
+        while (i < j && !(info->cmp(interp, base, ELEM(base, i, w), info) < 0))
+            ++i;
+        while (j > i && info->cmp(interp, base, ELEM(base, j - 1, w), info) < 0)
+            --j;
+    }
+
+    swap_elements(base, ELEM(base, i - 1, w), w);
+    return i - 1;
+}
+
+/*
+
+=item C<static void pdq_sort(PARROT_INTERP, char *base, size_t n, const
+sort_info_t *info, int bad_allowed, int leftmost)>
+
+Pattern-defeating quicksort of C<n> elements. C<bad_allowed> is the number
+of badly unbalanced partitions tolerated before switching to heapsort.
+Unless C<leftmost>, the element before C<base> is known to be no larger
+than any element of the range.
+
+=cut
+
+*/
+
+static void
+pdq_sort(PARROT_INTERP, ARGMOD(char *base), size_t n,
+        ARGIN(const sort_info_t *info), int bad_allowed, int leftmost)
+{
+    ASSERT_ARGS(pdq_sort)
+    const size_t w = info->width;
+
+    while (n > SORT_INSERTION_MAX) {
+        const size_t half = n / 2;
+        size_t       pivot, l_size, r_size;
+        int          already_partitioned;
+
+        /* move the median of three (or nine) to the front as pivot */
+        if (n > SORT_NINTHER_MIN) {
+            sort3(interp, base, 0, half, n - 1, info);
+            sort3(interp, base, 1, half - 1, n - 2, info);
+            sort3(interp, base, 2, half + 1, n - 3, info);
+            sort3(interp, base, half - 1, half, half + 1, info);
+            swap_elements(base, ELEM(base, half, w), w);
+        }
+        else
+            sort3(interp, base, half, 0, n - 1, info);
+
+        /* a pivot equal to the preceding element starts a run of equal
+         * elements; skip over it */
+        if (!leftmost && !(info->cmp(interp, base - w, base, info) < 0)) {
+            pivot = partition_left(interp, base, n, info);
+            base += (pivot + 1) * w;
+            n    -= pivot + 1;
+            continue;
+        }
+
+        pivot  = partition_right(interp, base, n, info, &already_partitioned);
+        l_size = pivot;
+        r_size = n - pivot - 1;
+
+        if (l_size < n / 8 || r_size < n / 8) {
+            if (--bad_allowed <= 0) {
+                heap_sort(interp, base, n, info);
+                return;
+            }
+
+            /* break up the pattern that produced the bad pivot */
+            if (l_size >= SORT_INSERTION_MAX) {
+                swap_elements(base, ELEM(base, l_size / 4, w), w);
+                swap_elements(ELEM(base, pivot - 1, w), ELEM(base, pivot - l_size / 4, w), w);
+            }
+            if (r_size >= SORT_INSERTION_MAX) {
+                swap_elements(ELEM(base, pivot + 1, w), ELEM(base, pivot + 1 + r_size / 4, w), w);
+                swap_elements(ELEM(base, n - 1, w), ELEM(base, n - r_size / 4, w), w);
+            }
+        }
+        else if (already_partitioned
+             &&  insertion_sort(interp, base, l_size, info, SORT_PARTIAL_MAX)
+             &&  insertion_sort(interp, ELEM(base, pivot + 1, w), r_size, info, SORT_PARTIAL_MAX))
+            return;
+
+        /* recurse into the smaller part to bound the stack depth */
+        if (l_size < r_size) {
+            pdq_sort(interp, base, l_size, info, bad_allowed, leftmost);
+            base    += (pivot + 1) * w;
+            n        = r_size;
+            leftmost = 0;
+        }
+        else {
+            pdq_sort(interp, ELEM(base, pivot + 1, w), r_size, info, bad_allowed, 0);
+            n = l_size;
+        }
+    }
+
+    insertion_sort(interp, base, n, info, 0);
+}
+
+/*
+
+=item C<static void merge_sort_indexes(PARROT_INTERP, INTVAL *idx, size_t n,
+const sort_info_t *info)>
+
+Stable merge sort of C<n> indexes into C<info-E<gt>base>. The elements
+themselves don't move, so scratch memory never holds the only reference to
+a PMC or STRING.
+
+=cut
+
+*/
+
+static void
+merge_sort_indexes(PARROT_INTERP, ARGMOD(INTVAL *idx), size_t n,
+        ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(merge_sort_indexes)
+    INTVAL * const scratch = mem_gc_allocate_n_typed(interp, n / 2 + 1, INTVAL);
+    merge_sort_run(interp, idx, scratch, n, info);
+    mem_gc_free(interp, scratch);
+}
+
+/*
+
+=item C<static void merge_sort_run(PARROT_INTERP, INTVAL *idx, INTVAL *scratch,
+size_t n, const sort_info_t *info)>
+
+Recursive part of C<merge_sort_indexes>; C<scratch> holds at least C<n / 2>
+indexes.
+
+=cut
+
+*/
+
+static void
+merge_sort_run(PARROT_INTERP, ARGMOD(INTVAL *idx), ARGMOD(INTVAL *scratch),
+        size_t n, ARGIN(const sort_info_t *info))
+{
+    ASSERT_ARGS(merge_sort_run)
+    const size_t  w    = info->width;
+    const char   *base = info->base;
+    size_t        m, i, j, k;
+
+    if (n <= SORT_INSERTION_MAX) {
+        for (i = 1; i < n; ++i) {
+            const INTVAL x = idx[i];
+
+            for (j = i; j > 0
+            &&   info->cmp(interp, ELEM(base, x, w), ELEM(base, idx[j - 1], w), info) < 0; --j)
+                idx[j] = idx[j - 1];
+
+            idx[j] = x;
+        }
+        return;
+    }
+
+    m = n / 2;
+    merge_sort_run(interp, idx, scratch, m, info);
+    merge_sort_run(interp, idx + m, scratch, n - m, info);
+
+    /* the halves are already in order */
+    if (!(info->cmp(interp, ELEM(base, idx[m], w), ELEM(base, idx[m - 1], w), info) < 0))
+        return;
+
+    memcpy(scratch, idx, m * sizeof (INTVAL));
+
+    for (i = 0, j = m, k = 0; i < m && j < n; ++k) {
+        if (info->cmp(interp, ELEM(base, idx[j], w), ELEM(base, scratch[i], w), info) < 0)
+            idx[k] = idx[j++];
+        else
+            idx[k] = scratch[i++];
+    }
+
+    while (i < m)
+        idx[k++] = scratch[i++];
+}
+
+/*
+
+=item C<static void apply_permutation(PARROT_INTERP, char *base, const INTVAL
+*perm, size_t n, size_t width)>
+
+Rearranges the C<n> elements at C<base> so that element C<i> becomes the
+former element C<perm[i]>. Nothing in here can trigger GC.
+
+=cut
+
+*/
+
+static void
+apply_permutation(PARROT_INTERP, ARGMOD(char *base), ARGIN(const INTVAL *perm),
+        size_t n, size_t width)
+{
+    ASSERT_ARGS(apply_permutation)
+    char * const copy = mem_gc_allocate_n_typed(interp, n * width, char);
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+        memcpy(ELEM(copy, i, width), ELEM(base, perm[i], width), width);
+
+    memcpy(base, copy, n * width);
+    mem_gc_free(interp, copy);
+}
+
+/*
+
+=back
+
+=head2 Radix sorts
+
+=over 4
+
+=item C<static UINTVAL int_to_radix(INTVAL i)>
+
+=item C<static INTVAL radix_to_int(UINTVAL u)>
+
+=item C<static UINTVAL float_to_radix(FLOATVAL f)>
+
+=item C<static FLOATVAL radix_to_float(UINTVAL u)>
+
+Map INTVALs and FLOATVALs to unsigned keys in the same order, and back.
+Negative floats have all bits flipped, others just the sign bit; NaNs end
+up at either end. The float mapping needs FLOATVAL to be an UINTVAL wide.
+
+=cut
+
+*/
+
+#define RADIX_SIGN_BIT ((UINTVAL)1 << (sizeof (UINTVAL) * 8 - 1))
+
+PARROT_CONST_FUNCTION
+static UINTVAL
+int_to_radix(INTVAL i)
+{
+    ASSERT_ARGS(int_to_radix)
+    return (UINTVAL)i ^ RADIX_SIGN_BIT;
+}
+
+PARROT_CONST_FUNCTION
+static INTVAL
+radix_to_int(UINTVAL u)
+{
+    ASSERT_ARGS(radix_to_int)
+    return (INTVAL)(u ^ RADIX_SIGN_BIT);
+}
+
+PARROT_CONST_FUNCTION
+static UINTVAL
+float_to_radix(FLOATVAL f)
+{
+    ASSERT_ARGS(float_to_radix)
+    UINTVAL u = 0;
+
+    memcpy(&u, &f, sizeof (UINTVAL));
+    return (u & RADIX_SIGN_BIT) ? ~u : u | RADIX_SIGN_BIT;
+}
+
+PARROT_CONST_FUNCTION
+static FLOATVAL
+radix_to_float(UINTVAL u)
+{
+    ASSERT_ARGS(radix_to_float)
+    FLOATVAL f = 0.0;
+
+    u = (u & RADIX_SIGN_BIT) ? u & ~RADIX_SIGN_BIT : ~u;
+    memcpy(&f, &u, sizeof (UINTVAL));
+    return f;
+}
+
+/*
+
+=item C<static void radix_sort(PARROT_INTERP, UINTVAL *keys, INTVAL *payload,
+size_t n)>
+
+Stable LSD radix sort of C<n> keys, a byte per pass. Passes in which all
+keys have the same byte are skipped. If C<payload> isn't NULL, its entries
+are moved along with the keys.
+
+=cut
+
+*/
+
+static void
+radix_sort(PARROT_INTERP, ARGMOD(UINTVAL *keys), ARGMOD_NULLOK(INTVAL *payload),
+        size_t n)
+{
+    ASSERT_ARGS(radix_sort)
+    size_t  *counts;
+    UINTVAL *src_k = keys,    *dst_k;
+    INTVAL  *src_p = payload, *dst_p = NULL;
+    size_t   i, d;
+
+    if (n < SORT_RADIX_MIN) {
+        for (i = 1; i < n; ++i) {
+            const UINTVAL k = keys[i];
+            const INTVAL  p = payload ? payload[i] : 0;
+            size_t        j;
+
+            for (j = i; j > 0 && keys[j - 1] > k; --j) {
+                keys[j] = keys[j - 1];
+                if (payload)
+                    payload[j] = payload[j - 1];
+            }
+
+            keys[j] = k;
+            if (payload)
+                payload[j] = p;
+        }
+        return;
+    }
+
+    /* histograms of all digits in one pass */
+    counts = mem_gc_allocate_n_zeroed_typed(interp, sizeof (UINTVAL) * 256, size_t);
+    for (i = 0; i < n; ++i)
+        for (d = 0; d < sizeof (UINTVAL); ++d)
+            ++counts[d * 256 + ((keys[i] >> (d * 8)) & 0xff)];
+
+    dst_k = mem_gc_allocate_n_typed(interp, n, UINTVAL);
+    if (payload)
+        dst_p = mem_gc_allocate_n_typed(interp, n, INTVAL);
+
+    for (d = 0; d < sizeof (UINTVAL); ++d) {
+        const unsigned int shift  = d * 8;
+        size_t * const     digit  = counts + d * 256;
+        size_t             offset = 0;
+
+        if (digit[(src_k[0] >> shift) & 0xff] == n)
+            continue;
+
+        for (i = 0; i < 256; ++i) {
+            const size_t c = digit[i];
+            digit[i] = offset;
+            offset  += c;
+        }
+
+        for (i = 0; i < n; ++i) {
+            const size_t pos = digit[(src_k[i] >> shift) & 0xff]++;
+            dst_k[pos] = src_k[i];
+            if (payload)
+                dst_p[pos] = src_p[i];
+        }
+
+        {
+            UINTVAL * const tk = src_k;
+            INTVAL  * const tp = src_p;
+            src_k = dst_k; dst_k = tk;
+            src_p = dst_p; dst_p = tp;
+        }
+    }
+
+    if (src_k != keys) {
+        memcpy(keys, src_k, n * sizeof (UINTVAL));
+        if (payload)
+            memcpy(payload, src_p, n * sizeof (INTVAL));
+        dst_k = src_k;
+        dst_p = src_p;
+    }
+
+    mem_gc_free(interp, dst_k);
+    if (payload)
+        mem_gc_free(interp, dst_p);
+    mem_gc_free(interp, counts);
+}
+
+/*
+
+=item C<static int strings_sort_bytewise(STRING **data, size_t n)>
+
+Returns true if comparing the bytes of the C<n> strings at C<data> orders
+them like C<Parrot_str_compare> does.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+strings_sort_bytewise(ARGIN(STRING **data), size_t n)
+{
+    ASSERT_ARGS(strings_sort_bytewise)
+    int has_latin1 = 0, has_utf8 = 0, has_binary = 0, has_ascii = 0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        const STR_VTABLE * const enc = STRING_IS_NULL(data[i]) ? NULL : data[i]->encoding;
+
+        if (!enc)
+            continue;
+        else if (enc == Parrot_ascii_encoding_ptr)
+            has_ascii = 1;
+        else if (enc == Parrot_latin1_encoding_ptr)
+            has_latin1 = 1;
+        else if (enc == Parrot_utf8_encoding_ptr)
+            has_utf8 = 1;
+        else if (enc == Parrot_binary_encoding_ptr)
+            has_binary = 1;
+        else
+            return 0;
+    }
+
+    if (has_binary)
+        return !(has_ascii || has_latin1 || has_utf8);
+
+    return !(has_latin1 && has_utf8);
+}
+
+/*
+
+=item C<static unsigned int string_byte(const STRING *s, size_t depth)>
+
+Returns 1 + the byte of C<s> at offset C<depth>, or 0 past its end.
+
+=cut
+
+*/
+
+PARROT_INLINE
+PARROT_PURE_FUNCTION
+static unsigned int
+string_byte(ARGIN_NULLOK(const STRING *s), size_t depth)
+{
+    ASSERT_ARGS(string_byte)
+
+    if (STRING_IS_NULL(s) || depth >= s->bufused)
+        return 0;
+
+    return 1 + (unsigned char)s->strstart[depth];
+}
+
+/*
+
+=item C<static int string_bytes_cmp(const STRING *a, const STRING *b, size_t
+depth)>
+
+Compares the bytes of two strings from offset C<depth> on.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static int
+string_bytes_cmp(ARGIN_NULLOK(const STRING *a), ARGIN_NULLOK(const STRING *b),
+        size_t depth)
+{
+    ASSERT_ARGS(string_bytes_cmp)
+    const size_t la = STRING_IS_NULL(a) || a->bufused < depth ? 0 : a->bufused - depth;
+    const size_t lb = STRING_IS_NULL(b) || b->bufused < depth ? 0 : b->bufused - depth;
+    const int    r  = la && lb
+                    ? memcmp(a->strstart + depth, b->strstart + depth, la < lb ? la : lb)
+                    : 0;
+
+    if (r)
+        return r;
+
+    return (la > lb) - (la < lb);
+}
+
+/*
+
+=item C<static void radix_sort_strings(STRING **data, STRING **aux, size_t
+*counts, size_t n, size_t depth)>
+
+MSD radix sort of C<n> strings that agree on their first C<depth> bytes,
+using C<aux> (room for C<n> strings) as scratch. The largest bucket is
+handled by iteration, so recursion is no deeper than log2(n); each level
+uses C<SORT_BUCKETS> entries of C<counts>. Nothing in here can trigger GC.
+
+=cut
+
+*/
+
+static void
+radix_sort_strings(ARGMOD(STRING **data), ARGMOD(STRING **aux),
+        ARGMOD(size_t *counts), size_t n, size_t depth)
+{
+    ASSERT_ARGS(radix_sort_strings)
+
+    while (n > SORT_INSERTION_MAX) {
+        size_t * const count = counts;
+        size_t * const start = counts + 257;
+        size_t i, largest = 1;
+
+        memset(count, 0, 257 * sizeof (size_t));
+        for (i = 0; i < n; ++i)
+            ++count[string_byte(data[i], depth)];
+
+        /* common prefix: nothing to move */
+        if (count[string_byte(data[0], depth)] == n) {
+            if (count[0] == n)
+                return;
+            ++depth;
+            continue;
+        }
+
+        start[0] = 0;
+        for (i = 1; i < 257; ++i) {
+            start[i] = start[i - 1] + count[i - 1];
+            if (count[i] > count[largest])
+                largest = i;
+        }
+
+        for (i = 0; i < n; ++i)
+            aux[start[string_byte(data[i], depth)]++] = data[i];
+        memcpy(data, aux, n * sizeof (STRING *));
+
+        /* start[] now holds the bucket ends; bucket 0 (ended strings) is
+         * all equal */
+        for (i = 1; i < 257; ++i)
+            if (i != largest && count[i] > 1)
+                radix_sort_strings(data + start[i] - count[i], aux,
+                        counts + SORT_BUCKETS, count[i], depth + 1);
+
+        data  += start[largest] - count[largest];
+        n      = count[largest];
+        ++depth;
+    }
+
+    {
+        size_t i;
+
+        for (i = 1; i < n; ++i) {
+            STRING * const s = data[i];
+            size_t j;
+
+            for (j = i; j > 0 && string_bytes_cmp(s, data[j - 1], depth) < 0; --j)
+                data[j] = data[j - 1];
+
+            data[j] = s;
+        }
+    }
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<include/parrot/misc.h>
+
+=cut
+
+*/
+
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -2338,12 +2338,13 @@ void
 Parrot_str_pin(SHIM_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_pin)
-    const size_t size = Buffer_buflen(s);
+    const size_t size   = Buffer_buflen(s);
+    const size_t offset = s->strstart - (char *)Buffer_bufstart(s);
     char * const memory = (char *)mem_internal_allocate(size);
 
     memcpy(memory, Buffer_bufstart(s), size);
     Buffer_bufstart(s) = memory;
-    s->strstart        = memory;
+    s->strstart        = memory + offset;
 
     /* Mark the memory as both from the system and immobile */
     PObj_sysmem_SET(s);
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2014, Parrot Foundation.
+Copyright (C) 2001-2026, Parrot Foundation.
 
 =head1 NAME
 
@@ -23,6 +23,7 @@ Subroutines, continuations, co-routines and other fun stuff...
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_continuation.h"
 #include "pmc/pmc_coroutine.h"
+#include "pmc/pmc_lexpad.h"
 #include "parrot/oplib/core_ops.h"
 
 /* HEADERIZER HFILE: include/parrot/sub.h */
@@ -338,6 +339,44 @@ Parrot_sub_find_pad(PARROT_INTERP, ARGIN(STRING *lex_name), ARGIN(PMC *ctx))
 }
 
 
+/*
+
+=item C<PMC* Parrot_sub_find_lex_ctx(PARROT_INTERP, PMC *ctx, PMC *lex_info,
+INTVAL depth)>
+
+Locate the context C<depth> outer scopes up from C<ctx>, if its lexicals are
+the registers described by C<lex_info>, i.e. its LexPad is a plain LexPad for
+C<lex_info>. Return PMCNULL otherwise.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC*
+Parrot_sub_find_lex_ctx(PARROT_INTERP, ARGIN(PMC *ctx), ARGIN(PMC *lex_info),
+        INTVAL depth)
+{
+    ASSERT_ARGS(Parrot_sub_find_lex_ctx)
+    PMC *lex_pad;
+
+    while (depth-- > 0) {
+        ctx = Parrot_pcc_get_outer_ctx(interp, ctx);
+        if (PMC_IS_NULL(ctx))
+            return PMCNULL;
+    }
+
+    lex_pad = Parrot_pcc_get_lex_pad(interp, ctx);
+
+    if (PMC_IS_NULL(lex_pad)
+    ||  lex_pad->vtable->base_type != enum_class_LexPad
+    ||  PARROT_LEXPAD(lex_pad)->lexinfo != lex_info)
+        return PMCNULL;
+
+    return ctx;
+}
+
 /*
 
 =item C<PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP, STRING *lex_name, PMC
@@ -393,6 +432,9 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
 
     PMC_get_sub(interp, Parrot_pcc_get_sub(interp, ctx), current_sub);
 
+    /* the closure keeps using the registers of ctx */
+    Parrot_pcc_capture_context(interp, ctx);
+
     /* MultiSub gets special treatment */
     if (VTABLE_isa(interp, sub_pmc, CONST_STRING(interp, "MultiSub"))) {
 
@@ -532,6 +574,157 @@ Parrot_sub_continuation_rewind_environment(PARROT_INTERP, ARGIN(PMC *pmc))
     Parrot_pcc_set_signature(interp, to_ctx, sig);
 }
 
+/*
+
+=item C<opcode_t * Parrot_sub_resume_coroutine(PARROT_INTERP, PMC *coro, PMC
+**result, opcode_t *here, opcode_t *next)>
+
+Runs the Coroutine C<coro> up to its next yield for the C<resume> op at
+C<here>, and returns where to go on. A yield comes back to C<here> with the
+value waiting in the coroutine, which the op executed again then takes
+into C<*result> and goes on at C<next>. Once the coroutine has returned,
+C<*result> is PMCNULL.
+
+Unlike a call, a resume doesn't build a CallContext for the arguments and
+the results or a return continuation: the coroutine keeps its context and
+continuation from its first run, and only the PC and the context are
+swapped.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+opcode_t *
+Parrot_sub_resume_coroutine(PARROT_INTERP, ARGIN(PMC *coro), ARGOUT(PMC **result),
+        ARGIN(opcode_t *here), ARGIN(opcode_t *next))
+{
+    ASSERT_ARGS(Parrot_sub_resume_coroutine)
+    PMC * const caller_ctx = CURRENT_CONTEXT(interp);
+    Parrot_Coroutine_attributes *co;
+    opcode_t *dest;
+
+    if (coro->vtable->base_type != enum_class_Coroutine)
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+                "Can only resume a Coroutine");
+
+    co = PARROT_COROUTINE(coro);
+
+    /* back from a yield */
+    if (co->yield) {
+        *result     = co->yielded;
+        co->yield   = 0;
+        co->yielded = PMCNULL;
+        return next;
+    }
+
+    /* back from the return of the coroutine */
+    if (PObj_get_FLAGS(coro) & SUB_FLAG_CORO_FF) {
+        /* an autoreset one has dropped its context and starts over */
+        if (PMC_IS_NULL(co->ctx))
+            PObj_get_FLAGS(coro) &= ~SUB_FLAG_CORO_FF;
+        *result = PMCNULL;
+        return next;
+    }
+
+    Parrot_pcc_set_pc(interp, caller_ctx, here);
+
+    /* the first run sets up the context as a call without arguments does */
+    if (PMC_IS_NULL(co->ctx)) {
+        Parrot_pcc_set_signature(interp, caller_ctx, PMCNULL);
+        Parrot_pcc_reuse_continuation(interp, caller_ctx, here);
+        dest = VTABLE_invoke(interp, coro, here);
+    }
+    else {
+        PMC * const ctx   = co->ctx;
+        PMC * const ccont = Parrot_pcc_get_continuation(interp, ctx);
+
+        /* a return of the coroutine comes back here too */
+        SETATTR_Continuation_to_ctx(interp, ccont, caller_ctx);
+        SETATTR_Continuation_address(interp, ccont, here);
+        SETATTR_Continuation_seg(interp, ccont, interp->code);
+        SETATTR_Continuation_runloop_id(interp, ccont, interp->current_runloop_id);
+        PARROT_GC_WRITE_BARRIER(interp, ccont);
+
+        Parrot_pcc_set_caller_ctx(interp, ctx, caller_ctx);
+        co->caller_seg         = interp->code;
+        dest                   = co->address;
+        co->address            = here;
+        PObj_get_FLAGS(coro)  |= SUB_FLAG_CORO_FF;
+
+        Parrot_pcc_set_context(interp, ctx);
+        if (interp->code != co->seg)
+            Parrot_pf_switch_to_cs(interp, co->seg, 1);
+    }
+
+    co->resumed = 1;
+    PARROT_GC_WRITE_BARRIER(interp, coro);
+    return dest;
+}
+
+/*
+
+=item C<opcode_t * Parrot_sub_yield_coroutine(PARROT_INTERP, PMC *value,
+opcode_t *next)>
+
+Yields C<value> from the running Coroutine, which goes on at C<next> when
+resumed. If a C<resume> op runs the coroutine, the value is just left in
+the coroutine for it; otherwise it is returned as C<.yield(value)> does.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+opcode_t *
+Parrot_sub_yield_coroutine(PARROT_INTERP, ARGIN(PMC *value), ARGIN(opcode_t *next))
+{
+    ASSERT_ARGS(Parrot_sub_yield_coroutine)
+    PMC * const ctx  = CURRENT_CONTEXT(interp);
+    PMC * const coro = Parrot_pcc_get_sub(interp, ctx);
+    Parrot_Coroutine_attributes *co;
+    PMC      *to_ctx;
+    opcode_t *dest;
+
+    if (PMC_IS_NULL(coro) || coro->vtable->base_type != enum_class_Coroutine)
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+                "Cannot yield from non-continuation");
+
+    co = PARROT_COROUTINE(coro);
+
+    if (!co->resumed) {
+        PMC * const caller_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+        PMC * const call_sig   = Parrot_pcc_build_call_from_c_args(interp,
+                Parrot_pcc_get_signature(interp, caller_ctx), "P", value);
+
+        Parrot_pcc_set_signature(interp, ctx, call_sig);
+        VTABLE_increment(interp, coro);
+        return VTABLE_invoke(interp, coro, next);
+    }
+
+    GETATTR_Continuation_to_ctx(interp, Parrot_pcc_get_continuation(interp, ctx), to_ctx);
+    if (PMC_IS_NULL(to_ctx))
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+                       "Cannot resume dead coroutine. Invalid context");
+
+    co->yield              = 1;
+    co->yielded            = value;
+    dest                   = co->address;
+    co->address            = next;
+    PObj_get_FLAGS(coro)  &= ~SUB_FLAG_CORO_FF;
+    PARROT_GC_WRITE_BARRIER(interp, coro);
+
+    Parrot_pcc_set_context(interp, to_ctx);
+    if (interp->code != co->caller_seg)
+        Parrot_pf_switch_to_cs(interp, co->caller_seg, 1);
+
+    return dest;
+}
+
 
 /*
 
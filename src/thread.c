@@ -28,12 +28,17 @@ Threads are created by creating new C<ParrotInterpreter> objects.
 #include "pmc/pmc_task.h"
 #include "pmc/pmc_proxy.h"
 #include "pmc/pmc_parrotinterpreter.h"
+#include "thread.str"
 
 /* HEADERIZER HFILE: include/parrot/thread.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void check_shareable(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CAN_RETURN_NULL
 static PMC * Parrot_thread_make_local_args_copy(PARROT_INTERP,
     ARGIN(Parrot_Interp source),
@@ -44,6 +49,9 @@ static PMC * Parrot_thread_make_local_args_copy(PARROT_INTERP,
 PARROT_CAN_RETURN_NULL
 static void* Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg));
 
+#define ASSERT_ARGS_check_shareable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_thread_make_local_args_copy \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -146,7 +154,7 @@ PMC*
 Parrot_thread_create_proxy(PARROT_INTERP, ARGIN(Parrot_Interp const thread), ARGIN(PMC *pmc))
 {
     ASSERT_ARGS(Parrot_thread_create_proxy)
-    if (PMC_IS_NULL(pmc))
+    if (PMC_IS_NULL(pmc) || Parrot_thread_is_shared_ro(pmc))
         return pmc;
 
     if (pmc->vtable->base_type == enum_class_Sub) {
@@ -304,6 +312,7 @@ Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg))
     Interp * const interp = PARROT_PARROTINTERPRETER(self)->interp;
 
     PMC * const scheduler = interp->scheduler;
+    PMC * const ctx       = CURRENT_CONTEXT(interp);
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
     INTVAL foreign_count, i;
     int lo_var_ptr;
@@ -319,6 +328,10 @@ Parrot_thread_outer_runloop(ARGIN_NULLOK(void *arg))
             interp->current_runloop_level = 0;
             reset_runloop_id_counter(interp);
 
+            /* a task that stopped halfway leaves its context behind; the
+             * next one must not see the handlers in there */
+            Parrot_pcc_set_context(interp, ctx);
+
             Parrot_cx_next_task(interp, scheduler);
 
             foreign_count = VTABLE_get_integer(interp, sched->foreign_tasks);
@@ -494,6 +507,8 @@ Parrot_thread_make_local_copy(PARROT_INTERP, ARGIN(Parrot_Interp from), ARGIN(PM
 
     if (PMC_IS_NULL(arg))
         ret_val = PMCNULL;
+    else if (Parrot_thread_is_shared_ro(arg))
+        ret_val = arg;
     else if (VTABLE_isa(from, arg, _multi_sub)) {
         INTVAL i = 0;
         const INTVAL n = VTABLE_elements(from, arg);
@@ -529,6 +544,99 @@ Parrot_thread_make_local_copy(PARROT_INTERP, ARGIN(Parrot_Interp from), ARGIN(PM
 
 /*
 
+=item C<PMC * Parrot_thread_share_ro(PARROT_INTERP, PMC *pmc)>
+
+Publishes the object graph of C<pmc> to all threads, deeply immutable. Every
+PMC of the graph is switched to its read-only variant and flagged as shared,
+so the GC of a thread never marks it, and every string is pinned, so
+compacting the string memory of the main interpreter never moves it. The
+graph is registered as a GC root of the main interpreter for good.
+
+Threads then get C<pmc> itself instead of a Proxy or a copy. Only plain
+data can be shared; code, objects, classes and namespaces can't, as they
+would take everything they refer to along.
+
+Returns C<pmc>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_thread_share_ro(PARROT_INTERP, ARGIN_NULLOK(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_thread_share_ro)
+    PMC    *visitor, *strings;
+    Hash   *seen;
+    INTVAL  i, n;
+
+    if (PMC_IS_NULL(pmc) || Parrot_thread_is_shared_ro(pmc))
+        return pmc;
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
+            "Only the main interpreter can share objects with all threads");
+
+    visitor = Parrot_pmc_new(interp, enum_class_ImageIOStrings);
+    VTABLE_set_pmc(interp, visitor, pmc);
+    seen    = (Hash *)VTABLE_get_pointer(interp, visitor);
+    strings = VTABLE_get_pmc(interp, visitor);
+
+    /* Check the whole graph first, so a failure leaves it untouched */
+    parrot_hash_iterate(seen,
+        check_shareable(interp, (PMC *)_bucket->key););
+
+    parrot_hash_iterate(seen,
+        PMC * const member = (PMC *)_bucket->key;
+        if (member->vtable->flags & VTABLE_HAS_READONLY_FLAG)
+            member->vtable = member->vtable->ro_variant_vtable;
+        PObj_is_shared_SET(member););
+
+    n = VTABLE_elements(interp, strings);
+    for (i = 0; i < n; ++i) {
+        STRING * const s = VTABLE_get_string_keyed_int(interp, strings, i);
+        if (!STRING_IS_NULL(s) && Buffer_buflen(s) && PObj_is_movable_TESTALL(s))
+            Parrot_str_pin(interp, s);
+    }
+
+    Parrot_pmc_gc_register(interp, pmc);
+    return pmc;
+}
+
+/*
+
+=item C<static void check_shareable(PARROT_INTERP, PMC *pmc)>
+
+Throws an exception unless C<pmc> is plain data with a read-only variant.
+
+=cut
+
+*/
+
+static void
+check_shareable(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(check_shareable)
+    STRING * const invokable = CONST_STRING(interp, "invokable");
+    const INTVAL   type      = pmc->vtable->base_type;
+
+    if (type == enum_class_Object
+    ||  type == enum_class_Class
+    ||  type == enum_class_PMCProxy
+    ||  type == enum_class_NameSpace
+    ||  VTABLE_does(interp, pmc, invokable))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can't share a %Ss, only plain data can be shared", pmc->vtable->whoami);
+
+    if (!(pmc->vtable->flags & (VTABLE_HAS_READONLY_FLAG | VTABLE_IS_READONLY_FLAG)))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can't share a %Ss, it has no read-only variant", pmc->vtable->whoami);
+}
+
+/*
+
 =item C<static PMC * Parrot_thread_make_local_args_copy(PARROT_INTERP,
 Parrot_Interp source, PMC *args)>
 
@@ -0,0 +1,523 @@
+/*
+Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+src/timer_wheel.c - The hierarchical timer wheel of a scheduler
+
+=head1 DESCRIPTION
+
+Every scheduler keeps its pending alarms in a hierarchical timer wheel, so
+that adding, cancelling and expiring an alarm costs the same no matter how
+many are pending.
+
+Time is counted in ticks of C<PARROT_TIMER_WHEEL_TICK> seconds of the
+monotonic clock, so alarms don't go off early or late when the system time is
+changed. An alarm is due at the first tick after its C<alarm_time>.
+
+The wheel has C<PARROT_TIMER_WHEEL_LEVELS> levels of
+C<PARROT_TIMER_WHEEL_SLOTS> slots each. A slot of level 0 holds the alarms
+due at a single tick, a slot of level 1 those due in a span of 64 ticks, one
+of level 2 a span of 64 * 64 ticks, and so on. An alarm goes into the lowest
+level whose slots can tell it apart from the current tick. Whenever level 0
+completes a turn, the next slot of level 1 is emptied and its alarms are
+spread over level 0, and likewise for the higher levels. That way every
+alarm is moved at most once per level.
+
+Each slot is a doubly linked list of Alarm PMCs, threaded through their
+C<wheel_prev> and C<wheel_next> attributes. The alarm records its slot in
+C<wheel_slot>, which makes cancelling it O(1).
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/scheduler_private.h"
+#include "parrot/timer_wheel.h"
+#include "pmc/pmc_alarm.h"
+
+/* HEADERIZER HFILE: include/parrot/timer_wheel.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void cascade(
+    ARGMOD(Parrot_timer_wheel *wheel),
+    int level,
+    INTVAL slot)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*wheel);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL current_tick(
+    ARGIN(const Parrot_timer_wheel *wheel),
+    FLOATVAL now)
+        __attribute__nonnull__(1);
+
+static void link_alarm(ARGMOD(Parrot_timer_wheel *wheel), ARGIN(PMC *alarm))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*wheel);
+
+static void unlink_alarm(
+    ARGMOD(Parrot_timer_wheel *wheel),
+    ARGIN(PMC *alarm))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*wheel);
+
+#define ASSERT_ARGS_cascade __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_current_tick __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel))
+#define ASSERT_ARGS_link_alarm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel) \
+    , PARROT_ASSERT_ARG(alarm))
+#define ASSERT_ARGS_unlink_alarm __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(wheel) \
+    , PARROT_ASSERT_ARG(alarm))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/* The number of ticks spanned by a slot of C<level> */
+#define SLOT_SPAN(level) ((INTVAL)1 << (PARROT_TIMER_WHEEL_BITS * (level)))
+
+/* The list head of C<slot> of C<level> */
+#define SLOT(wheel, level, slot) ((wheel)->slots[(level) * PARROT_TIMER_WHEEL_SLOTS + (slot)])
+
+/*
+
+=item C<Parrot_timer_wheel * Parrot_timer_wheel_new(PARROT_INTERP)>
+
+Creates an empty timer wheel, starting at the current time.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_MALLOC
+Parrot_timer_wheel *
+Parrot_timer_wheel_new(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_timer_wheel_new)
+    Parrot_timer_wheel * const wheel = mem_gc_allocate_zeroed_typed(interp, Parrot_timer_wheel);
+
+    wheel->start = Parrot_floatval_monotonic_time();
+    return wheel;
+}
+
+/*
+
+=item C<void Parrot_timer_wheel_destroy(PARROT_INTERP, Parrot_timer_wheel
+*wheel)>
+
+Frees the timer wheel. The alarms in it are left to the GC.
+
+=cut
+
+*/
+
+void
+Parrot_timer_wheel_destroy(PARROT_INTERP, ARGFREE(Parrot_timer_wheel *wheel))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_destroy)
+    mem_gc_free(interp, wheel);
+}
+
+/*
+
+=item C<void Parrot_timer_wheel_mark(PARROT_INTERP, const Parrot_timer_wheel
+*wheel)>
+
+Marks the pending and the spare alarms as live.
+
+=cut
+
+*/
+
+void
+Parrot_timer_wheel_mark(PARROT_INTERP, ARGIN(const Parrot_timer_wheel *wheel))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_mark)
+    PMC *alarm;
+    int  i;
+
+    for (i = 0; i < PARROT_TIMER_WHEEL_LEVELS * PARROT_TIMER_WHEEL_SLOTS; ++i)
+        for (alarm = wheel->slots[i]; alarm; alarm = PARROT_ALARM(alarm)->wheel_next)
+            Parrot_gc_mark_PMC_alive(interp, alarm);
+
+    for (alarm = wheel->spare; alarm; alarm = PARROT_ALARM(alarm)->wheel_next)
+        Parrot_gc_mark_PMC_alive(interp, alarm);
+}
+
+/*
+
+=item C<static INTVAL current_tick(const Parrot_timer_wheel *wheel, FLOATVAL
+now)>
+
+Returns the last tick that has begun at monotonic time C<now>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+current_tick(ARGIN(const Parrot_timer_wheel *wheel), FLOATVAL now)
+{
+    ASSERT_ARGS(current_tick)
+    return (INTVAL)floor((now - wheel->start) / PARROT_TIMER_WHEEL_TICK);
+}
+
+/*
+
+=item C<static void link_alarm(Parrot_timer_wheel *wheel, PMC *alarm)>
+
+Puts C<alarm> into the slot for its C<wheel_tick>. Alarms that are overdue go
+into the current slot, alarms beyond the reach of the wheel into the last slot
+of the top level, from where they are put back on every turn of that level.
+
+=cut
+
+*/
+
+static void
+link_alarm(ARGMOD(Parrot_timer_wheel *wheel), ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(link_alarm)
+    Parrot_Alarm_attributes * const data = PARROT_ALARM(alarm);
+    INTVAL tick  = data->wheel_tick < wheel->now ? wheel->now : data->wheel_tick;
+    int    level = 0;
+    INTVAL slot;
+
+    while (level < PARROT_TIMER_WHEEL_LEVELS - 1
+    &&     tick - wheel->now >= SLOT_SPAN(level + 1))
+        ++level;
+
+    if (tick - wheel->now >= SLOT_SPAN(PARROT_TIMER_WHEEL_LEVELS))
+        tick = wheel->now + SLOT_SPAN(PARROT_TIMER_WHEEL_LEVELS) - 1;
+
+    slot = level * PARROT_TIMER_WHEEL_SLOTS
+         + ((tick >> (PARROT_TIMER_WHEEL_BITS * level)) & PARROT_TIMER_WHEEL_MASK);
+
+    data->wheel_slot = slot;
+    data->wheel_prev = NULL;
+    data->wheel_next = wheel->slots[slot];
+
+    if (data->wheel_next)
+        PARROT_ALARM(data->wheel_next)->wheel_prev = alarm;
+
+    wheel->slots[slot] = alarm;
+}
+
+/*
+
+=item C<static void unlink_alarm(Parrot_timer_wheel *wheel, PMC *alarm)>
+
+Takes C<alarm> out of its slot.
+
+=cut
+
+*/
+
+static void
+unlink_alarm(ARGMOD(Parrot_timer_wheel *wheel), ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(unlink_alarm)
+    Parrot_Alarm_attributes * const data = PARROT_ALARM(alarm);
+
+    if (data->wheel_prev)
+        PARROT_ALARM(data->wheel_prev)->wheel_next = data->wheel_next;
+    else
+        wheel->slots[data->wheel_slot] = data->wheel_next;
+
+    if (data->wheel_next)
+        PARROT_ALARM(data->wheel_next)->wheel_prev = data->wheel_prev;
+
+    data->wheel_prev = NULL;
+    data->wheel_next = NULL;
+    data->wheel_slot = -1;
+}
+
+/*
+
+=item C<static void cascade(Parrot_timer_wheel *wheel, int level, INTVAL slot)>
+
+Spreads the alarms of C<slot> of C<level> over the levels below it.
+
+=cut
+
+*/
+
+static void
+cascade(ARGMOD(Parrot_timer_wheel *wheel), int level, INTVAL slot)
+{
+    ASSERT_ARGS(cascade)
+    PMC *alarm = SLOT(wheel, level, slot);
+
+    if (!alarm)
+        return;
+
+    /* Detach the list first, alarms out of reach come right back here.
+       Relink from the tail, so alarms due at the same tick keep their order. */
+    SLOT(wheel, level, slot) = NULL;
+
+    while (PARROT_ALARM(alarm)->wheel_next)
+        alarm = PARROT_ALARM(alarm)->wheel_next;
+
+    while (alarm) {
+        PMC * const prev = PARROT_ALARM(alarm)->wheel_prev;
+        link_alarm(wheel, alarm);
+        alarm = prev;
+    }
+}
+
+/*
+
+=item C<FLOATVAL Parrot_timer_wheel_insert(PARROT_INTERP, Parrot_timer_wheel
+*wheel, PMC *alarm)>
+
+Adds C<alarm> to the wheel, removing it first if it is already pending.
+Returns the system time at which the wheel will expire it, which may be a
+little after its C<alarm_time>.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_timer_wheel_insert(PARROT_INTERP, ARGMOD(Parrot_timer_wheel *wheel), ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_insert)
+    Parrot_Alarm_attributes * const data = PARROT_ALARM(alarm);
+    const FLOATVAL now_time  = Parrot_floatval_time();
+    const FLOATVAL monotonic = Parrot_floatval_monotonic_time();
+    FLOATVAL       delay     = data->alarm_time - now_time;
+    FLOATVAL       ticks;
+
+    if (data->wheel_slot >= 0)
+        Parrot_timer_wheel_remove(interp, wheel, alarm);
+
+    /* An empty wheel stops turning, catch up with the clock. */
+    if (wheel->count == 0)
+        wheel->now = current_tick(wheel, monotonic) + 1;
+
+    if (delay < 0)
+        delay = 0;
+
+    ticks = floor((monotonic + delay - wheel->start) / PARROT_TIMER_WHEEL_TICK) + 1;
+    if (ticks > (FLOATVAL)(PARROT_INTVAL_MAX / 2))
+        ticks = (FLOATVAL)(PARROT_INTVAL_MAX / 2);
+
+    data->wheel_tick = (INTVAL)ticks;
+    link_alarm(wheel, alarm);
+    ++wheel->count;
+
+    return now_time + (wheel->start + ticks * PARROT_TIMER_WHEEL_TICK - monotonic);
+}
+
+/*
+
+=item C<INTVAL Parrot_timer_wheel_remove(PARROT_INTERP, Parrot_timer_wheel
+*wheel, PMC *alarm)>
+
+Removes C<alarm> from the wheel. Returns 1 if it was pending, 0 otherwise.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_timer_wheel_remove(SHIM_INTERP, ARGMOD(Parrot_timer_wheel *wheel), ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_remove)
+
+    if (PARROT_ALARM(alarm)->wheel_slot < 0)
+        return 0;
+
+    unlink_alarm(wheel, alarm);
+    --wheel->count;
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_timer_wheel_expire(PARROT_INTERP, Parrot_timer_wheel
+*wheel)>
+
+Turns the wheel up to the current time, scheduling the tasks of all alarms
+that are due. Fired sleep alarms are kept for reuse.
+
+=cut
+
+*/
+
+void
+Parrot_timer_wheel_expire(PARROT_INTERP, ARGMOD(Parrot_timer_wheel *wheel))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_expire)
+    const INTVAL target = current_tick(wheel, Parrot_floatval_monotonic_time());
+
+    while (wheel->now <= target) {
+        const INTVAL now = wheel->now;
+        PMC *alarm;
+
+        if (wheel->count == 0) {
+            wheel->now = target + 1;
+            break;
+        }
+
+        /* At the end of a turn, pull down the next slot of the level above,
+           and so on up as long as that completes a turn too. */
+        if ((now & PARROT_TIMER_WHEEL_MASK) == 0) {
+            int level;
+            for (level = 1; level < PARROT_TIMER_WHEEL_LEVELS; ++level) {
+                const INTVAL slot = (now >> (PARROT_TIMER_WHEEL_BITS * level))
+                                  & PARROT_TIMER_WHEEL_MASK;
+                cascade(wheel, level, slot);
+                if (slot)
+                    break;
+            }
+        }
+
+        /* Fire from the tail, so alarms due at the same tick fire in the
+           order they were set. Scheduling a task can throw; the alarms not
+           fired yet stay in place for the next try. */
+        alarm = SLOT(wheel, 0, now & PARROT_TIMER_WHEEL_MASK);
+        if (alarm)
+            while (PARROT_ALARM(alarm)->wheel_next)
+                alarm = PARROT_ALARM(alarm)->wheel_next;
+
+        while (alarm) {
+            Parrot_Alarm_attributes * const data = PARROT_ALARM(alarm);
+            PMC * const prev = data->wheel_prev;
+            PMC * const task = data->alarm_task;
+
+            Parrot_timer_wheel_remove(interp, wheel, alarm);
+            Parrot_cx_schedule_immediate(interp, task);
+
+            if (ALARM_recycle_TEST(alarm)
+            &&  wheel->num_spare < PARROT_TIMER_WHEEL_MAX_SPARE) {
+                data->alarm_task = PMCNULL;
+                data->wheel_next = wheel->spare;
+                wheel->spare     = alarm;
+                ++wheel->num_spare;
+            }
+
+            alarm = prev;
+        }
+
+        ++wheel->now;
+    }
+}
+
+/*
+
+=item C<FLOATVAL Parrot_timer_wheel_next_time(PARROT_INTERP, const
+Parrot_timer_wheel *wheel)>
+
+Returns the system time at which the wheel needs turning next, to expire an
+alarm or to pull alarms down from a higher level. Returns 0 if the wheel is
+empty.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+FLOATVAL
+Parrot_timer_wheel_next_time(SHIM_INTERP, ARGIN(const Parrot_timer_wheel *wheel))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_next_time)
+    INTVAL next = -1;
+    INTVAL i;
+    int    level;
+
+    if (wheel->count == 0)
+        return 0.0;
+
+    for (i = 0; i < PARROT_TIMER_WHEEL_SLOTS; ++i)
+        if (SLOT(wheel, 0, (wheel->now + i) & PARROT_TIMER_WHEEL_MASK)) {
+            next = wheel->now + i;
+            break;
+        }
+
+    /* A slot of a higher level is pulled down when the turn of the level
+       below ends at the start of its span. */
+    for (level = 1; level < PARROT_TIMER_WHEEL_LEVELS; ++level) {
+        const INTVAL span = SLOT_SPAN(level);
+        const INTVAL turn = SLOT_SPAN(level + 1);
+        const INTVAL base = wheel->now & ~(turn - 1);
+
+        for (i = 0; i < PARROT_TIMER_WHEEL_SLOTS; ++i) {
+            if (SLOT(wheel, level, i)) {
+                INTVAL tick = base + i * span;
+                if (tick < wheel->now)
+                    tick += turn;
+                if (next < 0 || tick < next)
+                    next = tick;
+            }
+        }
+    }
+
+    return Parrot_floatval_time()
+         + (wheel->start + next * PARROT_TIMER_WHEEL_TICK - Parrot_floatval_monotonic_time());
+}
+
+/*
+
+=item C<PMC * Parrot_timer_wheel_get_alarm(PARROT_INTERP, Parrot_timer_wheel
+*wheel)>
+
+Returns an Alarm for the scheduler's own use, like the C<sleep> opcode,
+reusing one that fired earlier if there is one. Nobody else may hold on to
+the alarm, as it is recycled once it fires.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_timer_wheel_get_alarm(PARROT_INTERP, ARGMOD(Parrot_timer_wheel *wheel))
+{
+    ASSERT_ARGS(Parrot_timer_wheel_get_alarm)
+    PMC *alarm = wheel->spare;
+
+    if (alarm) {
+        wheel->spare = PARROT_ALARM(alarm)->wheel_next;
+        PARROT_ALARM(alarm)->wheel_next = NULL;
+        --wheel->num_spare;
+    }
+    else {
+        alarm = Parrot_pmc_new(interp, enum_class_Alarm);
+        ALARM_recycle_SET(alarm);
+    }
+
+    return alarm;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/scheduler.c>, F<src/pmc/alarm.pmc>, F<src/alarm.c>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -19,7 +19,6 @@ Opcode helper functions that don't really fit elsewhere.
 
 #include "parrot/parrot.h"
 #include "parrot/extend.h"
-#include "pmc/pmc_nci.h"
 
 typedef unsigned short _rand_buf[3];
 
@@ -48,17 +47,6 @@ static long _lrand48(void);
 static long _mrand48(void);
 static long _nrand48(_rand_buf buf);
 static void _srand48(long seed);
-static INTVAL COMPARE(PARROT_INTERP,
-    ARGIN(void *_a),
-    ARGIN(void *_b),
-    ARGIN(PMC *cmp),
-    ARGIN(const char * cmp_signature))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
-        __attribute__nonnull__(4)
-        __attribute__nonnull__(5);
-
 static void next_rand(_rand_buf X);
 #define ASSERT_ARGS__drand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__erand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -67,12 +55,6 @@ static void next_rand(_rand_buf X);
 #define ASSERT_ARGS__mrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__nrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__srand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_COMPARE __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(_a) \
-    , PARROT_ASSERT_ARG(_b) \
-    , PARROT_ASSERT_ARG(cmp) \
-    , PARROT_ASSERT_ARG(cmp_signature))
 #define ASSERT_ARGS_next_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
@@ -653,109 +635,6 @@ Parrot_util_byte_rindex(SHIM_INTERP, ARGIN(const STRING *base),
     return -1;
 }
 
-typedef INTVAL (*sort_func_t)(PARROT_INTERP, void *, void *);
-
-/*
-
-=item C<static INTVAL COMPARE(PARROT_INTERP, void *_a, void *_b, PMC *cmp, const
-char * cmp_signature)>
-
-General PMC comparison function. Takes two PMCs. Returns 0 if they are equal,
-returns 1 if C<a> is bigger, and returns -1 if C<b> is bigger.
-
-=cut
-
-*/
-
-/* TODO: Macroize COMPARE */
-/* This is an awfully expensive function to call, what with all the */
-/* comparisons that never change. We ought to precompute everything. */
-/* XXX We should be able to guarantee that *a and *b never change via const parameters. */
-static INTVAL
-COMPARE(PARROT_INTERP, ARGIN(void *_a), ARGIN(void *_b),
-        ARGIN(PMC *cmp),
-        ARGIN(const char * cmp_signature))
-{
-    ASSERT_ARGS(COMPARE)
-    INTVAL result = 0;
-    if (PMC_IS_NULL(cmp))
-        return VTABLE_cmp(interp, (PMC *)_a, (PMC *)_b);
-
-    if (cmp->vtable->base_type == enum_class_NCI) {
-        const sort_func_t f = (sort_func_t)D2FPTR(PARROT_NCI(cmp)->func);
-        return f(interp, _a, _b);
-    }
-
-    Parrot_ext_call(interp, cmp, cmp_signature, _a, _b, &result);
-    return result;
-}
-
-/*
-
-=item C<void Parrot_util_quicksort(PARROT_INTERP, void **data, UINTVAL n, PMC
-*cmp, const char * cmp_signature)>
-
-Perform a quicksort on a PMC array.
-
-cmp_signature is PCC signature for C<cmp>. E.g. C<II->I> for FIA.
-
-=cut
-
-*/
-
-void
-Parrot_util_quicksort(PARROT_INTERP, ARGMOD(void **data), UINTVAL n,
-        ARGIN(PMC *cmp),
-        ARGIN(const char * cmp_signature))
-{
-    ASSERT_ARGS(Parrot_util_quicksort)
-    while (n > 1) {
-        UINTVAL i, j, ln, rn;
-        void *temp;
-
-        /* Swap */
-        temp      = data[0];
-        data[0]   = data[n/2];
-        data[n/2] = temp;
-
-        for (i = 0, j = n; ;) {
-            do
-                --j;
-            while (j > 0 && COMPARE(interp, data[j], data[0], cmp, cmp_signature) > 0);
-
-            do
-                ++i;
-            while (i < j && COMPARE(interp, data[i], data[0], cmp, cmp_signature) < 0);
-
-            if (i >= j)
-                break;
-
-            /* Swap */
-            temp    = data[i];
-            data[i] = data[j];
-            data[j] = temp;
-        }
-
-        /* Swap */
-        temp    = data[j];
-        data[j] = data[0];
-        data[0] = temp;
-
-        ln = j;
-        rn = n - ++j;
-
-        if (ln < rn) {
-            Parrot_util_quicksort(interp, data, ln, cmp, cmp_signature);
-            data += j;
-            n = rn;
-        }
-        else {
-            Parrot_util_quicksort(interp, data + j, rn, cmp, cmp_signature);
-            n = ln;
-        }
-    }
-}
-
 /*
 
 =back
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 11;
+use Parrot::Test tests => 14;
 
 pir_output_is( <<'CODE', <<'OUT', "alligator" );
 # if the side-effect of set_label/continuation isn't
@@ -160,6 +160,82 @@ pir_output_is( <<'CODE', <<'OUT', "Wrong regs_used[S], afl crash 3 - GH #1168" )
 CODE
 OUT
 
+{
+    # the linear-scan allocator is used from -O1 on
+    local $ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -O1';
+
+    pir_output_is( <<'CODE', <<'OUT', "-O1 shares registers between disjoint live ranges" );
+.sub main :main
+    regs(1)
+.end
+
+.sub regs
+    .param int a
+    .local pmc m
+    .include "interpinfo.pasm"
+    m = interpinfo .INTERPINFO_CURRENT_SUB
+    $I1 = a + 1
+    say $I1
+    $I2 = a + 2
+    say $I2
+    $I3 = a + 3
+    $I4 = $I3 + 1
+    say $I4
+    $I0 = m."__get_regs_used"('I')
+    say $I0
+.end
+CODE
+2
+3
+5
+2
+OUT
+
+    pir_output_is( <<'CODE', <<'OUT', "-O1 keeps values live across loops" );
+.sub main :main
+    .local int sum, i
+    .local string keep
+    keep = "kept"
+    sum  = 0
+    i    = 0
+  loop:
+    $I0 = i * 2
+    $S0 = $I0
+    $I1 = length $S0
+    sum += $I1
+    inc i
+    if i < 12 goto loop
+    say sum
+    say keep
+.end
+CODE
+19
+kept
+OUT
+
+    pir_output_is( <<'CODE', <<'OUT', "-O1 keeps values live into exception handlers" );
+.sub main :main
+    .local string before
+    before = "before"
+    push_eh handler
+    $S0 = "temp1"
+    $S1 = "temp2"
+    $S2 = $S0 . $S1
+    die $S2
+    say "not reached"
+  handler:
+    .get_results ($P0)
+    pop_eh
+    $S3 = $P0
+    say $S3
+    say before
+.end
+CODE
+temp1temp2
+before
+OUT
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -0,0 +1,187 @@
+#!perl
+# Copyright (C) 2017, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 7;
+
+# value numbering, copy propagation and loop invariant code motion
+local $ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -O3';
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 reuses a recomputed value" );
+.sub main :main
+    regs(3, 4)
+.end
+
+.sub regs
+    .param int a
+    .param int b
+    .local pmc m
+    .include "interpinfo.pasm"
+    m = interpinfo .INTERPINFO_CURRENT_SUB
+    $I0 = a * b
+    $I1 = a * b
+    $I2 = $I0 + $I1
+    say $I2
+    $I9 = m."__get_regs_used"('I')
+    say $I9
+.end
+CODE
+24
+3
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 doesn't number values changed in between" );
+.sub main :main
+    vals(3, 4)
+.end
+
+.sub vals
+    .param int a
+    .param int b
+    $I0 = a * b
+    a = 5
+    $I1 = a * b
+    say $I0
+    say $I1
+.end
+CODE
+12
+20
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 moves loop invariants, keeps variants" );
+.sub main :main
+    loop(3, 4)
+.end
+
+.sub loop
+    .param int a
+    .param int b
+    .local int i, sum, prod
+    i = 0
+    sum = 0
+    prod = 1
+  again:
+    $I0 = a + b
+    $I1 = $I0 * 2
+    sum += $I1
+    $I2 = i + a
+    prod += $I2
+    inc i
+    if i < 10 goto again
+    say sum
+    say prod
+.end
+CODE
+140
+76
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 doesn't move guarded division out of a loop" );
+.sub main :main
+    guarded(6, 0)
+    guarded(6, 3)
+.end
+
+.sub guarded
+    .param int a
+    .param int b
+    .local int i, sum
+    i = 0
+    sum = 0
+  again:
+    unless b goto skip
+    $I0 = a / b
+    sum += $I0
+  skip:
+    inc i
+    if i < 4 goto again
+    say sum
+.end
+CODE
+0
+8
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 propagates copies" );
+.sub main :main
+    copies("abc")
+.end
+
+.sub copies
+    .param string s
+    $S0 = s
+    $S1 = $S0
+    $S2 = concat $S1, $S0
+    say $S2
+    $P0 = new 'Integer'
+    $P0 = 1
+    $P1 = $P0
+    inc $P0
+    say $P1
+.end
+CODE
+abcabc
+2
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 leaves exception handler code alone" );
+.sub main :main
+    handled(3, 4)
+.end
+
+.sub handled
+    .param int a
+    .param int b
+    $I0 = a * b
+    push_eh handler
+    $I1 = 1
+    die "oops"
+    pop_eh
+    say "not reached"
+    .return ()
+  handler:
+    .get_results($P0)
+    $I2 = a * b
+    $I3 = $I0 + $I2
+    say $I3
+    say $I1
+.end
+CODE
+24
+1
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O3 keeps values with several definitions" );
+.sub main :main
+    several(1)
+    several(0)
+.end
+
+.sub several
+    .param int flag
+    .local int x
+    x = 1
+    if flag goto one
+    x = 2
+  one:
+    $I0 = x + 10
+    $I1 = x + 10
+    $I2 = $I0 * $I1
+    say $I2
+.end
+CODE
+121
+144
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
 use Parrot::Config;
-use Parrot::Test tests => 7;
+use Parrot::Test tests => 8;
 
 ##############################
 # Parrot Calling Conventions:  Tail call optimization.
@@ -399,6 +399,101 @@ G
 H
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', ".tailcall runs the callee in the caller's context" );
+.sub main :main
+    $P0 = getinterp
+    $P0.'recursion_limit'(100)
+
+    $I0 = 'count'(0, 10000)
+    say $I0
+
+    ($I0, $S0) = 'even'(10001)
+    say $I0
+    say $S0
+
+    $P1 = 'wrap'(3)
+    say $P1
+
+    push_eh caught
+    'thrower'(5000)
+    say "not reached"
+  caught:
+    .get_results ($P2)
+    pop_eh
+    $S1 = $P2
+    say $S1
+.end
+
+.sub 'count'
+    .param int i
+    .param int n
+    if i >= n goto done
+    inc i
+    .tailcall 'count'(i, n)
+  done:
+    .return (i)
+.end
+
+.sub 'even'
+    .param int n
+    if n goto more
+    .return (1, "even")
+  more:
+    dec n
+    .tailcall 'odd'(n)
+.end
+
+.sub 'odd'
+    .param int n
+    .lex '$n', $P0
+    $P0 = box n
+    if n goto more
+    .return (0, "odd")
+  more:
+    push_eh never
+    $P1 = find_lex '$n'
+    $I0 = $P1
+    dec $I0
+    pop_eh
+    .tailcall 'even'($I0)
+  never:
+    .return (-1, "handler leaked")
+.end
+
+.sub 'wrap'
+    .param int n
+    .tailcall 'multi'(n)
+.end
+
+.sub 'multi' :multi(int)
+    .param int n
+    .return ("multi int")
+.end
+
+.sub 'multi' :multi(string)
+    .param string s
+    .return ("multi string")
+.end
+
+.sub 'thrower'
+    .param int n
+    if n goto more
+    die "thrown at the bottom"
+  more:
+    push_eh wrong
+    dec n
+    .tailcall 'thrower'(n)
+  wrong:
+    say "handler of an earlier call"
+.end
+CODE
+10000
+0
+odd
+multi int
+thrown at the bottom
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
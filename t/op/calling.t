@@ -1,12 +1,12 @@
 #!perl
-# Copyright (C) 2001-2014, Parrot Foundation.
+# Copyright (C) 2001-2026, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 104;
+use Parrot::Test tests => 107;
 
 =head1 NAME
 
@@ -1669,10 +1669,7 @@ ok 1
 ok 2
 OUTPUT
 
-TODO: {
-  local $TODO = 'bad -O1 test 63' if $ENV{TEST_PROG_ARGS}
-    and $ENV{TEST_PROG_ARGS} =~ /-O[12]/;
-  pir_output_is( <<'CODE', <<'OUTPUT', "newclosure followed by tailcall" );
+pir_output_is( <<'CODE', <<'OUTPUT', "newclosure followed by tailcall" );
 ## regression test for newclosure followed by tailcall, which used to recycle
 ## the context too soon.  it looks awful because (a) the original version was
 ## produced by a compiler, and (b) in order to detect regression, we must force
@@ -1738,7 +1735,6 @@ not 2
 [in test]
 got 9.
 OUTPUT
-}
 
 pir_output_is( <<'CODE', <<'OUTPUT', "call evaled vtable code" );
 .sub main :main
@@ -2679,6 +2675,167 @@ CODE
 /Null PMC access/
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "recycled register frames start out cleared" );
+.sub main :main
+    .local int i, sum
+    i = 0
+    sum = 0
+  loop:
+    $I0 = wide(i)
+    sum += $I0
+    sweep 1
+    $P0 = narrow()
+    if null $P0 goto ok
+    say "not ok - stale PMC register"
+  ok:
+    inc i
+    if i < 50 goto loop
+    say sum
+.end
+
+.sub wide
+    .param int n
+    $P0 = box n
+    $P1 = box 1
+    $P2 = $P0 + $P1
+    $S0 = $P2
+    $I0 = $S0
+    .return ($I0)
+.end
+
+.sub narrow
+    .return ($P0)
+.end
+CODE
+1275
+OUTPUT
+pir_output_is( <<'CODE', <<'OUTPUT', "positional-only params after a mismatched call" );
+.sub main :main
+    $P0 = box 1
+    pmcs($P0, 'a')
+    mixed(2, 3.5, 'b', $P0)
+    mixed('4', 5, 6, 7)
+    push_eh few
+    pmcs($P0)
+    say "not ok - too few"
+  few:
+    pop_eh
+    say "too few"
+    push_eh named
+    pmcs($P0, $P0, 'x' => 1)
+    say "not ok - named"
+  named:
+    pop_eh
+    say "named"
+    pmcs($P0, 'c')
+    mixed(8, 9, 'd', 'e')
+.end
+
+.sub pmcs
+    .param pmc a
+    .param pmc b
+    print a
+    say b
+.end
+
+.sub mixed
+    .param int i
+    .param num n
+    .param string s
+    .param pmc p
+    print i
+    print ' '
+    print n
+    print ' '
+    print s
+    print ' '
+    say p
+.end
+CODE
+1a
+2 3.5 b 1
+4 5 6 7
+too few
+named
+1c
+8 9 d e
+OUTPUT
+pir_output_is( <<'CODE', <<'OUTPUT', "arguments left in the caller's registers" );
+.sub main :main
+    $P0 = box 7
+    set_args '(0)', $P0
+    find_sub_not_null $P0, 'show'
+    invokecc $P0
+    $P0 = box 8
+    set_args '(0)', $P0
+    $P0 = get_global 'show'
+    invokecc $P0
+    $I0 = 9
+    autobox($I0, 'a')
+    $P1 = box 2
+    $P2 = multi($I0, $P1)
+    say $P2
+    $P2 = multi($P1, $P1)
+    say $P2
+    noparams($I0, $P1)
+    $P3 = new 'Continuation'
+    set_label $P3, cont
+    $I1 = 10
+    $P3($I1, 'b')
+    say "not ok - continuation"
+  cont:
+    .get_results ($I2, $S2)
+    print $I2
+    say $S2
+.end
+
+.sub show
+    .param pmc p
+    say p
+.end
+
+.sub autobox
+    .param pmc i
+    .param pmc s
+    $S0 = typeof i
+    print $S0
+    print ' '
+    print i
+    print ' '
+    say s
+.end
+
+.sub multi :multi(int, _)
+    .param int i
+    .param pmc p
+    .return ('int')
+.end
+
+.sub multi :multi(_, _)
+    .param pmc a
+    .param pmc b
+    .return ('any')
+.end
+
+.sub noparams
+    $P0 = getinterp
+    $P1 = $P0['context']
+    $I0 = elements $P1
+    say $I0
+    $P2 = $P1[1]
+    say $P2
+.end
+CODE
+7
+8
+Integer 9 a
+int
+any
+2
+2
+10b
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 32,
+use Parrot::Test tests => 34,
     qw[run_command slurp_file];
 use Parrot::Test::Util 'create_tempfile';
 
@@ -695,6 +695,113 @@ ok 3
 ok 4
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "push_eh label mixed with handler PMCs" );
+.sub main :main
+    .local pmc eh
+    push_eh outer
+    eh = new 'ExceptionHandler'
+    set_label eh, inner
+    push_eh eh
+    push_eh newest
+    $I0 = count_eh
+    say $I0
+    pop_eh
+    $I0 = count_eh
+    say $I0
+    thrower()
+    say "not reached"
+    end
+  newest:
+    say "popped handler invoked"
+    end
+  inner:
+    .get_results($P0)
+    say "inner caught"
+    $P1 = getattribute $P0, 'handler'
+    $I0 = issame $P1, eh
+    say $I0
+    rethrow $P0
+  outer:
+    .get_results($P0)
+    pop_eh
+    pop_eh
+    say "outer caught"
+    $P1 = getattribute $P0, 'handler'
+    $I0 = isa $P1, 'ExceptionHandler'
+    say $I0
+    $I0 = count_eh
+    say $I0
+.end
+
+.sub thrower
+    push_eh callee
+    pop_eh
+    die "boom"
+  callee:
+    say "popped callee handler invoked"
+.end
+CODE
+3
+2
+inner caught
+1
+outer caught
+1
+0
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "throw_control" );
+.include 'except_types.pasm'
+.sub main :main
+    .local pmc eh
+    eh = new 'ExceptionHandler', [.CONTROL_RETURN]
+    set_label eh, returned
+    push_eh eh
+    thrower()
+    say "not reached"
+    end
+  returned:
+    .get_results($P0)
+    pop_eh
+    $I0 = $P0['type']
+    $I1 = $I0 == .CONTROL_RETURN
+    say $I1
+    $P1 = getattribute $P0, 'payload'
+    say $P1
+    $P1 = getattribute $P0, 'handler'
+    $I0 = issame $P1, eh
+    say $I0
+
+    eh = new 'ExceptionHandler', [.CONTROL_LOOP_LAST]
+    set_label eh, last
+    push_eh eh
+    throw_control .CONTROL_LOOP_LAST
+    say "not reached"
+  last:
+    .get_results($P0)
+    pop_eh
+    $P1 = getattribute $P0, 'payload'
+    $I0 = isnull $P1
+    say $I0
+.end
+
+.sub thrower
+    .local pmc eh, payload
+    eh = new 'ExceptionHandler', [.CONTROL_LOOP_NEXT]
+    set_label eh, next
+    push_eh eh
+    payload = box "payload"
+    throw_control .CONTROL_RETURN, payload
+  next:
+    say "wrong handler"
+.end
+CODE
+1
+payload
+1
+1
+OUTPUT
+
 # Test massaged from TT #2188
 SKIP: {
     skip "with valgrind", 1 if $ENV{VALGRIND};
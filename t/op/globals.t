@@ -15,7 +15,7 @@ Tests the C<get_global> and C<set_global> operations.
 
 =cut
 
-.const int TESTS = 12
+.const int TESTS = 21
 
 .namespace []
 
@@ -32,6 +32,8 @@ Tests the C<get_global> and C<set_global> operations.
     find_null_global()
     get_hll_global_not_found()
     find_store_with_key()
+    cached_global_changes()
+    cached_keyed_global_changes()
 .end
 
 .namespace []
@@ -152,6 +154,69 @@ Tests the C<get_global> and C<set_global> operations.
     set_hll_global [ "Monkey2"; "Toaster" ], "Explosion", $P0
 .end
 
+.namespace []
+.sub 'cached_global_changes'
+    $P0 = box 'first'
+    set_global 'cached', $P0
+    $P1 = 'lookup_cached'()
+    is($P1, 'first', 'cached get_global')
+
+    $P0 = box 'second'
+    set_global 'cached', $P0
+    $P1 = 'lookup_cached'()
+    is($P1, 'second', 'cached get_global sees set_global')
+
+    $P2 = get_namespace
+    $P0 = box 'third'
+    $P2['cached'] = $P0
+    $P1 = 'lookup_cached'()
+    is($P1, 'third', 'cached get_global sees namespace assignment')
+
+    $P2['cached'] = 4
+    $P1 = 'lookup_cached'()
+    is($P1, 4, 'cached get_global sees native assignment')
+
+    $S0 = 'cached'
+    $P2[$S0] = 'fifth'
+    $P1 = 'lookup_cached'()
+    is($P1, 'fifth', 'cached get_global sees string assignment')
+
+    $P2.'del_var'('cached')
+    $P1 = 'lookup_cached'()
+    $I0 = isnull $P1
+    ok($I0, 'cached get_global sees deletion')
+.end
+
+.sub 'lookup_cached'
+    $P0 = get_global 'cached'
+    .return ($P0)
+.end
+
+.sub 'cached_keyed_global_changes'
+    $P0 = box 'inner'
+    set_hll_global ['Cache';'Inner'], 'x', $P0
+    $P1 = 'lookup_keyed_cached'()
+    is($P1, 'inner', 'cached keyed get_hll_global')
+
+    $P0 = box 'changed'
+    set_hll_global ['Cache';'Inner'], 'x', $P0
+    $P1 = 'lookup_keyed_cached'()
+    is($P1, 'changed', 'cached keyed get_hll_global sees nested change')
+
+    $P2 = get_hll_namespace ['Cache']
+    $P3 = new ['NameSpace']
+    $P0 = box 'replaced'
+    $P3['x'] = $P0
+    $P2['Inner'] = $P3
+    $P1 = 'lookup_keyed_cached'()
+    is($P1, 'replaced', 'cached keyed get_hll_global sees replaced namespace')
+.end
+
+.sub 'lookup_keyed_cached'
+    $P0 = get_hll_global ['Cache';'Inner'], 'x'
+    .return ($P0)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -13,7 +13,7 @@ $ENV{TEST_PROG_ARGS} ||= '';
 plan( skip_all => 'lexicals not thawed properly from PBC, GH #430' )
     if $ENV{TEST_PROG_ARGS} =~ /--run-pbc/;
 
-plan( tests => 54 );
+plan( tests => 56 );
 
 =head1 NAME
 
@@ -1645,6 +1645,73 @@ Starobrno
 Pilsner Urquell
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'store_lex into outer registers' );
+.sub 'main' :main
+    .lex 'i', $I0
+    .lex 'n', $N0
+    .lex 's', $S0
+    .lex 'p', $P0
+    $I0 = 1
+    $N0 = 1.5
+    $S0 = 'one'
+    $P0 = box 'uno'
+    'inner'()
+    say $I0
+    say $N0
+    say $S0
+    say $P0
+    $P1 = find_lex 'p'
+    say $P1
+.end
+.sub 'inner' :outer('main')
+    $I1 = find_lex 'i'
+    inc $I1
+    store_lex 'i', $I1
+    store_lex 'n', 2.5
+    store_lex 's', 'two'
+    $P1 = box 'dos'
+    store_lex 'p', $P1
+.end
+CODE
+2
+2.5
+two
+dos
+dos
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'find_lex in an outer context set at runtime' );
+.sub 'main' :main
+    .lex 'x', $P0
+    $P0 = box 'main'
+    'inner'()
+    'other'()
+.end
+.sub 'other'
+    .local pmc ctx, inner
+    .lex 'y', $P1
+    .lex 'x', $P2
+    $P2 = box 'other'
+    ctx = getinterp
+    ctx = ctx['context']
+    inner = get_global 'inner'
+    inner.'set_outer_ctx'(ctx)
+    inner()
+    $P3 = find_lex 'x'
+    say $P3
+.end
+.sub 'inner' :outer('main')
+    $P0 = find_lex 'x'
+    say $P0
+    $P1 = box 'changed'
+    store_lex 'x', $P1
+.end
+CODE
+main
+other
+changed
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -0,0 +1,95 @@
+#! perl
+# Copyright (C) 2026, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More tests => 20;
+
+use File::Spec;
+use Parrot::Config;
+
+=head1 NAME
+
+t/perl/Parrot_Benchmark.t - Parrot::Benchmark unit tests
+
+=head1 SYNOPSIS
+
+    % prove t/perl/Parrot_Benchmark.t
+
+=head1 DESCRIPTION
+
+Tests the statistics of C<Parrot::Benchmark>, and that a single benchmark
+run picks up the statistics Parrot writes to C<PARROT_STATS_FILE>.
+
+=cut
+
+BEGIN {
+    use_ok( 'Parrot::Benchmark',
+        qw( median mad mann_whitney find_benchmarks run_once benchmark compare ) );
+}
+
+is( median( 3, 1, 2 ),    2,   'median of an odd number of values' );
+is( median( 4, 1, 3, 2 ), 2.5, 'median of an even number of values' );
+ok( !defined median(), 'no median of nothing' );
+is( mad( 1, 2, 3, 4, 100 ), 1, 'median absolute deviation ignores outliers' );
+
+my ( $u, $p ) = mann_whitney( [ 1 .. 5 ], [ 6 .. 10 ] );
+is( $u, 0, 'U of a sample entirely below the other' );
+cmp_ok( $p, '<', 0.05, 'separated samples differ significantly' );
+
+( undef, $p ) = mann_whitney( [ 1, 3, 5, 7, 9 ], [ 2, 4, 6, 8, 10 ] );
+cmp_ok( $p, '>', 0.5, 'interleaved samples do not' );
+
+( undef, $p ) = mann_whitney( [ (1) x 5 ], [ (1) x 5 ] );
+is( $p, 1, 'identical samples do not' );
+
+( undef, $p ) = mann_whitney( [ 1, 2 ], [ 8, 9 ] );
+is( $p, 1, 'too few runs are never significant' );
+
+my $base = { times => [ 1.00, 1.01, 1.02, 0.99, 1.00 ], median => 1.00 };
+my $slow = { times => [ 1.20, 1.21, 1.19, 1.22, 1.20 ], median => 1.20 };
+my $same = { times => [ 1.01, 0.99, 1.00, 1.02, 1.00 ], median => 1.00 };
+
+is( compare( $base, $slow )->{verdict}, 'slower', 'a slowdown is flagged' );
+is( compare( $slow, $base )->{verdict}, 'faster', 'a speedup is flagged' );
+is( compare( $base, $same )->{verdict}, 'same',   'noise is not' );
+is( compare( undef, $same )->{verdict}, 'new',    'benchmarks without baseline are new' );
+is( compare( $base, { failed => 1 } )->{verdict}, 'failed', 'failures are reported' );
+
+my $dir   = File::Spec->catdir(qw( examples benchmarks ));
+my @files = find_benchmarks( $dir, '^fib\.', '^hello' );
+is_deeply( \@files,
+    [ map { File::Spec->catfile( $dir, $_ ) } qw( fib.pir hello.pir ) ],
+    'benchmarks are selected by pattern' );
+
+my $parrot = ".$PConfig{slash}$PConfig{test_prog}";
+
+SKIP: {
+    skip 'parrot is not built', 4 unless -x $parrot;
+
+    my $run = run_once(
+        parrot  => $parrot,
+        file    => File::Spec->catfile( $dir, 'hello.pir' ),
+        runcore => 'slow',
+        gc      => 'ms2',
+    );
+    is( $run->{status}, 0, 'the benchmark ran' );
+    is( "$run->{runcore} $run->{gc}", 'slow ms2', 'runcore and GC are passed on' );
+    ok( defined $run->{gc_mark_runs}, 'GC counters are reported' );
+
+    my $result = benchmark(
+        parrot => $parrot,
+        file   => File::Spec->catfile( $dir, 'hello.pir' ),
+        runs   => 3,
+    );
+    is( scalar @{ $result->{times} }, 3, 'all runs are timed' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2010-2011, Parrot Foundation.
+# Copyright (C) 2010-2026, Parrot Foundation.
 
 .include 'timer.pasm'
 .include 'sysinfo.pasm'
@@ -19,7 +19,7 @@
 
   run_unix_tests:
 
-    plan(7)
+    plan(16)
 
     $P0 = new 'Integer'
     $P0 = 0
@@ -63,6 +63,29 @@ done:
 good:
     ok(1, "Alarms actually waited")
 
+    $P0 = new 'Integer'
+    $P0 = 0
+    set_global 'CANCELLED', $P0
+
+    $P1 = get_global 'alarm_cancelled'
+    $N0 = time
+    $N0 = $N0 + 0.05
+    $P2 = make_alarm($N0, $P1)
+    $I0 = $P2.'cancel'()
+    is($I0, 1, "cancel a pending alarm")
+    $I0 = $P2.'cancel'()
+    is($I0, 0, "cancel it again")
+
+    $N0 = $N0 + 86400
+    $P2 = make_alarm($N0, $P1)
+    $I0 = $P2.'cancel'()
+    is($I0, 1, "cancel an alarm beyond the timer wheel")
+
+    sleep_in_nested_runloop()
+    die_after_nested_sleep()
+
+    many_alarms(2000)
+
     $P1 = get_global 'alarm_finish'
     $N0 = time
     $N0 = $N0 + 0.1
@@ -87,6 +110,165 @@ good:
     $P1[.PARROT_ALARM_TASK] = proc
 
     $P1()
+    .return($P1)
+.end
+
+# Sets n alarms in scrambled order over the next 0.2 seconds and waits for
+# them all to fire.
+.sub many_alarms
+    .param int n
+    .local num start, deadline
+    .local int i, fired
+
+    $P0 = new 'Integer'
+    $P0 = 0
+    set_global 'M', $P0
+    $P1 = get_global 'inc_M'
+
+    start = time
+    i = 0
+  set_loop:
+    $I0 = i * 7919
+    $I0 = $I0 % 200
+    $N0 = $I0 / 1000.0
+    $N0 = start + $N0
+    make_alarm($N0, $P1)
+    inc i
+    if i < n goto set_loop
+
+    deadline = start + 10.0
+  wait_loop:
+    $P0 = get_global 'M'
+    fired = $P0
+    if fired == n goto done
+    $N0 = time
+    if $N0 >= deadline goto done
+    goto wait_loop
+  done:
+    is(fired, n, "many alarms all fired")
+.end
+
+# An alarm task that sleeps in a vtable override, in a nested runloop, lets
+# the main task run until it wakes up.
+.sub sleep_in_nested_runloop
+    .local num deadline
+
+    $P0 = newclass 'SleepyString'
+    $P0 = new 'Integer'
+    $P0 = 0
+    set_global 'NESTED', $P0
+
+    $P1 = get_global 'alarm_nested'
+    $N0 = time
+    $N0 = $N0 + 0.02
+    make_alarm($N0, $P1)
+
+    sleep 0.1
+    $P0 = get_global 'NESTED'
+    $I0 = $P0
+    is($I0, 1, "main runs while a task sleeps in a nested runloop")
+
+    deadline = time
+    deadline = deadline + 10.0
+  wait_loop:
+    $P0 = get_global 'NESTED'
+    $I0 = $P0
+    if $I0 == 2 goto done
+    $N0 = time
+    if $N0 >= deadline goto done
+    goto wait_loop
+  done:
+    $P0 = get_global 'NESTED_RESULT'
+    $S0 = $P0
+    is($S0, "woke up", "the nested runloop resumes after the sleep")
+.end
+
+.sub alarm_nested
+    $P0 = new 'SleepyString'
+    $S0 = $P0
+    $P1 = new 'String'
+    $P1 = $S0
+    set_global 'NESTED_RESULT', $P1
+    $P0 = get_global 'NESTED'
+    $P0 = 2
+.end
+
+.namespace ['SleepyString']
+
+.sub get_string :vtable
+    $P0 = get_hll_global 'NESTED'
+    $P0 = 1
+    sleep 0.2
+    .return ("woke up")
+.end
+
+.namespace []
+
+# A task that dies after it slept in a nested runloop hands the exception to
+# whoever resumed it, on the stack of the thread.
+.sub die_after_nested_sleep
+    .local pmc task
+
+    $P0 = newclass 'DyingString'
+    $P0 = new 'Integer'
+    $P0 = 0
+    set_global 'DYING', $P0
+
+    $P0 = get_global 'task_nested_die'
+    task = new 'Task', $P0
+    $N0 = time
+    make_alarm($N0, task)
+
+    # let the task run into its sleep
+  wait_loop:
+    $P0 = get_global 'DYING'
+    $I0 = $P0
+    if $I0 == 1 goto resume
+    sleep 0.01
+    goto wait_loop
+
+  resume:
+    push_eh caught
+    task()
+    pop_eh
+    ok(0, "an exception leaves a task that slept in a nested runloop")
+    goto done
+
+  caught:
+    .get_results($P1)
+    pop_eh
+    $S0 = $P1['message']
+    is($S0, "died after sleeping", "an exception leaves a task that slept in a nested runloop")
+
+  done:
+    # the alarm of the sleep finds the task dead
+    sleep 0.3
+    $P0 = get_global 'DYING'
+    $I0 = $P0
+    is($I0, 1, "a dead task doesn't wake up again")
+.end
+
+.sub task_nested_die
+    $P0 = new 'DyingString'
+    $S0 = $P0
+    $P0 = get_global 'DYING'
+    $P0 = 2
+.end
+
+.namespace ['DyingString']
+
+.sub get_string :vtable
+    $P0 = get_hll_global 'DYING'
+    $P0 = 1
+    sleep 0.2
+    die "died after sleeping"
+.end
+
+.namespace []
+
+.sub inc_M
+    $P0 = get_global 'M'
+    inc $P0
 .end
 
 .sub inc_A
@@ -124,7 +306,16 @@ good:
     .return()
 .end
 
+.sub alarm_cancelled
+    $P0 = get_global 'CANCELLED'
+    inc $P0
+.end
+
 .sub alarm_finish
+    $P0 = get_global 'CANCELLED'
+    $I0 = $P0
+    is($I0, 0, "cancelled alarms never fire")
+
     $N0 = time
 
     $P0 = get_global 'FT'
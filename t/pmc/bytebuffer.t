@@ -21,7 +21,7 @@ Tests C<ByteBuffer> PMC..
 
 .sub 'main' :main
     .include 'test_more.pir'
-    plan(57)
+    plan(60)
 
     test_init()
     test_set_string()
@@ -31,6 +31,7 @@ Tests C<ByteBuffer> PMC..
     test_resize()
     test_alloc()
     test_iterate()
+    test_freeze()
     test_invalid()
     test_get_chars()
     test_resize()
@@ -330,6 +331,21 @@ donearray:
     is(r, s, 'iterate buffer content')
 .end
 
+.sub test_freeze
+    .local pmc bb, copy
+    bb = new ['ByteBuffer']
+    bb = "abc\x{0}def"
+    push bb, 0xff
+    $S0 = freeze bb
+    copy = thaw $S0
+    $I0 = elements copy
+    is($I0, 8, 'thawed buffer has the same size')
+    $I0 = copy[3]
+    is($I0, 0, 'thawed buffer keeps zero bytes')
+    $I0 = copy[7]
+    is($I0, 0xff, 'thawed buffer keeps high bytes')
+.end
+
 .sub test_invalid
     .local pmc bb, eh, ex
     .local string s
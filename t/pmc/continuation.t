@@ -17,7 +17,7 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(9)
+    plan(11)
 
     test_new()
     invoke_with_init()
@@ -25,6 +25,7 @@ Tests the Continuation PMC.
     returns_tt1528()
     experimental_caller()
     get_pointer_and_string()
+    reenter_returned_context()
 .end
 
 .sub test_new
@@ -173,6 +174,45 @@ end:
    dummy:
 .end
 
+.sub 'remember'
+    .param int n
+    .local pmc cc
+    cc = new 'Continuation'
+    set_label cc, again
+    set_global '!reenter', cc
+    .return (n)
+  again:
+    inc n
+    .return (n)
+.end
+
+.sub 'clobber'
+    .param int n
+    $I0 = n * 2
+    $I1 = n * 3
+    $I2 = $I0 + $I1
+    .return ($I2)
+.end
+
+.sub reenter_returned_context
+    .local int count
+    count = 0
+    $I0 = 'remember'(42)
+    inc count
+    if count > 1 goto done
+
+    # reuse the register frames of returned contexts
+    $I1 = 'clobber'(7)
+    sweep 1
+    $I1 = 'clobber'(9)
+
+    $P0 = get_global '!reenter'
+    $P0()
+  done:
+    is($I0, 43, "continuation into a returned context keeps its registers")
+    is(count, 2, "returned context returns again")
+.end
+
 # end of tests.
 
 # Local Variables:
@@ -1,11 +1,11 @@
 #! perl
-# Copyright (C) 2001-2014, Parrot Foundation.
+# Copyright (C) 2001-2026, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 17;
+use Parrot::Test tests => 19;
 
 =head1 NAME
 
@@ -568,6 +568,92 @@ CODE
 1
 OUTPUT
 
+pir_output_is(<<'CODE', <<'OUTPUT', "resume and yield" );
+.sub 'main' :main
+    .const 'Sub' counter = 'counter'
+    $P1 = clone counter
+  loop:
+    resume $P0, $P1
+    if null $P0 goto done
+    say $P0
+    goto loop
+  done:
+    say "done"
+    resume $P0, $P1
+    if null $P0 goto still_done
+    say "not done"
+  still_done:
+    say "still done"
+
+    # yield to a usual call, then to resume
+    $P1 = clone counter
+    $P0 = $P1()
+    say $P0
+    resume $P0, $P1
+    say $P0
+
+    # .yield to resume
+    .const 'Sub' old = 'old'
+    resume $P0, old
+    say $P0
+    resume $P0, old
+    say $P0
+.end
+.sub 'counter'
+    .local int i
+    i = 0
+  loop:
+    $P0 = box i
+    yield $P0
+    inc i
+    if i < 3 goto loop
+.end
+.sub 'old'
+    .yield('a')
+    .yield('b', 'c')
+.end
+CODE
+0
+1
+2
+done
+still done
+0
+1
+a
+b
+OUTPUT
+
+pir_output_is(<<'CODE', <<'OUTPUT', "resume with autoreset" );
+.sub 'main' :main
+    .const 'Coroutine' coro = 'MyCoro'
+    coro.'autoreset'()
+    $I0 = 0
+  loop:
+    resume $P0, coro
+    if null $P0 goto exhausted
+    say $P0
+    goto loop
+  exhausted:
+    say "exhausted"
+    inc $I0
+    if $I0 < 2 goto loop
+.end
+.sub 'MyCoro'
+    $P0 = box 1
+    yield $P0
+    .yield(2)
+    .return(3)
+.end
+CODE
+1
+2
+exhausted
+1
+2
+exhausted
+OUTPUT
+
 
 # Local Variables:
 #   mode: cperl
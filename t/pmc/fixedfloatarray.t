@@ -19,7 +19,7 @@ out-of-bounds test. Checks INT and PMC keys.
 .sub main :main
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
-    plan(36)
+    plan(43)
 
     array_size_tests()
     element_set_tests()
@@ -33,6 +33,8 @@ out-of-bounds test. Checks INT and PMC keys.
     test_invalid_init_tt1509()
     test_get_string()
     test_sort()
+    test_sort_negative()
+    test_freeze()
 .end
 
 .sub test_sort
@@ -52,6 +54,55 @@ out-of-bounds test. Checks INT and PMC keys.
     is($I3,10,'sort works')
 .end
 
+.sub test_sort_negative
+    $P0 = new ['FixedFloatArray'], 5
+    $P0[0] = 2.5
+    $P0[1] = -0.5
+    $P0[2] = -1e10
+    $P0[3] = 0.0
+    $P0[4] = 1e-300
+    $P0.'sort'()
+    $S0 = join ' ', $P0
+    is($S0, '-10000000000 -0.5 0 1e-300 2.5', 'radix sort handles negative floats')
+
+    .const 'Sub' by_desc = 'num_desc'
+    $P0.'sort'(by_desc)
+    $S0 = join ' ', $P0
+    is($S0, '2.5 1e-300 0 -0.5 -10000000000', 'sort with a float comparator')
+
+    $P0.'sort'(by_desc, 'stable' => 1)
+    $S0 = join ' ', $P0
+    is($S0, '2.5 1e-300 0 -0.5 -10000000000', 'stable sort with a float comparator')
+.end
+
+.sub num_desc
+    .param num a
+    .param num b
+    $I0 = cmp b, a
+    .return ($I0)
+.end
+
+.sub test_freeze
+    $P0 = new ['FixedFloatArray'], 3
+    $P0[0] = 1.5
+    $P0[1] = -2.25
+    $P0[2] = 1e300
+    $S0 = freeze $P0
+    $P1 = thaw $S0
+    $I0 = elements $P1
+    is($I0, 3, 'thawed array has the same size')
+    $N0 = $P1[1]
+    is($N0, -2.25, 'thawed array has the same elements')
+    $N0 = $P1[2]
+    is($N0, 1e300, 'thawed array keeps large values')
+
+    $P0 = new ['FixedFloatArray']
+    $S0 = freeze $P0
+    $P1 = thaw $S0
+    $I0 = elements $P1
+    is($I0, 0, 'empty array survives freeze/thaw')
+.end
+
 .sub array_size_tests
     $P0 = new ['FixedFloatArray']
 
@@ -34,6 +34,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_new_style_init()
     test_invalid_init_tt1509()
     test_custom_cmp()
+    test_sort_radix()
 
     done_testing()
 .end
@@ -314,6 +315,43 @@ CODE
     is( $S0, '1 2 3', 'FIA sorted with custom cmp function' )
 .end
 
+.sub test_sort_radix
+    .local pmc a
+    .local int i, n, prev, cur, in_order
+    n = 1000
+    a = new ['FixedIntegerArray'], n
+    a[0] = 9223372036854775807
+    a[1] = -9223372036854775807
+    i = 2
+  fill:
+    $I0 = i * 7919
+    $I0 = $I0 % 2003
+    $I0 -= 1000
+    $I0 *= 1000003
+    a[i] = $I0
+    inc i
+    if i < n goto fill
+
+    a.'sort'()
+
+    in_order = 1
+    prev = a[0]
+    i = 1
+  check:
+    cur = a[i]
+    if cur >= prev goto next
+    in_order = 0
+  next:
+    prev = cur
+    inc i
+    if i < n goto check
+    ok(in_order, 'radix sort orders negative and large integers')
+    $I0 = a[0]
+    is($I0, -9223372036854775807, 'smallest first')
+    $I0 = a[999]
+    is($I0, 9223372036854775807, 'largest last')
+.end
+
 .sub sorter
     .param pmc a
     .param pmc b
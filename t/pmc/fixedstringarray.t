@@ -18,7 +18,7 @@ out-of-bounds test. Checks INT and PMC keys.
 
 .sub 'main' :main
     .include 'test_more.pir'
-    plan(51)
+    plan(55)
 
     test_set_size()
     test_reset_size()
@@ -39,6 +39,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_new_style_init()
     test_invalid_init_tt1509()
     test_gc()
+    test_sort()
 .end
 
 .sub 'test_set_size'
@@ -401,6 +402,56 @@ CODE
     is($S0, "8000", "8000th element survived")
 .end
 
+.sub test_sort
+    .local pmc a
+    a = new ['ResizableStringArray']
+    push a, 'pear'
+    push a, 'apple'
+    push a, 'peach'
+    push a, ''
+    push a, 'apples'
+    push a, 'Zebra'
+    a.'sort'()
+    $S0 = join ',', a
+    is($S0, ',Zebra,apple,apples,peach,pear', 'strings sorted by radix sort')
+
+    .local int i
+    a = new ['FixedStringArray'], 200
+    i = 0
+  fill:
+    $I0 = i * 37
+    $I0 = $I0 % 200
+    $S0 = $I0
+    $S0 = concat 'k', $S0
+    a[i] = $S0
+    inc i
+    if i < 200 goto fill
+    a.'sort'()
+    $S0 = a[0]
+    is($S0, 'k0', 'many strings sorted, first')
+    $S0 = a[199]
+    is($S0, 'k99', 'many strings sorted, last')
+
+    .const 'Sub' by_length = 'length_cmp'
+    a = new ['ResizableStringArray']
+    push a, 'ccc'
+    push a, 'b'
+    push a, 'aa'
+    push a, 'a'
+    a.'sort'(by_length, 'stable' => 1)
+    $S0 = join ',', a
+    is($S0, 'b,a,aa,ccc', 'stable sort with a string comparator')
+.end
+
+.sub length_cmp
+    .param string a
+    .param string b
+    $I0 = length a
+    $I1 = length b
+    $I2 = cmp $I0, $I1
+    .return ($I2)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
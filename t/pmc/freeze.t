@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 25;
+use Parrot::Test tests => 29;
 
 =head1 NAME
 
@@ -887,6 +887,150 @@ CODE
 1 2 3 6
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "freeze/thaw through a FileHandle, several chunks" );
+.sub main :main
+    .local pmc fh, a, h, fia, h2, fia2
+    a = new ['ResizablePMCArray']
+    $I0 = 0
+  loop:
+    $S0 = $I0
+    push a, $S0
+    push a, $I0
+    inc $I0
+    if $I0 < 20000 goto loop
+    h = new ['Hash']
+    h['list'] = a
+    h['name'] = 'hello'
+    fia = new ['FixedIntegerArray'], 100000
+    fia[99999] = 42
+
+    fh = new ['FileHandle']
+    fh.'open'('temp.fpmc', 'wb')
+    freeze fh, h
+    freeze fh, fia
+    fh.'close'()
+
+    fh.'open'('temp.fpmc', 'rb')
+    thaw h2, fh
+    thaw fia2, fh
+    fh.'close'()
+
+    $P0 = h2['list']
+    $I1 = elements $P0
+    say $I1
+    $S1 = $P0[39998]
+    say $S1
+    $S1 = h2['name']
+    say $S1
+    $I1 = elements fia2
+    say $I1
+    $I1 = fia2[99999]
+    say $I1
+.end
+CODE
+40000
+19999
+hello
+100000
+42
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "freeze/thaw through a StringHandle" );
+.sub main :main
+    .local pmc sh, p
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    p = box 'abc'
+    freeze sh, p
+    p = box 17
+    freeze sh, p
+    sh.'close'()
+
+    sh.'open'('image', 'r')
+    thaw p, sh
+    say p
+    thaw p, sh
+    say p
+.end
+CODE
+abc
+17
+OUTPUT
+
+pir_error_output_like( <<'CODE', <<'OUTPUT', "thaw from a truncated stream" );
+.sub main :main
+    .local pmc sh, p
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    p = new ['ResizableStringArray']
+    push p, 'abc'
+    freeze sh, p
+    $S0 = sh.'readall'()
+    sh.'close'()
+
+    $I0 = length $S0
+    $I0 -= 12
+    $S0 = substr $S0, 0, $I0
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    print sh, $S0
+    sh.'close'()
+    sh.'open'('image', 'r')
+    thaw p, sh
+.end
+CODE
+/unexpected end of image/
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "GC still runs after a failed thaw from a stream" );
+.include 'interpinfo.pasm'
+.sub main :main
+    .local pmc sh, p
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    p = new ['ResizableStringArray']
+    push p, 'abc'
+    freeze sh, p
+    $S0 = sh.'readall'()
+    sh.'close'()
+
+    $I0 = length $S0
+    $I0 -= 12
+    $S0 = substr $S0, 0, $I0
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    print sh, $S0
+    sh.'close'()
+    sh.'open'('image', 'r')
+
+    push_eh caught
+    thaw p, sh
+    pop_eh
+    say "thawed a truncated image"
+    .return ()
+  caught:
+    pop_eh
+    say "caught"
+
+    $I0 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    sweep 1
+    $I1 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    if $I1 > $I0 goto gc_ran
+    say "GC is still blocked"
+    .return ()
+  gc_ran:
+    say "GC ran"
+.end
+CODE
+caught
+GC ran
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
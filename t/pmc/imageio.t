@@ -18,7 +18,7 @@ Tests the ImageIO PMC.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(12)
+    plan(17)
 
     .local pmc frz, thw
     frz = new ['ImageIOFreeze']
@@ -57,6 +57,57 @@ Tests the ImageIO PMC.
     $P1 = thaw $S1
     is_deeply($P0, $P1, 'thaw gives same PMC as ImageIO (aggregate)')
     is_deeply($P0, test_pmc, 'round trip gives same PMC (aggregate)')
+
+    'test_compact_integers'()
+    'test_string_table'()
+.end
+
+.sub test_compact_integers
+    .local pmc small, big
+    small = new ['ResizableIntegerArray']
+    big   = new ['ResizableIntegerArray']
+    $I0 = 0
+  loop:
+    $I1 = $I0 - 50
+    push small, $I1
+    $I1 = $I0 * 1000000007
+    $I1 *= 1000000007
+    push big, $I1
+    inc $I0
+    if $I0 < 100 goto loop
+
+    $S0 = freeze small
+    $S1 = freeze big
+    $I0 = length $S0
+    $I1 = length $S1
+    $I2 = $I0 < $I1
+    ok($I2, 'small integers take less room in the image')
+    $P0 = thaw $S0
+    is_deeply($P0, small, 'round trip of small integers')
+    $P0 = thaw $S1
+    is_deeply($P0, big, 'round trip of large integers')
+.end
+
+.sub test_string_table
+    .local pmc once, many
+    once = new ['ResizableStringArray']
+    push once, 'a somewhat long hash key'
+    many = new ['ResizableStringArray']
+    $I0 = 0
+  loop:
+    push many, 'a somewhat long hash key'
+    inc $I0
+    if $I0 < 50 goto loop
+
+    $S0 = freeze once
+    $S1 = freeze many
+    $I0 = length $S0
+    $I1 = length $S1
+    $I0 += 400
+    $I2 = $I1 < $I0
+    ok($I2, 'repeated strings are stored once')
+    $P0 = thaw $S1
+    is_deeply($P0, many, 'round trip of repeated strings')
 .end
 
 .sub get_test_simple
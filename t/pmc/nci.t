@@ -36,7 +36,7 @@ SKIP: {
     unless ( -e "runtime/parrot/dynext/libnci_test$load_ext" ) {
         plan skip_all => "Please make libnci_test$load_ext";
     }
-    plan tests => 70;
+    plan tests => 71;
 
     pir_output_is( << 'CODE', << 'OUTPUT', 'load library fails' );
 .sub test :main
@@ -801,6 +801,26 @@ OUTPUT
 CODE
 10 20 30
 2
+OUTPUT
+
+    pasm_output_is( <<'CODE', <<'OUTPUT', 'nci_iiiiiii - wide signature' );
+.pcc_sub :main main:
+  loadlib P1, "libnci_test"
+  dlfunc P0, P1, "nci_iiiiiii", "iiiiiii"
+  set I5, 1
+  set I6, 2
+  set I7, 3
+  set I8, 4
+  set I9, 5
+  set I10, 6
+  set_args "0,0,0,0,0,0", I5,I6,I7,I8,I9,I10
+  invokecc P0
+  get_results "0", I5
+  print I5
+  print "\n"
+  end
+CODE
+91
 OUTPUT
 
 SKIP:
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2006-2010, Parrot Foundation.
+# Copyright (C) 2006-2026, Parrot Foundation.
 
 =head1 NAME
 
@@ -21,10 +21,12 @@ Tests the ParrotInterpreter PMC.
 .sub main :main
 .include 'test_more.pir'
 
-    plan(14)
+    plan(24)
     test_new()      # 1 test
     test_hll_map()  # 3 tests
     test_hll_map_invalid()  # 1 tests
+    test_gc_events()        # 7 tests
+    test_gc_allocation_sites()  # 3 tests
 
 # Need for testing
 .annotate 'foo', 'bar'
@@ -86,6 +88,122 @@ Tests the ParrotInterpreter PMC.
     is(result, 1, 'hll_map outside an HLL throws')
 .end
 
+.sub test_gc_events
+    .local pmc interp, events, event, survivors, histogram
+    .local int next, total
+    interp = getinterp
+
+    next   = 0
+    events = interp.'gc_events'()
+    $I0    = elements events
+    unless $I0 goto run
+    event  = events[-1]
+    next   = event['cycle']
+    inc next
+  run:
+    interp.'run_gc'()
+
+    events = interp.'gc_events'(next)
+    $I0    = elements events
+    is($I0, 1, 'gc_events returns the collections since the given one')
+    event  = events[0]
+    $I0    = event['cycle']
+    is($I0, next, '... numbered in sequence')
+
+    $N0 = event['end']
+    $N1 = event['start']
+    $N0 -= $N1
+    $N1 = event['mark']
+    $N2 = event['sweep']
+    $N1 += $N2
+    $N2 = event['compact']
+    $N1 += $N2
+    $I0 = $N1 <= $N0
+    ok($I0, 'phases take no longer than the whole collection')
+
+    survivors = event['survivors']
+    $I0 = elements survivors
+    $I1 = event['generation']
+    inc $I1
+    is($I0, $I1, 'survivors are counted for every collected generation')
+    $I0 = survivors[0]
+    $I0 = $I0 > 0
+    ok($I0, '... and the interpreter survives')
+
+    histogram = interp.'gc_phase_histogram'('mark')
+    $I0 = elements histogram
+    is($I0, 32, 'gc_phase_histogram has a bucket for each power of two')
+
+    $I0 = 1
+    push_eh bad_phase
+    histogram = interp.'gc_phase_histogram'('lunch')
+    $I0 = 0
+  bad_phase:
+    pop_eh
+    ok($I0, 'unknown GC phases throw')
+.end
+
+.sub test_gc_allocation_sites
+    .local pmc interp, keep, sites, site, gens
+    .local int i, n, kept, dropped
+    interp = getinterp
+    keep   = new ['ResizablePMCArray']
+    gens   = new ['ResizableIntegerArray']
+
+    interp.'gc_sample_allocations'(1)
+    'allocate_kept'(keep)
+    'allocate_dropped'()
+    interp.'run_gc'()
+    sites = interp.'gc_allocation_sites'()
+    interp.'gc_sample_allocations'(0)
+
+    kept    = 0
+    dropped = 0
+    n       = elements sites
+    i       = 0
+  loop:
+    if i >= n goto done
+    site = sites[i]
+    inc i
+    $S0 = site['sub']
+    if $S0 == 'allocate_kept' goto is_kept
+    if $S0 == 'allocate_dropped' goto is_dropped
+    goto loop
+  is_kept:
+    kept = site['objects']
+    gens = site['generations']
+    goto loop
+  is_dropped:
+    dropped = site['objects']
+    goto loop
+  done:
+    $I0 = kept >= 100
+    ok($I0, 'surviving allocations are attributed to their sub')
+    $I0 = elements gens
+    $I0 = $I0 > 0
+    ok($I0, '... with their generations')
+    $I0 = dropped < 10
+    ok($I0, 'collected allocations are forgotten')
+.end
+
+.sub allocate_kept
+    .param pmc keep
+    $I0 = 0
+  loop:
+    $P0 = new ['Integer']
+    push keep, $P0
+    inc $I0
+    if $I0 < 100 goto loop
+.end
+
+.sub allocate_dropped
+    $I0 = 0
+  loop:
+    $P0 = new ['Integer']
+    inc $I0
+    if $I0 < 100 goto loop
+.end
+
 # Test accessors to various Interp fields
 .sub 'test_inspect'
     .local pmc interp
@@ -22,7 +22,7 @@ out-of-bounds test. Checks INT and PMC keys.
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
 
-    plan(163)
+    plan(168)
 
     init_tests()
     resize_tests()
@@ -57,6 +57,8 @@ out-of-bounds test. Checks INT and PMC keys.
     sort_with_broken_cmp()
     equality_tests()
     sort_tailcall()
+    sort_by_key()
+    sort_adversarial()
     push_to_subclasses_array()
     test_assign_from_another()
     test_assign_self()
@@ -1405,6 +1407,92 @@ resize_off_move:  #2,6,8
 
 # don't forget to change the test plan
 
+.sub sort_by_key
+    .local pmc array, key_func, count
+    array = new ['ResizablePMCArray']
+    push array, 'b2'
+    push array, 'a1'
+    push array, 'c1'
+    push array, 'd2'
+    push array, 'e0'
+    count = new ['Integer']
+    set_global 'key_calls', count
+    .const 'Sub' by_digit = 'digit_key'
+    array.'sort'('key' => by_digit)
+    $S0 = join ' ', array
+    is($S0, 'e0 a1 c1 b2 d2', 'sort by integer key is stable')
+    is(count, 5, 'key sub called once per element')
+
+    .const 'Sub' by_name = 'name_key'
+    array.'sort'('key' => by_name)
+    $S0 = join ' ', array
+    is($S0, 'a1 b2 c1 d2 e0', 'sort by string key')
+
+    .const 'Sub' by_digit_cmp = 'digit_cmp'
+    array.'sort'(by_digit_cmp, 'stable' => 1)
+    $S0 = join ' ', array
+    is($S0, 'e0 a1 c1 b2 d2', 'stable sort with comparator')
+.end
+
+.sub digit_key
+    .param pmc s
+    $P0 = get_global 'key_calls'
+    inc $P0
+    $S0 = s
+    $S0 = substr $S0, 1, 1
+    $I0 = $S0
+    .return ($I0)
+.end
+
+.sub name_key
+    .param pmc s
+    $S0 = s
+    .return ($S0)
+.end
+
+.sub digit_cmp
+    .param pmc a
+    .param pmc b
+    $S0 = a
+    $S0 = substr $S0, 1, 1
+    $S1 = b
+    $S1 = substr $S1, 1, 1
+    $I0 = cmp $S0, $S1
+    .return ($I0)
+.end
+
+.sub sort_adversarial
+    # organ pipe and many duplicates, sorted with the cmp vtable
+    .local pmc array
+    .local int i, in_order
+    array = new ['ResizablePMCArray']
+    i = 0
+  fill:
+    $I0 = i
+    if i < 1000 goto up
+    $I0 = 2000 - i
+  up:
+    $I0 = $I0 % 97
+    push array, $I0
+    inc i
+    if i < 2000 goto fill
+
+    array.'sort'()
+
+    in_order = 1
+    i = 1
+  check:
+    $I0 = i - 1
+    $P0 = array[$I0]
+    $P1 = array[i]
+    if $P0 <= $P1 goto next
+    in_order = 0
+  next:
+    inc i
+    if i < 2000 goto check
+    ok(in_order, 'organ pipe input with duplicates sorts')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -28,6 +28,9 @@ C<Continuation> PMCs.
 
 $ENV{TEST_PROG_ARGS} ||= '';
 my $testr = $ENV{TEST_PROG_ARGS} =~ /--run-pbc/;
+# -O1 and above share registers between disjoint live ranges
+my $opt_args = $ENV{TEST_PROG_ARGS} || '';
+my $regs_used_2 = $opt_args =~ /-O[23]/ ? "1101\n" : $opt_args =~ /-O1/ ? "2201\n" : "2301\n";
 my @todo;
 
 pasm_output_is( <<'CODE', <<'OUTPUT', "PASM subs - invokecc" );
@@ -1050,7 +1053,7 @@ CODE
 0101
 OUTPUT
 
-pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
+pir_output_is( <<'CODE', $regs_used_2, "__get_regs_used 2" );
 .sub main :main
     foo()
 .end
@@ -1076,8 +1079,6 @@ pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
 
 
 CODE
-2301
-OUTPUT
 
 pir_output_like( <<"CODE", <<'OUTPUT', 'warn on in main' );
 .sub 'test' :main
@@ -0,0 +1,51 @@
+#! perl
+# Copyright (C) 2026, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use Parrot::Test tests => 2;
+
+=head1 NAME
+
+t/pmc/task-errors.t - Tasks dying of unhandled exceptions
+
+=head1 SYNOPSIS
+
+    % prove t/pmc/task-errors.t
+
+=head1 DESCRIPTION
+
+Tests that an exception leaving a scheduled C<Task> kills the interpreter,
+instead of letting its waiters go on as if the task had returned.
+
+=cut
+
+$ENV{TEST_PROG_ARGS} ||= '';
+
+my $code = <<'CODE';
+.sub main :main
+    $P0 = get_global 'dies'
+    $P1 = new ['Task'], $P0
+    schedule $P1
+    wait $P1
+    say "task ok"
+.end
+
+.sub dies
+    die "oops"
+.end
+CODE
+
+pir_error_output_like( $code, qr/\Aoops\n(?!.*task ok)/s,
+    "a scheduled task dies of an unhandled exception" );
+
+pir_exit_code_is( $code, 1, "the exit status of a scheduled task dying" );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -9,14 +9,16 @@
     # Use say instead inside tasks
     .include 'test_more.pir'
 
-    plan(8)
+    plan(10)
 
     ok(1, "initialized")
 
     tasks_run()
     task_send_recv()
+    task_send_many()
+    task_deep_recursion()
 
-    print "ok 7 #SKIP task.kill - no reliable test yet [GH #907]\n"
+    print "ok 9 #SKIP task.kill - no reliable test yet [GH #907]\n"
     goto post_kill
 
     $S0 = sysinfo .SYSINFO_PARROT_OS
@@ -25,7 +27,7 @@
     task_kill()
     goto post_kill
   skip_kill:
-    print "ok 7 #SKIP task.kill - no signals on Windows yet\n"
+    print "ok 9 #SKIP task.kill - no signals on Windows yet\n"
   post_kill:
     preempt_and_exit()
 .end
@@ -105,6 +107,71 @@ ok:
     say "ok 6 Got existing message"
 .end
 
+.sub task_send_many
+    $P0 = get_global 'recv_many'
+    $P1 = new 'Task', $P0
+
+    # some messages wait before the task runs, the rest arrive while it
+    # is blocked in receive
+    $I0 = 0
+  send_early:
+    $P2 = new 'Integer', $I0
+    $P1.'send'($P2)
+    inc $I0
+    if $I0 < 100 goto send_early
+
+    schedule $P1
+    sleep 0.1
+
+  send_late:
+    $P2 = new 'Integer', $I0
+    $P1.'send'($P2)
+    inc $I0
+    if $I0 < 300 goto send_late
+
+    wait $P1
+.end
+
+.sub recv_many
+    $I0 = 0
+  loop:
+    $P0 = receive
+    $I1 = $P0
+    if $I1 != $I0 goto out_of_order
+    inc $I0
+    if $I0 < 300 goto loop
+    say "ok 7 Got many messages in order"
+    returncc
+  out_of_order:
+    print "not ok 7 Got message "
+    print $I1
+    print " instead of "
+    say $I0
+.end
+
+.sub task_deep_recursion
+    $P0 = get_global 'recurse_deep'
+    $P1 = new 'Task', $P0
+    $P1()
+.end
+
+# get_repr recurses in C once per level, deeper than a small stack allows
+.sub recurse_deep
+    .local pmc outer, inner
+    outer = new 'ResizablePMCArray'
+    inner = outer
+    $I0 = 0
+  nest:
+    $P0 = new 'ResizablePMCArray'
+    push inner, $P0
+    inner = $P0
+    inc $I0
+    if $I0 < 20000 goto nest
+
+    $S0 = get_repr outer
+    say "ok 8 deep C recursion in a task"
+.end
+
 .sub task_kill
     .local pmc task, code
     code = get_global 'task_to_kill'
@@ -122,9 +189,9 @@ ok:
 .end
 
 .sub task_to_kill
-    print "ok 7 task_to_kill running\n"
+    print "ok 9 task_to_kill running\n"
     sleep 0.2
-    say "not ok 8 task_to_kill wasn't killed"
+    say "not ok 10 task_to_kill wasn't killed"
 .end
 
 .sub preempt_and_exit
@@ -136,7 +203,7 @@ again:
 .end
 
 .sub exit0
-    say "ok 8 pre-empt and exit"
+    say "ok 10 pre-empt and exit"
     exit 0
 .end
 
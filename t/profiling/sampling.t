@@ -0,0 +1,111 @@
+#!perl
+# Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+t/profiling/sampling.t - test the sampling profiler runcore
+
+=head1 SYNOPSIS
+
+    % prove t/profiling/sampling.t
+
+=head1 DESCRIPTION
+
+Runs PIR code with C<-R sampling> and checks the folded stacks written to
+C<PARROT_SAMPLING_FILENAME>.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( lib . ../lib ../../lib );
+
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 7;
+use File::Temp 0.13 qw/tempfile/;
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+
+sub run_sampled {
+    my ($code, $interval) = @_;
+
+    my ($pir_fh, $pir_file) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print {$pir_fh} $code;
+    close $pir_fh;
+
+    my (undef, $folded_file) = tempfile( SUFFIX => '.folded', UNLINK => 1 );
+    local $ENV{PARROT_SAMPLING_FILENAME} = $folded_file;
+    local $ENV{PARROT_SAMPLING_INTERVAL} = $interval;
+
+    my $out = `"$PARROT" -R sampling "$pir_file"`;
+
+    open my $folded_fh, '<', $folded_file or die "can't read $folded_file: $!";
+    my @lines = <$folded_fh>;
+    close $folded_fh;
+
+    return ($out, $pir_file, @lines);
+}
+
+my ($out, $pir_file, @lines) = run_sampled(<<'END_PIR', 200);
+.sub main :main
+    $N0 = time
+    $N0 += 0.3
+  loop:
+    'spin'()
+    $N1 = time
+    if $N1 < $N0 goto loop
+    say "done"
+.end
+
+.sub 'spin'
+    $I0 = 0
+  inner:
+    inc $I0
+    if $I0 < 1000 goto inner
+.end
+END_PIR
+
+is( $out, "done\n", 'program output is unaffected' );
+ok( scalar @lines, 'folded stacks are written' );
+
+my $wellformed = grep { /^\S.* \d+$/ } @lines;
+is( $wellformed, scalar @lines, 'every line is a call chain and a count' );
+
+my $total = 0;
+$total += (split ' ', $_)[-1] for @lines;
+# How many samples land in 0.3 seconds depends on how busy the machine is
+cmp_ok( $total, '>', 0, 'samples are counted' );
+
+my ($spin) = grep { /;main \(\Q$pir_file\E:\d+\);spin \(\Q$pir_file\E:\d+\) \d+$/ } @lines;
+ok( $spin, 'callee frames are nested in their callers with PIR positions' );
+
+($out, $pir_file, @lines) = run_sampled(<<'END_PIR', 200);
+.sub main :main
+    $N0 = time
+    $N0 += 0.2
+  loop:
+    .annotate 'file', 'busy.hll'
+    .annotate 'line', 42
+    $N1 = time
+    if $N1 < $N0 goto loop
+.end
+END_PIR
+
+ok( scalar(grep { /;main \(busy\.hll:42\) \d+$/ } @lines),
+    'HLL file and line annotations are used' );
+
+($out, $pir_file, @lines) = run_sampled(<<'END_PIR', 1000000);
+.sub main :main
+    say "quick"
+.end
+END_PIR
+
+is( scalar @lines, 0, 'nothing is written when no sample was taken' );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
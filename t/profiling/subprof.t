@@ -0,0 +1,116 @@
+#!perl
+# Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+t/profiling/subprof.t - test the subprof runcores
+
+=head1 SYNOPSIS
+
+    % prove t/profiling/subprof.t
+
+=head1 DESCRIPTION
+
+Runs PIR code with the C<subprof> runcores and checks the callgrind profile
+they write to stderr, with and without C<PARROT_SUBPROF_COUNTERS>.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( lib . ../lib ../../lib );
+
+use Test::More;
+use Parrot::Config;
+use Parrot::Test tests => 10;
+use File::Temp 0.13 qw/tempfile/;
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+
+my ($pir_fh, $pir_file) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+print {$pir_fh} <<'END_PIR';
+.sub main :main
+    $I0 = 0
+  loop:
+    'callee'($I0)
+    inc $I0
+    if $I0 < 1000 goto loop
+    say "done"
+.end
+
+.sub 'callee'
+    .param int i
+    $P0 = new 'ResizablePMCArray'
+    push $P0, i
+.end
+END_PIR
+close $pir_fh;
+
+sub run_subprof {
+    my ($core, $counters) = @_;
+
+    my (undef, $err_file) = tempfile( SUFFIX => '.out', UNLINK => 1 );
+    local $ENV{PARROT_SUBPROF_COUNTERS} = $counters;
+    delete $ENV{PARROT_SUBPROF_COUNTERS} unless defined $counters;
+
+    my $out = `"$PARROT" -R $core "$pir_file" 2>"$err_file"`;
+
+    open my $err_fh, '<', $err_file or die "can't read $err_file: $!";
+    my @lines = <$err_fh>;
+    close $err_fh;
+
+    return ($out, @lines);
+}
+
+# the event names, and whether every cost line has a value for each of them
+sub check_costs {
+    my @lines  = @_;
+    my ($events) = grep { /^events:/ } @lines;
+    my @events = split ' ', $events;
+    shift @events;
+
+    my @costs = grep { /^-?\d+(?: \d+)+$/ } @lines;
+    my $bad   = grep { (split ' ', $_) != @events + 1 } @costs;
+
+    return (\@events, scalar @costs, $bad);
+}
+
+my ($out, @lines) = run_subprof('subprof_hll');
+is( $out, "done\n", 'program output is unaffected' );
+
+my ($events, $costs, $bad) = check_costs(@lines);
+is( "@$events", 'ops ticks', 'ops and ticks are the default events' );
+ok( $costs, 'cost lines are written' );
+is( $bad, 0, 'every cost line has the line and all events' );
+ok( scalar(grep { /^calls=1000 / } @lines), 'calls are counted' );
+
+($out, @lines) = run_subprof('subprof_ops', 'task-clock,cycles,task-clock');
+($events, $costs, $bad) = check_costs(@lines);
+is( $events->[0] . ' ' . $events->[1], 'ops ticks',
+    'counters are reported after ops and ticks' );
+ok( !grep( { !/^(?:cycles|task-clock)$/ } @{$events}[2 .. $#$events] )
+    && @$events <= 4,
+    'only the requested counters are reported, once each' );
+is( $bad, 0, 'every cost line has a value for every counter' );
+
+SKIP: {
+    skip 'perf_event_open is not available', 1
+        unless $PConfig{i_linuxperf_event} && grep { $_ eq 'task-clock' } @$events;
+
+    my ($summary) = grep { /^summary:/ } @lines;
+    my @summary   = split ' ', $summary;
+    my %total;
+    @total{@$events} = @summary[1 .. $#summary];
+    cmp_ok( $total{'task-clock'}, '>', 0, 'software counters count' );
+}
+
+($out, @lines) = run_subprof('subprof_sub', 'cycles,bogus');
+ok( scalar(grep { /unknown performance counter 'bogus'/ } @lines),
+    'unknown counters are rejected' );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
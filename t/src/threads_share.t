@@ -0,0 +1,187 @@
+#!./parrot
+# Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+t/src/threads_share.t - Publishing read-only data to other threads
+
+=head1 SYNOPSIS
+
+    % prove t/src/threads_share.t
+
+=head1 DESCRIPTION
+
+Tests the C<share_ro> op, which freezes a graph of plain data and hands it
+to tasks in other threads without wrapping it in a C<Proxy>.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+
+    plan(12)
+
+    share_makes_read_only()
+    share_rejects_code()
+    share_skips_proxy()
+.end
+
+.sub make_graph
+    .local pmc hash, list
+    hash = new 'Hash'
+    list = new 'ResizablePMCArray'
+    push list, 1
+    push list, 'two'
+    hash['list'] = list
+
+    # a string pointing into the middle of its buffer
+    $S0 = 'xxhelloyy'
+    $S1 = substr $S0, 2, 5
+    hash[$S1] = $S1
+    .return (hash)
+.end
+
+.sub share_makes_read_only
+    .local pmc hash, list, shared
+    hash   = make_graph()
+    list   = hash['list']
+    shared = share_ro hash
+    $I0 = issame shared, hash
+    ok($I0, 'share_ro returns the PMC itself')
+
+    $I0 = 1
+    push_eh write_hash
+    hash['new'] = 1
+    $I0 = 0
+  write_hash:
+    pop_eh
+    ok($I0, 'shared Hash is read-only')
+
+    $I0 = 1
+    push_eh write_list
+    push list, 3
+    $I0 = 0
+  write_list:
+    pop_eh
+    ok($I0, 'nested array is read-only')
+
+    sweep 1
+    collect
+    $S0 = hash['hello']
+    is($S0, 'hello', 'shared strings survive a collection')
+    $S0 = list[1]
+    is($S0, 'two', 'nested elements survive a collection')
+
+    shared = share_ro hash
+    $I0 = issame shared, hash
+    ok($I0, 'sharing again is harmless')
+.end
+
+.sub share_rejects_code
+    .local pmc list, ex
+    list = new 'ResizablePMCArray'
+    $P0  = get_global 'make_graph'
+    push list, $P0
+
+    push_eh share_failed
+    list = share_ro list
+    pop_eh
+    ok(0, 'share_ro refuses code')
+    goto share_done
+  share_failed:
+    .get_results(ex)
+    pop_eh
+    $S0 = ex
+    is($S0, "Can't share a Sub, only plain data can be shared", 'share_ro refuses code')
+  share_done:
+
+    push list, 2
+    $I0 = elements list
+    is($I0, 2, 'a graph that could not be shared stays writable')
+.end
+
+.sub share_skips_proxy
+    .local pmc hash, reader, task
+    reader = get_global 'reader'
+
+    # test_more isn't thread-safe yet, so the tasks print their own results
+    hash = make_graph()
+    hash = share_ro hash
+    task = new 'Task', reader
+    push task, hash
+    $P0  = box "read-only instance of 'Hash'"
+    push task, $P0
+    $P0  = box 9
+    push task, $P0
+    schedule task
+    wait task
+
+    hash = make_graph()
+    task = new 'Task', reader
+    push task, hash
+    $P0  = box "read-only proxy of 'Hash'"
+    push task, $P0
+    $P0  = box 12
+    push task, $P0
+    schedule task
+    wait task
+.end
+
+.sub reader
+    .local pmc interp, task, hash, list
+    .local string expected, result
+    .local int test
+    interp   = getinterp
+    task     = interp.'current_task'()
+    $P0      = pop task
+    test     = $P0
+    $P0      = pop task
+    expected = $P0
+    hash     = pop task
+
+    if test != 9 goto check_write
+    list = hash['list']
+    $S0  = list[1]
+    $S1  = hash['hello']
+    result = 'not ok 9'
+    if $S0 != 'two' goto nested_done
+    result = 'ok 9'
+  nested_done:
+    result .= ' - task reads nested elements'
+    say result
+    result = 'not ok 10'
+    if $S1 != 'hello' goto strings_done
+    result = 'ok 10'
+  strings_done:
+    result .= ' - task reads shared strings'
+    say result
+    test = 11
+
+  check_write:
+    push_eh write_failed
+    hash['b'] = 2
+    pop_eh
+    $S0 = 'written'
+    goto write_done
+  write_failed:
+    .get_results($P0)
+    pop_eh
+    $S0 = $P0
+  write_done:
+    $I0 = index $S0, expected
+    result = 'not ok '
+    if $I0 < 0 goto write_checked
+    result = 'ok '
+  write_checked:
+    $S1 = test
+    result .= $S1
+    result .= ' - task writes to '
+    result .= expected
+    say result
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,59 @@
+#! perl
+# Copyright (C) 2026, Parrot Foundation.
+
+=head1 NAME
+
+t/tools/parrot_microbench.t - test the op and internals micro-benchmarks
+
+=head1 SYNOPSIS
+
+    % prove t/tools/parrot_microbench.t
+
+=head1 DESCRIPTION
+
+Runs C<parrot_microbench> with a few iterations and checks that every
+benchmark it lists is timed.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Test::More;
+use Parrot::Config;
+
+my $MICROBENCH = ".$PConfig{slash}parrot_microbench$PConfig{exe}";
+
+if ( -e $MICROBENCH ) {
+    plan tests => 6;
+}
+else {
+    plan skip_all => "parrot_microbench not built";
+}
+
+my @names = split /\n/, `$MICROBENCH --list`;
+is( $?, 0, 'benchmarks are listed' );
+is( scalar( grep { m{^(?:op|vtable|pcc|hash|string)/\w+$} } @names ), scalar @names,
+    'every benchmark is in a group' );
+
+my $out = `$MICROBENCH -n 1000 -r 3`;
+is( $?, 0, 'all benchmarks ran' );
+
+my %timed = map { /^(\S+)\s+(-?\d+\.\d+)\s+(-?\d+\.\d+)$/ ? ( $1 => $2 ) : () }
+    split /\n/, $out;
+is_deeply( [ sort keys %timed ], [ sort @names ], 'all benchmarks are reported in ns/op' );
+
+$out = `$MICROBENCH -n 1000 -r 1 hash/ pcc/invoke_pmc`;
+my @ran = map { /^((?:op|vtable|pcc|hash|string)\/\w+)\s/ ? $1 : () } split /\n/, $out;
+is_deeply( \@ran, [ 'pcc/invoke_pmc', grep { m{^hash/} } @names ],
+    'benchmarks are selected by pattern' );
+
+$out = `$MICROBENCH -n 1000 -r 1 -R slow op/add_i`;
+like( $out, qr/slow runcore.*^op\/add_i_i_i\s/ms, 'the runcore can be chosen' );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,168 @@
+#! perl
+# Copyright (C) 2026, Parrot Foundation.
+
+use strict;
+use warnings;
+
+use FindBin qw( $Bin );
+use lib "$Bin/../../lib";
+
+use Getopt::Long;
+use JSON::PP ();
+use Pod::Usage;
+
+use Parrot::Config;
+use Parrot::Benchmark qw( find_benchmarks benchmark compare );
+
+=head1 NAME
+
+tools/dev/bench.pl - Run the benchmarks in examples/benchmarks
+
+=head1 SYNOPSIS
+
+    % perl tools/dev/bench.pl [options] [pattern ...]
+
+    % perl tools/dev/bench.pl --output before.json fib gc_
+    ... upgrade, rebuild ...
+    % perl tools/dev/bench.pl --baseline before.json fib gc_
+
+ Options:
+   --runcore=NAME     runcore to use, may be repeated (default: fast)
+   --gc=NAME          GC to use, may be repeated (default: gms)
+   --warmup=N         runs to make before measuring (default: 1)
+   --runs=N           measured runs per benchmark (default: 5)
+   --output=FILE      write the results as JSON to FILE
+   --baseline=FILE    compare against the results in FILE
+   --alpha=P          significance level of the comparison (default: 0.05)
+   --dir=DIR          where the benchmarks are (default: examples/benchmarks)
+   --parrot=PATH      the parrot executable (default: ./parrot)
+   --help             show this message
+
+=head1 DESCRIPTION
+
+Runs every PIR and PASM benchmark whose name matches one of the patterns,
+or all of them, under each combination of the requested runcores and
+garbage collectors. Every benchmark is run C<--warmup> times to get caches
+and the file system warm, then C<--runs> times for real.
+
+For each benchmark the median wall clock time and its median absolute
+deviation are reported, together with the CPU time, the peak resident set
+size and the number of GC mark runs. These and the individual times are
+written to the C<--output> file, which can serve as the C<--baseline> of a
+later run.
+
+Against a baseline, every benchmark's times are compared with the
+Mann-Whitney U test and flagged as C<slower> or C<faster> only when the
+difference is significant at level C<--alpha>. With the default five runs
+only a difference seen in every run is significant; use more runs to detect
+smaller changes. The script exits with status 1 when a benchmark got slower
+or failed, so it can gate a smoke run.
+
+=cut
+
+my %opt = (
+    warmup => 1,
+    runs   => 5,
+    alpha  => 0.05,
+    dir    => 'examples/benchmarks',
+    parrot => ".$PConfig{slash}$PConfig{test_prog}",
+);
+my ( @runcores, @gcs );
+
+GetOptions(
+    \%opt,
+    'runcore=s' => \@runcores,
+    'gc=s'      => \@gcs,
+    'warmup=i', 'runs=i', 'output=s', 'baseline=s', 'alpha=f',
+    'dir=s', 'parrot=s', 'help',
+) or pod2usage(2);
+pod2usage(1) if $opt{help};
+
+@runcores = ('fast') unless @runcores;
+@gcs      = ('gms')  unless @gcs;
+
+my %baseline;
+if ( $opt{baseline} ) {
+    open my $in, '<', $opt{baseline} or die "can't read $opt{baseline}: $!\n";
+    my $old = JSON::PP::decode_json( do { local $/; <$in> } );
+    close $in;
+
+    %baseline = map { ( _key($_) => $_ ) } @{ $old->{results} };
+}
+
+my @files = find_benchmarks( $opt{dir}, @ARGV );
+die "no benchmarks found in $opt{dir}\n" unless @files;
+
+my ( @results, $regressions );
+
+printf "%-28s %-8s %-4s %10s %8s %9s %9s %7s",
+    qw( benchmark runcore gc median mad cpu rss(KB) gc_runs );
+print $opt{baseline} ? sprintf( " %8s %8s  %s\n", 'change', 'p', 'verdict' ) : "\n";
+
+for my $file (@files) {
+    for my $runcore (@runcores) {
+        for my $gc (@gcs) {
+            my $result = benchmark(
+                parrot  => $opt{parrot},
+                file    => $file,
+                runcore => $runcore,
+                gc      => $gc,
+                warmup  => $opt{warmup},
+                runs    => $opt{runs},
+            );
+            push @results, $result;
+
+            printf "%-28s %-8s %-4s", @{$result}{qw( benchmark runcore gc )};
+
+            if ( $result->{failed} ) {
+                print "   failed with exit status $result->{failed}";
+            }
+            else {
+                printf " %10.4f %8.4f %9.3f %9s %7s",
+                    @{$result}{qw( median mad cpu )},
+                    defined $result->{max_rss} ? int( $result->{max_rss} / 1024 ) : '-',
+                    defined $result->{gc_mark_runs} ? $result->{gc_mark_runs} : '-';
+            }
+
+            if ( $opt{baseline} ) {
+                my $cmp = compare( $baseline{ _key($result) }, $result, $opt{alpha} );
+
+                if ( defined $cmp->{ratio} ) {
+                    printf " %+7.1f%% %8.4f  %s",
+                        ( $cmp->{ratio} - 1 ) * 100, $cmp->{p}, $cmp->{verdict};
+                }
+                elsif ( !$result->{failed} ) {
+                    print "  $cmp->{verdict}";
+                }
+
+                $regressions++ if $cmp->{verdict} =~ /^(?:slower|failed)$/;
+            }
+            print "\n";
+        }
+    }
+}
+
+if ( $opt{output} ) {
+    open my $out, '>', $opt{output} or die "can't write $opt{output}: $!\n";
+    print {$out} JSON::PP->new->canonical->pretty->encode( {
+        version => $PConfig{VERSION},
+        warmup  => $opt{warmup},
+        runs    => $opt{runs},
+        results => \@results,
+    } );
+    close $out;
+}
+
+exit( $regressions ? 1 : 0 );
+
+sub _key {
+    my ($result) = @_;
+    return join '|', @{$result}{qw( benchmark runcore gc )};
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: